@@ -16,6 +16,7 @@
 #define BOOST_TEST_MAIN
 
 #include <boost/array.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <boost/test/floating_point_comparison.hpp>
@@ -244,7 +245,9 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGeneratorHypersonicLocalInclinat
     }
 }
 
-std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const int numberOfThreads = 1,
+        const std::string& coefficientCacheDirectory = "" )
 {
 
     // Create test capsule.
@@ -302,7 +305,7 @@ std::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterf
     return std::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, false, numberOfThreads, coefficientCacheDirectory );
 }
 
 //! Apollo capsule test case.
@@ -391,6 +394,56 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test whether coefficients are independent of number of threads, and whether they are correctly re-used from cache.
+BOOST_AUTO_TEST_CASE( testApolloCapsuleParallelAndCachedGeneration )
+{
+    std::string cacheDirectory = ( boost::filesystem::temp_directory_path( ) /
+                                   boost::filesystem::unique_path( "localInclinationCache-%%%%-%%%%" ) ).string( );
+
+    // Create coefficients serially, in parallel, and twice with cache.
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > serialCoefficientInterface =
+            getApolloCoefficientInterface( 1 );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > parallelCoefficientInterface =
+            getApolloCoefficientInterface( 4 );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > firstCachedCoefficientInterface =
+            getApolloCoefficientInterface( 4, cacheDirectory );
+    std::shared_ptr< HypersonicLocalInclinationAnalysis > secondCachedCoefficientInterface =
+            getApolloCoefficientInterface( 4, cacheDirectory );
+
+    BOOST_CHECK_EQUAL( firstCachedCoefficientInterface->areCoefficientsLoadedFromCache( ), false );
+    BOOST_CHECK_EQUAL( secondCachedCoefficientInterface->areCoefficientsLoadedFromCache( ), true );
+    BOOST_CHECK_EQUAL( secondCachedCoefficientInterface->getGeometryAndSettingsHash( ),
+                       serialCoefficientInterface->getGeometryAndSettingsHash( ) );
+
+    // Check that all coefficients are identical
+    boost::array< int, 3 > independentVariables;
+    for( int i = 0; i < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 0 ); i++ )
+    {
+        independentVariables[ 0 ] = i;
+        for( int j = 0; j < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 1 ); j++ )
+        {
+            independentVariables[ 1 ] = j;
+            for( int k = 0; k < serialCoefficientInterface->getNumberOfValuesOfIndependentVariable( 2 ); k++ )
+            {
+                independentVariables[ 2 ] = k;
+                Eigen::Vector6d serialCoefficients =
+                        serialCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Eigen::Vector6d parallelCoefficients =
+                        parallelCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                Eigen::Vector6d cachedCoefficients =
+                        secondCachedCoefficientInterface->getAerodynamicCoefficientsDataPoint( independentVariables );
+                for( int l = 0; l < 6; l++ )
+                {
+                    BOOST_CHECK_EQUAL( parallelCoefficients( l ), serialCoefficients( l ) );
+                    BOOST_CHECK_EQUAL( cachedCoefficients( l ), serialCoefficients( l ) );
+                }
+            }
+        }
+    }
+
+    boost::filesystem::remove_all( cacheDirectory );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
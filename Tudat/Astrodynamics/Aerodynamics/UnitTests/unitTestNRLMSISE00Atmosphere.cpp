@@ -1102,6 +1102,95 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Test interpolated NRLMSISE00 output along a typical LEO orbit, comparing the density error w.r.t. direct model
+//! evaluations for various interpolation settings.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00InterpolationAccuracy )
+{
+    tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            tudat::input_output::solar_activity::readSolarActivityData(
+                tudat::input_output::getSpaceWeatherDataPath( ) + "sw19571001.txt" );
+    std::function< tudat::aerodynamics::NRLMSISE00Input( double, double, double, double ) > inputFunction =
+            std::bind( &tudat::aerodynamics::nrlmsiseInputFunction, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, std::placeholders::_4, solarActivityData, false, TUDAT_NAN );
+
+    // Define sequence of (altitude, longitude, latitude, time) along a near-circular 51.6 degree inclination orbit, for one day,
+    // sampled at 2.5 s (representative of the number of evaluations by a fixed-step RK4 integrator with 10 s step size).
+    double initialTime = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2012, 3, 15, 0, 0, 0.0 ),
+                tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    double inclination = 51.6 * PI / 180.0;
+    double orbitalPeriod = 5550.0;
+    double earthRotationRate = 7.2921150E-5;
+    std::vector< std::vector< double > > evaluationPoints;
+    for( double timeSinceStart = 0.0; timeSinceStart < 86400.0; timeSinceStart += 2.5 )
+    {
+        double argumentOfLatitude = 2.0 * PI * timeSinceStart / orbitalPeriod;
+        double latitude = std::asin( std::sin( inclination ) * std::sin( argumentOfLatitude ) );
+        double longitude = std::remainder(
+                    std::atan2( std::cos( inclination ) * std::sin( argumentOfLatitude ), std::cos( argumentOfLatitude ) ) -
+                    earthRotationRate * timeSinceStart, 2.0 * PI );
+        double altitude = 400.0E3 + 10.0E3 * std::sin( 1.1 * argumentOfLatitude );
+        evaluationPoints.push_back( { altitude, longitude, latitude, initialTime + timeSinceStart } );
+    }
+
+    // Compute densities by direct evaluation
+    NRLMSISE00Atmosphere directModel( inputFunction );
+    std::vector< double > directDensities( evaluationPoints.size( ) );
+    for( unsigned int i = 0; i < evaluationPoints.size( ); i++ )
+    {
+        directDensities[ i ] = directModel.getDensity(
+                    evaluationPoints[ i ][ 0 ], evaluationPoints[ i ][ 1 ],
+                evaluationPoints[ i ][ 2 ], evaluationPoints[ i ][ 3 ] );
+    }
+
+    // Compute densities by interpolation, for various settings
+    std::vector< std::shared_ptr< tudat::aerodynamics::NRLMSISE00InterpolationSettings > > interpolationSettingsList;
+    interpolationSettingsList.push_back(
+                std::make_shared< tudat::aerodynamics::NRLMSISE00InterpolationSettings >( ) );
+    interpolationSettingsList.push_back(
+                std::make_shared< tudat::aerodynamics::NRLMSISE00InterpolationSettings >(
+                    2.0E3, 1.0 * PI / 180.0, 0.25, 3600.0, 1.0E-3 ) );
+    for( unsigned int j = 0; j < interpolationSettingsList.size( ); j++ )
+    {
+        NRLMSISE00Atmosphere interpolatedModel( inputFunction );
+        interpolatedModel.setInterpolationSettings( interpolationSettingsList.at( j ) );
+
+        double maximumRelativeError = 0.0;
+        double meanRelativeError = 0.0;
+        double currentRelativeError;
+        std::vector< double > interpolatedDensities( evaluationPoints.size( ) );
+        for( unsigned int i = 0; i < evaluationPoints.size( ); i++ )
+        {
+            interpolatedDensities[ i ] = interpolatedModel.getDensity(
+                        evaluationPoints[ i ][ 0 ], evaluationPoints[ i ][ 1 ],
+                    evaluationPoints[ i ][ 2 ], evaluationPoints[ i ][ 3 ] );
+        }
+
+        for( unsigned int i = 0; i < evaluationPoints.size( ); i++ )
+        {
+            currentRelativeError = std::fabs( interpolatedDensities[ i ] - directDensities[ i ] ) / directDensities[ i ];
+            maximumRelativeError = std::max( maximumRelativeError, currentRelativeError );
+            meanRelativeError += currentRelativeError / static_cast< double >( evaluationPoints.size( ) );
+        }
+
+        // Check whether interpolation was used, and error is consistent with tolerance
+        BOOST_CHECK_EQUAL( interpolatedModel.getNumberOfInterpolatedEvaluations( ) > 0, true );
+        BOOST_CHECK_SMALL( meanRelativeError, interpolationSettingsList.at( j )->relativeDensityTolerance );
+        BOOST_CHECK_SMALL( maximumRelativeError, 5.0 * interpolationSettingsList.at( j )->relativeDensityTolerance );
+    }
+}
+
+//! Test whether invalid interpolation settings are rejected.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00InvalidInterpolationSettings )
+{
+    using tudat::aerodynamics::NRLMSISE00InterpolationSettings;
+    BOOST_CHECK_THROW( NRLMSISE00InterpolationSettings( 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( NRLMSISE00InterpolationSettings( 5.0E3, -1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( NRLMSISE00InterpolationSettings( 5.0E3, 0.01, 0.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( NRLMSISE00InterpolationSettings( 5.0E3, 0.01, 0.5, -3600.0 ), std::runtime_error );
+    BOOST_CHECK_NO_THROW( NRLMSISE00InterpolationSettings( 5.0E3, 0.01, 0.5, 3600.0 ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
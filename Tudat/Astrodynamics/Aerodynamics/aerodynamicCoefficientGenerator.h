@@ -26,7 +26,7 @@
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientInterface.h"
 #include "Tudat/InputOutput/multiDimensionalArrayWriter.h"
-#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearVectorInterpolator.h"
 #include "Tudat/Basics/basicTypedefs.h"
 #include "Tudat/Basics/utilities.h"
 
@@ -242,9 +242,8 @@ public:
         }
 
         // Update current coefficients.
-        Eigen::Vector6d currentCoefficients = coefficientInterpolator_->interpolate(
-                    independentVariables );
-
+        Eigen::Matrix< double, NumberOfCoefficients, 1 > currentCoefficients =
+                coefficientInterpolator_->interpolate( independentVariables );
 
         currentForceCoefficients_ = currentCoefficients.segment( 0, 3 );
         currentMomentCoefficients_ = currentCoefficients.segment( 3, 3 );
@@ -266,9 +265,9 @@ protected:
     {
         // Create interpolator for coefficients.
         coefficientInterpolator_ =
-                std::make_shared< interpolators::MultiLinearInterpolator< double,
-                Eigen::Vector6d, 3 > >
-                ( dataPointsOfIndependentVariables_, aerodynamicCoefficients_ );
+                std::make_shared< interpolators::MultiLinearVectorInterpolator<
+                NumberOfIndependentVariables, NumberOfCoefficients > >(
+                    dataPointsOfIndependentVariables_, aerodynamicCoefficients_ );
     }
 
     //! N-dimensional array containing all computed aerodynamic coefficients.
@@ -291,8 +290,8 @@ protected:
     std::vector< std::vector< double > > dataPointsOfIndependentVariables_;
 
     //! Interpolator producing continuous aerodynamic coefficients from the discrete calculations
-    //! contained in aerodynamicCoefficients_.
-    std::shared_ptr< interpolators::Interpolator< double, Eigen::Vector6d > >
+    //! contained in aerodynamicCoefficients_ (all coefficients are interpolated in a single pass).
+    std::shared_ptr< interpolators::MultiLinearVectorInterpolator< NumberOfIndependentVariables, NumberOfCoefficients > >
     coefficientInterpolator_;
 };
 
@@ -33,6 +33,9 @@ FlightConditions::FlightConditions( const std::shared_ptr< basic_astrodynamics::
     aerodynamicAngleCalculator_( aerodynamicAngleCalculator ),
     currentTime_( TUDAT_NAN )
 {
+    isScalarFlightConditionComputed_.fill( false );
+    isLatitudeAndLongitudeSet_ = 0;
+
     // Link body-state function.
     bodyCenteredPseudoBodyFixedStateFunction_ = std::bind(
                 &reference_frames::AerodynamicAngleCalculator::getCurrentAirspeedBasedBodyFixedState, aerodynamicAngleCalculator_ );
@@ -75,7 +78,9 @@ AtmosphericFlightConditions::AtmosphericFlightConditions(
     FlightConditions( shapeModel, aerodynamicAngleCalculator ),
     atmosphereModel_( atmosphereModel ),
     aerodynamicCoefficientInterface_( aerodynamicCoefficientInterface ),
-    controlSurfaceDeflectionFunction_( controlSurfaceDeflectionFunction )
+    controlSurfaceDeflectionFunction_( controlSurfaceDeflectionFunction ),
+    evaluateAerodynamicCoefficientsOnDemand_( false ),
+    areAerodynamicCoefficientsUpToDate_( false )
 {
     // Check if atmosphere requires latitude and longitude update.
     if( std::dynamic_pointer_cast< aerodynamics::StandardAtmosphere >( atmosphereModel_ ) == nullptr )
@@ -131,20 +136,46 @@ void AtmosphericFlightConditions::updateConditions( const double currentTime )
         // Calculate state of vehicle in global frame and corotating frame.
         currentBodyCenteredAirspeedBasedBodyFixedState_ = bodyCenteredPseudoBodyFixedStateFunction_( );
 
-        updateAerodynamicCoefficientInput( );
+        areAerodynamicCoefficientsUpToDate_ = false;
 
-        // Update angles from aerodynamic to body-fixed frame (if relevant).
+        // Update angles from aerodynamic to body-fixed frame (if relevant). The coefficient input is always computed
+        // first, as the functions setting the body-fixed angles (e.g. trim or guidance) may require it.
         if( aerodynamicAngleCalculator_!= nullptr )
         {
+            updateAerodynamicCoefficientInput( );
             aerodynamicAngleCalculator_->update( currentTime, true );
+        }
+
+        // Update coefficient input for updated angles and aerodynamic coefficients, or clear input to be recomputed
+        // when coefficients are requested.
+        if( !evaluateAerodynamicCoefficientsOnDemand_ )
+        {
             updateAerodynamicCoefficientInput( );
+            updateAerodynamicCoefficients( );
+        }
+        else
+        {
+            aerodynamicCoefficientIndependentVariables_.clear( );
+            controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
         }
+    }
+}
 
-        // Update aerodynamic coefficients.
-        aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
-                    aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_,
-                    currentTime_ );
+//! Function to update the aerodynamic coefficients to the current flight conditions
+void AtmosphericFlightConditions::updateAerodynamicCoefficients( )
+{
+    if( ( aerodynamicCoefficientIndependentVariables_.size( ) !=
+          aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) ) ||
+            ( controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ) !=
+              aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ) ) )
+    {
+        updateAerodynamicCoefficientInput( );
     }
+
+    aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
+                aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_,
+                currentTime_ );
+    areAerodynamicCoefficientsUpToDate_ = true;
 }
 
 //! Function to (compute and) retrieve the value of an independent variable of aerodynamic coefficients
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include <functional>
+#include <boost/array.hpp>
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/trimOrientation.h"
@@ -56,7 +57,8 @@ protected:
         airspeed_flight_condition,
         geodetic_latitude_condition,
         dynamic_pressure_condition,
-        aerodynamic_heat_rate
+        aerodynamic_heat_rate,
+        number_of_flight_condition_variables
     };
 
 public:
@@ -91,11 +93,11 @@ public:
      */
     double getCurrentAltitude( )
     {
-        if( scalarFlightConditions_.count( altitude_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ altitude_flight_condition ] )
         {
             computeAltitude( );
         }
-        return scalarFlightConditions_.at( altitude_flight_condition );
+        return scalarFlightConditions_[ altitude_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current longitude
@@ -105,11 +107,11 @@ public:
      */
     double getCurrentLongitude( )
     {
-        if( scalarFlightConditions_.count( longitude_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ longitude_flight_condition ] )
         {
             computeLatitudeAndLongitude( );
         }
-        return scalarFlightConditions_.at( longitude_flight_condition );
+        return scalarFlightConditions_[ longitude_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current geodetic latitude
@@ -119,11 +121,11 @@ public:
      */
     double getCurrentGeodeticLatitude( )
     {
-        if( scalarFlightConditions_.count( geodetic_latitude_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ geodetic_latitude_condition ] )
         {
             computeGeodeticLatitude( );
         }
-        return scalarFlightConditions_.at( geodetic_latitude_condition );
+        return scalarFlightConditions_[ geodetic_latitude_condition ];
     }
 
     //! Function to return the current time of the AtmosphericFlightConditions
@@ -171,7 +173,7 @@ public:
     {
         currentTime_ = currentTime;
 
-        scalarFlightConditions_.clear( );
+        isScalarFlightConditionComputed_.fill( false );
         isLatitudeAndLongitudeSet_ = 0;
 
         aerodynamicAngleCalculator_->resetCurrentTime( currentTime_ );
@@ -189,21 +191,33 @@ public:
 
 protected:
 
+    //! Function to set the value of a flight condition at the current time step, and flag it as computed
+    /*!
+     *  Function to set the value of a flight condition at the current time step, and flag it as computed
+     *  \param variable Identifier of flight condition
+     *  \param value Value of flight condition at current time step
+     */
+    void setScalarFlightCondition( const FlightConditionVariables variable, const double value )
+    {
+        scalarFlightConditions_[ variable ] = value;
+        isScalarFlightConditionComputed_[ variable ] = true;
+    }
+
     //! Function to compute and set the current latitude and longitude
     void computeLatitudeAndLongitude( )
     {
-        scalarFlightConditions_[ latitude_flight_condition ] = aerodynamicAngleCalculator_->getAerodynamicAngle(
-                    reference_frames::latitude_angle );
-        scalarFlightConditions_[ longitude_flight_condition ] = aerodynamicAngleCalculator_->getAerodynamicAngle(
-                    reference_frames::longitude_angle );
+        setScalarFlightCondition( latitude_flight_condition, aerodynamicAngleCalculator_->getAerodynamicAngle(
+                    reference_frames::latitude_angle ) );
+        setScalarFlightCondition( longitude_flight_condition, aerodynamicAngleCalculator_->getAerodynamicAngle(
+                    reference_frames::longitude_angle ) );
         isLatitudeAndLongitudeSet_ = 1;
     }
 
     //! Function to compute and set the current altitude
     void computeAltitude( )
     {
-        scalarFlightConditions_[ altitude_flight_condition ] =
-                shapeModel_->getAltitude( currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 0, 3 ) );
+        setScalarFlightCondition( altitude_flight_condition,
+                                  shapeModel_->getAltitude( currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 0, 3 ) ) );
     }
 
     //! Function to compute and set the current geodetic latitude.
@@ -211,16 +225,16 @@ protected:
     {
         if( !( geodeticLatitudeFunction_ == nullptr ) )
         {
-            scalarFlightConditions_[ geodetic_latitude_condition ] = geodeticLatitudeFunction_(
-                        currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 0, 3 ) );
+            setScalarFlightCondition( geodetic_latitude_condition, geodeticLatitudeFunction_(
+                        currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 0, 3 ) ) );
         }
         else
         {
-            if( scalarFlightConditions_.count( latitude_flight_condition ) == 0 || !isLatitudeAndLongitudeSet_ )
+            if( !isScalarFlightConditionComputed_[ latitude_flight_condition ] || !isLatitudeAndLongitudeSet_ )
             {
                 computeLatitudeAndLongitude( );
             }
-            scalarFlightConditions_[ geodetic_latitude_condition ] = scalarFlightConditions_[ latitude_flight_condition ] ;
+            setScalarFlightCondition( geodetic_latitude_condition, scalarFlightConditions_[ latitude_flight_condition ] );
         }
     }
 
@@ -248,8 +262,12 @@ protected:
     //! Boolean denoting whether the current latitude and longitude have been computed at current time step
     bool isLatitudeAndLongitudeSet_;
 
-    //! List of atmospheric/flight properties computed at current time step.
-    std::map< FlightConditionVariables, double > scalarFlightConditions_;
+    //! List of atmospheric/flight properties computed at current time step (only valid for entries for which
+    //! isScalarFlightConditionComputed_ is true), indexed by FlightConditionVariables.
+    boost::array< double, number_of_flight_condition_variables > scalarFlightConditions_;
+
+    //! List of booleans denoting whether the entries of scalarFlightConditions_ have been computed at current time step.
+    boost::array< bool, number_of_flight_condition_variables > isScalarFlightConditionComputed_;
 
     //! Function from which to compute the geodetic latitude as function of body-fixed position (empty if equal to
     //! geographic latitude).
@@ -297,7 +315,10 @@ public:
     //! Function to update all flight conditions.
     /*!
      *  Function to update all flight conditions (altitude, density, force coefficients) to
-     *  current state of vehicle and central body.
+     *  current state of vehicle and central body. If the aerodynamic coefficients are evaluated on demand (see
+     *  setEvaluateAerodynamicCoefficientsOnDemand), only the aerodynamic angles and vehicle state are updated here, and the
+     *  coefficients are computed upon first request. The coefficient input is always computed before updating the
+     *  body-fixed angles, as the functions defining these angles (e.g. for trimmed conditions) may require it.
      *  \param currentTime Time to which conditions are to be updated.
      */
     void updateConditions( const double currentTime );
@@ -309,11 +330,11 @@ public:
      */
     double getCurrentDensity( )
     {
-        if( scalarFlightConditions_.count( density_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ density_flight_condition ] )
         {
             computeDensity( );
         }
-        return scalarFlightConditions_.at( density_flight_condition );
+        return scalarFlightConditions_[ density_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current freestream temperature
@@ -323,11 +344,11 @@ public:
      */
     double getCurrentFreestreamTemperature( )
     {
-        if( scalarFlightConditions_.count( temperature_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ temperature_flight_condition ] )
         {
             computeTemperature( );
         }
-        return scalarFlightConditions_.at( temperature_flight_condition );
+        return scalarFlightConditions_[ temperature_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current freestream dynamic pressure
@@ -337,11 +358,11 @@ public:
      */
     double getCurrentDynamicPressure( )
     {
-        if( scalarFlightConditions_.count( dynamic_pressure_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ dynamic_pressure_condition ] )
         {
             computeDynamicPressure( );
         }
-        return scalarFlightConditions_.at( dynamic_pressure_condition );
+        return scalarFlightConditions_[ dynamic_pressure_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current aerodynamic heat rate
@@ -351,11 +372,11 @@ public:
      */
     double getCurrentAerodynamicHeatRate( )
     {
-        if( scalarFlightConditions_.count( aerodynamic_heat_rate ) == 0 )
+        if( !isScalarFlightConditionComputed_[ aerodynamic_heat_rate ] )
         {
             computeAerodynamicHeatRate( );
         }
-        return scalarFlightConditions_.at( aerodynamic_heat_rate );
+        return scalarFlightConditions_[ aerodynamic_heat_rate ];
     }
 
     //! Function to retrieve (and compute if necessary) the current freestream pressure
@@ -365,11 +386,11 @@ public:
      */
     double getCurrentPressure( )
     {
-        if( scalarFlightConditions_.count( pressure_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ pressure_flight_condition ] )
         {
             computeFreestreamPressure( );
         }
-        return scalarFlightConditions_.at( pressure_flight_condition );
+        return scalarFlightConditions_[ pressure_flight_condition ];
     }
 
     /*!
@@ -378,11 +399,11 @@ public:
      */
     double getCurrentAirspeed( )
     {
-        if( scalarFlightConditions_.count( airspeed_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ airspeed_flight_condition ] )
         {
             computeAirspeed( );
         }
-        return scalarFlightConditions_.at( airspeed_flight_condition );
+        return scalarFlightConditions_[ airspeed_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current speed of sound
@@ -392,11 +413,11 @@ public:
      */
     double getCurrentSpeedOfSound( )
     {
-        if( scalarFlightConditions_.count( speed_of_sound_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ speed_of_sound_flight_condition ] )
         {
             computeSpeedOfSound( );
         }
-        return scalarFlightConditions_.at( speed_of_sound_flight_condition );
+        return scalarFlightConditions_[ speed_of_sound_flight_condition ];
     }
 
     //! Function to retrieve (and compute if necessary) the current Mach number
@@ -406,11 +427,11 @@ public:
      */
     double getCurrentMachNumber( )
     {
-        if( scalarFlightConditions_.count( mach_number_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ mach_number_flight_condition ] )
         {
             computeMachNumber( );
         }
-        return scalarFlightConditions_.at( mach_number_flight_condition );
+        return scalarFlightConditions_[ mach_number_flight_condition ];
     }
 
     //! Function to return atmosphere model object
@@ -488,6 +509,74 @@ public:
         return controlSurfaceAerodynamicCoefficientIndependentVariables_;
     }
 
+    //! Function to set whether the aerodynamic coefficients are to be evaluated on demand
+    /*!
+     *  Function to set whether the aerodynamic coefficients (and their independent variables) are to be evaluated on demand,
+     *  i.e. upon the first call to getCurrentForceCoefficients, getCurrentMomentCoefficients or
+     *  getCurrentAerodynamicCoefficients after the flight conditions are updated, instead of during each call to
+     *  updateConditions. If set to true, the coefficients should not be retrieved directly from the aerodynamic coefficient
+     *  interface, as they are only updated when requested through this class. By default, the coefficients are evaluated
+     *  during each call to updateConditions.
+     *  \param evaluateAerodynamicCoefficientsOnDemand Boolean denoting whether the aerodynamic coefficients are to be
+     *  evaluated on demand.
+     */
+    void setEvaluateAerodynamicCoefficientsOnDemand( const bool evaluateAerodynamicCoefficientsOnDemand )
+    {
+        evaluateAerodynamicCoefficientsOnDemand_ = evaluateAerodynamicCoefficientsOnDemand;
+    }
+
+    //! Function to retrieve whether the aerodynamic coefficients are evaluated on demand
+    /*!
+     *  Function to retrieve whether the aerodynamic coefficients are evaluated on demand
+     *  \return Boolean denoting whether the aerodynamic coefficients are evaluated on demand.
+     */
+    bool getEvaluateAerodynamicCoefficientsOnDemand( )
+    {
+        return evaluateAerodynamicCoefficientsOnDemand_;
+    }
+
+    //! Function to retrieve (and compute if necessary) the current aerodynamic force coefficients
+    /*!
+     * Function to retrieve (and compute if necessary) the current aerodynamic force coefficients
+     * \return Current aerodynamic force coefficients
+     */
+    Eigen::Vector3d getCurrentForceCoefficients( )
+    {
+        if( !areAerodynamicCoefficientsUpToDate_ )
+        {
+            updateAerodynamicCoefficients( );
+        }
+        return aerodynamicCoefficientInterface_->getCurrentForceCoefficients( );
+    }
+
+    //! Function to retrieve (and compute if necessary) the current aerodynamic moment coefficients
+    /*!
+     * Function to retrieve (and compute if necessary) the current aerodynamic moment coefficients
+     * \return Current aerodynamic moment coefficients
+     */
+    Eigen::Vector3d getCurrentMomentCoefficients( )
+    {
+        if( !areAerodynamicCoefficientsUpToDate_ )
+        {
+            updateAerodynamicCoefficients( );
+        }
+        return aerodynamicCoefficientInterface_->getCurrentMomentCoefficients( );
+    }
+
+    //! Function to retrieve (and compute if necessary) the current aerodynamic force and moment coefficients
+    /*!
+     * Function to retrieve (and compute if necessary) the current aerodynamic force and moment coefficients
+     * \return Current aerodynamic force (first three entries) and moment (last three entries) coefficients
+     */
+    Eigen::Vector6d getCurrentAerodynamicCoefficients( )
+    {
+        if( !areAerodynamicCoefficientsUpToDate_ )
+        {
+            updateAerodynamicCoefficients( );
+        }
+        return aerodynamicCoefficientInterface_->getCurrentAerodynamicCoefficients( );
+    }
+
     //! Function to reset the current time of the flight conditions.
     /*!
      *  Function to reset the current time of the flight conditions. This function is typically sused to set the current time
@@ -498,12 +587,13 @@ public:
     {
         currentTime_ = currentTime;
 
-        scalarFlightConditions_.clear( );
+        isScalarFlightConditionComputed_.fill( false );
         isLatitudeAndLongitudeSet_ = 0;
 
         aerodynamicAngleCalculator_->resetCurrentTime( currentTime_ );
         aerodynamicCoefficientIndependentVariables_.clear( );
         controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
+        areAerodynamicCoefficientsUpToDate_ = false;
     }
 
 private:
@@ -522,8 +612,8 @@ private:
     //! Function to update input to atmosphere model (altitude, as well as latitude and longitude if needed).
     void updateAtmosphereInput( )
     {
-        if( ( scalarFlightConditions_.count( latitude_flight_condition ) == 0 ||
-              scalarFlightConditions_.count( longitude_flight_condition ) == 0 ) )
+        if( ( !isScalarFlightConditionComputed_[ latitude_flight_condition ] ||
+              !isScalarFlightConditionComputed_[ longitude_flight_condition ] ) )
         {
             if( updateLatitudeAndLongitudeForAtmosphere_ )
             {
@@ -531,12 +621,12 @@ private:
             }
             else
             {
-                scalarFlightConditions_[ latitude_flight_condition ] = 0.0;
-                scalarFlightConditions_[ longitude_flight_condition ] = 0.0;
+                setScalarFlightCondition( latitude_flight_condition, 0.0 );
+                setScalarFlightCondition( longitude_flight_condition, 0.0 );
             }
         }
 
-        if( scalarFlightConditions_.count( altitude_flight_condition ) == 0 )
+        if( !isScalarFlightConditionComputed_[ altitude_flight_condition ] )
         {
             computeAltitude( );
         }
@@ -546,33 +636,30 @@ private:
     void computeDensity( )
     {
         updateAtmosphereInput( );
-        scalarFlightConditions_[ density_flight_condition ] =
-                atmosphereModel_->getDensity(
-                    scalarFlightConditions_.at( altitude_flight_condition ),
-                    scalarFlightConditions_.at( longitude_flight_condition ),
-                    scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( density_flight_condition, atmosphereModel_->getDensity(
+                    scalarFlightConditions_[ altitude_flight_condition ],
+                    scalarFlightConditions_[ longitude_flight_condition ],
+                    scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
     //! Function to compute and set the current freestream temperature
     void computeTemperature( )
     {
         updateAtmosphereInput( );
-        scalarFlightConditions_[ temperature_flight_condition ] =
-                atmosphereModel_->getTemperature(
-                    scalarFlightConditions_.at( altitude_flight_condition ),
-                    scalarFlightConditions_.at( longitude_flight_condition ),
-                    scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( temperature_flight_condition, atmosphereModel_->getTemperature(
+                    scalarFlightConditions_[ altitude_flight_condition ],
+                    scalarFlightConditions_[ longitude_flight_condition ],
+                    scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
     //! Function to compute and set the current freestream pressure.
     void computeFreestreamPressure( )
     {
         updateAtmosphereInput( );
-        scalarFlightConditions_[ pressure_flight_condition ] =
-                atmosphereModel_->getPressure(
-                    scalarFlightConditions_.at( altitude_flight_condition ),
-                    scalarFlightConditions_.at( longitude_flight_condition ),
-                    scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( pressure_flight_condition, atmosphereModel_->getPressure(
+                    scalarFlightConditions_[ altitude_flight_condition ],
+                    scalarFlightConditions_[ longitude_flight_condition ],
+                    scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
 
@@ -580,45 +667,51 @@ private:
     void computeSpeedOfSound( )
     {
         updateAtmosphereInput( );
-        scalarFlightConditions_[ speed_of_sound_flight_condition ]  =
-                atmosphereModel_->getSpeedOfSound(
-                    scalarFlightConditions_.at( altitude_flight_condition ),
-                    scalarFlightConditions_.at( longitude_flight_condition ),
-                    scalarFlightConditions_.at( latitude_flight_condition ), currentTime_ );
+        setScalarFlightCondition( speed_of_sound_flight_condition, atmosphereModel_->getSpeedOfSound(
+                    scalarFlightConditions_[ altitude_flight_condition ],
+                    scalarFlightConditions_[ longitude_flight_condition ],
+                    scalarFlightConditions_[ latitude_flight_condition ], currentTime_ ) );
     }
 
     //! Function to compute and set the current airspeed
     void computeAirspeed( )
     {
-        scalarFlightConditions_[ airspeed_flight_condition ] = currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 3, 3 ).norm( );
+        setScalarFlightCondition( airspeed_flight_condition,
+                                  currentBodyCenteredAirspeedBasedBodyFixedState_.segment( 3, 3 ).norm( ) );
     }
 
     //! Function to compute and set the current freestream dynamic pressure.
     void computeDynamicPressure( )
     {
         double currentAirspeed = getCurrentAirspeed( );
-        scalarFlightConditions_[ dynamic_pressure_condition ] = 0.5 *
-                getCurrentDensity( ) * currentAirspeed * currentAirspeed;
+        setScalarFlightCondition( dynamic_pressure_condition, 0.5 *
+                getCurrentDensity( ) * currentAirspeed * currentAirspeed );
     }
 
     //! Function to compute and set the current aerodynamic heat rate.
     void computeAerodynamicHeatRate( )
     {
         double currentAirspeed = getCurrentAirspeed( );
-        scalarFlightConditions_[ aerodynamic_heat_rate ] = 0.5 *
-                getCurrentDensity( ) * currentAirspeed * currentAirspeed * currentAirspeed;
+        setScalarFlightCondition( aerodynamic_heat_rate, 0.5 *
+                getCurrentDensity( ) * currentAirspeed * currentAirspeed * currentAirspeed );
     }
 
     //! Function to compute and set the current Mach number.
     void computeMachNumber( )
     {
-        scalarFlightConditions_[ mach_number_flight_condition ] =
-                getCurrentAirspeed( ) / getCurrentSpeedOfSound( );
+        setScalarFlightCondition( mach_number_flight_condition, getCurrentAirspeed( ) / getCurrentSpeedOfSound( ) );
     }
 
     //! Function to update the independent variables of the aerodynamic coefficient interface
     void updateAerodynamicCoefficientInput( );
 
+    //! Function to update the aerodynamic coefficients to the current flight conditions
+    /*!
+     *  Function to update the aerodynamic coefficients to the current flight conditions. The independent variables of the
+     *  coefficients are recomputed if they have not yet been computed since the last update of the conditions.
+     */
+    void updateAerodynamicCoefficients( );
+
 
     //! Atmosphere model of atmosphere through which vehicle is flying
     std::shared_ptr< aerodynamics::AtmosphereModel > atmosphereModel_;
@@ -643,6 +736,12 @@ private:
     //! List of independent variables of the control surface aerodynamic coefficient interface, with map key
     //! control surface identifiers.
     std::map< std::string, std::vector< double > > controlSurfaceAerodynamicCoefficientIndependentVariables_;
+
+    //! Boolean denoting whether the aerodynamic coefficients are evaluated on demand, instead of in updateConditions.
+    bool evaluateAerodynamicCoefficientsOnDemand_;
+
+    //! Boolean denoting whether the aerodynamic coefficients have been updated to the current flight conditions.
+    bool areAerodynamicCoefficientsUpToDate_;
 };
 
 } // namespace aerodynamics
@@ -13,9 +13,14 @@
  *
  */
 
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <string>
 
 #include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
 #include <functional>
 #include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
@@ -24,6 +29,7 @@
 
 #include <Eigen/Geometry>
 
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
@@ -42,6 +48,23 @@ using mathematical_constants::PI;
 
 using namespace geometric_shapes;
 
+//! Identifier at start of binary local inclination coefficient cache files.
+static const char LOCAL_INCLINATION_CACHE_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'H', 'L', 'I' };
+
+//! Version of binary local inclination coefficient cache file format (and of the analysis, for cache invalidation).
+static const boost::int32_t LOCAL_INCLINATION_CACHE_FILE_VERSION = 1;
+
+//! Function to add a block of data to a 64-bit FNV-1a hash.
+static void addDataToHash( boost::uint64_t& hash, const void* data, const std::size_t numberOfBytes )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for( std::size_t i = 0; i < numberOfBytes; i++ )
+    {
+        hash ^= static_cast< boost::uint64_t >( bytes[ i ] );
+        hash *= 1099511628211ULL;
+    }
+}
+
 //! Returns default values of mach number for use in HypersonicLocalInclinationAnalysis.
 std::vector< double > getDefaultHypersonicLocalInclinationMachPoints(
         const std::string& machRegime )
@@ -176,14 +199,18 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const double referenceArea,
         const double referenceLength,
         const Eigen::Vector3d& momentReferencePoint,
-        const bool savePressureCoefficients )
+        const bool savePressureCoefficients,
+        const int numberOfThreads,
+        const std::string& coefficientCacheDirectory )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint, { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent },true, false ),
-      stagnationPressureCoefficient( 2.0 ),
       ratioOfSpecificHeats( 1.4 ),
       selectedMethods_( selectedMethods ),
-      savePressureCoefficients_( savePressureCoefficients )
+      savePressureCoefficients_( savePressureCoefficients ),
+      numberOfThreads_( numberOfThreads ),
+      coefficientCacheDirectory_( coefficientCacheDirectory ),
+      areCoefficientsLoadedFromCache_( false )
 {
     // Set geometry if it is a single surface.
     if ( std::dynamic_pointer_cast< SingleSurfaceGeometry > ( inputVehicleSurface ) !=
@@ -253,19 +280,8 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
-    inclination_.resize( vehicleParts_.size( ) );
-    pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
-    {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
-        {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-        }
-    }
+    // Set panel properties in contiguous matrices.
+    setPanelProperties( );
 
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
     for( int i = 0; i < 3; i++ )
@@ -279,7 +295,22 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
 
-    generateCoefficients( );
+    // Retrieve coefficients from cache if possible (pressure coefficients are not cached), compute them otherwise.
+    geometryAndSettingsHash_ = computeGeometryAndSettingsHash( );
+    if( coefficientCacheDirectory_ != "" && !savePressureCoefficients_ )
+    {
+        areCoefficientsLoadedFromCache_ = loadCoefficientsFromCache( );
+    }
+
+    if( !areCoefficientsLoadedFromCache_ )
+    {
+        generateCoefficients( );
+        if( coefficientCacheDirectory_ != "" )
+        {
+            writeCoefficientsToCache( );
+        }
+    }
+
     createInterpolator( );
 }
 
@@ -299,25 +330,60 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 //! Generate aerodynamic database.
 void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
+    const int numberOfAnglesOfAttack = dataPointsOfIndependentVariables_[ 1 ].size( );
+    const int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    const int numberOfAttitudes = numberOfAnglesOfAttack * numberOfAnglesOfSideslip;
+    const int numberOfDataPoints = dataPointsOfIndependentVariables_[ 0 ].size( ) * numberOfAttitudes;
+
+    // Compute panel inclinations once for each combination of angle of attack and sideslip.
+    std::vector< std::vector< Eigen::VectorXd > > panelInclinationsPerAttitude( numberOfAttitudes );
+    utilities::executeParallelLoop(
+                numberOfAttitudes, [ & ]( const int attitudeIndex )
+    {
+        panelInclinationsPerAttitude[ attitudeIndex ] = computePanelInclinations(
+                    dataPointsOfIndependentVariables_[ 1 ][ attitudeIndex / numberOfAnglesOfSideslip ],
+                    dataPointsOfIndependentVariables_[ 2 ][ attitudeIndex % numberOfAnglesOfSideslip ] );
+    }, numberOfThreads_ );
 
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    // Compute coefficients at all combinations of independent variables.
+    std::vector< std::vector< Eigen::VectorXd > > panelPressureCoefficientsPerDataPoint;
+    if( savePressureCoefficients_ )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        panelPressureCoefficientsPerDataPoint.resize( numberOfDataPoints );
+    }
+    utilities::executeParallelLoop(
+                numberOfDataPoints, [ & ]( const int dataPointIndex )
+    {
+        const int attitudeIndex = dataPointIndex % numberOfAttitudes;
+        boost::array< int, 3 > independentVariableIndices;
+        independentVariableIndices[ 0 ] = dataPointIndex / numberOfAttitudes;
+        independentVariableIndices[ 1 ] = attitudeIndex / numberOfAnglesOfSideslip;
+        independentVariableIndices[ 2 ] = attitudeIndex % numberOfAnglesOfSideslip;
+
+        std::vector< Eigen::VectorXd > panelPressureCoefficients;
+        aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                    dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                    panelInclinationsPerAttitude[ attitudeIndex ], panelPressureCoefficients );
+        isCoefficientGenerated_( independentVariableIndices ) = 1;
+
+        if( savePressureCoefficients_ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
-            {
-                independentVariableIndices[ 2 ] = k;
+            panelPressureCoefficientsPerDataPoint[ dataPointIndex ].swap( panelPressureCoefficients );
+        }
+    }, numberOfThreads_ );
 
-                determineVehicleCoefficients( independentVariableIndices );
-            }
+    // Save pressure coefficients, if required.
+    if( savePressureCoefficients_ )
+    {
+        for( int dataPointIndex = 0; dataPointIndex < numberOfDataPoints; dataPointIndex++ )
+        {
+            const int attitudeIndex = dataPointIndex % numberOfAttitudes;
+            boost::array< int, 3 > independentVariableIndices;
+            independentVariableIndices[ 0 ] = dataPointIndex / numberOfAttitudes;
+            independentVariableIndices[ 1 ] = attitudeIndex / numberOfAnglesOfSideslip;
+            independentVariableIndices[ 2 ] = attitudeIndex % numberOfAnglesOfSideslip;
+            savePanelPressureCoefficients(
+                        independentVariableIndices, panelPressureCoefficientsPerDataPoint[ dataPointIndex ] );
         }
     }
 }
@@ -326,207 +392,131 @@ void HypersonicLocalInclinationAnalysis::generateCoefficients( )
 void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
         const boost::array< int, 3 > independentVariableIndices )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
-
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
-    {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
-    }
+    std::vector< Eigen::VectorXd > panelPressureCoefficients;
+    aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                computePanelInclinations( dataPointsOfIndependentVariables_[ 1 ][ independentVariableIndices[ 1 ] ],
+                                          dataPointsOfIndependentVariables_[ 2 ][ independentVariableIndices[ 2 ] ] ),
+                panelPressureCoefficients );
+    isCoefficientGenerated_( independentVariableIndices ) = 1;
 
     if( savePressureCoefficients_ )
     {
-        pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficient_;
+        savePanelPressureCoefficients( independentVariableIndices, panelPressureCoefficients );
     }
-
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
 }
 
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Function to set the panel properties of all vehicle parts in contiguous matrices.
+void HypersonicLocalInclinationAnalysis::setPanelProperties( )
 {
-    // Declare and determine angles of attack and sideslip for analysis.
-    double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
-            [ independentVariableIndices[ 1 ] ];
-
-    double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
-            [ independentVariableIndices[ 2 ] ];
-
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
-    if ( previouslyComputedInclinations_.count( std::pair< double, double >(
-                                                    angleOfAttack, angleOfSideslip ) ) == 0 )
-    {
-        // Determine panel inclinations for part.
-        determineInclinations( angleOfAttack, angleOfSideslip );
-
-        // Add panel inclinations to container
-        previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ] = inclination_;
-    }
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelAreas_.resize( vehicleParts_.size( ) );
+    panelMomentArmCrossSurfaceNormals_.resize( vehicleParts_.size( ) );
 
-    else
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        // Fetch inclinations from container
-        inclination_ = previouslyComputedInclinations_[ std::pair< double, double >(
-                    angleOfAttack, angleOfSideslip ) ];
-    }
-
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
-
-    return partCoefficients;
-}
-
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
-{
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
+        const int numberOfPanelLines = vehicleParts_[ k ]->getNumberOfLines( ) - 1;
+        const int numberOfPanelPoints = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
+        const int numberOfPanels = std::max( numberOfPanelLines, 0 ) * std::max( numberOfPanelPoints, 0 );
 
-    // Determine stagnation point pressure coefficients. Value is computed once
-    // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
-                machNumber, ratioOfSpecificHeats );
+        panelSurfaceNormals_[ k ].resize( 3, numberOfPanels );
+        panelAreas_[ k ].resize( numberOfPanels );
+        panelMomentArmCrossSurfaceNormals_[ k ].resize( 3, numberOfPanels );
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
-}
-
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
-{
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
-
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
+        int panelIndex = 0;
+        for ( int i = 0 ; i < numberOfPanelLines ; i++ )
         {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
+            for ( int j = 0 ; j < numberOfPanelPoints ; j++ )
+            {
+                panelSurfaceNormals_[ k ].col( panelIndex ) = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                panelAreas_[ k ]( panelIndex ) = vehicleParts_[ k ]->getPanelArea( i, j );
+                panelMomentArmCrossSurfaceNormals_[ k ].col( panelIndex ) =
+                        ( vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_ ).cross(
+                            vehicleParts_[ k ]->getPanelSurfaceNormal( i, j ) );
+                panelIndex++;
+            }
         }
     }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
 }
 
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
+//! Function to compute the aerodynamic coefficients of the full vehicle from the panel inclinations.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const double machNumber,
+        const std::vector< Eigen::VectorXd >& panelInclinations,
+        std::vector< Eigen::VectorXd >& panelPressureCoefficients ) const
 {
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
-
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance;
+    // Declare coefficients vector and initialize to zeros.
+    Vector6d coefficients = Vector6d::Zero( );
 
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Loop over all vehicle parts, calculate pressure coefficients and add resulting forces and moments.
+    panelPressureCoefficients.resize( vehicleParts_.size( ) );
+    Eigen::VectorXd panelPressureForces;
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->getPanelCentroid( i, j ) -
-                                  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
+        panelPressureCoefficients[ i ] = Eigen::VectorXd::Zero( panelAreas_[ i ].rows( ) );
+        updateCompressionPressures( machNumber, i, panelInclinations[ i ], panelPressureCoefficients[ i ] );
+        updateExpansionPressures( machNumber, i, panelInclinations[ i ], panelPressureCoefficients[ i ] );
+
+        // Sum pressures, scaled by panel area, in direction of surface normals and resulting moments.
+        panelPressureForces = panelPressureCoefficients[ i ].cwiseProduct( panelAreas_[ i ] );
+        coefficients.segment( 0, 3 ) -= panelSurfaceNormals_[ i ] * panelPressureForces;
+        coefficients.segment( 3, 3 ) -= panelMomentArmCrossSurfaceNormals_[ i ] * panelPressureForces;
     }
 
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
+    // Normalize result by reference area (and length).
+    coefficients.segment( 0, 3 ) /= referenceArea_;
+    coefficients.segment( 3, 3 ) /= ( referenceLength_ * referenceArea_ );
 
-    return momentCoefficients;
+    return coefficients;
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+//! Function to compute the inclination angles of all panels for given attitude.
+std::vector< Eigen::VectorXd > HypersonicLocalInclinationAnalysis::computePanelInclinations(
+        const double angleOfAttack, const double angleOfSideslip ) const
 {
-    // Declare free-stream velocity vector.
-    Eigen::Vector3d freestreamVelocityDirection;
-
     // Set freestream velocity vector in body frame.
-    double freestreamVelocityDirectionX = cos( angleOfAttack )* cos( angleOfSideslip );
-    double freestreamVelocityDirectionY = sin( angleOfSideslip );
-    double freestreamVelocityDirectionZ = sin( angleOfAttack ) * cos( angleOfSideslip );
-    freestreamVelocityDirection( 0 ) = freestreamVelocityDirectionX;
-    freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
-    freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
-
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
+    Eigen::Vector3d freestreamVelocityDirection;
+    freestreamVelocityDirection( 0 ) = cos( angleOfAttack )* cos( angleOfSideslip );
+    freestreamVelocityDirection( 1 ) = sin( angleOfSideslip );
+    freestreamVelocityDirection( 2 ) = sin( angleOfAttack ) * cos( angleOfSideslip );
 
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Determine cosine of inclination angles from inner product between surface normals and free-stream direction,
+    // and set inclination angles.
+    std::vector< Eigen::VectorXd > panelInclinations( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
-        }
+        panelInclinations[ k ] = ( PI / 2.0 - ( panelSurfaceNormals_[ k ].transpose( ) *
+                                                freestreamVelocityDirection ).array( ).acos( ) ).matrix( );
     }
+    return panelInclinations;
 }
 
-//! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+//! Determine compression pressure coefficients on a single part.
+void HypersonicLocalInclinationAnalysis::updateCompressionPressures(
+        const double machNumber, const int partNumber,
+        const Eigen::VectorXd& panelInclinations, Eigen::VectorXd& panelPressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
+    // Evaluate (modified) Newtonian methods for all panels simultaneously.
+    if( method == 0 || method == 1 )
+    {
+        double stagnationPressureCoefficient = 2.0;
+        if( method == 1 )
+        {
+            stagnationPressureCoefficient = computeStagnationPressure( machNumber, ratioOfSpecificHeats );
+        }
+        panelPressureCoefficients = ( panelInclinations.array( ) > 0.0 ).select(
+                    stagnationPressureCoefficient * panelInclinations.array( ).sin( ).square( ),
+                    panelPressureCoefficients.array( ) ).matrix( );
+        return;
+    }
+
     std::function< double( double ) > pressureFunction;
 
     // Switch to analyze part using correct method.
     switch( method )
     {
-    case 0:
-        pressureFunction =
-                std::bind( aerodynamics::computeNewtonianPressureCoefficient, std::placeholders::_1 );
-        break;
-
-    case 1:
-        pressureFunction =
-                std::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, std::placeholders::_1,
-                           stagnationPressureCoefficient );
-        break;
-
     case 2:
         // Method currently disabled.
         break;
@@ -575,62 +565,47 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    for ( int i = 0 ; i < panelInclinations.rows( ); i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( panelInclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            panelPressureCoefficients( i ) = pressureFunction( panelInclinations( i ) );
         }
     }
 }
 
-//! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+//! Determines expansion pressure coefficients on a single part.
+void HypersonicLocalInclinationAnalysis::updateExpansionPressures(
+        const double machNumber, const int partNumber,
+        const Eigen::VectorXd& panelInclinations, Eigen::VectorXd& panelPressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
 
     if ( method == 0 || method == 1 || method == 4 )
     {
-        std::function< double( ) > pressureFunction;
+        // Pressure coefficient is independent of inclination for these methods.
+        double expansionPressureCoefficient = 0.0;
         switch( method )
         {
         case 0:
-            pressureFunction = std::bind( &aerodynamics::computeVacuumPressureCoefficient,
-                                          machNumber, ratioOfSpecificHeats );
+            expansionPressureCoefficient = aerodynamics::computeVacuumPressureCoefficient(
+                        machNumber, ratioOfSpecificHeats );
             break;
 
         case 1:
-            pressureFunction = [ ]( ){ return 0.0; };
+            expansionPressureCoefficient = 0.0;
             break;
 
         case 4:
-            pressureFunction = std::bind( &aerodynamics::computeHighMachBasePressure,
-                                          machNumber );
+            expansionPressureCoefficient = aerodynamics::computeHighMachBasePressure( machNumber );
             break;
 
         }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
-            }
-        }
+        panelPressureCoefficients = ( panelInclinations.array( ) <= 0.0 ).select(
+                    expansionPressureCoefficient, panelPressureCoefficients.array( ) ).matrix( );
     }
 
     else if( method == 3 || method == 5 || method == 6 )
@@ -667,17 +642,12 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < panelInclinations.rows( ); i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( panelInclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate pressure coefficient.
+                panelPressureCoefficients( i ) = pressureFunction( panelInclinations( i ) );
             }
         }
     }
@@ -690,5 +660,173 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
     }
 }
 
+//! Function to save the panel pressure coefficients at a given data point to pressureCoefficientList_
+void HypersonicLocalInclinationAnalysis::savePanelPressureCoefficients(
+        const boost::array< int, 3 > independentVariableIndices,
+        const std::vector< Eigen::VectorXd >& panelPressureCoefficients )
+{
+    std::vector< std::vector< std::vector< double > > > pressureCoefficients( vehicleParts_.size( ) );
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    {
+        pressureCoefficients[ k ].resize( vehicleParts_[ k ]->getNumberOfLines( ) );
+        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) ; i++ )
+        {
+            pressureCoefficients[ k ][ i ].resize( vehicleParts_[ k ]->getNumberOfPoints( ), 0.0 );
+        }
+
+        int panelIndex = 0;
+        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
+            {
+                pressureCoefficients[ k ][ i ][ j ] = panelPressureCoefficients[ k ]( panelIndex );
+                panelIndex++;
+            }
+        }
+    }
+    pressureCoefficientList_[ independentVariableIndices ] = pressureCoefficients;
+}
+
+//! Function to compute the hash of the vehicle geometry and analysis settings.
+boost::uint64_t HypersonicLocalInclinationAnalysis::computeGeometryAndSettingsHash( ) const
+{
+    boost::uint64_t hash = 14695981039346656037ULL;
+
+    addDataToHash( hash, &LOCAL_INCLINATION_CACHE_FILE_VERSION, sizeof( LOCAL_INCLINATION_CACHE_FILE_VERSION ) );
+
+    // Add panel geometry.
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
+    {
+        boost::int64_t numberOfPanels = panelAreas_[ k ].rows( );
+        addDataToHash( hash, &numberOfPanels, sizeof( numberOfPanels ) );
+        addDataToHash( hash, panelSurfaceNormals_[ k ].data( ), 3 * numberOfPanels * sizeof( double ) );
+        addDataToHash( hash, panelAreas_[ k ].data( ), numberOfPanels * sizeof( double ) );
+        addDataToHash( hash, panelMomentArmCrossSurfaceNormals_[ k ].data( ), 3 * numberOfPanels * sizeof( double ) );
+    }
+
+    // Add independent variables.
+    for( unsigned int i = 0; i < dataPointsOfIndependentVariables_.size( ); i++ )
+    {
+        boost::int64_t numberOfDataPoints = dataPointsOfIndependentVariables_[ i ].size( );
+        addDataToHash( hash, &numberOfDataPoints, sizeof( numberOfDataPoints ) );
+        addDataToHash( hash, dataPointsOfIndependentVariables_[ i ].data( ), numberOfDataPoints * sizeof( double ) );
+    }
+
+    // Add analysis settings.
+    for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < selectedMethods_[ i ].size( ); j++ )
+        {
+            boost::int32_t selectedMethod = selectedMethods_[ i ][ j ];
+            addDataToHash( hash, &selectedMethod, sizeof( selectedMethod ) );
+        }
+    }
+    addDataToHash( hash, &referenceArea_, sizeof( referenceArea_ ) );
+    addDataToHash( hash, &referenceLength_, sizeof( referenceLength_ ) );
+    addDataToHash( hash, momentReferencePoint_.data( ), 3 * sizeof( double ) );
+    addDataToHash( hash, &ratioOfSpecificHeats, sizeof( ratioOfSpecificHeats ) );
+
+    return hash;
+}
+
+//! Function to retrieve the name of the coefficient cache file for the current geometry and settings.
+std::string HypersonicLocalInclinationAnalysis::getCoefficientCacheFileName( ) const
+{
+    std::ostringstream hashString;
+    hashString << std::hex << std::setw( 16 ) << std::setfill( '0' ) << geometryAndSettingsHash_;
+    return ( boost::filesystem::path( coefficientCacheDirectory_ ) /
+             ( "localInclinationCoefficients_" + hashString.str( ) + ".dat" ) ).string( );
+}
+
+//! Function to load the aerodynamic coefficients from the cache file, if it exists and is consistent.
+bool HypersonicLocalInclinationAnalysis::loadCoefficientsFromCache( )
+{
+    std::ifstream cacheFile( getCoefficientCacheFileName( ).c_str( ), std::ios::binary );
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
+
+    // Read and check header.
+    char fileIdentifier[ 8 ];
+    boost::int32_t fileVersion;
+    boost::uint64_t fileHash;
+    boost::int32_t numberOfDataPoints[ 3 ];
+    cacheFile.read( fileIdentifier, 8 );
+    cacheFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    cacheFile.read( reinterpret_cast< char* >( &fileHash ), sizeof( fileHash ) );
+    cacheFile.read( reinterpret_cast< char* >( numberOfDataPoints ), sizeof( numberOfDataPoints ) );
+
+    if( !cacheFile.good( ) ||
+            std::memcmp( fileIdentifier, LOCAL_INCLINATION_CACHE_FILE_IDENTIFIER, 8 ) != 0 ||
+            fileVersion != LOCAL_INCLINATION_CACHE_FILE_VERSION || fileHash != geometryAndSettingsHash_ )
+    {
+        return false;
+    }
+
+    for( int i = 0; i < 3; i++ )
+    {
+        if( numberOfDataPoints[ i ] != static_cast< boost::int32_t >( dataPointsOfIndependentVariables_[ i ].size( ) ) )
+        {
+            return false;
+        }
+    }
+
+    // Read coefficients (stored in order of multi-array storage).
+    std::vector< double > coefficientData( 6 * aerodynamicCoefficients_.num_elements( ) );
+    cacheFile.read( reinterpret_cast< char* >( coefficientData.data( ) ), coefficientData.size( ) * sizeof( double ) );
+    if( !cacheFile.good( ) )
+    {
+        return false;
+    }
+
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        *( aerodynamicCoefficients_.origin( ) + i ) = Eigen::Map< Vector6d >( coefficientData.data( ) + 6 * i );
+    }
+    std::fill( isCoefficientGenerated_.origin( ),
+               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 1 );
+
+    return true;
+}
+
+//! Function to write the aerodynamic coefficients to the cache file.
+void HypersonicLocalInclinationAnalysis::writeCoefficientsToCache( ) const
+{
+    boost::filesystem::create_directories( coefficientCacheDirectory_ );
+
+    std::string cacheFileName = getCoefficientCacheFileName( );
+    std::string temporaryFileName = boost::filesystem::unique_path( cacheFileName + ".%%%%-%%%%-%%%%.tmp" ).string( );
+
+    std::ofstream cacheFile( temporaryFileName.c_str( ), std::ios::binary );
+    if( !cacheFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing local inclination coefficient cache, could not open file " +
+                                  temporaryFileName );
+    }
+
+    // Write header.
+    cacheFile.write( LOCAL_INCLINATION_CACHE_FILE_IDENTIFIER, 8 );
+    cacheFile.write( reinterpret_cast< const char* >( &LOCAL_INCLINATION_CACHE_FILE_VERSION ),
+                     sizeof( LOCAL_INCLINATION_CACHE_FILE_VERSION ) );
+    cacheFile.write( reinterpret_cast< const char* >( &geometryAndSettingsHash_ ), sizeof( geometryAndSettingsHash_ ) );
+    for( int i = 0; i < 3; i++ )
+    {
+        boost::int32_t numberOfDataPoints = dataPointsOfIndependentVariables_[ i ].size( );
+        cacheFile.write( reinterpret_cast< const char* >( &numberOfDataPoints ), sizeof( numberOfDataPoints ) );
+    }
+
+    // Write coefficients (in order of multi-array storage).
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        cacheFile.write( reinterpret_cast< const char* >( ( aerodynamicCoefficients_.origin( ) + i )->data( ) ),
+                         6 * sizeof( double ) );
+    }
+    cacheFile.close( );
+
+    // Move file to its final name.
+    boost::filesystem::rename( temporaryFileName, cacheFileName );
+}
+
 } // namespace aerodynamics
 } // namespace tudat
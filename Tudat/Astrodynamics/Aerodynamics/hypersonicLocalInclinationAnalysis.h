@@ -23,6 +23,7 @@
 #include <vector>
 
 #include <boost/array.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/multi_array.hpp>
 #include <memory>
 
@@ -67,6 +68,10 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * panel inclination determination process, a geometry with outward surface-normals is assumed.
  * The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
+ * The coefficients at the different data points are computed in parallel. Optionally, the full set of coefficients is
+ * stored in (and on subsequent runs retrieved from) a binary cache file, the name of which is based on a hash of the
+ * vehicle panel geometry and all analysis settings, so that the (costly) analysis is only performed once for any given
+ * vehicle and settings.
  */
 class HypersonicLocalInclinationAnalysis: public AerodynamicCoefficientGenerator< 3, 6 >
 {
@@ -100,6 +105,11 @@ public:
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
      *  \param savePressureCoefficients Boolean denoting whether to save the pressure coefficients that are computed to files
+     *  \param numberOfThreads Number of threads over which the computation of the coefficients is distributed (default
+     *  1, i.e. serial computation; utilities::getDefaultNumberOfThreads( ) may be used to use all hardware threads).
+     *  \param coefficientCacheDirectory Directory in which the coefficients are cached (no caching if empty). If a cache
+     *  file for the current geometry and settings exists in this directory, the coefficients are loaded from it. If not,
+     *  the coefficients are computed and written to a new cache file in this directory.
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -111,7 +121,9 @@ public:
             const double referenceArea,
             const double referenceLength,
             const Eigen::Vector3d& momentReferencePoint,
-            const bool savePressureCoefficients = false );
+            const bool savePressureCoefficients = false,
+            const int numberOfThreads = 1,
+            const std::string& coefficientCacheDirectory = "" );
 
     //! Default destructor.
     /*!
@@ -131,16 +143,6 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
-    //! Determine inclination angles of panels on a given part.
-    /*!
-     * Determines panel inclinations for all panels on all parts for given attitude.
-     * Outward pointing surface-normals are assumed!
-     * \param angleOfAttack Angle of attack at which to determine inclination angles.
-     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
-     */
-    void determineInclinations( const double angleOfAttack,
-                                const double angleOfSideslip );
-
     //! Get the number of vehicle parts.
     /*!
      *  Returns the number of vehicle parts.
@@ -206,12 +208,40 @@ public:
         return paneSurfaceNormalList;
     }
 
+    //! Function to retrieve the panel pressure coefficients at a given data point
+    /*!
+     * Function to retrieve the panel pressure coefficients at a given data point (only available if the
+     * savePressureCoefficients input to the constructor was set to true).
+     * \param independentVariables Array of indices of independent variables of data point.
+     * \return Pressure coefficients at requested data point. Indices indicate part-line-point.
+     */
     std::vector< std::vector< std::vector< double > > > getPressureCoefficientList(
             const boost::array< int, 3 > independentVariables )
     {
         return pressureCoefficientList_.at( independentVariables );
     }
 
+    //! Function to retrieve the hash of the vehicle geometry and analysis settings.
+    /*!
+     * Function to retrieve the hash of the vehicle geometry and analysis settings, which is used to identify the
+     * coefficient cache file.
+     * \return Hash of the vehicle geometry and analysis settings.
+     */
+    boost::uint64_t getGeometryAndSettingsHash( )
+    {
+        return geometryAndSettingsHash_;
+    }
+
+    //! Function to retrieve whether the coefficients were loaded from a cache file.
+    /*!
+     * Function to retrieve whether the coefficients were loaded from a cache file.
+     * \return True if the coefficients were loaded from a cache file, false if they were computed.
+     */
+    bool areCoefficientsLoadedFromCache( )
+    {
+        return areCoefficientsLoadedFromCache_;
+    }
+
 
 private:
 
@@ -219,7 +249,8 @@ private:
     /*!
      * Generates aerodynamic database. Settings of geometry,
      * reference quantities, database point settings and analysis methods
-     * should have been set previously.
+     * should have been set previously. The panel inclinations are computed once for each combination of angle of attack
+     * and sideslip, after which the coefficients at all data points are computed in parallel.
      */
     void generateCoefficients( );
 
@@ -232,113 +263,137 @@ private:
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
-    /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
-     */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
-
-    //! Determine pressure coefficients on a given part.
+    //! Function to set the panel properties of all vehicle parts in contiguous matrices.
     /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
+     * Function to set the panel properties (surface normals, areas, and cross products of moment arms and surface
+     * normals) of all vehicle parts in contiguous matrices, so that the coefficients can be computed from the pressure
+     * coefficients by matrix-vector multiplications. Panels are ordered by line, then by point.
      */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
+    void setPanelProperties( );
 
-    //! Determine force coefficients of a part.
+    //! Function to compute the inclination angles of all panels for given attitude.
     /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
+     * Function to compute the inclination angles of all panels for given attitude.
+     * Outward pointing surface-normals are assumed!
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \return Panel inclination angles, with vector entry the part index.
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    std::vector< Eigen::VectorXd > computePanelInclinations(
+            const double angleOfAttack, const double angleOfSideslip ) const;
 
-    //! Determine moment coefficients of a part.
+    //! Function to compute the aerodynamic coefficients of the full vehicle from the panel inclinations.
     /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * Function to compute the aerodynamic coefficients of the full vehicle from the panel inclinations. This function
+     * does not modify the object, and may be called concurrently from different threads.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param panelInclinations Panel inclination angles, with vector entry the part index.
+     * \param panelPressureCoefficients Panel pressure coefficients, with vector entry the part index (returned by
+     * reference).
+     * \return Force and moment coefficients of vehicle.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector6d computeVehicleCoefficients(
+            const double machNumber,
+            const std::vector< Eigen::VectorXd >& panelInclinations,
+            std::vector< Eigen::VectorXd >& panelPressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of the panel pressure coefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param panelInclinations Panel inclination angles of part.
+     * \param panelPressureCoefficients Panel pressure coefficients of part (modified by function).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber, const int partNumber,
+                                     const Eigen::VectorXd& panelInclinations,
+                                     Eigen::VectorXd& panelPressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
-     * which inclination <= 0.
+     * Sets the values of the panel pressure coefficients on given part and at given Mach number for which
+     * inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param panelInclinations Panel inclination angles of part.
+     * \param panelPressureCoefficients Panel pressure coefficients of part (modified by function).
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& panelInclinations,
+                                   Eigen::VectorXd& panelPressureCoefficients ) const;
 
-    //! Array of vehicle parts.
+    //! Function to save the panel pressure coefficients at a given data point to pressureCoefficientList_
     /*!
-     * Array of vehicle parts.
+     * Function to save the panel pressure coefficients at a given data point to pressureCoefficientList_
+     * \param independentVariableIndices Array of indices of independent variables of data point.
+     * \param panelPressureCoefficients Panel pressure coefficients, with vector entry the part index.
      */
-    std::vector< std::shared_ptr< geometric_shapes::LawgsPartGeometry > > vehicleParts_;
+    void savePanelPressureCoefficients( const boost::array< int, 3 > independentVariableIndices,
+                                        const std::vector< Eigen::VectorXd >& panelPressureCoefficients );
 
-    //! Multi-array as which indicates which coefficients have been calculated already.
+    //! Function to compute the hash of the vehicle geometry and analysis settings.
     /*!
-     * Multi-array as which indicates which coefficients have been calculated already. Indices of
-     * entries coincide with indices of aerodynamicCoefficients_.
+     * Function to compute the hash (64-bit FNV-1a) of the vehicle panel geometry, data points of independent variables,
+     * selected methods and reference quantities.
+     * \return Hash of the vehicle geometry and analysis settings.
      */
-    boost::multi_array< bool, 3 > isCoefficientGenerated_;
+    boost::uint64_t computeGeometryAndSettingsHash( ) const;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Function to retrieve the name of the coefficient cache file for the current geometry and settings.
+    std::string getCoefficientCacheFileName( ) const;
+
+    //! Function to load the aerodynamic coefficients from the cache file, if it exists and is consistent.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Function to load the aerodynamic coefficients from the cache file, if it exists and is consistent with the current
+     * geometry and settings.
+     * \return True if the coefficients were loaded, false otherwise.
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    bool loadCoefficientsFromCache( );
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
+    //! Function to write the aerodynamic coefficients to the cache file.
     /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
+     * Function to write the aerodynamic coefficients to the cache file. The file is first written under a unique
+     * temporary name, and then renamed, so that concurrent runs can safely use the same cache directory.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-    previouslyComputedInclinations_;
+    void writeCoefficientsToCache( ) const;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Array of vehicle parts.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Array of vehicle parts.
      */
-     std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    std::vector< std::shared_ptr< geometric_shapes::LawgsPartGeometry > > vehicleParts_;
 
-     std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
+    //! Multi-array as which indicates which coefficients have been calculated already.
+    /*!
+     * Multi-array as which indicates which coefficients have been calculated already. Indices of
+     * entries coincide with indices of aerodynamicCoefficients_.
+     */
+    boost::multi_array< bool, 3 > isCoefficientGenerated_;
+
+    //! Panel surface normals of each part (one column per panel), with vector entry the part index.
+    std::vector< Eigen::Matrix3Xd > panelSurfaceNormals_;
+
+    //! Panel areas of each part, with vector entry the part index.
+    std::vector< Eigen::VectorXd > panelAreas_;
 
-    //! Stagnation pressure coefficient.
+    //! Cross products of panel moment arms (w.r.t. moment reference point) and surface normals of each part (one column
+    //! per panel), with vector entry the part index.
+    std::vector< Eigen::Matrix3Xd > panelMomentArmCrossSurfaceNormals_;
+
+    //! Panel pressure coefficients at each data point (only set if savePressureCoefficients_ is true).
     /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
+     * Panel pressure coefficients at each data point (only set if savePressureCoefficients_ is true), with map key the
+     * indices of the independent variables. Indices of map values indicate part-line-point.
      */
-    double stagnationPressureCoefficient;
+    std::map< boost::array< int, 3 >,  std::vector< std::vector< std::vector< double > > > > pressureCoefficientList_;
 
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-    \
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
@@ -346,7 +401,20 @@ private:
      */
     std::vector< std::vector< int > > selectedMethods_;
 
+    //! Boolean denoting whether to save the pressure coefficients that are computed.
     bool savePressureCoefficients_;
+
+    //! Number of threads over which the computation of the coefficients is distributed.
+    int numberOfThreads_;
+
+    //! Directory in which the coefficients are cached (no caching if empty).
+    std::string coefficientCacheDirectory_;
+
+    //! Hash of the vehicle geometry and analysis settings.
+    boost::uint64_t geometryAndSettingsHash_;
+
+    //! Boolean denoting whether the coefficients were loaded from a cache file.
+    bool areCoefficientsLoadedFromCache_;
 };
 
 
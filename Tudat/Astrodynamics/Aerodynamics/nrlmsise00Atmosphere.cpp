@@ -1,164 +1,384 @@
-/*    Copyright (c) 2010-2018, Delft University of Technology
- *    All rigths reserved
- *
- *    This file is part of the Tudat. Redistribution and use in source and
- *    binary forms, with or without modification, are permitted exclusively
- *    under the terms of the Modified BSD license. You should have received
- *    a copy of the license with this file. If not, please or visit:
- *    http://tudat.tudelft.nl/LICENSE.
- */
-
-#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
-#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
-
-
-//! Tudat library namespace.
-namespace tudat
-{
-namespace aerodynamics
-{
-
-void NRLMSISE00Atmosphere::computeProperties(
-        const double altitude, const double longitude,
-        const double latitude, const double time )
-{
-    // Compute the hash key
-    size_t hashKey = hashFunc( altitude, longitude, latitude, time );
-
-    // If hash key is same do nothing
-    if (hashKey == hashKey_)
-    {
-        return;
-    }
-    hashKey_ = hashKey;
-
-    // Retrieve input data.
-    inputData_ = nrlmsise00InputFunction_(
-                altitude, longitude, latitude, time );
-    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
-    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
-
-    input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
-    input_.alt    = altitude * 1.0E-3; // m to km
-    input_.year   = inputData_.year;
-    input_.doy    = inputData_.dayOfTheYear;
-    input_.sec    = inputData_.secondOfTheDay;
-    input_.lst    = inputData_.localSolarTime;
-    input_.f107   = inputData_.f107;
-    input_.f107A  = inputData_.f107a;
-    input_.ap     = inputData_.apDaily;
-    input_.ap_a   = &aph_;
-
-    // Call NRLMSISE00
-    gtd7(&input_, &flags_, &output_);
-
-    // Retrieve density and temperature
-    density_ = output_.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
-    temperature_ = output_.t[1];
-
-    // Get number densities
-    numberDensities_.resize(8);
-    numberDensities_[0] = output_.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
-    numberDensities_[1] = output_.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
-    numberDensities_[2] = output_.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
-    numberDensities_[3] = output_.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
-    numberDensities_[4] = output_.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
-    numberDensities_[5] = output_.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
-    numberDensities_[6] = output_.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
-    numberDensities_[7] = output_.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
-
-    // Get average number density
-    double sumOfNumberDensity = 0.0 ;
-    for( unsigned int i = 0 ; i < numberDensities_.size( ) ; i++)
-    {
-        sumOfNumberDensity += numberDensities_[ i ];
-    }
-    averageNumberDensity_ = sumOfNumberDensity / double( numberDensities_.size( ) );
-
-    // Mean molar mass (Thermodynamics an Engineering Approach, Michael A. Boles)
-    meanMolarMass_ = numberDensities_[0] * gasComponentProperties_.molarMassHelium;
-    meanMolarMass_ += numberDensities_[1] * gasComponentProperties_.molarMassAtomicOxygen;
-    meanMolarMass_ += numberDensities_[2] * gasComponentProperties_.molarMassNitrogen;
-    meanMolarMass_ += numberDensities_[3] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ += numberDensities_[4] * gasComponentProperties_.molarMassArgon;
-    meanMolarMass_ += numberDensities_[5] * gasComponentProperties_.molarMassAtomicHydrogen;
-    meanMolarMass_ += numberDensities_[6] * gasComponentProperties_.molarMassAtomicNitrogen;
-    meanMolarMass_ += numberDensities_[7] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ = meanMolarMass_ / sumOfNumberDensity ;
-
-    // Speed of sound
-    speedOfSound_ = aerodynamics::computeSpeedOfSound(
-                temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
-
-    // Collision diameter
-    weightedAverageCollisionDiameter_ = numberDensities_[0]* gasComponentProperties_.diameterHelium ;
-    weightedAverageCollisionDiameter_ += numberDensities_[1]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[2]* gasComponentProperties_.diameterNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[3]* gasComponentProperties_.diameterOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[4]* gasComponentProperties_.diameterArgon ;
-    weightedAverageCollisionDiameter_ += numberDensities_[5]* gasComponentProperties_.diameterAtomicHydrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[6]* gasComponentProperties_.diameterAtomicNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[7]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ = weightedAverageCollisionDiameter_ / sumOfNumberDensity;
-
-    // Mean free path.
-    meanFreePath_ = aerodynamics::computeMeanFreePath( weightedAverageCollisionDiameter_, averageNumberDensity_ );
-
-    // Calculate pressure using ideal gas law (Thermodynamics an Engineering Approach, Michael A. Boles)
-    if( useIdealGasLaw_ )
-    {
-        pressure_ = density_ * molarGasConstant_ * temperature_ / meanMolarMass_ ;
-    }
-    else
-    {
-        pressure_ = TUDAT_NAN;
-    }
-}
-
-//! Overloaded ostream to print class information.
-std::ostream& operator << ( std::ostream& stream,
-                            NRLMSISE00Input& nrlmsiseInput ){
-    stream << "This is a NRLMSISE Input data object." << std::endl;
-    stream << "The input data is stored as: " << std::endl;
-
-    stream << "Year              = " << nrlmsiseInput.year << std::endl;
-    stream << "Day of the year   = " << nrlmsiseInput.dayOfTheYear << std::endl;
-    stream << "Second of the day = " << nrlmsiseInput.secondOfTheDay << std::endl;
-    stream << "Local solar time  = " << nrlmsiseInput.localSolarTime << std::endl;
-    stream << "f107              = " << nrlmsiseInput.f107 << std::endl;
-    stream << "f107a             = " << nrlmsiseInput.f107a << std::endl;
-    stream << "apDaily           = " << nrlmsiseInput.apDaily << std::endl;
-
-    for( unsigned int i = 0 ; i < nrlmsiseInput.apVector.size( ) ; i++ )
-    {
-        stream << "apVector[ " << i << " ]     = " << nrlmsiseInput.apVector[i] << std::endl;
-    }
-
-    for( unsigned int i = 0 ; i < nrlmsiseInput.switches.size( ) ; i++ )
-    {
-        stream << "switches[ " << i << " ]     = " << nrlmsiseInput.switches[i] << std::endl;
-    }
-
-    return stream;
-}
-
-//! Get the full model output
-std::pair< std::vector< double >, std::vector< double > >
-NRLMSISE00Atmosphere::getFullOutput( const double altitude, const double longitude,
-                                     const double latitude, const double time )
-{
-    // Compute the properties
-    computeProperties( altitude, longitude, latitude, time );
-    std::pair< std::vector< double >, std::vector< double >> output;
-
-    // Copy array members of struct to vectors on the pair.
-    output.first = std::vector< double >(
-                output_.d, output_.d + sizeof output_.d / sizeof output_.d[ 0 ] );
-    output.second = std::vector< double >(
-                output_.t, output_.t + sizeof output_.t / sizeof output_.t[ 0 ] );
-    return output;
-}
-
-}  // namespace aerodynamics
-}  // namespace tudat
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <limits>
+
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+
+//! Tudat library namespace.
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Compute the local atmospheric properties.
+void NRLMSISE00Atmosphere::computeProperties(
+        const double altitude, const double longitude,
+        const double latitude, const double time )
+{
+    // Compute the hash key
+    size_t hashKey = hashFunc( altitude, longitude, latitude, time );
+
+    // If hash key is same do nothing
+    if (hashKey == hashKey_)
+    {
+        return;
+    }
+    hashKey_ = hashKey;
+
+    // Interpolate model output if requested, and evaluate directly otherwise.
+    if( interpolationSettings_ == nullptr ||
+            !interpolateModelOutput( altitude, longitude, latitude, time ) )
+    {
+        evaluateModel( altitude, longitude, latitude, time );
+    }
+
+    computeDerivedProperties( );
+}
+
+//! Evaluate the NRLMSISE00 model directly, setting the input_ and output_ members.
+void NRLMSISE00Atmosphere::evaluateModel(
+        const double altitude, const double longitude,
+        const double latitude, const double time )
+{
+    // Retrieve input data.
+    inputData_ = nrlmsise00InputFunction_(
+                altitude, longitude, latitude, time );
+    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
+    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
+
+    input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
+    input_.alt    = altitude * 1.0E-3; // m to km
+    input_.year   = inputData_.year;
+    input_.doy    = inputData_.dayOfTheYear;
+    input_.sec    = inputData_.secondOfTheDay;
+    input_.lst    = inputData_.localSolarTime;
+    input_.f107   = inputData_.f107;
+    input_.f107A  = inputData_.f107a;
+    input_.ap     = inputData_.apDaily;
+    input_.ap_a   = &aph_;
+
+    // Call NRLMSISE00
+    gtd7(&input_, &flags_, &output_);
+    numberOfModelEvaluations_++;
+}
+
+//! Compute the derived atmospheric properties (density, pressure, etc.) from the output_ member.
+void NRLMSISE00Atmosphere::computeDerivedProperties( )
+{
+    // Retrieve density and temperature
+    density_ = output_.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
+    temperature_ = output_.t[1];
+
+    // Get number densities
+    numberDensities_.resize(8);
+    numberDensities_[0] = output_.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
+    numberDensities_[1] = output_.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
+    numberDensities_[2] = output_.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
+    numberDensities_[3] = output_.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
+    numberDensities_[4] = output_.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
+    numberDensities_[5] = output_.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
+    numberDensities_[6] = output_.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
+    numberDensities_[7] = output_.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
+
+    // Get average number density
+    double sumOfNumberDensity = 0.0 ;
+    for( unsigned int i = 0 ; i < numberDensities_.size( ) ; i++)
+    {
+        sumOfNumberDensity += numberDensities_[ i ];
+    }
+    averageNumberDensity_ = sumOfNumberDensity / double( numberDensities_.size( ) );
+
+    // Mean molar mass (Thermodynamics an Engineering Approach, Michael A. Boles)
+    meanMolarMass_ = numberDensities_[0] * gasComponentProperties_.molarMassHelium;
+    meanMolarMass_ += numberDensities_[1] * gasComponentProperties_.molarMassAtomicOxygen;
+    meanMolarMass_ += numberDensities_[2] * gasComponentProperties_.molarMassNitrogen;
+    meanMolarMass_ += numberDensities_[3] * gasComponentProperties_.molarMassOxygen;
+    meanMolarMass_ += numberDensities_[4] * gasComponentProperties_.molarMassArgon;
+    meanMolarMass_ += numberDensities_[5] * gasComponentProperties_.molarMassAtomicHydrogen;
+    meanMolarMass_ += numberDensities_[6] * gasComponentProperties_.molarMassAtomicNitrogen;
+    meanMolarMass_ += numberDensities_[7] * gasComponentProperties_.molarMassOxygen;
+    meanMolarMass_ = meanMolarMass_ / sumOfNumberDensity ;
+
+    // Speed of sound
+    speedOfSound_ = aerodynamics::computeSpeedOfSound(
+                temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
+
+    // Collision diameter
+    weightedAverageCollisionDiameter_ = numberDensities_[0]* gasComponentProperties_.diameterHelium ;
+    weightedAverageCollisionDiameter_ += numberDensities_[1]* gasComponentProperties_.diameterAtomicOxygen ;
+    weightedAverageCollisionDiameter_ += numberDensities_[2]* gasComponentProperties_.diameterNitrogen ;
+    weightedAverageCollisionDiameter_ += numberDensities_[3]* gasComponentProperties_.diameterOxygen ;
+    weightedAverageCollisionDiameter_ += numberDensities_[4]* gasComponentProperties_.diameterArgon ;
+    weightedAverageCollisionDiameter_ += numberDensities_[5]* gasComponentProperties_.diameterAtomicHydrogen ;
+    weightedAverageCollisionDiameter_ += numberDensities_[6]* gasComponentProperties_.diameterAtomicNitrogen ;
+    weightedAverageCollisionDiameter_ += numberDensities_[7]* gasComponentProperties_.diameterAtomicOxygen ;
+    weightedAverageCollisionDiameter_ = weightedAverageCollisionDiameter_ / sumOfNumberDensity;
+
+    // Mean free path.
+    meanFreePath_ = aerodynamics::computeMeanFreePath( weightedAverageCollisionDiameter_, averageNumberDensity_ );
+
+    // Calculate pressure using ideal gas law (Thermodynamics an Engineering Approach, Michael A. Boles)
+    if( useIdealGasLaw_ )
+    {
+        pressure_ = density_ * molarGasConstant_ * temperature_ / meanMolarMass_ ;
+    }
+    else
+    {
+        pressure_ = TUDAT_NAN;
+    }
+}
+
+//! Overloaded ostream to print class information.
+std::ostream& operator << ( std::ostream& stream,
+                            NRLMSISE00Input& nrlmsiseInput ){
+    stream << "This is a NRLMSISE Input data object." << std::endl;
+    stream << "The input data is stored as: " << std::endl;
+
+    stream << "Year              = " << nrlmsiseInput.year << std::endl;
+    stream << "Day of the year   = " << nrlmsiseInput.dayOfTheYear << std::endl;
+    stream << "Second of the day = " << nrlmsiseInput.secondOfTheDay << std::endl;
+    stream << "Local solar time  = " << nrlmsiseInput.localSolarTime << std::endl;
+    stream << "f107              = " << nrlmsiseInput.f107 << std::endl;
+    stream << "f107a             = " << nrlmsiseInput.f107a << std::endl;
+    stream << "apDaily           = " << nrlmsiseInput.apDaily << std::endl;
+
+    for( unsigned int i = 0 ; i < nrlmsiseInput.apVector.size( ) ; i++ )
+    {
+        stream << "apVector[ " << i << " ]     = " << nrlmsiseInput.apVector[i] << std::endl;
+    }
+
+    for( unsigned int i = 0 ; i < nrlmsiseInput.switches.size( ) ; i++ )
+    {
+        stream << "switches[ " << i << " ]     = " << nrlmsiseInput.switches[i] << std::endl;
+    }
+
+    return stream;
+}
+
+//! Get the full model output
+std::pair< std::vector< double >, std::vector< double > >
+NRLMSISE00Atmosphere::getFullOutput( const double altitude, const double longitude,
+                                     const double latitude, const double time )
+{
+    // Compute the properties
+    computeProperties( altitude, longitude, latitude, time );
+    std::pair< std::vector< double >, std::vector< double >> output;
+
+    // Copy array members of struct to vectors on the pair.
+    output.first = std::vector< double >(
+                output_.d, output_.d + sizeof output_.d / sizeof output_.d[ 0 ] );
+    output.second = std::vector< double >(
+                output_.t, output_.t + sizeof output_.t / sizeof output_.t[ 0 ] );
+    return output;
+}
+
+//! Function to set the settings for interpolation of the model output
+void NRLMSISE00Atmosphere::setInterpolationSettings(
+        const std::shared_ptr< NRLMSISE00InterpolationSettings > interpolationSettings )
+{
+    interpolationSettings_ = interpolationSettings;
+    if( interpolationSettings_ != nullptr )
+    {
+        numberOfLocalSolarTimeNodes_ = static_cast< int >( std::round( 24.0 / interpolationSettings_->localSolarTimeStep ) );
+        if( std::fabs( numberOfLocalSolarTimeNodes_ * interpolationSettings_->localSolarTimeStep - 24.0 ) >
+                std::numeric_limits< double >::epsilon( ) * 240.0 )
+        {
+            throw std::runtime_error(
+                        "Error when setting NRLMSISE00 interpolation, 24 hours is not a multiple of the local solar time step" );
+        }
+    }
+    clearInterpolationCache( );
+}
+
+//! Function to retrieve the (cached) model output at a grid node, evaluating the model if it is not yet cached.
+const NRLMSISE00Atmosphere::InterpolationNodeValues& NRLMSISE00Atmosphere::getInterpolationNodeValues(
+        const InterpolationGridIndex& nodeIndex )
+{
+    std::unordered_map< InterpolationGridIndex, InterpolationNodeValues, InterpolationGridIndexHash >::const_iterator
+            nodeIterator = interpolationNodes_.find( nodeIndex );
+    if( nodeIterator != interpolationNodes_.end( ) )
+    {
+        return nodeIterator->second;
+    }
+
+    // Determine physical coordinates of node
+    double nodeAltitude = static_cast< double >( nodeIndex[ 0 ] ) * interpolationSettings_->altitudeStep;
+    double nodeLatitude = std::max( -mathematical_constants::PI / 2.0, std::min(
+                                        mathematical_constants::PI / 2.0,
+                                        static_cast< double >( nodeIndex[ 1 ] ) * interpolationSettings_->latitudeStep ) );
+    double nodeTime = static_cast< double >( nodeIndex[ 3 ] ) * interpolationSettings_->timeStep;
+
+    // Determine longitude at which local solar time of node is reached.
+    double nodeLocalSolarTime = static_cast< double >( nodeIndex[ 2 ] ) * interpolationSettings_->localSolarTimeStep;
+    double secondOfTheDay = std::fmod( nodeTime + physical_constants::JULIAN_DAY / 2.0, physical_constants::JULIAN_DAY );
+    double nodeLongitude = ( nodeLocalSolarTime - secondOfTheDay / 3600.0 ) * mathematical_constants::PI / 12.0;
+    nodeLongitude = std::fmod( nodeLongitude + 3.0 * mathematical_constants::PI, 2.0 * mathematical_constants::PI ) -
+            mathematical_constants::PI;
+
+    evaluateModel( nodeAltitude, nodeLongitude, nodeLatitude, nodeTime );
+
+    // Store logarithms of densities (zero densities mapped to very small values) and temperatures.
+    InterpolationNodeValues nodeValues;
+    for( unsigned int i = 0; i < 9; i++ )
+    {
+        nodeValues[ i ] = std::log( std::max( output_.d[ i ], std::numeric_limits< double >::min( ) ) );
+    }
+    nodeValues[ 9 ] = output_.t[ 0 ];
+    nodeValues[ 10 ] = output_.t[ 1 ];
+
+    if( interpolationNodes_.size( ) >= interpolationSettings_->maximumNumberOfCachedNodes )
+    {
+        interpolationNodes_.clear( );
+        interpolationCellValidity_.clear( );
+    }
+    return interpolationNodes_[ nodeIndex ] = nodeValues;
+}
+
+//! Function to interpolate the model output in the grid, returning the 11 values in log-density/temperature form.
+NRLMSISE00Atmosphere::InterpolationNodeValues NRLMSISE00Atmosphere::interpolateInCell(
+        const InterpolationGridIndex& cellIndex,
+        const boost::array< double, 4 >& cellFractions )
+{
+    InterpolationNodeValues interpolatedValues;
+    interpolatedValues.fill( 0.0 );
+
+    // Iterate over all 16 corners of the grid cell
+    InterpolationGridIndex nodeIndex;
+    double nodeWeight;
+    for( unsigned int corner = 0; corner < 16; corner++ )
+    {
+        nodeWeight = 1.0;
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            int offset = ( corner >> j ) & 1;
+            nodeIndex[ j ] = cellIndex[ j ] + offset;
+            nodeWeight *= ( offset == 1 ) ? cellFractions[ j ] : ( 1.0 - cellFractions[ j ] );
+        }
+        nodeIndex[ 2 ] = nodeIndex[ 2 ] % numberOfLocalSolarTimeNodes_;
+
+        if( nodeWeight != 0.0 )
+        {
+            const InterpolationNodeValues& nodeValues = getInterpolationNodeValues( nodeIndex );
+            for( unsigned int i = 0; i < 11; i++ )
+            {
+                interpolatedValues[ i ] += nodeWeight * nodeValues[ i ];
+            }
+        }
+    }
+    return interpolatedValues;
+}
+
+//! Function to set the output_ member by interpolation, if the current grid cell is valid
+bool NRLMSISE00Atmosphere::interpolateModelOutput(
+        const double altitude, const double longitude,
+        const double latitude, const double time )
+{
+    // Compute local solar time in hours, in range [0,24)
+    double secondOfTheDay = std::fmod( time + physical_constants::JULIAN_DAY / 2.0, physical_constants::JULIAN_DAY );
+    if( secondOfTheDay < 0.0 )
+    {
+        secondOfTheDay += physical_constants::JULIAN_DAY;
+    }
+    double localSolarTime = std::fmod( secondOfTheDay / 3600.0 + longitude * 12.0 / mathematical_constants::PI, 24.0 );
+    if( localSolarTime < 0.0 )
+    {
+        localSolarTime += 24.0;
+    }
+
+    // Determine grid cell, and position in grid cell.
+    boost::array< double, 4 > scaledCoordinates =
+    {{ altitude / interpolationSettings_->altitudeStep, latitude / interpolationSettings_->latitudeStep,
+       localSolarTime / interpolationSettings_->localSolarTimeStep, time / interpolationSettings_->timeStep }};
+    InterpolationGridIndex cellIndex;
+    boost::array< double, 4 > cellFractions;
+    for( unsigned int j = 0; j < 4; j++ )
+    {
+        double lowerNode = std::floor( scaledCoordinates[ j ] );
+        cellIndex[ j ] = static_cast< int >( lowerNode );
+        cellFractions[ j ] = scaledCoordinates[ j ] - lowerNode;
+    }
+    cellIndex[ 2 ] = cellIndex[ 2 ] % numberOfLocalSolarTimeNodes_;
+
+    // Validate grid cell, if not yet done, by comparing interpolated and direct density at the cell center, and at the
+    // midpoints of the cell edges through its lowest and highest corner (the corners themselves are grid nodes, at which
+    // the interpolation is exact).
+    std::unordered_map< InterpolationGridIndex, bool, InterpolationGridIndexHash >::const_iterator cellIterator =
+            interpolationCellValidity_.find( cellIndex );
+    bool isCellValid;
+    if( cellIterator == interpolationCellValidity_.end( ) )
+    {
+        std::vector< boost::array< double, 4 > > validationPoints;
+        validationPoints.push_back( {{ 0.5, 0.5, 0.5, 0.5 }} );
+        for( unsigned int j = 0; j < 4; j++ )
+        {
+            for( unsigned int corner = 0; corner < 2; corner++ )
+            {
+                boost::array< double, 4 > edgeMidpoint;
+                edgeMidpoint.fill( static_cast< double >( corner ) );
+                edgeMidpoint[ j ] = 0.5;
+                validationPoints.push_back( edgeMidpoint );
+            }
+        }
+
+        isCellValid = true;
+        for( unsigned int i = 0; i < validationPoints.size( ) && isCellValid; i++ )
+        {
+            double interpolatedDensity = std::exp( interpolateInCell( cellIndex, validationPoints.at( i ) )[ 5 ] );
+
+            double pointLatitude = ( static_cast< double >( cellIndex[ 1 ] ) + validationPoints.at( i )[ 1 ] ) *
+                    interpolationSettings_->latitudeStep;
+            pointLatitude = std::max( -mathematical_constants::PI / 2.0,
+                                      std::min( mathematical_constants::PI / 2.0, pointLatitude ) );
+            double pointLocalSolarTime = ( static_cast< double >( cellIndex[ 2 ] ) + validationPoints.at( i )[ 2 ] ) *
+                    interpolationSettings_->localSolarTimeStep;
+            double pointTime = ( static_cast< double >( cellIndex[ 3 ] ) + validationPoints.at( i )[ 3 ] ) *
+                    interpolationSettings_->timeStep;
+            double pointSecondOfTheDay =
+                    std::fmod( pointTime + physical_constants::JULIAN_DAY / 2.0, physical_constants::JULIAN_DAY );
+            evaluateModel( ( static_cast< double >( cellIndex[ 0 ] ) + validationPoints.at( i )[ 0 ] ) *
+                           interpolationSettings_->altitudeStep,
+                           ( pointLocalSolarTime - pointSecondOfTheDay / 3600.0 ) * mathematical_constants::PI / 12.0,
+                           pointLatitude, pointTime );
+
+            isCellValid = ( std::fabs( interpolatedDensity - output_.d[ 5 ] ) <=
+                            interpolationSettings_->relativeDensityTolerance * std::fabs( output_.d[ 5 ] ) );
+        }
+        interpolationCellValidity_[ cellIndex ] = isCellValid;
+    }
+    else
+    {
+        isCellValid = cellIterator->second;
+    }
+
+    if( !isCellValid )
+    {
+        return false;
+    }
+
+    // Set model output from interpolated values
+    InterpolationNodeValues interpolatedValues = interpolateInCell( cellIndex, cellFractions );
+    for( unsigned int i = 0; i < 9; i++ )
+    {
+        output_.d[ i ] = std::exp( interpolatedValues[ i ] );
+    }
+    output_.t[ 0 ] = interpolatedValues[ 9 ];
+    output_.t[ 1 ] = interpolatedValues[ 10 ];
+
+    numberOfInterpolatedEvaluations_++;
+    return true;
+}
+
+}  // namespace aerodynamics
+}  // namespace tudat
@@ -17,6 +17,10 @@
 #include <algorithm>
 
 #include <functional>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <boost/array.hpp>
 #include <boost/functional/hash.hpp>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
@@ -169,6 +173,67 @@ struct NRLMSISE00Input
     std::vector< int > switches;
 };
 
+//! Settings for the (optional) interpolation of the NRLMSISE-00 model output.
+/*!
+ *  Settings for the (optional) interpolation of the NRLMSISE-00 model output. When used, the model output is
+ *  interpolated from a lazily generated 4-dimensional grid in altitude, latitude, local solar time and time, on which the full
+ *  model is evaluated only once per grid node. The logarithms of the densities are interpolated linearly, as are the
+ *  temperatures. Each grid cell is validated upon first use, by comparing the interpolated total mass density at the
+ *  center of the cell, and at the midpoints of the cell edges through its lowest and highest corner, with the directly
+ *  evaluated model. If the relative difference exceeds the tolerance at any of these points, the model is evaluated
+ *  directly for all queries inside that cell.
+ */
+struct NRLMSISE00InterpolationSettings
+{
+    //! Constructor
+    /*!
+     * Constructor, throws an exception if any of the grid spacings is not positive.
+     * \param altitudeStep Grid spacing in altitude [m]
+     * \param latitudeStep Grid spacing in latitude [rad]
+     * \param localSolarTimeStep Grid spacing in local solar time [hours]; 24 must be an integer multiple of this value.
+     * \param timeStep Grid spacing in time [s]
+     * \param relativeDensityTolerance Maximum relative error of the total mass density at the validation points of a
+     * grid cell (center and edge midpoints), for which interpolation is used in that cell.
+     * \param maximumNumberOfCachedNodes Maximum number of grid nodes that is kept in memory. When exceeded, the full
+     * cache is cleared.
+     */
+    NRLMSISE00InterpolationSettings(
+            const double altitudeStep = 5.0E3,
+            const double latitudeStep = 2.5 * mathematical_constants::PI / 180.0,
+            const double localSolarTimeStep = 0.5,
+            const double timeStep = 3.0 * 3600.0,
+            const double relativeDensityTolerance = 1.0E-2,
+            const unsigned int maximumNumberOfCachedNodes = 1000000 ):
+        altitudeStep( altitudeStep ), latitudeStep( latitudeStep ), localSolarTimeStep( localSolarTimeStep ),
+        timeStep( timeStep ), relativeDensityTolerance( relativeDensityTolerance ),
+        maximumNumberOfCachedNodes( maximumNumberOfCachedNodes )
+    {
+        if( !( altitudeStep > 0.0 ) || !( latitudeStep > 0.0 ) || !( localSolarTimeStep > 0.0 ) || !( timeStep > 0.0 ) )
+        {
+            throw std::runtime_error(
+                        "Error when creating NRLMSISE00 interpolation settings, grid spacings must be positive." );
+        }
+    }
+
+    //! Grid spacing in altitude [m]
+    double altitudeStep;
+
+    //! Grid spacing in latitude [rad]
+    double latitudeStep;
+
+    //! Grid spacing in local solar time [hours]
+    double localSolarTimeStep;
+
+    //! Grid spacing in time [s]
+    double timeStep;
+
+    //! Maximum relative error of the total mass density at the validation points of a grid cell
+    double relativeDensityTolerance;
+
+    //! Maximum number of grid nodes that is kept in memory
+    unsigned int maximumNumberOfCachedNodes;
+};
+
 //! NRLMSISE-00 atmosphere model class.
 /*!
  *  NRLMSISE-00 atmosphere model class. This class uses the NRLMSISE00 atmosphere model to calculate atmospheric
@@ -197,7 +262,8 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
      */
     NRLMSISE00Atmosphere( const NRLMSISE00InputFunction nrlmsise00InputFunction,
                          const bool useIdealGasLaw = true )
-        :nrlmsise00InputFunction_(nrlmsise00InputFunction)
+        :nrlmsise00InputFunction_(nrlmsise00InputFunction), numberOfLocalSolarTimeNodes_( 0 ),
+          numberOfModelEvaluations_( 0 ), numberOfInterpolatedEvaluations_( 0 )
     {
         resetHashKey( );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
@@ -220,7 +286,8 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const double specificHeatRatio,
                          const GasComponentProperties gasProperties,
                          const bool useIdealGasLaw = true)
-        : nrlmsise00InputFunction_(nrlmsise00InputFunction)
+        : nrlmsise00InputFunction_(nrlmsise00InputFunction), numberOfLocalSolarTimeNodes_( 0 ),
+          numberOfModelEvaluations_( 0 ), numberOfInterpolatedEvaluations_( 0 )
     {
         resetHashKey( );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
@@ -420,7 +487,8 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
 
     //! Function to get  Input data to NRLMSISE00 atmosphere model
     /*!
-     *  Function to get input data to NRLMSISE00 atmosphere model
+     *  Function to get input data to NRLMSISE00 atmosphere model. If the model output is interpolated, this is the input
+     *  of the last direct evaluation of the model.
      *  \return Input data to NRLMSISE00 atmosphere model
      */
     NRLMSISE00Input getNRLMSISE00Input( )
@@ -428,8 +496,61 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         return inputData_;
     }
 
+    //! Function to set the settings for interpolation of the model output
+    /*!
+     *  Function to set the settings for interpolation of the model output (see NRLMSISE00InterpolationSettings). Resets
+     *  all cached data.
+     *  \param interpolationSettings Settings for interpolation of the model output (nullptr to evaluate model directly)
+     */
+    void setInterpolationSettings( const std::shared_ptr< NRLMSISE00InterpolationSettings > interpolationSettings );
+
+    //! Function to retrieve the settings for interpolation of the model output
+    /*!
+     *  Function to retrieve the settings for interpolation of the model output
+     *  \return Settings for interpolation of the model output (nullptr if model is evaluated directly)
+     */
+    std::shared_ptr< NRLMSISE00InterpolationSettings > getInterpolationSettings( )
+    {
+        return interpolationSettings_;
+    }
+
+    //! Function to clear all cached interpolation grid nodes and cell validations
+    void clearInterpolationCache( )
+    {
+        interpolationNodes_.clear( );
+        interpolationCellValidity_.clear( );
+        resetHashKey( );
+    }
+
+    //! Function to retrieve the number of direct evaluations of the NRLMSISE-00 model (gtd7 calls)
+    unsigned int getNumberOfModelEvaluations( )
+    {
+        return numberOfModelEvaluations_;
+    }
+
+    //! Function to retrieve the number of evaluations for which the model output was interpolated
+    unsigned int getNumberOfInterpolatedEvaluations( )
+    {
+        return numberOfInterpolatedEvaluations_;
+    }
+
  private:
 
+    //! Typedef for index of grid node, or grid cell, (altitude, latitude, local solar time and time) for interpolation
+    typedef boost::array< int, 4 > InterpolationGridIndex;
+
+    //! Typedef for model output at grid node (logarithms of 9 densities, 2 temperatures)
+    typedef boost::array< double, 11 > InterpolationNodeValues;
+
+    //! Hash function for index of interpolation grid node/cell.
+    struct InterpolationGridIndexHash
+    {
+        size_t operator( )( const InterpolationGridIndex& index ) const
+        {
+            return boost::hash_range( index.begin( ), index.end( ) );
+        }
+    };
+
     //! Shared pointer to solar activity function
     NRLMSISE00InputFunction nrlmsise00InputFunction_;
 
@@ -587,8 +708,71 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void computeProperties( const double altitude, const double longitude,
                             const double latitude, const double time );
 
+    //! Evaluate the NRLMSISE00 model directly, setting the input_ and output_ members.
+    /*!
+     * Evaluate the NRLMSISE00 model directly, setting the input_ and output_ members.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     */
+    void evaluateModel( const double altitude, const double longitude,
+                        const double latitude, const double time );
+
+    //! Compute the derived atmospheric properties (density, pressure, etc.) from the output_ member.
+    void computeDerivedProperties( );
+
+    //! Function to retrieve the (cached) model output at a grid node, evaluating the model if it is not yet cached.
+    /*!
+     * Function to retrieve the (cached) model output at a grid node, evaluating the model if it is not yet cached.
+     * \param nodeIndex Index of grid node (altitude, latitude, local solar time and time).
+     * \return Model output at grid node (logarithms of 9 densities, 2 temperatures).
+     */
+    const InterpolationNodeValues& getInterpolationNodeValues( const InterpolationGridIndex& nodeIndex );
+
+    //! Function to interpolate the model output in the grid, returning the 11 values in log-density/temperature form.
+    /*!
+     * Function to interpolate the model output in the grid, returning the 11 values in log-density/temperature form.
+     * \param cellIndex Index of grid cell in which interpolation is to be performed.
+     * \param cellFractions Fractional position in grid cell (each entry in [0,1)).
+     * \return Interpolated model output at requested point (logarithms of 9 densities, 2 temperatures).
+     */
+    InterpolationNodeValues interpolateInCell( const InterpolationGridIndex& cellIndex,
+                                               const boost::array< double, 4 >& cellFractions );
+
+    //! Function to set the output_ member by interpolation, if the current grid cell is valid
+    /*!
+     * Function to set the output_ member by interpolation, if the current grid cell is valid (validating the cell if
+     * this was not yet done).
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     * \return True if output_ was set by interpolation, false if the model should be evaluated directly.
+     */
+    bool interpolateModelOutput( const double altitude, const double longitude,
+                                 const double latitude, const double time );
+
     //! Input data to NRLMSISE00 atmosphere model
     NRLMSISE00Input inputData_;
+
+    //! Settings for interpolation of the model output (nullptr if model is evaluated directly)
+    std::shared_ptr< NRLMSISE00InterpolationSettings > interpolationSettings_;
+
+    //! Number of local solar time grid nodes in a day.
+    int numberOfLocalSolarTimeNodes_;
+
+    //! Cached model output at interpolation grid nodes.
+    std::unordered_map< InterpolationGridIndex, InterpolationNodeValues, InterpolationGridIndexHash > interpolationNodes_;
+
+    //! List of interpolation grid cells for which validation was performed (value true if interpolation may be used)
+    std::unordered_map< InterpolationGridIndex, bool, InterpolationGridIndexHash > interpolationCellValidity_;
+
+    //! Number of direct evaluations of the NRLMSISE-00 model
+    unsigned int numberOfModelEvaluations_;
+
+    //! Number of evaluations for which the model output was interpolated
+    unsigned int numberOfInterpolatedEvaluations_;
 };
 
 }  // namespace aerodynamics
@@ -253,41 +253,110 @@ void TabulatedAtmosphere::createMultiDimensionalAtmosphereInterpolators( )
     // Assign independent variables
     independentVariablesData_ = tabulatedAtmosphereData.second;
 
-    // Create interpolators for density, pressure and temperature
-    interpolatorForDensity_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 0 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 0 ) ) );
-    interpolatorForPressure_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 1 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 1 ) ) );
-    interpolatorForTemperature_ =
-            std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 2 ) ),
-                huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 2 ) ) );
-
-    // Create remaining interpolators, if requested by user
-    if ( dependentVariablesDependency_.at( 3 ) )
+    // Collect all dependent variables (ordered as in AtmosphereDependentVariables) and their default values at each node
+    boost::multi_array< Eigen::Vector6d, static_cast< size_t >( NumberOfIndependentVariables ) > dependentVariablesData;
+    dependentVariablesData.resize( reinterpret_cast< boost::array< size_t, NumberOfIndependentVariables > const& >(
+                                       *tabulatedAtmosphereData.first.at( 0 ).shape( ) ) );
+    std::vector< std::pair< Eigen::Vector6d, Eigen::Vector6d > > defaultExtrapolationValues(
+                NumberOfIndependentVariables, std::make_pair( Eigen::Vector6d::Zero( ), Eigen::Vector6d::Zero( ) ) );
+    for ( unsigned int i = 0; i < dependentVariablesData.num_elements( ); i++ )
     {
-        interpolatorForGasConstant_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 3 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 3 ) ) );
+        Eigen::Vector6d currentDependentVariables = Eigen::Vector6d::Zero( );
+        for ( unsigned int j = 0; j < dependentVariablesDependency_.size( ); j++ )
+        {
+            if ( dependentVariablesDependency_.at( j ) )
+            {
+                currentDependentVariables( j ) =
+                        *( tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( j ) ).data( ) + i );
+            }
+        }
+        *( dependentVariablesData.data( ) + i ) = currentDependentVariables;
     }
-    if ( dependentVariablesDependency_.at( 4 ) )
+    for ( unsigned int j = 0; j < dependentVariablesDependency_.size( ); j++ )
     {
-        interpolatorForSpecificHeatRatio_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 4 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 4 ) ) );
+        if ( dependentVariablesDependency_.at( j ) )
+        {
+            for ( unsigned int k = 0; k < NumberOfIndependentVariables; k++ )
+            {
+                defaultExtrapolationValues.at( k ).first( j ) =
+                        defaultExtrapolationValue_.at( dependentVariableIndices_.at( j ) ).at( k ).first;
+                defaultExtrapolationValues.at( k ).second( j ) =
+                        defaultExtrapolationValue_.at( dependentVariableIndices_.at( j ) ).at( k ).second;
+            }
+        }
     }
-    if ( dependentVariablesDependency_.at( 5 ) )
+
+    // Create single interpolator for all dependent variables
+    interpolatorForAllDependentVariables_ =
+            std::make_shared< MultiLinearVectorInterpolator< NumberOfIndependentVariables, 6 > >(
+                independentVariablesData_, dependentVariablesData, huntingAlgorithm, boundaryHandling_,
+                defaultExtrapolationValues );
+    independentVariablesOfLastInterpolation_.clear( );
+}
+
+//! Function to set the values of the independent variables of the table, from the full list of atmosphere inputs.
+void TabulatedAtmosphere::setCurrentIndependentVariables( const double altitude, const double longitude,
+                                                          const double latitude, const double time )
+{
+    currentIndependentVariables_.resize( numberOfIndependentVariables_ );
+    for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
     {
-        interpolatorForMolarMass_ =
-                std::make_shared< MultiLinearInterpolator< double, double, NumberOfIndependentVariables > >(
-                    independentVariablesData_, tabulatedAtmosphereData.first.at( dependentVariableIndices_.at( 5 ) ),
-                    huntingAlgorithm, boundaryHandling_, defaultExtrapolationValue_.at( dependentVariableIndices_.at( 5 ) ) );
+        switch ( independentVariables_.at( i ) )
+        {
+        case altitude_dependent_atmosphere:
+            currentIndependentVariables_[ i ] = altitude;
+            break;
+        case longitude_dependent_atmosphere:
+            currentIndependentVariables_[ i ] = longitude;
+            break;
+        case latitude_dependent_atmosphere:
+            currentIndependentVariables_[ i ] = latitude;
+            break;
+        case time_dependent_atmosphere:
+            currentIndependentVariables_[ i ] = time;
+            break;
+        }
+    }
+}
+
+//! Function to retrieve a single dependent variable of the atmosphere at the specified conditions.
+double TabulatedAtmosphere::getDependentVariable( const AtmosphereDependentVariables dependentVariable,
+                                                  const double altitude, const double longitude,
+                                                  const double latitude, const double time )
+{
+    setCurrentIndependentVariables( altitude, longitude, latitude, time );
+
+    if ( numberOfIndependentVariables_ == 1 )
+    {
+        switch ( dependentVariable )
+        {
+        case density_dependent_atmosphere:
+            return interpolatorForDensity_->interpolate( currentIndependentVariables_ );
+        case pressure_dependent_atmosphere:
+            return interpolatorForPressure_->interpolate( currentIndependentVariables_ );
+        case temperature_dependent_atmosphere:
+            return interpolatorForTemperature_->interpolate( currentIndependentVariables_ );
+        case gas_constant_dependent_atmosphere:
+            return interpolatorForGasConstant_->interpolate( currentIndependentVariables_ );
+        case specific_heat_ratio_dependent_atmosphere:
+            return interpolatorForSpecificHeatRatio_->interpolate( currentIndependentVariables_ );
+        case molar_mass_dependent_atmosphere:
+            return interpolatorForMolarMass_->interpolate( currentIndependentVariables_ );
+        default:
+            throw std::runtime_error( "Error in tabulated atmosphere, dependent variable " +
+                                      std::to_string( dependentVariable ) + " not recognized." );
+        }
+    }
+    else
+    {
+        // Interpolate all dependent variables at once, if not yet done at current conditions
+        if ( currentIndependentVariables_ != independentVariablesOfLastInterpolation_ )
+        {
+            dependentVariablesOfLastInterpolation_ =
+                    interpolatorForAllDependentVariables_->interpolate( currentIndependentVariables_ );
+            independentVariablesOfLastInterpolation_ = currentIndependentVariables_;
+        }
+        return dependentVariablesOfLastInterpolation_( dependentVariable );
     }
 }
 
@@ -30,7 +30,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
-#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearVectorInterpolator.h"
 #include "Tudat/InputOutput/tabulatedAtmosphereReader.h"
 
 namespace tudat
@@ -217,29 +217,7 @@ public:
     double getDensity( const double altitude, const double longitude = 0.0,
                        const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForDensity_->interpolate( independentVariableData );
+        return getDependentVariable( density_dependent_atmosphere, altitude, longitude, latitude, time );
     }
 
     //! Get local pressure.
@@ -254,29 +232,7 @@ public:
     double getPressure( const double altitude, const double longitude = 0.0,
                         const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForPressure_->interpolate( independentVariableData );
+        return getDependentVariable( pressure_dependent_atmosphere, altitude, longitude, latitude, time );
     }
 
     //! Get local temperature.
@@ -291,29 +247,7 @@ public:
     double getTemperature( const double altitude, const double longitude = 0.0,
                            const double latitude = 0.0, const double time = 0.0 )
     {
-        // Get list of independent variables
-        std::vector< double > independentVariableData;
-        for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-        {
-            switch ( independentVariables_.at( i ) )
-            {
-            case altitude_dependent_atmosphere:
-                independentVariableData.push_back( altitude );
-                break;
-            case longitude_dependent_atmosphere:
-                independentVariableData.push_back( longitude );
-                break;
-            case latitude_dependent_atmosphere:
-                independentVariableData.push_back( latitude );
-                break;
-            case time_dependent_atmosphere:
-                independentVariableData.push_back( time );
-                break;
-            }
-        }
-
-        // Give output
-        return interpolatorForTemperature_->interpolate( independentVariableData );
+        return getDependentVariable( temperature_dependent_atmosphere, altitude, longitude, latitude, time );
     }
 
     //! Get specific gas constant.
@@ -330,29 +264,7 @@ public:
     {
         if ( dependentVariablesDependency_.at( gas_constant_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForGasConstant_->interpolate( independentVariableData );
+            return getDependentVariable( gas_constant_dependent_atmosphere, altitude, longitude, latitude, time );
         }
         else
         {
@@ -374,29 +286,7 @@ public:
     {
         if ( dependentVariablesDependency_.at( specific_heat_ratio_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForSpecificHeatRatio_->interpolate( independentVariableData );
+            return getDependentVariable( specific_heat_ratio_dependent_atmosphere, altitude, longitude, latitude, time );
         }
         else
         {
@@ -418,29 +308,7 @@ public:
     {
         if ( dependentVariablesDependency_.at( molar_mass_dependent_atmosphere ) )
         {
-            // Get list of independent variables
-            std::vector< double > independentVariableData;
-            for ( unsigned int i = 0; i < numberOfIndependentVariables_; i++ )
-            {
-                switch ( independentVariables_.at( i ) )
-                {
-                case altitude_dependent_atmosphere:
-                    independentVariableData.push_back( altitude );
-                    break;
-                case longitude_dependent_atmosphere:
-                    independentVariableData.push_back( longitude );
-                    break;
-                case latitude_dependent_atmosphere:
-                    independentVariableData.push_back( latitude );
-                    break;
-                case time_dependent_atmosphere:
-                    independentVariableData.push_back( time );
-                    break;
-                }
-            }
-
-            // Give output
-            return interpolatorForMolarMass_->interpolate( independentVariableData );
+            return getDependentVariable( molar_mass_dependent_atmosphere, altitude, longitude, latitude, time );
         }
         else
         {
@@ -487,6 +355,34 @@ private:
     template< unsigned int NumberOfIndependentVariables >
     void createMultiDimensionalAtmosphereInterpolators( );
 
+    //! Function to set the values of the independent variables of the table, from the full list of atmosphere inputs.
+    /*!
+     *  Function to set the values of the independent variables of the table (in currentIndependentVariables_), in the order
+     *  specified by independentVariables_, from the full list of atmosphere inputs.
+     *  \param altitude Altitude at which atmosphere is to be evaluated.
+     *  \param longitude Longitude at which atmosphere is to be evaluated.
+     *  \param latitude Latitude at which atmosphere is to be evaluated.
+     *  \param time Time at which atmosphere is to be evaluated.
+     */
+    void setCurrentIndependentVariables( const double altitude, const double longitude,
+                                         const double latitude, const double time );
+
+    //! Function to retrieve a single dependent variable of the atmosphere at the specified conditions.
+    /*!
+     *  Function to retrieve a single dependent variable of the atmosphere at the specified conditions. For multi-dimensional
+     *  tables, all dependent variables are interpolated in a single pass, and stored, so that subsequent requests for other
+     *  dependent variables at the same conditions do not require a new interpolation.
+     *  \param dependentVariable Dependent variable that is to be retrieved
+     *  \param altitude Altitude at which dependent variable is to be computed.
+     *  \param longitude Longitude at which dependent variable is to be computed.
+     *  \param latitude Latitude at which dependent variable is to be computed.
+     *  \param time Time at which dependent variable is to be computed.
+     *  \return Value of requested dependent variable at specified conditions.
+     */
+    double getDependentVariable( const AtmosphereDependentVariables dependentVariable,
+                                 const double altitude, const double longitude,
+                                 const double latitude, const double time );
+
     //! The file name of the atmosphere table.
     /*!
      *  The file name of the atmosphere table. The file should contain four columns of data,
@@ -525,24 +421,41 @@ private:
     //! Ratio of specific heats of the atmosphere at constant pressure and constant volume.
     double ratioOfSpecificHeats_;
 
-    //! Interpolation for density. Note that type of interpolator depends on number of independent variables specified.
+    //! Interpolation for density. Only used for a single independent variable.
     std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForDensity_;
 
-    //! Interpolation for pressure. Note that type of interpolator depends on number of independent variables specified.
+    //! Interpolation for pressure. Only used for a single independent variable.
     std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForPressure_;
 
-    //! Interpolation for temperature. Note that type of interpolator depends on number of independent variables specified.
+    //! Interpolation for temperature. Only used for a single independent variable.
     std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForTemperature_;
 
-    //! Interpolation for specific gas constant. Note that type of interpolator depends on number of independent variables specified.
+    //! Interpolation for specific gas constant. Only used for a single independent variable.
     std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForGasConstant_;
 
-    //! Interpolation for ratio of specific heats. Note that type of interpolator depends on number of independent variables specified.
+    //! Interpolation for ratio of specific heats. Only used for a single independent variable.
     std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForSpecificHeatRatio_;
 
-    //! Interpolation for molar mass. Note that type of interpolator depends on number of independent variables specified.
+    //! Interpolation for molar mass. Only used for a single independent variable.
     std::shared_ptr< interpolators::Interpolator< double, double > > interpolatorForMolarMass_;
 
+    //! Interpolator for all dependent variables at once, used for more than one independent variable.
+    /*!
+     *  Interpolator for all dependent variables at once, used for more than one independent variable. The entries of the
+     *  interpolated vector are ordered as in the AtmosphereDependentVariables enum, with entries of dependent variables that
+     *  are not provided in the tables set to zero.
+     */
+    std::shared_ptr< interpolators::Interpolator< double, Eigen::Vector6d > > interpolatorForAllDependentVariables_;
+
+    //! Current values of independent variables, as set by setCurrentIndependentVariables
+    std::vector< double > currentIndependentVariables_;
+
+    //! Values of independent variables at which interpolatorForAllDependentVariables_ was last evaluated.
+    std::vector< double > independentVariablesOfLastInterpolation_;
+
+    //! Values of dependent variables, as computed by last evaluation of interpolatorForAllDependentVariables_.
+    Eigen::Vector6d dependentVariablesOfLastInterpolation_;
+
     //! Behavior of interpolator when independent variable is outside range.
     std::vector< interpolators::BoundaryInterpolationType > boundaryHandling_;
 
@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/modifiedEquinoctialElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unifiedStateModelQuaternionElementConversions.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace orbital_element_conversions;
+using mathematical_constants::PI;
+
+//! Gravitational parameter of the Earth used in tests.
+const static double earthGravitationalParameter = 3.986004418E14;
+
+//! Function to create random Keplerian states, including parabolic, hyperbolic, circular and equatorial orbits.
+Eigen::Matrix< double, 6, Eigen::Dynamic > getTestKeplerianStates( const int numberOfStates )
+{
+    std::mt19937 randomGenerator( 45 );
+    std::uniform_real_distribution< double > semiMajorAxisDistribution( 6.6E6, 5.0E7 );
+    std::uniform_real_distribution< double > eccentricityDistribution( 0.0, 0.95 );
+    std::uniform_real_distribution< double > inclinationDistribution( 0.0, PI );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * PI );
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStates( 6, numberOfStates );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        keplerianStates.col( i ) << semiMajorAxisDistribution( randomGenerator ),
+                eccentricityDistribution( randomGenerator ), inclinationDistribution( randomGenerator ),
+                angleDistribution( randomGenerator ), angleDistribution( randomGenerator ),
+                angleDistribution( randomGenerator );
+
+        // Set limit cases for part of the states.
+        switch( i % 10 )
+        {
+        case 1:
+            keplerianStates( eccentricityIndex, i ) = 0.0;
+            break;
+        case 2:
+            keplerianStates( inclinationIndex, i ) = 0.0;
+            break;
+        case 3:
+            keplerianStates( eccentricityIndex, i ) = 0.0;
+            keplerianStates( inclinationIndex, i ) = 0.0;
+            break;
+        case 4:
+            // Parabolic orbit (semi-latus rectum stored as first element).
+            keplerianStates( eccentricityIndex, i ) = 1.0;
+            keplerianStates( trueAnomalyIndex, i ) = 0.5 * angleDistribution( randomGenerator ) - 0.5 * PI;
+            break;
+        case 5:
+            // Hyperbolic orbit.
+            keplerianStates( semiMajorAxisIndex, i ) = -keplerianStates( semiMajorAxisIndex, i );
+            keplerianStates( eccentricityIndex, i ) = 1.5;
+            keplerianStates( trueAnomalyIndex, i ) = 0.25 * angleDistribution( randomGenerator ) - 0.25 * PI;
+            break;
+        default:
+            break;
+        }
+    }
+    return keplerianStates;
+}
+
+//! Function to compute the difference between two angles, in the range [-pi, pi].
+double getAngleDifference( const double firstAngle, const double secondAngle )
+{
+    return std::remainder( firstAngle - secondAngle, 2.0 * PI );
+}
+
+BOOST_AUTO_TEST_SUITE( test_batch_orbital_element_conversions )
+
+//! Test conversion of arrays of Keplerian states to Cartesian states, and back.
+BOOST_AUTO_TEST_CASE( testKeplerianCartesianStateArrayConversions )
+{
+    const int numberOfStates = 1003;
+    const Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStates = getTestKeplerianStates( numberOfStates );
+
+    // Convert Keplerian to Cartesian states, and compare to single-state conversion.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    convertKeplerianToCartesianStates( keplerianStates, earthGravitationalParameter, cartesianStates, 1 );
+    BOOST_CHECK_EQUAL( cartesianStates.cols( ), numberOfStates );
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > expectedCartesianStates( 6, numberOfStates );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        expectedCartesianStates.col( i ) = convertKeplerianToCartesianElements< double >(
+                    keplerianStates.col( i ), earthGravitationalParameter );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( cartesianStates( j, i ) - expectedCartesianStates( j, i ),
+                               1.0E-14 * expectedCartesianStates.col( i ).segment( 0, 3 ).norm( ) );
+            BOOST_CHECK_SMALL( cartesianStates( j + 3, i ) - expectedCartesianStates( j + 3, i ),
+                               1.0E-14 * expectedCartesianStates.col( i ).segment( 3, 3 ).norm( ) );
+        }
+    }
+
+    // Add exactly circular and equatorial Cartesian states.
+    expectedCartesianStates.col( 0 ) << 7.0E6, 0.0, 0.0, 0.0, std::sqrt( earthGravitationalParameter / 7.0E6 ), 0.0;
+    expectedCartesianStates.col( 1 ) << 7.0E6, 0.0, 0.0, 0.0, 8.0E3, 0.0;
+    expectedCartesianStates.col( 2 ) << 0.0, 7.0E6, 0.0, 0.0, 0.0, std::sqrt( earthGravitationalParameter / 7.0E6 );
+
+    // Convert Cartesian to Keplerian states, and compare to single-state conversion.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > computedKeplerianStates;
+    convertCartesianToKeplerianStates(
+                expectedCartesianStates, earthGravitationalParameter, computedKeplerianStates, 1 );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        const Eigen::Vector6d expectedKeplerianState = convertCartesianToKeplerianElements< double >(
+                    expectedCartesianStates.col( i ), earthGravitationalParameter );
+        BOOST_CHECK_SMALL( computedKeplerianStates( semiMajorAxisIndex, i ) - expectedKeplerianState( 0 ),
+                           1.0E-13 * std::fabs( expectedKeplerianState( 0 ) ) );
+        BOOST_CHECK_SMALL( computedKeplerianStates( eccentricityIndex, i ) - expectedKeplerianState( 1 ), 1.0E-14 );
+        for( int j = 2; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( getAngleDifference( computedKeplerianStates( j, i ), expectedKeplerianState( j ) ),
+                               1.0E-12 );
+        }
+
+        // Check that limit cases are identified identically.
+        BOOST_CHECK_EQUAL( computedKeplerianStates( argumentOfPeriapsisIndex, i ) == 0.0,
+                           expectedKeplerianState( argumentOfPeriapsisIndex ) == 0.0 );
+        BOOST_CHECK_EQUAL( computedKeplerianStates( longitudeOfAscendingNodeIndex, i ) == 0.0,
+                           expectedKeplerianState( longitudeOfAscendingNodeIndex ) == 0.0 );
+    }
+
+    // Check that the round trip recovers the original (non-limit case) states.
+    for( int i = 3; i < numberOfStates; i++ )
+    {
+        if( i % 10 == 0 || i % 10 > 5 )
+        {
+            for( int j = 2; j < 6; j++ )
+            {
+                BOOST_CHECK_SMALL( getAngleDifference( computedKeplerianStates( j, i ), keplerianStates( j, i ) ),
+                                   1.0E-9 );
+            }
+        }
+    }
+
+    // Check that results are independent of number of threads, and that in-place conversion is supported.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > multiThreadedCartesianStates;
+    convertKeplerianToCartesianStates( keplerianStates, earthGravitationalParameter, multiThreadedCartesianStates, 4 );
+    BOOST_CHECK( multiThreadedCartesianStates == cartesianStates );
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > convertedInPlaceStates = expectedCartesianStates;
+    convertCartesianToKeplerianStates(
+                convertedInPlaceStates, earthGravitationalParameter, convertedInPlaceStates, 4 );
+    BOOST_CHECK( convertedInPlaceStates == computedKeplerianStates );
+
+    // Check empty arrays.
+    convertKeplerianToCartesianStates( Eigen::Matrix< double, 6, Eigen::Dynamic >( 6, 0 ),
+                                       earthGravitationalParameter, cartesianStates );
+    BOOST_CHECK_EQUAL( cartesianStates.cols( ), 0 );
+}
+
+//! Test column-wise conversions of arrays of states, and conversion of state histories.
+BOOST_AUTO_TEST_CASE( testColumnwiseStateArrayConversions )
+{
+    const int numberOfStates = 600;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    convertKeplerianToCartesianStates(
+                getTestKeplerianStates( numberOfStates ), earthGravitationalParameter, cartesianStates );
+
+    // Compare modified equinoctial and unified state model elements to single-state conversions.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > modifiedEquinoctialStates, recomputedCartesianStates;
+    convertCartesianToModifiedEquinoctialStates(
+                cartesianStates, earthGravitationalParameter, false, modifiedEquinoctialStates, 4 );
+    convertModifiedEquinoctialToCartesianStates(
+                modifiedEquinoctialStates, earthGravitationalParameter, false, recomputedCartesianStates, 4 );
+
+    Eigen::Matrix< double, 7, Eigen::Dynamic > unifiedStateModelStates;
+    convertStatesColumnwise< 6, 7 >(
+                cartesianStates, unifiedStateModelStates, [ = ]( const Eigen::Vector6d& cartesianState )
+    {
+        return convertCartesianToUnifiedStateModelQuaternionsElements( cartesianState, earthGravitationalParameter );
+    }, 4 );
+
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        BOOST_CHECK( modifiedEquinoctialStates.col( i ) == convertCartesianToModifiedEquinoctialElements< double >(
+                         cartesianStates.col( i ), earthGravitationalParameter, false ) );
+        BOOST_CHECK( unifiedStateModelStates.col( i ) == convertCartesianToUnifiedStateModelQuaternionsElements(
+                         cartesianStates.col( i ), earthGravitationalParameter ) );
+
+        // Skip parabolic orbits for the inverse conversion (resulting in NaN values).
+        if( i % 10 != 4 )
+        {
+            BOOST_CHECK( recomputedCartesianStates.col( i ) ==
+                         convertModifiedEquinoctialToCartesianElements< double >(
+                             modifiedEquinoctialStates.col( i ), earthGravitationalParameter, false ) );
+        }
+    }
+
+    // Convert state history.
+    std::map< double, Eigen::VectorXd > cartesianStateHistory;
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        cartesianStateHistory[ 60.0 * i ] = cartesianStates.col( i );
+    }
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStates;
+    convertCartesianToKeplerianStates( cartesianStates, earthGravitationalParameter, keplerianStates );
+
+    const std::map< double, Eigen::VectorXd > keplerianStateHistory = convertCartesianToKeplerianStateHistory(
+                cartesianStateHistory, earthGravitationalParameter );
+    BOOST_CHECK_EQUAL( keplerianStateHistory.size( ), cartesianStateHistory.size( ) );
+    int stateIndex = 0;
+    for( const auto& stateIterator : keplerianStateHistory )
+    {
+        BOOST_CHECK_EQUAL( stateIterator.first, 60.0 * stateIndex );
+        BOOST_CHECK( stateIterator.second == keplerianStates.col( stateIndex ) );
+        stateIndex++;
+    }
+
+    cartesianStateHistory[ 1.0 ] = Eigen::VectorXd::Zero( 7 );
+    BOOST_CHECK_THROW( convertCartesianToKeplerianStateHistory( cartesianStateHistory, earthGravitationalParameter ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -429,6 +429,70 @@ BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_specificInitialG
                        1.0E-13 );
 }
 
+//! Test 8: Test dedicated solver (scalar and batch) against root finder solution.
+BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_dedicatedSolver )
+{
+    // Create random eccentricities and mean anomalies, including small (mirrored) mean anomalies.
+    boost::random::mt19937 randomNumberGenerator( 12345 );
+    boost::random::uniform_real_distribution< > uniformDistribution( 0.0, 1.0 );
+
+    const int numberOfSamples = 100000;
+    Eigen::ArrayXd eccentricities( numberOfSamples ), meanAnomalies( numberOfSamples );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        eccentricities( i ) = ( i % 2 == 0 ) ? 0.99 * uniformDistribution( randomNumberGenerator ) :
+                                               1.0 - std::pow( 10.0, -11.0 * uniformDistribution( randomNumberGenerator ) );
+        meanAnomalies( i ) = ( i % 3 == 0 ) ? std::pow( 10.0, -10.0 * uniformDistribution( randomNumberGenerator ) ) :
+                                              4.0 * PI * ( uniformDistribution( randomNumberGenerator ) - 0.5 );
+        if( i % 5 == 0 )
+        {
+            meanAnomalies( i ) = 2.0 * PI - meanAnomalies( i );
+        }
+    }
+
+    Eigen::ArrayXd batchEccentricAnomalies;
+    convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies, batchEccentricAnomalies );
+    BOOST_CHECK_EQUAL( batchEccentricAnomalies.rows( ), numberOfSamples );
+
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        // Check that batch and scalar conversion are identical.
+        const double eccentricAnomaly = convertMeanAnomalyToEccentricAnomaly( eccentricities( i ), meanAnomalies( i ) );
+        BOOST_CHECK_EQUAL( eccentricAnomaly, batchEccentricAnomalies( i ) );
+
+        // Compare with root finder solution, accounting for the conditioning of Kepler's equation, and check residual.
+        const double reducedMeanAnomaly = basic_mathematics::computeModulo( meanAnomalies( i ), 2.0 * PI );
+        const double rootFinderEccentricAnomaly = convertMeanAnomalyToEccentricAnomaly(
+                    eccentricities( i ), meanAnomalies( i ), false,
+                    ( reducedMeanAnomaly > PI ) ? reducedMeanAnomaly - eccentricities( i ) :
+                                                  reducedMeanAnomaly + eccentricities( i ) );
+        const double keplerFunctionDerivative =
+                1.0 - eccentricities( i ) * std::cos( eccentricAnomaly );
+        BOOST_CHECK_SMALL( ( eccentricAnomaly - rootFinderEccentricAnomaly ) * keplerFunctionDerivative, 1.0E-13 );
+        BOOST_CHECK_SMALL( computeKeplersFunctionForEllipticalOrbits(
+                               eccentricAnomaly, eccentricities( i ), reducedMeanAnomaly ), 1.0E-14 );
+    }
+
+    // Check conversion along a single orbit.
+    Eigen::ArrayXd singleOrbitEccentricAnomalies;
+    convertMeanAnomaliesToEccentricAnomalies( 0.7, meanAnomalies, singleOrbitEccentricAnomalies );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_EQUAL( singleOrbitEccentricAnomalies( i ),
+                           convertMeanAnomalyToEccentricAnomaly( 0.7, meanAnomalies( i ) ) );
+    }
+
+    // Check that invalid input is rejected.
+    eccentricities( 10 ) = 1.0;
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies, batchEccentricAnomalies ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies(
+                           Eigen::ArrayXd( eccentricities.segment( 0, 10 ) ), meanAnomalies, batchEccentricAnomalies ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( -0.1, meanAnomalies, batchEccentricAnomalies ),
+                       std::runtime_error );
+}
+
 // End Boost test suite.
 BOOST_AUTO_TEST_SUITE_END( )
 
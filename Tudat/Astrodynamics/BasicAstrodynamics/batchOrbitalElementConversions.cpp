@@ -0,0 +1,383 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <limits>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/modifiedEquinoctialElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Function to execute a conversion kernel for all blocks of an array of states.
+/*!
+ * Function to execute a conversion kernel for all blocks of an array of states, distributing the blocks over the
+ * available threads for large arrays.
+ * \param originalStates States that are to be converted, one per column.
+ * \param convertedStates Converted states, one per column (returned by reference, resized if needed).
+ * \param blockConversionKernel Kernel converting a block of states, with input arguments the pointer to the first
+ * original state, the pointer to the first converted state and the number of states in the block.
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ */
+template< typename BlockConversionKernel >
+static void convertStateBlocks( const Eigen::Matrix< double, 6, Eigen::Dynamic >& originalStates,
+                                Eigen::Matrix< double, 6, Eigen::Dynamic >& convertedStates,
+                                const BlockConversionKernel& blockConversionKernel,
+                                const int numberOfThreads )
+{
+    const int numberOfStates = static_cast< int >( originalStates.cols( ) );
+    convertedStates.resize( 6, numberOfStates );
+
+    const double* originalData = originalStates.data( );
+    double* convertedData = convertedStates.data( );
+    const int numberOfBlocks = ( numberOfStates + numberOfStatesPerConversionBlock - 1 ) /
+            numberOfStatesPerConversionBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int firstState = blockIndex * numberOfStatesPerConversionBlock;
+        blockConversionKernel( originalData + 6 * firstState, convertedData + 6 * firstState,
+                               std::min( numberOfStatesPerConversionBlock, numberOfStates - firstState ) );
+    }, getNumberOfThreadsForStateConversion( numberOfStates, numberOfThreads ) );
+}
+
+//! Function to convert a block of Keplerian states to Cartesian states.
+/*!
+ * Function to convert a block of Keplerian states to Cartesian states. The states are first copied to one array per
+ * element, after which all trigonometric functions are evaluated, followed by the (vectorizable) arithmetic.
+ * \param keplerianStates Pointer to the first Keplerian state (6 contiguous elements per state).
+ * \param cartesianStates Pointer to the first Cartesian state (6 contiguous elements per state).
+ * \param numberOfStates Number of states in the block (at most numberOfStatesPerConversionBlock).
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.
+ */
+static void convertKeplerianToCartesianStateBlock(
+        const double* keplerianStates, double* cartesianStates, const int numberOfStates,
+        const double centralBodyGravitationalParameter )
+{
+    const int blockSize = numberOfStatesPerConversionBlock;
+    const double tolerance = std::numeric_limits< double >::epsilon( );
+
+    double semiMajorAxes[ blockSize ], eccentricities[ blockSize ];
+    double cosinesOfInclination[ blockSize ], sinesOfInclination[ blockSize ];
+    double cosinesOfArgumentOfPeriapsis[ blockSize ], sinesOfArgumentOfPeriapsis[ blockSize ];
+    double cosinesOfLongitudeOfAscendingNode[ blockSize ], sinesOfLongitudeOfAscendingNode[ blockSize ];
+    double cosinesOfTrueAnomaly[ blockSize ], sinesOfTrueAnomaly[ blockSize ];
+
+    // Load elements and evaluate trigonometric functions.
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        const double* keplerianState = keplerianStates + 6 * i;
+        semiMajorAxes[ i ] = keplerianState[ semiMajorAxisIndex ];
+        eccentricities[ i ] = keplerianState[ eccentricityIndex ];
+        cosinesOfInclination[ i ] = std::cos( keplerianState[ inclinationIndex ] );
+        sinesOfInclination[ i ] = std::sin( keplerianState[ inclinationIndex ] );
+        cosinesOfArgumentOfPeriapsis[ i ] = std::cos( keplerianState[ argumentOfPeriapsisIndex ] );
+        sinesOfArgumentOfPeriapsis[ i ] = std::sin( keplerianState[ argumentOfPeriapsisIndex ] );
+        cosinesOfLongitudeOfAscendingNode[ i ] = std::cos( keplerianState[ longitudeOfAscendingNodeIndex ] );
+        sinesOfLongitudeOfAscendingNode[ i ] = std::sin( keplerianState[ longitudeOfAscendingNodeIndex ] );
+        cosinesOfTrueAnomaly[ i ] = std::cos( keplerianState[ trueAnomalyIndex ] );
+        sinesOfTrueAnomaly[ i ] = std::sin( keplerianState[ trueAnomalyIndex ] );
+    }
+
+    // Compute Cartesian states, using the semi-major axis as semi-latus rectum for parabolic orbits.
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        const double eccentricity = eccentricities[ i ];
+        const double semiLatusRectum = ( std::fabs( eccentricity - 1.0 ) > tolerance ) ?
+                    semiMajorAxes[ i ] * ( 1.0 - eccentricity * eccentricity ) : semiMajorAxes[ i ];
+
+        const double cosineOfTrueAnomaly = cosinesOfTrueAnomaly[ i ];
+        const double sineOfTrueAnomaly = sinesOfTrueAnomaly[ i ];
+        const double xPositionPerifocal = semiLatusRectum * cosineOfTrueAnomaly /
+                ( 1.0 + eccentricity * cosineOfTrueAnomaly );
+        const double yPositionPerifocal = semiLatusRectum * sineOfTrueAnomaly /
+                ( 1.0 + eccentricity * cosineOfTrueAnomaly );
+        const double velocityScaling = std::sqrt( centralBodyGravitationalParameter / semiLatusRectum );
+        const double xVelocityPerifocal = -velocityScaling * sineOfTrueAnomaly;
+        const double yVelocityPerifocal = velocityScaling * ( eccentricity + cosineOfTrueAnomaly );
+
+        const double cosineOfInclination = cosinesOfInclination[ i ];
+        const double sineOfInclination = sinesOfInclination[ i ];
+        const double cosineOfArgumentOfPeriapsis = cosinesOfArgumentOfPeriapsis[ i ];
+        const double sineOfArgumentOfPeriapsis = sinesOfArgumentOfPeriapsis[ i ];
+        const double cosineOfLongitudeOfAscendingNode = cosinesOfLongitudeOfAscendingNode[ i ];
+        const double sineOfLongitudeOfAscendingNode = sinesOfLongitudeOfAscendingNode[ i ];
+
+        // Compute the transformation matrix from the perifocal to the inertial frame.
+        const double transformationMatrix00 = cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis -
+                sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination;
+        const double transformationMatrix01 = -cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis -
+                sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination;
+        const double transformationMatrix10 = sineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis +
+                cosineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis * cosineOfInclination;
+        const double transformationMatrix11 = -sineOfLongitudeOfAscendingNode * sineOfArgumentOfPeriapsis +
+                cosineOfLongitudeOfAscendingNode * cosineOfArgumentOfPeriapsis * cosineOfInclination;
+        const double transformationMatrix20 = sineOfArgumentOfPeriapsis * sineOfInclination;
+        const double transformationMatrix21 = cosineOfArgumentOfPeriapsis * sineOfInclination;
+
+        double* cartesianState = cartesianStates + 6 * i;
+        cartesianState[ xCartesianPositionIndex ] =
+                transformationMatrix00 * xPositionPerifocal + transformationMatrix01 * yPositionPerifocal;
+        cartesianState[ yCartesianPositionIndex ] =
+                transformationMatrix10 * xPositionPerifocal + transformationMatrix11 * yPositionPerifocal;
+        cartesianState[ zCartesianPositionIndex ] =
+                transformationMatrix20 * xPositionPerifocal + transformationMatrix21 * yPositionPerifocal;
+        cartesianState[ xCartesianVelocityIndex ] =
+                transformationMatrix00 * xVelocityPerifocal + transformationMatrix01 * yVelocityPerifocal;
+        cartesianState[ yCartesianVelocityIndex ] =
+                transformationMatrix10 * xVelocityPerifocal + transformationMatrix11 * yVelocityPerifocal;
+        cartesianState[ zCartesianVelocityIndex ] =
+                transformationMatrix20 * xVelocityPerifocal + transformationMatrix21 * yVelocityPerifocal;
+    }
+}
+
+//! Function to convert a block of Cartesian states to Keplerian states.
+/*!
+ * Function to convert a block of Cartesian states to Keplerian states, following the same steps as the single-state
+ * convertCartesianToKeplerianElements function. The vector quantities are computed first, followed by the evaluation
+ * of all inverse cosines, and the quadrant corrections. The limit cases are handled by selections, so that the loops
+ * contain no data-dependent branches.
+ * \param cartesianStates Pointer to the first Cartesian state (6 contiguous elements per state).
+ * \param keplerianStates Pointer to the first Keplerian state (6 contiguous elements per state).
+ * \param numberOfStates Number of states in the block (at most numberOfStatesPerConversionBlock).
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body.
+ */
+static void convertCartesianToKeplerianStateBlock(
+        const double* cartesianStates, double* keplerianStates, const int numberOfStates,
+        const double centralBodyGravitationalParameter )
+{
+    const int blockSize = numberOfStatesPerConversionBlock;
+    const double tolerance = 20.0 * std::numeric_limits< double >::epsilon( );
+    const double twoPi = 2.0 * mathematical_constants::PI;
+
+    double semiMajorAxes[ blockSize ], eccentricities[ blockSize ];
+    double cosinesOfInclination[ blockSize ], inclinations[ blockSize ];
+    double xAscendingNodeVectors[ blockSize ], yAscendingNodeVectors[ blockSize ];
+    double argumentOfPeriapsisQuadrantConditions[ blockSize ], cosinesOfArgumentOfPeriapsis[ blockSize ];
+    double trueAnomalyQuadrantConditions[ blockSize ], cosinesOfTrueAnomaly[ blockSize ];
+    double xEccentricityVectors[ blockSize ], yEccentricityVectors[ blockSize ], zEccentricityVectors[ blockSize ];
+    double xPositions[ blockSize ], yPositions[ blockSize ], zPositions[ blockSize ];
+    double radialVelocityConditions[ blockSize ];
+
+    // Compute angular momentum, eccentricity vector and size and shape of the orbits.
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        const double* cartesianState = cartesianStates + 6 * i;
+        const double xPosition = cartesianState[ xCartesianPositionIndex ];
+        const double yPosition = cartesianState[ yCartesianPositionIndex ];
+        const double zPosition = cartesianState[ zCartesianPositionIndex ];
+        const double xVelocity = cartesianState[ xCartesianVelocityIndex ];
+        const double yVelocity = cartesianState[ yCartesianVelocityIndex ];
+        const double zVelocity = cartesianState[ zCartesianVelocityIndex ];
+
+        const double xAngularMomentum = yPosition * zVelocity - zPosition * yVelocity;
+        const double yAngularMomentum = zPosition * xVelocity - xPosition * zVelocity;
+        const double zAngularMomentum = xPosition * yVelocity - yPosition * xVelocity;
+        const double squaredAngularMomentum = xAngularMomentum * xAngularMomentum +
+                yAngularMomentum * yAngularMomentum + zAngularMomentum * zAngularMomentum;
+        const double angularMomentum = std::sqrt( squaredAngularMomentum );
+        const double semiLatusRectum = squaredAngularMomentum / centralBodyGravitationalParameter;
+
+        // Compute (unit) vector to ascending node, as z-axis cross unit angular momentum vector.
+        const double xAscendingNodeVector = -yAngularMomentum / angularMomentum;
+        const double yAscendingNodeVector = xAngularMomentum / angularMomentum;
+        const double ascendingNodeVectorNorm = std::sqrt(
+                    xAscendingNodeVector * xAscendingNodeVector + yAscendingNodeVector * yAscendingNodeVector );
+        xAscendingNodeVectors[ i ] = ( ascendingNodeVectorNorm > 0.0 ) ?
+                    xAscendingNodeVector / ascendingNodeVectorNorm : xAscendingNodeVector;
+        yAscendingNodeVectors[ i ] = ( ascendingNodeVectorNorm > 0.0 ) ?
+                    yAscendingNodeVector / ascendingNodeVectorNorm : yAscendingNodeVector;
+
+        // Compute eccentricity vector.
+        const double radius = std::sqrt( xPosition * xPosition + yPosition * yPosition + zPosition * zPosition );
+        const double xEccentricityVector =
+                ( yVelocity * zAngularMomentum - zVelocity * yAngularMomentum ) / centralBodyGravitationalParameter -
+                xPosition / radius;
+        const double yEccentricityVector =
+                ( zVelocity * xAngularMomentum - xVelocity * zAngularMomentum ) / centralBodyGravitationalParameter -
+                yPosition / radius;
+        const double zEccentricityVector =
+                ( xVelocity * yAngularMomentum - yVelocity * xAngularMomentum ) / centralBodyGravitationalParameter -
+                zPosition / radius;
+        const double eccentricity = std::sqrt( xEccentricityVector * xEccentricityVector +
+                                               yEccentricityVector * yEccentricityVector +
+                                               zEccentricityVector * zEccentricityVector );
+
+        // Store semi-latus rectum instead of semi-major axis for parabolic orbits.
+        eccentricities[ i ] = eccentricity;
+        semiMajorAxes[ i ] = ( std::fabs( eccentricity - 1.0 ) < tolerance ) ?
+                    semiLatusRectum : semiLatusRectum / ( 1.0 - eccentricity * eccentricity );
+        cosinesOfInclination[ i ] = zAngularMomentum / angularMomentum;
+
+        xEccentricityVectors[ i ] = xEccentricityVector;
+        yEccentricityVectors[ i ] = yEccentricityVector;
+        zEccentricityVectors[ i ] = zEccentricityVector;
+        xPositions[ i ] = xPosition / radius;
+        yPositions[ i ] = yPosition / radius;
+        zPositions[ i ] = zPosition / radius;
+        radialVelocityConditions[ i ] =
+                xPosition * xVelocity + yPosition * yVelocity + zPosition * zVelocity;
+    }
+
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        inclinations[ i ] = std::acos( cosinesOfInclination[ i ] );
+    }
+
+    // Compute cosines of argument of periapsis and true anomaly, replacing the line of nodes by the x-axis for
+    // equatorial orbits, and the eccentricity vector by the line of nodes for circular orbits.
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        const bool isOrbitEquatorial = std::fabs( inclinations[ i ] ) < tolerance;
+        const bool isOrbitCircular = std::fabs( eccentricities[ i ] ) < tolerance;
+        const double xAscendingNodeVector = isOrbitEquatorial ? 1.0 : xAscendingNodeVectors[ i ];
+        const double yAscendingNodeVector = isOrbitEquatorial ? 0.0 : yAscendingNodeVectors[ i ];
+        xAscendingNodeVectors[ i ] = xAscendingNodeVector;
+        yAscendingNodeVectors[ i ] = yAscendingNodeVector;
+
+        argumentOfPeriapsisQuadrantConditions[ i ] = isOrbitEquatorial ?
+                    yEccentricityVectors[ i ] : zEccentricityVectors[ i ];
+
+        // Compute unit eccentricity vector (zero vector remains unchanged).
+        const double eccentricity = eccentricities[ i ];
+        const double xUnitEccentricityVector = ( eccentricity > 0.0 ) ?
+                    xEccentricityVectors[ i ] / eccentricity : xEccentricityVectors[ i ];
+        const double yUnitEccentricityVector = ( eccentricity > 0.0 ) ?
+                    yEccentricityVectors[ i ] / eccentricity : yEccentricityVectors[ i ];
+        const double zUnitEccentricityVector = ( eccentricity > 0.0 ) ?
+                    zEccentricityVectors[ i ] / eccentricity : zEccentricityVectors[ i ];
+
+        cosinesOfArgumentOfPeriapsis[ i ] = std::min( 1.0, std::max(
+                -1.0, xUnitEccentricityVector * xAscendingNodeVector +
+                yUnitEccentricityVector * yAscendingNodeVector ) );
+
+        // For circular orbits, use the normalized line of nodes as periapsis direction.
+        const double ascendingNodeVectorNorm = std::sqrt(
+                    xAscendingNodeVector * xAscendingNodeVector + yAscendingNodeVector * yAscendingNodeVector );
+        const double xPeriapsisDirection = isOrbitCircular ?
+                    xAscendingNodeVector / ascendingNodeVectorNorm : xUnitEccentricityVector;
+        const double yPeriapsisDirection = isOrbitCircular ?
+                    yAscendingNodeVector / ascendingNodeVectorNorm : yUnitEccentricityVector;
+        const double zPeriapsisDirection = isOrbitCircular ? 0.0 : zUnitEccentricityVector;
+
+        double cosineOfTrueAnomaly = xPositions[ i ] * xPeriapsisDirection + yPositions[ i ] * yPeriapsisDirection +
+                zPositions[ i ] * zPeriapsisDirection;
+        cosineOfTrueAnomaly = ( std::fabs( 1.0 - cosineOfTrueAnomaly ) < tolerance ) ? 1.0 : cosineOfTrueAnomaly;
+        cosineOfTrueAnomaly = ( std::fabs( 1.0 + cosineOfTrueAnomaly ) < tolerance ) ? -1.0 : cosineOfTrueAnomaly;
+        cosineOfTrueAnomaly = ( std::fabs( cosineOfTrueAnomaly ) < tolerance ) ? 0.0 : cosineOfTrueAnomaly;
+        cosinesOfTrueAnomaly[ i ] = cosineOfTrueAnomaly;
+
+        // For circular orbits, position.dot( velocity ) is zero, so that the position component normal to the line of
+        // nodes (or the y-component, for equatorial orbits) is used as quadrant condition.
+        const bool isLineOfNodesXAxis = ( xAscendingNodeVector == 1.0 ) && ( yAscendingNodeVector == 0.0 );
+        trueAnomalyQuadrantConditions[ i ] = isOrbitCircular ?
+                    ( isLineOfNodesXAxis ? yPositions[ i ] : zPositions[ i ] ) : radialVelocityConditions[ i ];
+    }
+
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        xAscendingNodeVectors[ i ] = std::acos( xAscendingNodeVectors[ i ] );
+        cosinesOfArgumentOfPeriapsis[ i ] = std::acos( cosinesOfArgumentOfPeriapsis[ i ] );
+        cosinesOfTrueAnomaly[ i ] = std::acos( cosinesOfTrueAnomaly[ i ] );
+    }
+
+    // Apply quadrant corrections and store elements.
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        const double longitudeOfAscendingNode = xAscendingNodeVectors[ i ];
+        const double argumentOfPeriapsis = cosinesOfArgumentOfPeriapsis[ i ];
+        const double trueAnomaly = cosinesOfTrueAnomaly[ i ];
+
+        double* keplerianState = keplerianStates + 6 * i;
+        keplerianState[ semiMajorAxisIndex ] = semiMajorAxes[ i ];
+        keplerianState[ eccentricityIndex ] = eccentricities[ i ];
+        keplerianState[ inclinationIndex ] = inclinations[ i ];
+        keplerianState[ longitudeOfAscendingNodeIndex ] = ( yAscendingNodeVectors[ i ] < 0.0 ) ?
+                    twoPi - longitudeOfAscendingNode : longitudeOfAscendingNode;
+        keplerianState[ argumentOfPeriapsisIndex ] = ( std::fabs( eccentricities[ i ] ) < tolerance ) ? 0.0 :
+                    ( ( argumentOfPeriapsisQuadrantConditions[ i ] < 0.0 ) ?
+                          twoPi - argumentOfPeriapsis : argumentOfPeriapsis );
+        keplerianState[ trueAnomalyIndex ] = ( trueAnomalyQuadrantConditions[ i ] < 0.0 ) ?
+                    twoPi - trueAnomaly : trueAnomaly;
+    }
+}
+
+//! Convert an array of Keplerian states to Cartesian states.
+void convertKeplerianToCartesianStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& keplerianStates,
+        const double centralBodyGravitationalParameter,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const int numberOfThreads )
+{
+    convertStateBlocks( keplerianStates, cartesianStates,
+                        [ = ]( const double* originalStates, double* convertedStates, const int numberOfStates )
+    {
+        convertKeplerianToCartesianStateBlock(
+                    originalStates, convertedStates, numberOfStates, centralBodyGravitationalParameter );
+    }, numberOfThreads );
+}
+
+//! Convert an array of Cartesian states to Keplerian states.
+void convertCartesianToKeplerianStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const double centralBodyGravitationalParameter,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& keplerianStates,
+        const int numberOfThreads )
+{
+    convertStateBlocks( cartesianStates, keplerianStates,
+                        [ = ]( const double* originalStates, double* convertedStates, const int numberOfStates )
+    {
+        convertCartesianToKeplerianStateBlock(
+                    originalStates, convertedStates, numberOfStates, centralBodyGravitationalParameter );
+    }, numberOfThreads );
+}
+
+//! Convert an array of Cartesian states to modified equinoctial elements.
+void convertCartesianToModifiedEquinoctialStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const double centralBodyGravitationalParameter,
+        const bool flipSingularityToZeroInclination,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& modifiedEquinoctialStates,
+        const int numberOfThreads )
+{
+    convertStatesColumnwise< 6, 6 >(
+                cartesianStates, modifiedEquinoctialStates, [ = ]( const Eigen::Vector6d& cartesianState )
+    {
+        return convertCartesianToModifiedEquinoctialElements< double >(
+                    cartesianState, centralBodyGravitationalParameter, flipSingularityToZeroInclination );
+    }, numberOfThreads );
+}
+
+//! Convert an array of modified equinoctial elements to Cartesian states.
+void convertModifiedEquinoctialToCartesianStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& modifiedEquinoctialStates,
+        const double centralBodyGravitationalParameter,
+        const bool flipSingularityToZeroInclination,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const int numberOfThreads )
+{
+    convertStatesColumnwise< 6, 6 >(
+                modifiedEquinoctialStates, cartesianStates, [ = ]( const Eigen::Vector6d& modifiedEquinoctialState )
+    {
+        return convertModifiedEquinoctialToCartesianElements< double >(
+                    modifiedEquinoctialState, centralBodyGravitationalParameter, flipSingularityToZeroInclination );
+    }, numberOfThreads );
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The functions in this file convert arrays of states, stored as the columns of a 6xN (or 7xN) matrix, so that
+ *      each state is contiguous in memory. The Keplerian/Cartesian conversions use dedicated kernels, which process
+ *      the states in blocks, with the limit cases (parabolic, circular, equatorial orbits) of the single-state
+ *      conversions in orbitalElementConversions.h handled by selections instead of branches. The results are equal
+ *      to those of the single-state conversions up to rounding errors. Other conversions apply the single-state
+ *      conversions to each column, see convertStatesColumnwise.
+ *
+ */
+
+#ifndef TUDAT_BATCH_ORBITAL_ELEMENT_CONVERSIONS_H
+#define TUDAT_BATCH_ORBITAL_ELEMENT_CONVERSIONS_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelLoop.h"
+
+namespace tudat
+{
+
+namespace orbital_element_conversions
+{
+
+//! Number of states that is converted per block (and per task, when using multiple threads).
+const static int numberOfStatesPerConversionBlock = 64;
+
+//! Function to compute the number of threads to use for a conversion of an array of states.
+/*!
+ * Function to compute the number of threads to use for a conversion of an array of states, such that each thread
+ * converts at least a few blocks of states (for smaller arrays, the thread overhead exceeds the conversion time).
+ * \param numberOfStates Number of states that is to be converted.
+ * \param numberOfThreads Maximum number of threads.
+ * \return Number of threads to use.
+ */
+inline int getNumberOfThreadsForStateConversion( const int numberOfStates, const int numberOfThreads )
+{
+    return std::max( 1, std::min( numberOfThreads, numberOfStates / ( 4 * numberOfStatesPerConversionBlock ) ) );
+}
+
+//! Function to convert an array of states by applying a single-state conversion to each column.
+/*!
+ * Function to convert an array of states by applying a single-state conversion to each column. The columns are
+ * converted in blocks, which are distributed over the available threads for large arrays. The conversion function
+ * must be thread-safe. Example usage, to convert Cartesian states to unified state model elements:
+ * \code
+ *  convertStatesColumnwise< 6, 7 >(
+ *      cartesianStates, unifiedStateModelStates, [ = ]( const Eigen::Vector6d& state )
+ *      { return convertCartesianToUnifiedStateModelQuaternionsElements( state, gravitationalParameter ); } );
+ * \endcode
+ * \param originalStates States that are to be converted, one per column.
+ * \param convertedStates Converted states, one per column (returned by reference, resized if needed).
+ * \param conversionFunction Function converting a single state.
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ */
+template< int NumberOfOriginalElements, int NumberOfConvertedElements, typename ConversionFunction >
+void convertStatesColumnwise(
+        const Eigen::Matrix< double, NumberOfOriginalElements, Eigen::Dynamic >& originalStates,
+        Eigen::Matrix< double, NumberOfConvertedElements, Eigen::Dynamic >& convertedStates,
+        const ConversionFunction& conversionFunction,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) )
+{
+    const int numberOfStates = static_cast< int >( originalStates.cols( ) );
+    convertedStates.resize( NumberOfConvertedElements, numberOfStates );
+
+    const int numberOfBlocks = ( numberOfStates + numberOfStatesPerConversionBlock - 1 ) /
+            numberOfStatesPerConversionBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int lastState = std::min( ( blockIndex + 1 ) * numberOfStatesPerConversionBlock, numberOfStates );
+        for( int i = blockIndex * numberOfStatesPerConversionBlock; i < lastState; i++ )
+        {
+            convertedStates.col( i ) = conversionFunction(
+                        Eigen::Matrix< double, NumberOfOriginalElements, 1 >( originalStates.col( i ) ) );
+        }
+    }, getNumberOfThreadsForStateConversion( numberOfStates, numberOfThreads ) );
+}
+
+//! Convert an array of Keplerian states to Cartesian states.
+/*!
+ * Converts an array of Keplerian states to Cartesian states, with the same element order and limit cases as the
+ * single-state convertKeplerianToCartesianElements function.
+ * \param keplerianStates Keplerian states, one per column (see KeplerianElementIndices).
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param cartesianStates Cartesian states, one per column (returned by reference, resized if needed). May be the same
+ * object as keplerianStates, in which case the states are converted in place.
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ */
+void convertKeplerianToCartesianStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& keplerianStates,
+        const double centralBodyGravitationalParameter,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Convert an array of Cartesian states to Keplerian states.
+/*!
+ * Converts an array of Cartesian states to Keplerian states, with the same element order, tolerances and limit cases
+ * (parabolic, circular and equatorial orbits) as the single-state convertCartesianToKeplerianElements function.
+ * \param cartesianStates Cartesian states, one per column (see CartesianElementIndices).
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param keplerianStates Keplerian states, one per column (returned by reference, resized if needed). May be the same
+ * object as cartesianStates, in which case the states are converted in place.
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ */
+void convertCartesianToKeplerianStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const double centralBodyGravitationalParameter,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& keplerianStates,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Convert an array of Cartesian states to modified equinoctial elements.
+/*!
+ * Converts an array of Cartesian states to modified equinoctial elements, using the single-state
+ * convertCartesianToModifiedEquinoctialElements function for each state.
+ * \param cartesianStates Cartesian states, one per column.
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param flipSingularityToZeroInclination Boolean denoting whether the set of equations for the inclination = 180 degrees
+ * (false) or 0 degrees (true) singular case is to be used (must be the same for the conversion back).
+ * \param modifiedEquinoctialStates Modified equinoctial elements, one state per column (returned by reference).
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ */
+void convertCartesianToModifiedEquinoctialStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const double centralBodyGravitationalParameter,
+        const bool flipSingularityToZeroInclination,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& modifiedEquinoctialStates,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Convert an array of modified equinoctial elements to Cartesian states.
+/*!
+ * Converts an array of modified equinoctial elements to Cartesian states, using the single-state
+ * convertModifiedEquinoctialToCartesianElements function for each state.
+ * \param modifiedEquinoctialStates Modified equinoctial elements, one state per column.
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param flipSingularityToZeroInclination Boolean denoting whether the set of equations for the inclination = 180 degrees
+ * (false) or 0 degrees (true) singular case is to be used (must be the same for the conversion back).
+ * \param cartesianStates Cartesian states, one per column (returned by reference).
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ */
+void convertModifiedEquinoctialToCartesianStates(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& modifiedEquinoctialStates,
+        const double centralBodyGravitationalParameter,
+        const bool flipSingularityToZeroInclination,
+        Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Convert a history of Cartesian states to a history of Keplerian states.
+/*!
+ * Converts a history of Cartesian states (e.g. a propagated state history of a single body) to a history of Keplerian
+ * states, by copying the states into a contiguous array and using convertCartesianToKeplerianStates.
+ * \param cartesianStateHistory History of Cartesian states (each of size 6).
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body [m^3 s^-2].
+ * \param numberOfThreads Maximum number of threads used for the conversion.
+ * \return History of Keplerian states, at the same times as the Cartesian states.
+ */
+template< typename TimeType, typename StateType >
+std::map< TimeType, StateType > convertCartesianToKeplerianStateHistory(
+        const std::map< TimeType, StateType >& cartesianStateHistory,
+        const double centralBodyGravitationalParameter,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) )
+{
+    Eigen::Matrix< double, 6, Eigen::Dynamic > states( 6, cartesianStateHistory.size( ) );
+    int stateIndex = 0;
+    for( const auto& stateIterator : cartesianStateHistory )
+    {
+        if( stateIterator.second.rows( ) != 6 )
+        {
+            throw std::runtime_error( "Error when converting Cartesian state history to Keplerian elements, state has "
+                                      "size " + std::to_string( stateIterator.second.rows( ) ) + ", expected 6." );
+        }
+        states.col( stateIndex++ ) = stateIterator.second.template cast< double >( );
+    }
+
+    convertCartesianToKeplerianStates( states, centralBodyGravitationalParameter, states, numberOfThreads );
+
+    std::map< TimeType, StateType > keplerianStateHistory;
+    stateIndex = 0;
+    for( const auto& stateIterator : cartesianStateHistory )
+    {
+        keplerianStateHistory.insert(
+                    keplerianStateHistory.end( ), std::make_pair(
+                        stateIterator.first, StateType( states.col( stateIndex++ ).template cast<
+                                                        typename StateType::Scalar >( ) ) ) );
+    }
+    return keplerianStateHistory;
+}
+
+} // namespace orbital_element_conversions
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_ORBITAL_ELEMENT_CONVERSIONS_H
@@ -17,6 +17,9 @@
  *              Deep Space Maneuvers, MSc thesis report, Delft University of Technology, 2012.
  *              [unpublished so far]. Section available on tudat website (tudat.tudelft.nl)
  *              under issue #539.
+ *      Regarding the dedicated solver for elliptical orbits:
+ *          Markley, F.L. Kepler equation solver, Celestial Mechanics and Dynamical Astronomy 63(1),
+ *              101-111, 1995.
  *
  *    Notes
  *      There are known to be some issues on some systems with near-parabolic orbits that are very
@@ -36,6 +39,11 @@
 #include <boost/math/special_functions/asinh.hpp>
 
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/Core>
 
 #include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 #include "Tudat/Mathematics/RootFinders/rootFinder.h"
@@ -135,6 +143,73 @@ ScalarType computeFirstDerivativeKeplersFunctionForHyperbolicOrbits(
     return eccentricity * std::cosh( hyperbolicEccentricAnomaly ) - 1.0;
 }
 
+//! Solve Kepler's equation for elliptical orbits, using a starter and a fixed number of corrections.
+/*!
+ * Solves Kepler's equation for elliptical orbits, for all eccentricities >= 0.0 and < 1.0, using the method of
+ * (Markley, 1995): a starter obtained from the solution of a cubic equation, followed by a fifth-order correction. A
+ * single correction is applied for double (or lower) precision, and a second correction for ScalarTypes with a
+ * higher precision. Since no iterations, function objects or dynamic memory are used, this function is much faster than
+ * solving Kepler's equation with a root finder. The accuracy of the eccentric anomaly is close to machine precision,
+ * except for near-parabolic orbits with small mean anomalies, for which Kepler's equation itself is ill-conditioned.
+ * The validity of the eccentricity is not checked by this function.
+ * \param eccentricity Eccentricity of the orbit [-].
+ * \param meanAnomaly Mean anomaly [rad], in the range [ 0, 2.0*PI ].
+ * \return Eccentric anomaly [rad], in the range [ 0, 2.0*PI ].
+ */
+template< typename ScalarType = double >
+ScalarType solveKeplersEquationForEllipticalOrbits( const ScalarType eccentricity, const ScalarType meanAnomaly )
+{
+    using mathematical_constants::getPi;
+    const ScalarType pi = getPi< ScalarType >( );
+    const ScalarType one = mathematical_constants::getFloatingInteger< ScalarType >( 1 );
+
+    // Solve for mean anomaly in the range [ 0, PI ], using the symmetry of Kepler's equation.
+    const bool isMeanAnomalyMirrored = ( meanAnomaly > pi );
+    const ScalarType reducedMeanAnomaly = isMeanAnomalyMirrored ? ( 2.0 * pi - meanAnomaly ) : meanAnomaly;
+    if( !( reducedMeanAnomaly > 0.0 ) )
+    {
+        return meanAnomaly;
+    }
+
+    // Compute starter from cubic equation (Markley, 1995, eqs. 5, 9-11, 15-20).
+    const ScalarType alpha = ( 3.0 * pi * pi + 1.6 * pi * ( pi - reducedMeanAnomaly ) / ( one + eccentricity ) ) /
+            ( pi * pi - 6.0 );
+    const ScalarType d = 3.0 * ( one - eccentricity ) + alpha * eccentricity;
+    const ScalarType q = 2.0 * alpha * d * ( one - eccentricity ) - reducedMeanAnomaly * reducedMeanAnomaly;
+    const ScalarType r = 3.0 * alpha * d * ( d - one + eccentricity ) * reducedMeanAnomaly +
+            reducedMeanAnomaly * reducedMeanAnomaly * reducedMeanAnomaly;
+    const ScalarType w = std::pow( std::fabs( r ) + std::sqrt( q * q * q + r * r ),
+                                   mathematical_constants::getFloatingFraction< ScalarType >( 2, 3 ) );
+    ScalarType eccentricAnomaly = ( 2.0 * r * w / ( w * w + w * q + q * q ) + reducedMeanAnomaly ) / d;
+
+    // Apply fifth-order corrections (Markley, 1995, eqs. 21-25), to the starter mapped back to the full range of the
+    // mean anomaly (to prevent loss of precision when mapping the corrected value).
+    if( isMeanAnomalyMirrored )
+    {
+        eccentricAnomaly = 2.0 * pi - eccentricAnomaly;
+    }
+    const int numberOfCorrections = ( std::numeric_limits< ScalarType >::digits >
+                                      std::numeric_limits< double >::digits ) ? 2 : 1;
+    for( int i = 0; i < numberOfCorrections; i++ )
+    {
+        const ScalarType eccentricitySine = eccentricity * std::sin( eccentricAnomaly );
+        const ScalarType eccentricityCosine = eccentricity * std::cos( eccentricAnomaly );
+
+        const ScalarType f0 = eccentricAnomaly - eccentricitySine - meanAnomaly;
+        const ScalarType f1 = one - eccentricityCosine;
+        const ScalarType f2 = 0.5 * eccentricitySine;
+        const ScalarType f3 = eccentricityCosine / 6.0;
+        const ScalarType f4 = -eccentricitySine / 24.0;
+
+        const ScalarType delta3 = -f0 / ( f1 - f0 * f2 / f1 );
+        const ScalarType delta4 = -f0 / ( f1 + delta3 * ( f2 + delta3 * f3 ) );
+        const ScalarType delta5 = -f0 / ( f1 + delta4 * ( f2 + delta4 * ( f3 + delta4 * f4 ) ) );
+        eccentricAnomaly += delta5;
+    }
+
+    return eccentricAnomaly;
+}
+
 //! Convert mean anomaly to eccentric anomaly.
 /*!
  * Converts mean anomaly to eccentric anomaly for elliptical orbits for all eccentricities >=
@@ -143,15 +218,17 @@ ScalarType computeFirstDerivativeKeplersFunctionForHyperbolicOrbits(
  * for some near-parabolic cases in which macine precision problems occur. These are tested
  * against an accuracy of 1.0e-9. Near-parabolic in this sense means e > 1.0-1.0e-11. Also
  * note that your mean anomaly is automatically transformed to fit within the 0 to 2.0*PI
- * spectrum. Numerical tests performed using double ScalarType.
+ * spectrum. Numerical tests performed using double ScalarType. If the default initial guess is
+ * used and no root finder is provided, Kepler's equation is solved without root finder by
+ * solveKeplersEquationForEllipticalOrbits.
  * \param eccentricity Eccentricity of the orbit [-].
  * \param aMeanAnomaly Mean anomaly to convert to eccentric anomaly [rad].
  * \param useDefaultInitialGuess Boolean specifying whether to use default initial guess [-].
  * \param userSpecifiedInitialGuess Initial guess for rootfinder [rad].
- * \param rootFinder Shared-pointer to the rootfinder that is to be used. Default is
- *          Newton-Raphson using 1000 iterations as maximum and apprximately 1.0e-13 absolute
- *          X-tolerance (for doubles; 500 times ScalarType resolution ).
- *          Higher precision may invoke machine precision problems for some values.
+ * \param rootFinder Shared-pointer to the rootfinder that is to be used. If a user specified
+ *          initial guess is used, the default is Newton-Raphson using 1000 iterations as maximum
+ *          and apprximately 1.0e-13 absolute X-tolerance (for doubles; 500 times ScalarType
+ *          resolution ). Higher precision may invoke machine precision problems for some values.
  * \return Eccentric anomaly [rad].
  */
 template< typename ScalarType = double >
@@ -171,6 +248,18 @@ ScalarType convertMeanAnomalyToEccentricAnomaly(
                 aMeanAnomaly, getFloatingInteger< ScalarType >( 2 ) *
                 getPi< ScalarType >( ) );
 
+    // Use dedicated solver, unless a root finder or initial guess is provided.
+    if ( useDefaultInitialGuess && !rootFinder.get( ) )
+    {
+        if ( !( eccentricity < getFloatingInteger< ScalarType >( 1 ) &&
+                eccentricity >= getFloatingInteger< ScalarType >( 0 ) ) )
+        {
+            throw std::runtime_error( "Invalid eccentricity. Valid range is 0.0 <= e < 1.0. Eccentricity was: " +
+                                std::to_string( eccentricity ) );
+        }
+        return solveKeplersEquationForEllipticalOrbits< ScalarType >( eccentricity, meanAnomaly );
+    }
+
     // Required because the make_shared in the function definition gives problems for MSVC.
     if ( !rootFinder.get( ) )
     {
@@ -282,6 +371,81 @@ ScalarType convertMeanAnomalyToEccentricAnomaly(
     return eccentricAnomaly;
 }
 
+//! Convert mean anomalies to eccentric anomalies for a batch of elliptical orbits.
+/*!
+ * Converts mean anomalies to eccentric anomalies for a batch of elliptical orbits (all eccentricities >= 0.0 and < 1.0),
+ * using solveKeplersEquationForEllipticalOrbits. The conversion of each entry is identical to that of
+ * convertMeanAnomalyToEccentricAnomaly (using the default initial guess and no root finder), but no root finder or
+ * function objects are created per entry, and no memory is allocated (if the output is of the correct size).
+ * \param eccentricities Eccentricities of the orbits [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad] (same size as eccentricities).
+ * \param eccentricAnomalies Eccentric anomalies [rad], in the range [ 0, 2.0*PI ] (returned by reference, resized if
+ * required).
+ */
+template< typename ScalarType = double >
+void convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricAnomalies )
+{
+    using namespace mathematical_constants;
+
+    if( eccentricities.rows( ) != meanAnomalies.rows( ) )
+    {
+        throw std::runtime_error( "Error when converting mean to eccentric anomalies, number of eccentricities (" +
+                                  std::to_string( eccentricities.rows( ) ) + ") and mean anomalies (" +
+                                  std::to_string( meanAnomalies.rows( ) ) + ") is not equal." );
+    }
+    if( ( eccentricities.rows( ) > 0 ) &&
+            !( eccentricities.minCoeff( ) >= getFloatingInteger< ScalarType >( 0 ) &&
+               eccentricities.maxCoeff( ) < getFloatingInteger< ScalarType >( 1 ) ) )
+    {
+        throw std::runtime_error( "Invalid eccentricity in batch conversion of mean to eccentric anomalies. Valid range "
+                                  "is 0.0 <= e < 1.0." );
+    }
+
+    eccentricAnomalies.resize( meanAnomalies.rows( ) );
+    const ScalarType fullCircle = getFloatingInteger< ScalarType >( 2 ) * getPi< ScalarType >( );
+    for( int i = 0; i < meanAnomalies.rows( ); i++ )
+    {
+        eccentricAnomalies( i ) = solveKeplersEquationForEllipticalOrbits< ScalarType >(
+                    eccentricities( i ), basic_mathematics::computeModulo< ScalarType >( meanAnomalies( i ), fullCircle ) );
+    }
+}
+
+//! Convert mean anomalies to eccentric anomalies along a single elliptical orbit.
+/*!
+ * Converts mean anomalies to eccentric anomalies along a single elliptical orbit (eccentricity >= 0.0 and < 1.0), for
+ * instance to evaluate the orbit at a batch of epochs, using solveKeplersEquationForEllipticalOrbits.
+ * \param eccentricity Eccentricity of the orbit [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \param eccentricAnomalies Eccentric anomalies [rad], in the range [ 0, 2.0*PI ] (returned by reference, resized if
+ * required).
+ */
+template< typename ScalarType = double >
+void convertMeanAnomaliesToEccentricAnomalies(
+        const ScalarType eccentricity,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricAnomalies )
+{
+    using namespace mathematical_constants;
+
+    if( !( eccentricity >= getFloatingInteger< ScalarType >( 0 ) &&
+           eccentricity < getFloatingInteger< ScalarType >( 1 ) ) )
+    {
+        throw std::runtime_error( "Invalid eccentricity. Valid range is 0.0 <= e < 1.0. Eccentricity was: " +
+                                  std::to_string( eccentricity ) );
+    }
+
+    eccentricAnomalies.resize( meanAnomalies.rows( ) );
+    const ScalarType fullCircle = getFloatingInteger< ScalarType >( 2 ) * getPi< ScalarType >( );
+    for( int i = 0; i < meanAnomalies.rows( ); i++ )
+    {
+        eccentricAnomalies( i ) = solveKeplersEquationForEllipticalOrbits< ScalarType >(
+                    eccentricity, basic_mathematics::computeModulo< ScalarType >( meanAnomalies( i ), fullCircle ) );
+    }
+}
+
 
 //! Convert mean anomaly to hyperbolic eccentric anomaly.
 /*!
@@ -0,0 +1,246 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include "Tudat/Basics/parallelLoop.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesTable.h"
+#include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace earth_orientation;
+
+BOOST_AUTO_TEST_SUITE( test_earth_orientation_angles_table )
+
+//! Function to get the name of a (not yet existing) file in the temporary directory.
+std::string getTemporaryTableFileName( )
+{
+    return ( boost::filesystem::temp_directory_path( ) /
+             boost::filesystem::unique_path( "earthOrientationAnglesTable-%%%%-%%%%.dat" ) ).string( );
+}
+
+//! Test whether tabulated Earth orientation angles are consistent with directly computed angles, and with file I/O.
+BOOST_AUTO_TEST_CASE( testEarthOrientationAnglesTable )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+
+    // Create table over two days, with 10 minute time step.
+    double intervalStart = 1.0E8;
+    double intervalEnd = intervalStart + 2.0 * 86400.0;
+    double timeStep = 600.0;
+    std::shared_ptr< EarthOrientationAnglesTable > anglesTable = createEarthOrientationAnglesTable(
+                intervalStart, intervalEnd, timeStep, basic_astrodynamics::tdb_scale, earthOrientationCalculator );
+
+    BOOST_CHECK_EQUAL( anglesTable->getNumberOfSamples( ), 289 );
+    BOOST_CHECK_CLOSE_FRACTION( anglesTable->getEndTime( ), intervalEnd, std::numeric_limits< double >::epsilon( ) );
+
+    // Write table to file, and reload it with a window that is much smaller than the table
+    std::string tableFile = getTemporaryTableFileName( );
+    anglesTable->writeToFile( tableFile );
+    std::shared_ptr< EarthOrientationAnglesTable > reloadedAnglesTable =
+            std::make_shared< EarthOrientationAnglesTable >( tableFile, 20 );
+    BOOST_CHECK_EQUAL( reloadedAnglesTable->getNumberOfSamples( ), anglesTable->getNumberOfSamples( ) );
+    BOOST_CHECK_EQUAL( reloadedAnglesTable->getTimeScale( ), basic_astrodynamics::tdb_scale );
+
+    std::pair< Eigen::Vector5d, double > directAngles, tabulatedAngles, reloadedAngles;
+    Eigen::Quaterniond tabulatedRotation;
+    Eigen::Matrix3d tabulatedRotationDerivative, expectedRotation, expectedRotationDerivative;
+    for( double testTime = intervalStart + 1.0; testTime < intervalEnd - 1.0; testTime += 1234.5 )
+    {
+        directAngles = earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                    testTime, basic_astrodynamics::tdb_scale );
+        tabulatedAngles = anglesTable->getRotationAnglesFromItrsToGcrs( testTime );
+        reloadedAngles = reloadedAnglesTable->getRotationAnglesFromItrsToGcrs( testTime );
+
+        // Check interpolation error (X, Y, s, xp, yp) and UT1
+        for( int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( directAngles.first( i ) - tabulatedAngles.first( i ) ), 1.0E-14 );
+        }
+        for( int i = 3; i < 5; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( directAngles.first( i ) - tabulatedAngles.first( i ) ), 1.0E-11 );
+        }
+        BOOST_CHECK_SMALL( std::fabs( directAngles.second - tabulatedAngles.second ), 1.0E-6 );
+
+        // Check whether reloaded table provides identical values
+        for( int i = 0; i < 5; i++ )
+        {
+            BOOST_CHECK_EQUAL( reloadedAngles.first( i ), tabulatedAngles.first( i ) );
+        }
+        BOOST_CHECK_EQUAL( reloadedAngles.second, tabulatedAngles.second );
+
+        // Check combined rotation/derivative against separate computation from same angles
+        anglesTable->getRotationAndDerivativeFromItrsToGcrs( testTime, tabulatedRotation, tabulatedRotationDerivative );
+        expectedRotation = calculateRotationFromItrsToGcrs< double >( tabulatedAngles, testTime ).toRotationMatrix( );
+        expectedRotationDerivative = calculateRotationRateFromItrsToGcrs< double >( tabulatedAngles, testTime );
+
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( tabulatedRotation.toRotationMatrix( )( i, j ) - expectedRotation( i, j ) ),
+                                   1.0E-14 );
+                BOOST_CHECK_SMALL( std::fabs( tabulatedRotationDerivative( i, j ) - expectedRotationDerivative( i, j ) ),
+                                   1.0E-18 );
+            }
+        }
+    }
+
+    // Check whether data was reloaded from file as needed.
+    BOOST_CHECK_EQUAL( reloadedAnglesTable->getNumberOfWindowLoads( ) > 1, true );
+
+    // Check whether times outside of table are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        anglesTable->getRotationAnglesFromItrsToGcrs( intervalEnd + 1.0 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    boost::filesystem::remove( tableFile );
+}
+
+//! Test whether a table that is loaded from file can be evaluated from multiple threads.
+BOOST_AUTO_TEST_CASE( testEarthOrientationAnglesTableThreadSafety )
+{
+    double intervalStart = 1.0E8;
+    double intervalEnd = intervalStart + 2.0 * 86400.0;
+    std::shared_ptr< EarthOrientationAnglesTable > anglesTable = createEarthOrientationAnglesTable(
+                intervalStart, intervalEnd, 600.0 );
+
+    std::string tableFile = getTemporaryTableFileName( );
+    anglesTable->writeToFile( tableFile );
+    std::shared_ptr< EarthOrientationAnglesTable > reloadedAnglesTable =
+            std::make_shared< EarthOrientationAnglesTable >( tableFile, 20 );
+
+    // Evaluate table at times spread over full table from multiple threads, such that window is reloaded frequently.
+    int numberOfTestTimes = 500;
+    std::vector< double > testTimes( numberOfTestTimes );
+    std::vector< std::pair< Eigen::Vector5d, double > > reloadedAngles( numberOfTestTimes );
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        testTimes[ i ] = intervalStart + 1.0 + static_cast< double >( ( 37 * i ) % numberOfTestTimes ) *
+                ( intervalEnd - intervalStart - 2.0 ) / static_cast< double >( numberOfTestTimes );
+    }
+    utilities::executeParallelLoop( numberOfTestTimes, [ & ]( const int i )
+    {
+        reloadedAngles[ i ] = reloadedAnglesTable->getRotationAnglesFromItrsToGcrs( testTimes[ i ] );
+    }, 4 );
+
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        std::pair< Eigen::Vector5d, double > tabulatedAngles =
+                anglesTable->getRotationAnglesFromItrsToGcrs( testTimes[ i ] );
+        for( int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( reloadedAngles[ i ].first( j ), tabulatedAngles.first( j ) );
+        }
+        BOOST_CHECK_EQUAL( reloadedAngles[ i ].second, tabulatedAngles.second );
+    }
+    BOOST_CHECK_EQUAL( reloadedAnglesTable->getNumberOfWindowLoads( ) > 1, true );
+
+    boost::filesystem::remove( tableFile );
+}
+
+//! Test whether the consistency of a table with an Earth orientation calculator is checked correctly.
+BOOST_AUTO_TEST_CASE( testEarthOrientationAnglesTableConsistency )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+
+    double intervalStart = 1.0E8;
+    double timeStep = 3600.0;
+    std::shared_ptr< EarthOrientationAnglesTable > anglesTable = createEarthOrientationAnglesTable(
+                intervalStart, intervalStart + 86400.0, timeStep, basic_astrodynamics::tdb_scale,
+                earthOrientationCalculator );
+    BOOST_CHECK_NO_THROW( checkEarthOrientationAnglesTableConsistency( anglesTable, earthOrientationCalculator ) );
+
+    // Create table with a polar motion offset of 1 microarcsecond, as would result from different EOP data.
+    std::vector< Eigen::Vector6d > tabulatedValues;
+    for( int i = 0; i < anglesTable->getNumberOfSamples( ); i++ )
+    {
+        double currentTime = intervalStart + static_cast< double >( i ) * timeStep;
+        std::pair< Eigen::Vector5d, double > currentAngles =
+                anglesTable->getRotationAnglesFromItrsToGcrs( currentTime );
+        Eigen::Vector6d currentValues;
+        currentValues << currentAngles.first, currentAngles.second - currentTime;
+        currentValues( 3 ) += 1.0E-6 * mathematical_constants::PI / ( 180.0 * 3600.0 );
+        tabulatedValues.push_back( currentValues );
+    }
+    std::shared_ptr< EarthOrientationAnglesTable > inconsistentAnglesTable =
+            std::make_shared< EarthOrientationAnglesTable >( intervalStart, timeStep, tabulatedValues );
+    BOOST_CHECK_THROW( checkEarthOrientationAnglesTableConsistency(
+                           inconsistentAnglesTable, earthOrientationCalculator ), std::runtime_error );
+}
+
+//! Test whether the GCRS<->ITRS rotation model using a table is consistent with the model computing angles directly.
+BOOST_AUTO_TEST_CASE( testEarthOrientationAnglesTableRotationModel )
+{
+    std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+            createStandardEarthOrientationCalculator( );
+
+    double intervalStart = 1.0E8;
+    double intervalEnd = intervalStart + 86400.0;
+    std::shared_ptr< EarthOrientationAnglesTable > anglesTable = createEarthOrientationAnglesTable(
+                intervalStart, intervalEnd, 600.0, basic_astrodynamics::tdb_scale, earthOrientationCalculator );
+
+    ephemerides::GcrsToItrsRotationModel directRotationModel( earthOrientationCalculator );
+    ephemerides::GcrsToItrsRotationModel tabulatedRotationModel(
+                earthOrientationCalculator, basic_astrodynamics::tdb_scale, "GCRS", anglesTable );
+
+    Eigen::Quaterniond directRotation, tabulatedRotation;
+    Eigen::Matrix3d directRotationDerivative, tabulatedRotationDerivative;
+    Eigen::Vector3d directAngularVelocity, tabulatedAngularVelocity;
+    for( double testTime = intervalStart + 1.0; testTime < intervalEnd - 1.0; testTime += 3456.7 )
+    {
+        directRotationModel.getFullRotationalQuantitiesToTargetFrame(
+                    directRotation, directRotationDerivative, directAngularVelocity, testTime );
+        tabulatedRotationModel.getFullRotationalQuantitiesToTargetFrame(
+                    tabulatedRotation, tabulatedRotationDerivative, tabulatedAngularVelocity, testTime );
+
+        Eigen::Matrix3d rotationDifference =
+                tabulatedRotation.toRotationMatrix( ) - directRotation.toRotationMatrix( );
+        Eigen::Matrix3d baseFrameRotationDifference =
+                tabulatedRotationModel.getRotationToBaseFrame( testTime ).toRotationMatrix( ) -
+                directRotationModel.getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        BOOST_CHECK_SMALL( rotationDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( baseFrameRotationDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( ( tabulatedRotationDerivative - directRotationDerivative ).cwiseAbs( ).maxCoeff( ),
+                           1.0E-14 );
+        BOOST_CHECK_SMALL( ( tabulatedAngularVelocity - directAngularVelocity ).norm( ), 1.0E-14 );
+    }
+
+    // Check whether table in wrong time scale is rejected
+    BOOST_CHECK_THROW( ephemerides::GcrsToItrsRotationModel(
+                           earthOrientationCalculator, basic_astrodynamics::utc_scale, "GCRS", anglesTable ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,348 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesTable.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Identifier at start of binary Earth orientation table files.
+static const char EARTH_ORIENTATION_TABLE_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'E', 'O', 'T' };
+
+//! Version of binary Earth orientation table file format.
+static const boost::int32_t EARTH_ORIENTATION_TABLE_FILE_VERSION = 1;
+
+//! Size of header of binary Earth orientation table files.
+static const std::streamoff EARTH_ORIENTATION_TABLE_HEADER_SIZE =
+        8 + 2 * sizeof( boost::int32_t ) + 2 * sizeof( double ) + sizeof( boost::int64_t );
+
+//! Constructor from tabulated data in memory
+EarthOrientationAnglesTable::EarthOrientationAnglesTable(
+        const double startTime,
+        const double timeStep,
+        const std::vector< Eigen::Vector6d >& tabulatedValues,
+        const basic_astrodynamics::TimeScales timeScale,
+        const int interpolationOrder ):
+    startTime_( startTime ), timeStep_( timeStep ), numberOfSamples_( static_cast< int >( tabulatedValues.size( ) ) ),
+    timeScale_( timeScale ), interpolationOrder_( interpolationOrder ), fileName_( "" ),
+    samplesPerWindow_( static_cast< int >( tabulatedValues.size( ) ) ), windowStartIndex_( 0 ),
+    windowSize_( static_cast< int >( tabulatedValues.size( ) ) ), numberOfWindowLoads_( 0 )
+{
+    setInterpolationDenominators( );
+
+    // Store data contiguously
+    windowData_.resize( 6 * numberOfSamples_ );
+    for( int i = 0; i < numberOfSamples_; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            windowData_[ 6 * i + j ] = tabulatedValues.at( i )( j );
+        }
+    }
+}
+
+//! Constructor from binary file, loading the data lazily
+EarthOrientationAnglesTable::EarthOrientationAnglesTable(
+        const std::string& fileName,
+        const int samplesPerWindow,
+        const int interpolationOrder ):
+    interpolationOrder_( interpolationOrder ), fileName_( fileName ), samplesPerWindow_( samplesPerWindow ),
+    windowStartIndex_( 0 ), windowSize_( 0 ), numberOfWindowLoads_( 0 )
+{
+    setInterpolationDenominators( );
+
+    if( samplesPerWindow_ < interpolationOrder_ )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, window size is smaller than interpolation order" );
+    }
+
+    // Read and check file header
+    std::ifstream tableFile( fileName_.c_str( ), std::ios::binary );
+    if( !tableFile.good( ) )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, could not open file " + fileName_ );
+    }
+
+    char fileIdentifier[ 8 ];
+    boost::int32_t fileVersion, timeScale;
+    boost::int64_t numberOfSamples;
+    tableFile.read( fileIdentifier, 8 );
+    tableFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    tableFile.read( reinterpret_cast< char* >( &timeScale ), sizeof( timeScale ) );
+    tableFile.read( reinterpret_cast< char* >( &startTime_ ), sizeof( startTime_ ) );
+    tableFile.read( reinterpret_cast< char* >( &timeStep_ ), sizeof( timeStep_ ) );
+    tableFile.read( reinterpret_cast< char* >( &numberOfSamples ), sizeof( numberOfSamples ) );
+
+    if( !tableFile.good( ) ||
+            std::memcmp( fileIdentifier, EARTH_ORIENTATION_TABLE_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file " + fileName_ +
+                                  " is not an Earth orientation table" );
+    }
+    else if( fileVersion != EARTH_ORIENTATION_TABLE_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when loading Earth orientation table, file version " +
+                                  boost::lexical_cast< std::string >( fileVersion ) + " not supported" );
+    }
+
+    timeScale_ = static_cast< basic_astrodynamics::TimeScales >( timeScale );
+    numberOfSamples_ = static_cast< int >( numberOfSamples );
+}
+
+//! Function to retrieve the rotation angles from ITRS to GCRS, and UT1, at given time
+std::pair< Eigen::Vector5d, double > EarthOrientationAnglesTable::getRotationAnglesFromItrsToGcrs( const double time )
+{
+    Eigen::Vector6d interpolatedValues = interpolateTabulatedValues( time );
+    return std::make_pair( Eigen::Vector5d( interpolatedValues.segment( 0, 5 ) ), time + interpolatedValues( 5 ) );
+}
+
+//! Function to compute the rotation from ITRS to GCRS, and its time derivative, at given time
+void EarthOrientationAnglesTable::getRotationAndDerivativeFromItrsToGcrs(
+        const double time,
+        Eigen::Quaterniond& rotationToGcrs,
+        Eigen::Matrix3d& rotationToGcrsDerivative )
+{
+    static const Eigen::Matrix3d earthRotationDerivativePremultiplier =
+            reference_frames::Z_AXIS_ROTATION_MATRIX_DERIVATIVE_PREMULTIPLIER *
+            ( -2.0 * mathematical_constants::PI / 86400.0 * 1.00273781191135448 );
+
+    Eigen::Vector6d interpolatedValues = interpolateTabulatedValues( time );
+
+    // Compute sub-rotations that are shared by rotation and its derivative
+    Eigen::Quaterniond rotationFromTirsToGcrs =
+            calculateRotationFromCirsToGcrs( interpolatedValues( 0 ), interpolatedValues( 1 ), interpolatedValues( 2 ) ) *
+            calculateRotationFromTirsToCirs(
+                sofa_interface::calculateEarthRotationAngleTemplated< double >( time + interpolatedValues( 5 ) ) );
+    Eigen::Quaterniond rotationFromItrsToTirs = calculateRotationFromItrsToTirs(
+                interpolatedValues( 3 ), interpolatedValues( 4 ), getApproximateTioLocator( time ) );
+
+    rotationToGcrs = rotationFromTirsToGcrs * rotationFromItrsToTirs;
+    rotationToGcrsDerivative = rotationFromTirsToGcrs.toRotationMatrix( ) * earthRotationDerivativePremultiplier *
+            rotationFromItrsToTirs.toRotationMatrix( );
+}
+
+//! Function to write the full table to a binary file
+void EarthOrientationAnglesTable::writeToFile( const std::string& fileName ) const
+{
+    if( fileName_ != "" )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, table was loaded from file " + fileName_ );
+    }
+
+    std::ofstream tableFile( fileName.c_str( ), std::ios::binary );
+    if( !tableFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing Earth orientation table, could not open file " + fileName );
+    }
+
+    boost::int32_t timeScale = static_cast< boost::int32_t >( timeScale_ );
+    boost::int64_t numberOfSamples = static_cast< boost::int64_t >( numberOfSamples_ );
+    tableFile.write( EARTH_ORIENTATION_TABLE_FILE_IDENTIFIER, 8 );
+    tableFile.write( reinterpret_cast< const char* >( &EARTH_ORIENTATION_TABLE_FILE_VERSION ),
+                     sizeof( EARTH_ORIENTATION_TABLE_FILE_VERSION ) );
+    tableFile.write( reinterpret_cast< const char* >( &timeScale ), sizeof( timeScale ) );
+    tableFile.write( reinterpret_cast< const char* >( &startTime_ ), sizeof( startTime_ ) );
+    tableFile.write( reinterpret_cast< const char* >( &timeStep_ ), sizeof( timeStep_ ) );
+    tableFile.write( reinterpret_cast< const char* >( &numberOfSamples ), sizeof( numberOfSamples ) );
+    tableFile.write( reinterpret_cast< const char* >( windowData_.data( ) ),
+                     static_cast< std::streamsize >( windowData_.size( ) * sizeof( double ) ) );
+}
+
+//! Function to initialize the Lagrange interpolation denominators
+void EarthOrientationAnglesTable::setInterpolationDenominators( )
+{
+    if( interpolationOrder_ < 2 || interpolationOrder_ > 16 || interpolationOrder_ % 2 != 0 )
+    {
+        throw std::runtime_error( "Error in Earth orientation table, interpolation order must be even and in range [2,16], but is " +
+                                  boost::lexical_cast< std::string >( interpolationOrder_ ) );
+    }
+
+    interpolationDenominators_.resize( interpolationOrder_ );
+    for( int j = 0; j < interpolationOrder_; j++ )
+    {
+        interpolationDenominators_[ j ] = 1.0;
+        for( int k = 0; k < interpolationOrder_; k++ )
+        {
+            if( k != j )
+            {
+                interpolationDenominators_[ j ] *= static_cast< double >( j - k );
+            }
+        }
+    }
+}
+
+//! Function to interpolate all tabulated quantities at given time
+Eigen::Vector6d EarthOrientationAnglesTable::interpolateTabulatedValues( const double time )
+{
+    if( numberOfSamples_ < interpolationOrder_ )
+    {
+        throw std::runtime_error( "Error in Earth orientation table, number of epochs is smaller than interpolation order" );
+    }
+
+    // Determine first node of interpolation, and move nodes inward at edges of table.
+    double scaledTime = ( time - startTime_ ) / timeStep_;
+    if( scaledTime < 0.0 || scaledTime > static_cast< double >( numberOfSamples_ - 1 ) )
+    {
+        throw std::runtime_error( "Error in Earth orientation table, requested time " +
+                                  boost::lexical_cast< std::string >( time ) + " is outside of table range" );
+    }
+    int firstNodeIndex = static_cast< int >( std::floor( scaledTime ) ) - interpolationOrder_ / 2 + 1;
+    if( firstNodeIndex < 0 )
+    {
+        firstNodeIndex = 0;
+    }
+    else if( firstNodeIndex > numberOfSamples_ - interpolationOrder_ )
+    {
+        firstNodeIndex = numberOfSamples_ - interpolationOrder_;
+    }
+
+    // Make sure required data is in memory, and is not replaced by other threads while it is used
+    std::unique_lock< std::mutex > windowLock( windowMutex_, std::defer_lock );
+    if( fileName_ != "" )
+    {
+        windowLock.lock( );
+    }
+    if( firstNodeIndex < windowStartIndex_ ||
+            firstNodeIndex + interpolationOrder_ > windowStartIndex_ + windowSize_ )
+    {
+        loadWindow( firstNodeIndex, firstNodeIndex + interpolationOrder_ - 1 );
+    }
+
+    // Compute Lagrange polynomial numerators, using prefix/suffix products of ( u - k ).
+    double normalizedTime = scaledTime - static_cast< double >( firstNodeIndex );
+    double prefixProducts[ 16 ], suffixProducts[ 16 ];
+    prefixProducts[ 0 ] = 1.0;
+    suffixProducts[ interpolationOrder_ - 1 ] = 1.0;
+    for( int k = 1; k < interpolationOrder_; k++ )
+    {
+        prefixProducts[ k ] = prefixProducts[ k - 1 ] * ( normalizedTime - static_cast< double >( k - 1 ) );
+        suffixProducts[ interpolationOrder_ - 1 - k ] = suffixProducts[ interpolationOrder_ - k ] *
+                ( normalizedTime - static_cast< double >( interpolationOrder_ - k ) );
+    }
+
+    // Evaluate interpolating polynomial for all quantities in one pass
+    Eigen::Vector6d interpolatedValues = Eigen::Vector6d::Zero( );
+    const double* currentData = windowData_.data( ) + 6 * ( firstNodeIndex - windowStartIndex_ );
+    for( int j = 0; j < interpolationOrder_; j++ )
+    {
+        interpolatedValues += ( prefixProducts[ j ] * suffixProducts[ j ] / interpolationDenominators_[ j ] ) *
+                Eigen::Map< const Eigen::Vector6d >( currentData + 6 * j );
+    }
+
+    return interpolatedValues;
+}
+
+//! Function to load the window of data from file, such that it contains the requested range of epochs
+void EarthOrientationAnglesTable::loadWindow( const int firstRequiredIndex, const int lastRequiredIndex )
+{
+    if( fileName_ == "" )
+    {
+        throw std::runtime_error( "Error in Earth orientation table, requested data not available" );
+    }
+
+    // Center window on requested data, and keep it inside table.
+    windowStartIndex_ = ( firstRequiredIndex + lastRequiredIndex ) / 2 - samplesPerWindow_ / 2;
+    windowStartIndex_ = std::max( 0, std::min( windowStartIndex_, numberOfSamples_ - samplesPerWindow_ ) );
+    windowSize_ = std::min( samplesPerWindow_, numberOfSamples_ - windowStartIndex_ );
+
+    // Read data from file
+    std::ifstream tableFile( fileName_.c_str( ), std::ios::binary );
+    tableFile.seekg( EARTH_ORIENTATION_TABLE_HEADER_SIZE +
+                     static_cast< std::streamoff >( 6 * sizeof( double ) ) * windowStartIndex_ );
+    windowData_.resize( 6 * windowSize_ );
+    tableFile.read( reinterpret_cast< char* >( windowData_.data( ) ),
+                    static_cast< std::streamsize >( windowData_.size( ) * sizeof( double ) ) );
+    if( !tableFile.good( ) )
+    {
+        throw std::runtime_error( "Error when loading data from Earth orientation table file " + fileName_ );
+    }
+    numberOfWindowLoads_++;
+}
+
+//! Function to create a table of Earth orientation angles and UT1 from an EarthOrientationAnglesCalculator
+std::shared_ptr< EarthOrientationAnglesTable > createEarthOrientationAnglesTable(
+        const double intervalStart, const double intervalEnd, const double timeStep,
+        const basic_astrodynamics::TimeScales timeScale,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const int interpolationOrder )
+{
+    // Iterate over all times and compute rotation parameters
+    int numberOfSamples = static_cast< int >( std::ceil( ( intervalEnd - intervalStart ) / timeStep ) ) + 1;
+    std::vector< Eigen::Vector6d > tabulatedValues;
+    tabulatedValues.resize( numberOfSamples );
+
+    std::pair< Eigen::Vector5d, double > currentRotationValues;
+    double currentTime;
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        currentTime = intervalStart + static_cast< double >( i ) * timeStep;
+        currentRotationValues = earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                    currentTime, timeScale );
+        tabulatedValues[ i ].segment( 0, 5 ) = currentRotationValues.first;
+        tabulatedValues[ i ]( 5 ) = currentRotationValues.second - currentTime;
+    }
+
+    return std::make_shared< EarthOrientationAnglesTable >(
+                intervalStart, timeStep, tabulatedValues, timeScale, interpolationOrder );
+}
+
+//! Function to check whether a table of Earth orientation angles is consistent with an EarthOrientationAnglesCalculator
+void checkEarthOrientationAnglesTableConsistency(
+        const std::shared_ptr< EarthOrientationAnglesTable > anglesTable,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const int numberOfTestEpochs,
+        const double angleTolerance,
+        const double ut1Tolerance )
+{
+    if( numberOfTestEpochs < 1 )
+    {
+        throw std::runtime_error( "Error when checking Earth orientation table, number of test epochs must be positive" );
+    }
+
+    std::pair< Eigen::Vector5d, double > tabulatedAngles, directAngles;
+    for( int i = 0; i < numberOfTestEpochs; i++ )
+    {
+        // Last epoch is excluded, as rounding errors may put it (slightly) outside of the table
+        int testIndex = 0;
+        if( numberOfTestEpochs > 1 )
+        {
+            testIndex = ( i * ( anglesTable->getNumberOfSamples( ) - 2 ) ) / ( numberOfTestEpochs - 1 );
+        }
+        double testTime = anglesTable->getStartTime( ) + static_cast< double >( testIndex ) * anglesTable->getTimeStep( );
+
+        tabulatedAngles = anglesTable->getRotationAnglesFromItrsToGcrs( testTime );
+        directAngles = earthOrientationCalculator->getRotationAnglesFromItrsToGcrs< double >(
+                    testTime, anglesTable->getTimeScale( ) );
+        if( ( tabulatedAngles.first - directAngles.first ).cwiseAbs( ).maxCoeff( ) > angleTolerance ||
+                std::fabs( tabulatedAngles.second - directAngles.second ) > ut1Tolerance )
+        {
+            throw std::runtime_error(
+                        "Error, Earth orientation table is inconsistent with Earth orientation settings (nutation theory, "
+                        "EOP data or corrections) at time " + boost::lexical_cast< std::string >( testTime ) );
+        }
+    }
+}
+
+} // namespace earth_orientation
+
+} // namespace tudat
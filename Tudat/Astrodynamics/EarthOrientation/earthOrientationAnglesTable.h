@@ -0,0 +1,236 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_EARTHORIENTATIONANGLESTABLE_H
+#define TUDAT_EARTHORIENTATIONANGLESTABLE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+
+namespace tudat
+{
+
+namespace earth_orientation
+{
+
+//! Class containing precomputed, equidistantly tabulated Earth orientation angles
+/*!
+ *  Class containing precomputed, equidistantly tabulated Earth orientation angles (X, Y, s, x_p, y_p in IERS 2010 notation)
+ *  and UT1, for fast evaluation of the ITRS<->GCRS rotation. The table is generated once from an
+ *  EarthOrientationAnglesCalculator (see createEarthOrientationAnglesTable), and can be written to a compact binary file, from
+ *  which it can subsequently be re-loaded. When loaded from file, only a window of the data around the requested epoch is kept
+ *  in memory, which is re-loaded whenever an epoch outside of the current window is requested. (Re)loading of this window is
+ *  protected by a mutex, so that a single table may be evaluated from multiple threads.
+ *  Values in between tabulated epochs are obtained by equidistant Lagrange interpolation. Instead of UT1 itself, the difference
+ *  between UT1 and the time in the table's time scale is tabulated, which varies slowly and can be interpolated without loss of
+ *  precision (NOTE: if the table time scale is UTC, this difference contains leap-second discontinuities).
+ *
+ *  The binary file format is: 8-character identifier ("TUDATEOT"), format version (int32), time scale (int32), start time
+ *  (double), time step (double), number of epochs (int64), followed by 6 doubles (X, Y, s, x_p, y_p, UT1 - t) per epoch. All
+ *  values are written in native byte order.
+ */
+class EarthOrientationAnglesTable
+{
+public:
+
+    //! Constructor from tabulated data in memory
+    /*!
+     *  Constructor from tabulated data in memory
+     *  \param startTime Epoch of first entry in tabulatedValues
+     *  \param timeStep Time step between subsequent entries in tabulatedValues
+     *  \param tabulatedValues Tabulated values of X, Y, s, x_p, y_p and UT1 - t (in that order)
+     *  \param timeScale Time scale in which the independent variable (and input to class functions) is defined
+     *  \param interpolationOrder Number of points used for Lagrange interpolation (must be even, and at most 16)
+     */
+    EarthOrientationAnglesTable(
+            const double startTime,
+            const double timeStep,
+            const std::vector< Eigen::Vector6d >& tabulatedValues,
+            const basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tdb_scale,
+            const int interpolationOrder = 6 );
+
+    //! Constructor from binary file, loading the data lazily
+    /*!
+     *  Constructor from binary file (as written by writeToFile), loading the data lazily. Only the file header is read upon
+     *  construction, data is loaded in windows of samplesPerWindow epochs, as required by the epochs at which the table is
+     *  evaluated.
+     *  \param fileName Name of the binary file from which the table is to be loaded
+     *  \param samplesPerWindow Number of epochs that are kept in memory at any given time
+     *  \param interpolationOrder Number of points used for Lagrange interpolation (must be even, and at most 16)
+     */
+    EarthOrientationAnglesTable(
+            const std::string& fileName,
+            const int samplesPerWindow = 8192,
+            const int interpolationOrder = 6 );
+
+    //! Function to retrieve the rotation angles from ITRS to GCRS, and UT1, at given time
+    /*!
+     *  Function to retrieve the rotation angles from ITRS to GCRS, and UT1, at given time, interpolated from the table. Output
+     *  is in the same format as EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param time Time (in time scale of table) at which angles are to be retrieved.
+     *  \return Rotation angles for ITRS<->GCRS transformation at given epoch. First pair entry is: X, Y, s, x_p, y_p. Second
+     *  defines UT1.
+     */
+    std::pair< Eigen::Vector5d, double > getRotationAnglesFromItrsToGcrs( const double time );
+
+    //! Function to compute the rotation from ITRS to GCRS, and its time derivative, at given time
+    /*!
+     *  Function to compute the rotation from ITRS to GCRS, and its time derivative, at given time. The angles are interpolated
+     *  only once, and the sub-rotations shared by the rotation and its derivative are computed only once. The derivative is
+     *  approximated in the same manner as in calculateRotationRateFromItrsToGcrs (only the Earth rotation part is
+     *  differentiated).
+     *  \param time Time (in time scale of table) at which rotation is to be computed.
+     *  \param rotationToGcrs Rotation from ITRS to GCRS (returned by reference)
+     *  \param rotationToGcrsDerivative Time derivative of rotation matrix from ITRS to GCRS (returned by reference)
+     */
+    void getRotationAndDerivativeFromItrsToGcrs(
+            const double time,
+            Eigen::Quaterniond& rotationToGcrs,
+            Eigen::Matrix3d& rotationToGcrsDerivative );
+
+    //! Function to write the full table to a binary file
+    /*!
+     *  Function to write the full table to a binary file, in the format described in the class documentation. Only allowed
+     *  for tables that were not themselves loaded from file.
+     *  \param fileName Name of file to which the table is to be written.
+     */
+    void writeToFile( const std::string& fileName ) const;
+
+    //! Function to retrieve the epoch of the first entry in the table
+    double getStartTime( ){ return startTime_; }
+
+    //! Function to retrieve the epoch of the last entry in the table
+    double getEndTime( ){ return startTime_ + static_cast< double >( numberOfSamples_ - 1 ) * timeStep_; }
+
+    //! Function to retrieve the time step between the entries in the table
+    double getTimeStep( ){ return timeStep_; }
+
+    //! Function to retrieve the number of epochs in the table
+    int getNumberOfSamples( ){ return numberOfSamples_; }
+
+    //! Function to retrieve the time scale in which the independent variable of the table is defined
+    basic_astrodynamics::TimeScales getTimeScale( ){ return timeScale_; }
+
+    //! Function to retrieve the number of times data has been (re)loaded from file.
+    int getNumberOfWindowLoads( ){ return numberOfWindowLoads_; }
+
+private:
+
+    //! Function to initialize the Lagrange interpolation denominators
+    void setInterpolationDenominators( );
+
+    //! Function to interpolate all tabulated quantities at given time
+    /*!
+     *  Function to interpolate all tabulated quantities at given time, (re)loading a data window from file if required.
+     *  \param time Time at which the data is to be interpolated
+     *  \return Interpolated values of X, Y, s, x_p, y_p and UT1 - t
+     */
+    Eigen::Vector6d interpolateTabulatedValues( const double time );
+
+    //! Function to load the window of data from file, such that it contains the requested range of epochs
+    /*!
+     *  Function to load the window of data from file, such that it contains the requested range of epochs
+     *  \param firstRequiredIndex Index of first epoch that is to be in memory after the call.
+     *  \param lastRequiredIndex Index of last epoch that is to be in memory after the call.
+     */
+    void loadWindow( const int firstRequiredIndex, const int lastRequiredIndex );
+
+    //! Epoch of first entry in table
+    double startTime_;
+
+    //! Time step between subsequent entries in table
+    double timeStep_;
+
+    //! Total number of epochs in table
+    int numberOfSamples_;
+
+    //! Time scale in which the independent variable is defined
+    basic_astrodynamics::TimeScales timeScale_;
+
+    //! Number of points used for Lagrange interpolation
+    int interpolationOrder_;
+
+    //! Denominators of equidistant Lagrange polynomials (in units of time step)
+    std::vector< double > interpolationDenominators_;
+
+    //! Name of the file from which data is loaded (empty if table is kept fully in memory)
+    std::string fileName_;
+
+    //! Number of epochs that are kept in memory when loading data from file
+    int samplesPerWindow_;
+
+    //! Index of first epoch currently in memory
+    int windowStartIndex_;
+
+    //! Number of epochs currently in memory
+    int windowSize_;
+
+    //! Data currently in memory, 6 entries per epoch (X, Y, s, x_p, y_p, UT1 - t)
+    std::vector< double > windowData_;
+
+    //! Number of times data has been (re)loaded from file.
+    int numberOfWindowLoads_;
+
+    //! Mutex protecting the data window of tables that are loaded from file.
+    std::mutex windowMutex_;
+};
+
+//! Function to create a table of Earth orientation angles and UT1 from an EarthOrientationAnglesCalculator
+/*!
+ *  Function to create a table of Earth orientation angles and UT1 from an EarthOrientationAnglesCalculator, at an equidistant
+ *  set of epochs, which may then be used directly, or written to a binary file for use in subsequent runs.
+ *  \param intervalStart Start of time interval where table is to be generated
+ *  \param intervalEnd End of time interval where table is to be generated (last epoch is first epoch >= intervalEnd)
+ *  \param timeStep Time step between epochs in table
+ *  \param timeScale Time scale in which epochs are defined
+ *  \param earthOrientationCalculator Object from which Earth orientation data is to be retrieved
+ *  \param interpolationOrder Number of points used for Lagrange interpolation (must be even, and at most 16)
+ *  \return Table of Earth orientation angles and UT1
+ */
+std::shared_ptr< EarthOrientationAnglesTable > createEarthOrientationAnglesTable(
+        const double intervalStart, const double intervalEnd, const double timeStep,
+        const basic_astrodynamics::TimeScales timeScale = basic_astrodynamics::tdb_scale,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator =
+        createStandardEarthOrientationCalculator( ),
+        const int interpolationOrder = 6 );
+
+//! Function to check whether a table of Earth orientation angles is consistent with an EarthOrientationAnglesCalculator
+/*!
+ *  Function to check whether a table of Earth orientation angles is consistent with an EarthOrientationAnglesCalculator,
+ *  i.e. whether it was generated with the same nutation theory, EOP data and corrections as those of the calculator it is to
+ *  replace. The angles are compared at a number of tabulated epochs (distributed evenly over the table, excluding the last
+ *  epoch), at which the interpolation is exact, so that any significant difference indicates different settings. An
+ *  exception is thrown if the table is inconsistent.
+ *  \param anglesTable Table of Earth orientation angles that is to be checked
+ *  \param earthOrientationCalculator Object from which Earth orientation angles are computed directly
+ *  \param numberOfTestEpochs Number of tabulated epochs at which the angles are compared
+ *  \param angleTolerance Maximum difference in X, Y, s, x_p and y_p [rad]
+ *  \param ut1Tolerance Maximum difference in UT1 [s]
+ */
+void checkEarthOrientationAnglesTableConsistency(
+        const std::shared_ptr< EarthOrientationAnglesTable > anglesTable,
+        const std::shared_ptr< EarthOrientationAnglesCalculator > earthOrientationCalculator,
+        const int numberOfTestEpochs = 5,
+        const double angleTolerance = 1.0E-13,
+        const double ut1Tolerance = 1.0E-6 );
+
+} // namespace earth_orientation
+
+} // namespace tudat
+
+#endif // TUDAT_EARTHORIENTATIONANGLESTABLE_H
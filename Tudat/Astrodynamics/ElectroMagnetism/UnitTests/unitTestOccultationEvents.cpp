@@ -0,0 +1,264 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/occultationEvents.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/radiationPressureInterface.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace electro_magnetism;
+
+BOOST_AUTO_TEST_SUITE( test_occultation_events )
+
+// Test geometry: Sun fixed along the positive x-axis, Earth at the origin, and a satellite in a circular orbit in the
+// xy-plane, so that the satellite is occulted once per orbit.
+const double sunRadius = 6.96E8;
+const double earthRadius = 6378.137E3;
+const double orbitRadius = 7000.0E3;
+const double orbitalPeriod = 2.0 * mathematical_constants::PI * std::sqrt(
+            orbitRadius * orbitRadius * orbitRadius / 3.986004418E14 );
+
+Eigen::Vector3d getSunPosition( const double )
+{
+    return physical_constants::ASTRONOMICAL_UNIT * Eigen::Vector3d::UnitX( );
+}
+
+Eigen::Vector3d getEarthPosition( const double )
+{
+    return Eigen::Vector3d::Zero( );
+}
+
+Eigen::Vector3d getSatellitePosition( const double time )
+{
+    const double angle = 2.0 * mathematical_constants::PI * time / orbitalPeriod;
+    return orbitRadius * ( Eigen::Vector3d( ) << std::cos( angle ), std::sin( angle ), 0.0 ).finished( );
+}
+
+double getShadowFunction( const double time )
+{
+    return mission_geometry::computeShadowFunction(
+                getSunPosition( time ), sunRadius, getEarthPosition( time ), earthRadius,
+                getSatellitePosition( time ) );
+}
+
+//! Test computation of occultation intervals and phases.
+BOOST_AUTO_TEST_CASE( testOccultationEventTable )
+{
+    const double startTime = 0.0;
+    const double endTime = 2.5 * orbitalPeriod;
+
+    OccultationEventTable occultationEventTable(
+                &getSunPosition, sunRadius,
+                std::vector< std::function< Eigen::Vector3d( const double ) > >( { &getEarthPosition } ),
+                std::vector< double >( { earthRadius } ), &getSatellitePosition, startTime, endTime, 60.0, 1.0E-4 );
+
+    // Satellite starts in sunlight (at +x), and is occulted around half an orbit.
+    const std::vector< OccultationInterval >& occultationIntervals =
+            occultationEventTable.getOccultationIntervals( 0 );
+    BOOST_CHECK_EQUAL( occultationIntervals.size( ), 3 );
+    BOOST_CHECK_EQUAL( occultationEventTable.getOccultationBoundaryTimes( ).size( ), 4 * 3 - 2 );
+
+    for( unsigned int i = 0; i < occultationIntervals.size( ); i++ )
+    {
+        const OccultationInterval& interval = occultationIntervals.at( i );
+
+        // Check start and end times of the occultations (the last one is in progress at the end time).
+        BOOST_CHECK_EQUAL( getShadowFunction( interval.partialOccultationStartTime_ - 1.0E-3 ), 1.0 );
+        BOOST_CHECK_LT( getShadowFunction( interval.partialOccultationStartTime_ + 1.0E-3 ), 1.0 );
+        BOOST_CHECK_GT( getShadowFunction( interval.totalOccultationStartTime_ - 1.0E-3 ), 0.0 );
+        BOOST_CHECK_EQUAL( getShadowFunction( interval.totalOccultationStartTime_ + 1.0E-3 ), 0.0 );
+        if( i < 2 )
+        {
+            BOOST_CHECK_EQUAL( getShadowFunction( interval.totalOccultationEndTime_ - 1.0E-3 ), 0.0 );
+            BOOST_CHECK_GT( getShadowFunction( interval.totalOccultationEndTime_ + 1.0E-3 ), 0.0 );
+            BOOST_CHECK_LT( getShadowFunction( interval.partialOccultationEndTime_ - 1.0E-3 ), 1.0 );
+            BOOST_CHECK_EQUAL( getShadowFunction( interval.partialOccultationEndTime_ + 1.0E-3 ), 1.0 );
+
+            // Check symmetry of occultation w.r.t. the time at which the satellite is at -x.
+            const double centralTime = ( 0.5 + i ) * orbitalPeriod;
+            BOOST_CHECK_SMALL( interval.partialOccultationStartTime_ + interval.partialOccultationEndTime_ -
+                               2.0 * centralTime, 1.0E-3 );
+            BOOST_CHECK_SMALL( interval.totalOccultationStartTime_ + interval.totalOccultationEndTime_ -
+                               2.0 * centralTime, 1.0E-3 );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( interval.totalOccultationEndTime_, endTime );
+            BOOST_CHECK_EQUAL( interval.partialOccultationEndTime_, endTime );
+        }
+    }
+
+    // Check consistency of occultation phases with shadow function, both for increasing and decreasing times, and
+    // consistency of the phases found with and without interval index.
+    for( int direction = 0; direction < 2; direction++ )
+    {
+        int numberOfPartialPhases = 0;
+        int intervalIndex = 0;
+        for( int i = 0; i <= 10000; i++ )
+        {
+            const double time =
+                    startTime + ( ( direction == 0 ) ? i : ( 10000 - i ) ) * ( endTime - startTime ) / 1.0E4;
+            const OccultationPhase occultationPhase = occultationEventTable.getOccultationPhase( time, 0 );
+            BOOST_CHECK_EQUAL( occultationEventTable.getOccultationPhase( time, 0, intervalIndex ), occultationPhase );
+            const double shadowFunction = getShadowFunction( time );
+            if( occultationPhase == no_occultation_phase )
+            {
+                BOOST_CHECK_EQUAL( shadowFunction, 1.0 );
+            }
+            else if( occultationPhase == total_occultation_phase )
+            {
+                BOOST_CHECK_EQUAL( shadowFunction, 0.0 );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( occultationPhase, partial_occultation_phase );
+                numberOfPartialPhases++;
+            }
+        }
+        BOOST_CHECK_LT( numberOfPartialPhases, 100 );
+    }
+
+    BOOST_CHECK_EQUAL( occultationEventTable.getOccultationPhase( endTime + 1.0, 0 ), unknown_occultation_phase );
+}
+
+//! Test use of occultation event table and multiple occultations in radiation pressure interface.
+BOOST_AUTO_TEST_CASE( testRadiationPressureInterfaceWithOccultationEvents )
+{
+    const double totalSolarPower = 1367.0 * 4.0 * mathematical_constants::PI *
+            physical_constants::ASTRONOMICAL_UNIT * physical_constants::ASTRONOMICAL_UNIT;
+    const double endTime = 2.0 * orbitalPeriod;
+
+    // Create radiation pressure interfaces with and without occultation event table.
+    double currentTime = 0.0;
+    std::vector< std::shared_ptr< RadiationPressureInterface > > radiationPressureInterfaces;
+    for( int i = 0; i < 2; i++ )
+    {
+        radiationPressureInterfaces.push_back(
+                    std::make_shared< RadiationPressureInterface >(
+                        [ & ]( ){ return totalSolarPower; },
+                        [ & ]( ){ return getSunPosition( currentTime ); },
+                        [ & ]( ){ return getSatellitePosition( currentTime ); },
+                        1.0, 1.0,
+                        std::vector< std::function< Eigen::Vector3d( ) > >(
+                            { [ & ]( ){ return getEarthPosition( currentTime ); } } ),
+                        std::vector< double >( { earthRadius } ), sunRadius ) );
+    }
+    radiationPressureInterfaces.at( 1 )->setOccultationEventTable(
+                std::make_shared< OccultationEventTable >(
+                    &getSunPosition, sunRadius,
+                    std::vector< std::function< Eigen::Vector3d( const double ) > >( { &getEarthPosition } ),
+                    std::vector< double >( { earthRadius } ), &getSatellitePosition, 0.0, endTime, 60.0 ) );
+
+    // Check that identical radiation pressures are computed, both inside and outside the table time interval.
+    for( int i = 0; i <= 2000; i++ )
+    {
+        currentTime = i * 1.1 * endTime / 2000.0;
+        radiationPressureInterfaces.at( 0 )->updateInterface( currentTime );
+        radiationPressureInterfaces.at( 1 )->updateInterface( currentTime );
+        BOOST_CHECK_EQUAL( radiationPressureInterfaces.at( 0 )->getCurrentRadiationPressure( ),
+                           radiationPressureInterfaces.at( 1 )->getCurrentRadiationPressure( ) );
+    }
+
+    // Check that an inconsistent table is rejected.
+    BOOST_CHECK_THROW( radiationPressureInterfaces.at( 1 )->setOccultationEventTable(
+                           std::make_shared< OccultationEventTable >(
+                               &getSunPosition, sunRadius,
+                               std::vector< std::function< Eigen::Vector3d( const double ) > >( ),
+                               std::vector< double >( ), &getSatellitePosition, 0.0, endTime, 60.0 ) ),
+                       std::runtime_error );
+
+    // Create geometry in which two small bodies partially occult the Sun, on opposite sides of its disk, such that
+    // the occulting bodies do not overlap.
+    const Eigen::Vector3d satellitePosition = Eigen::Vector3d::Zero( );
+    const Eigen::Vector3d sunPosition = -physical_constants::ASTRONOMICAL_UNIT * Eigen::Vector3d::UnitX( );
+    const double sunApparentRadius = std::asin( sunRadius / physical_constants::ASTRONOMICAL_UNIT );
+    const double occultingBodyDistance = 1.0E9;
+    const double occultingBodyRadius = 0.3 * sunApparentRadius * occultingBodyDistance;
+    std::vector< Eigen::Vector3d > occultingBodyPositions;
+    for( int i = 0; i < 2; i++ )
+    {
+        const double angle = ( ( i == 0 ) ? 1.0 : -0.9 ) * sunApparentRadius;
+        occultingBodyPositions.push_back(
+                    occultingBodyDistance *
+                    ( Eigen::Vector3d( ) << -std::cos( angle ), std::sin( angle ), 0.0 ).finished( ) );
+    }
+
+    // Compute shadow functions of individual occulting bodies, and of both together.
+    std::vector< double > shadowFunctions;
+    for( int i = 0; i < 3; i++ )
+    {
+        std::vector< std::function< Eigen::Vector3d( ) > > occultingBodyPositionFunctions;
+        if( i != 1 )
+        {
+            occultingBodyPositionFunctions.push_back( [ & ]( ){ return occultingBodyPositions.at( 0 ); } );
+        }
+        if( i != 0 )
+        {
+            occultingBodyPositionFunctions.push_back( [ & ]( ){ return occultingBodyPositions.at( 1 ); } );
+        }
+
+        RadiationPressureInterface occultedInterface(
+                    [ & ]( ){ return totalSolarPower; }, [ & ]( ){ return sunPosition; },
+                    [ & ]( ){ return satellitePosition; }, 1.0, 1.0, occultingBodyPositionFunctions,
+                    std::vector< double >( occultingBodyPositionFunctions.size( ), occultingBodyRadius ), sunRadius );
+        occultedInterface.updateInterface( 0.0 );
+        shadowFunctions.push_back(
+                    occultedInterface.getCurrentRadiationPressure( ) /
+                    calculateRadiationPressure( totalSolarPower, physical_constants::ASTRONOMICAL_UNIT ) );
+    }
+
+    // Occulted areas are disjoint, so occulted fractions are added.
+    BOOST_CHECK_LT( shadowFunctions.at( 0 ), 1.0 );
+    BOOST_CHECK_LT( shadowFunctions.at( 1 ), 1.0 );
+    BOOST_CHECK_CLOSE_FRACTION( shadowFunctions.at( 2 ), shadowFunctions.at( 0 ) + shadowFunctions.at( 1 ) - 1.0,
+                                1.0E-12 );
+}
+
+//! Test input checks of occultation event table.
+BOOST_AUTO_TEST_CASE( testOccultationEventTableErrors )
+{
+    BOOST_CHECK_THROW( OccultationEventTable(
+                           &getSunPosition, sunRadius,
+                           std::vector< std::function< Eigen::Vector3d( const double ) > >( { &getEarthPosition } ),
+                           std::vector< double >( ), &getSatellitePosition, 0.0, 1.0E4, 60.0 ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( OccultationEventTable(
+                           &getSunPosition, sunRadius,
+                           std::vector< std::function< Eigen::Vector3d( const double ) > >( { &getEarthPosition } ),
+                           std::vector< double >( { earthRadius } ), &getSatellitePosition, 0.0, 1.0E4, 0.0 ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( OccultationEventTable(
+                           &getSunPosition, sunRadius,
+                           std::vector< std::function< Eigen::Vector3d( const double ) > >( { &getEarthPosition } ),
+                           std::vector< double >( { earthRadius } ), &getSatellitePosition, 1.0E4, 0.0, 60.0 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,312 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/ElectroMagnetism/occultationEvents.h"
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+#include "Tudat/Mathematics/RootFinders/terminationConditions.h"
+
+namespace tudat
+{
+
+namespace electro_magnetism
+{
+
+//! Function to compute the functions of which the zeroes define the start and end of partial and total occultation.
+std::pair< double, double > computeOccultationConditionFunctions(
+        const Eigen::Vector3d& sourcePosition,
+        const double sourceRadius,
+        const Eigen::Vector3d& occultingBodyPosition,
+        const double occultingBodyRadius,
+        const Eigen::Vector3d& targetPosition )
+{
+    const Eigen::Vector3d targetPositionRelativeToOccultingBody = targetPosition - occultingBodyPosition;
+    const Eigen::Vector3d sourcePositionRelativeToTarget = sourcePosition - targetPosition;
+    const double distanceToOccultingBody = targetPositionRelativeToOccultingBody.norm( );
+    const double distanceToSource = sourcePositionRelativeToTarget.norm( );
+
+    // Compute apparent radii and separation of both bodies, as seen from the target.
+    const double sourceApparentRadius = std::asin( std::min( sourceRadius / distanceToSource, 1.0 ) );
+    const double occultingBodyApparentRadius =
+            std::asin( std::min( occultingBodyRadius / distanceToOccultingBody, 1.0 ) );
+    const double apparentSeparation = std::acos( std::max( std::min(
+            -targetPositionRelativeToOccultingBody.dot( sourcePositionRelativeToTarget ) /
+            ( distanceToOccultingBody * distanceToSource ), 1.0 ), -1.0 ) );
+
+    return std::make_pair( apparentSeparation - ( sourceApparentRadius + occultingBodyApparentRadius ),
+                           apparentSeparation - std::fabs( occultingBodyApparentRadius - sourceApparentRadius ) );
+}
+
+//! Constructor.
+OccultationEventTable::OccultationEventTable(
+        const std::function< Eigen::Vector3d( const double ) > sourcePositionFunction,
+        const double sourceRadius,
+        const std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPositionFunctions,
+        const std::vector< double >& occultingBodyRadii,
+        const std::function< Eigen::Vector3d( const double ) > targetPositionFunction,
+        const double startTime,
+        const double endTime,
+        const double searchTimeStep,
+        const double timeTolerance,
+        const double boundaryTimeMargin ):
+    startTime_( startTime ), endTime_( endTime ), boundaryTimeMargin_( boundaryTimeMargin )
+{
+    if( occultingBodyPositionFunctions.size( ) != occultingBodyRadii.size( ) )
+    {
+        throw std::runtime_error( "Error when creating occultation event table, number of occulting body positions and "
+                                  "radii is inconsistent." );
+    }
+
+    if( !( searchTimeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating occultation event table, search time step must be positive." );
+    }
+
+    if( !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when creating occultation event table, end time must be larger than start "
+                                  "time." );
+    }
+
+    // Create root finder for the start and end times of the occultations.
+    std::shared_ptr< root_finders::BisectionCore< double > > rootFinder =
+            std::make_shared< root_finders::BisectionCore< double > >(
+                std::bind( &root_finders::termination_conditions::RootAbsoluteToleranceTerminationCondition<
+                           double >::checkTerminationCondition,
+                           std::make_shared< root_finders::termination_conditions::
+                           RootAbsoluteToleranceTerminationCondition< double > >( timeTolerance, 100, false ),
+                           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                           std::placeholders::_4, std::placeholders::_5 ) );
+
+    const int numberOfSearchSteps = static_cast< int >( std::ceil( ( endTime - startTime ) / searchTimeStep ) );
+    occultationIntervals_.resize( occultingBodyPositionFunctions.size( ) );
+
+    for( unsigned int i = 0; i < occultingBodyPositionFunctions.size( ); i++ )
+    {
+        const std::function< Eigen::Vector3d( const double ) > occultingBodyPositionFunction =
+                occultingBodyPositionFunctions.at( i );
+        const double occultingBodyRadius = occultingBodyRadii.at( i );
+        std::function< std::pair< double, double >( const double ) > conditionFunctions =
+                [ & ]( const double time )
+        {
+            return computeOccultationConditionFunctions(
+                        sourcePositionFunction( time ), sourceRadius, occultingBodyPositionFunction( time ),
+                        occultingBodyRadius, targetPositionFunction( time ) );
+        };
+
+        // Properties of the occultation interval that is currently in progress.
+        bool isOccultationInProgress = false;
+        int numberOfTotalOccultations = 0;
+        double partialOccultationStartTime = TUDAT_NAN;
+        double totalOccultationStartTime = TUDAT_NAN;
+        double totalOccultationEndTime = TUDAT_NAN;
+
+        double previousTime = startTime;
+        std::pair< double, double > previousConditionValues = conditionFunctions( startTime );
+        if( previousConditionValues.first < 0.0 )
+        {
+            isOccultationInProgress = true;
+            partialOccultationStartTime = startTime;
+        }
+        if( previousConditionValues.second < 0.0 )
+        {
+            numberOfTotalOccultations++;
+            totalOccultationStartTime = startTime;
+        }
+
+        for( int k = 1; k <= numberOfSearchSteps; k++ )
+        {
+            const double currentTime = ( k == numberOfSearchSteps ) ? endTime : startTime + k * searchTimeStep;
+            const std::pair< double, double > currentConditionValues = conditionFunctions( currentTime );
+
+            // Determine times of sign changes of both condition functions in the current search step.
+            double partialOccultationEventTime = TUDAT_NAN;
+            double totalOccultationEventTime = TUDAT_NAN;
+            for( int j = 0; j < 2; j++ )
+            {
+                const double previousValue =
+                        ( j == 0 ) ? previousConditionValues.first : previousConditionValues.second;
+                const double currentValue =
+                        ( j == 0 ) ? currentConditionValues.first : currentConditionValues.second;
+                if( ( previousValue < 0.0 ) != ( currentValue < 0.0 ) )
+                {
+                    rootFinder->resetBoundaries( previousTime, currentTime );
+                    const double eventTime = rootFinder->execute(
+                                std::make_shared< basic_mathematics::FunctionProxy< double, double > >(
+                                    [ & ]( const double time )
+                    {
+                        return ( j == 0 ) ? conditionFunctions( time ).first : conditionFunctions( time ).second;
+                    } ), 0.5 * ( previousTime + currentTime ) );
+                    if( j == 0 )
+                    {
+                        partialOccultationEventTime = eventTime;
+                    }
+                    else
+                    {
+                        totalOccultationEventTime = eventTime;
+                    }
+                }
+            }
+
+            // Process start of occultations, followed by end of occultations (the total occultation condition can
+            // only change within the partial occultation).
+            if( partialOccultationEventTime == partialOccultationEventTime && currentConditionValues.first < 0.0 )
+            {
+                isOccultationInProgress = true;
+                numberOfTotalOccultations = 0;
+                partialOccultationStartTime = partialOccultationEventTime;
+                totalOccultationStartTime = TUDAT_NAN;
+                totalOccultationEndTime = TUDAT_NAN;
+            }
+            if( totalOccultationEventTime == totalOccultationEventTime )
+            {
+                if( currentConditionValues.second < 0.0 )
+                {
+                    numberOfTotalOccultations++;
+                    totalOccultationStartTime = std::max( totalOccultationEventTime, partialOccultationStartTime );
+                }
+                else
+                {
+                    totalOccultationEndTime = totalOccultationEventTime;
+                }
+            }
+            if( partialOccultationEventTime == partialOccultationEventTime && !( currentConditionValues.first < 0.0 ) )
+            {
+                if( isOccultationInProgress )
+                {
+                    // Total occultation phases are not used for (exceptional) intervals with multiple total
+                    // occultations.
+                    occultationIntervals_[ i ].push_back(
+                                OccultationInterval(
+                                    partialOccultationStartTime,
+                                    ( numberOfTotalOccultations == 1 ) ? totalOccultationStartTime : TUDAT_NAN,
+                                    ( numberOfTotalOccultations == 1 ) ?
+                                        std::min( totalOccultationEndTime, partialOccultationEventTime ) : TUDAT_NAN,
+                                    partialOccultationEventTime ) );
+                }
+                isOccultationInProgress = false;
+            }
+
+            previousTime = currentTime;
+            previousConditionValues = currentConditionValues;
+        }
+
+        // Terminate occultation that is in progress at the end time.
+        if( isOccultationInProgress )
+        {
+            if( numberOfTotalOccultations == 1 && !( totalOccultationEndTime == totalOccultationEndTime ) )
+            {
+                totalOccultationEndTime = endTime;
+            }
+            occultationIntervals_[ i ].push_back(
+                        OccultationInterval(
+                            partialOccultationStartTime,
+                            ( numberOfTotalOccultations == 1 ) ? totalOccultationStartTime : TUDAT_NAN,
+                            ( numberOfTotalOccultations == 1 ) ? totalOccultationEndTime : TUDAT_NAN,
+                            endTime ) );
+        }
+    }
+}
+
+//! Function to return the occultation phase of the target w.r.t. a single occulting body.
+OccultationPhase OccultationEventTable::getOccultationPhase(
+        const double time, const int occultingBodyIndex, int& intervalIndex ) const
+{
+    if( !( time >= startTime_ && time <= endTime_ ) )
+    {
+        return unknown_occultation_phase;
+    }
+
+    const std::vector< OccultationInterval >& occultationIntervals = occultationIntervals_.at( occultingBodyIndex );
+    const int numberOfIntervals = static_cast< int >( occultationIntervals.size( ) );
+    if( numberOfIntervals == 0 )
+    {
+        return no_occultation_phase;
+    }
+
+    // Find last interval of which the (extended) start time is before the requested time, starting from the interval
+    // index provided as input.
+    intervalIndex = std::max( 0, std::min( intervalIndex, numberOfIntervals - 1 ) );
+    while( intervalIndex + 1 < numberOfIntervals &&
+           occultationIntervals[ intervalIndex + 1 ].partialOccultationStartTime_ - boundaryTimeMargin_ <= time )
+    {
+        intervalIndex++;
+    }
+    while( intervalIndex > 0 &&
+           occultationIntervals[ intervalIndex ].partialOccultationStartTime_ - boundaryTimeMargin_ > time )
+    {
+        intervalIndex--;
+    }
+
+    const OccultationInterval& interval = occultationIntervals[ intervalIndex ];
+    if( time < interval.partialOccultationStartTime_ - boundaryTimeMargin_ ||
+            time > interval.partialOccultationEndTime_ + boundaryTimeMargin_ )
+    {
+        return no_occultation_phase;
+    }
+    else if( time > interval.totalOccultationStartTime_ + boundaryTimeMargin_ &&
+             time < interval.totalOccultationEndTime_ - boundaryTimeMargin_ )
+    {
+        return total_occultation_phase;
+    }
+    else
+    {
+        return partial_occultation_phase;
+    }
+}
+
+//! Function to return the occultation phase of the target w.r.t. a single occulting body.
+OccultationPhase OccultationEventTable::getOccultationPhase( const double time, const int occultingBodyIndex ) const
+{
+    const std::vector< OccultationInterval >& occultationIntervals = occultationIntervals_.at( occultingBodyIndex );
+    int intervalIndex = static_cast< int >( std::upper_bound(
+                occultationIntervals.begin( ), occultationIntervals.end( ), time,
+                [ & ]( const double currentTime, const OccultationInterval& interval )
+    {
+        return currentTime < interval.partialOccultationStartTime_ - boundaryTimeMargin_;
+    } ) - occultationIntervals.begin( ) ) - 1;
+    return getOccultationPhase( time, occultingBodyIndex, intervalIndex );
+}
+
+//! Function to return the start and end times of all occultations, for use as integrator step breakpoints.
+std::vector< double > OccultationEventTable::getOccultationBoundaryTimes( ) const
+{
+    std::vector< double > boundaryTimes;
+    for( unsigned int i = 0; i < occultationIntervals_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < occultationIntervals_.at( i ).size( ); j++ )
+        {
+            const OccultationInterval& interval = occultationIntervals_.at( i ).at( j );
+            const double intervalTimes[ 4 ] = { interval.partialOccultationStartTime_,
+                                                interval.totalOccultationStartTime_,
+                                                interval.totalOccultationEndTime_,
+                                                interval.partialOccultationEndTime_ };
+            for( int k = 0; k < 4; k++ )
+            {
+                if( intervalTimes[ k ] > startTime_ && intervalTimes[ k ] < endTime_ )
+                {
+                    boundaryTimes.push_back( intervalTimes[ k ] );
+                }
+            }
+        }
+    }
+    std::sort( boundaryTimes.begin( ), boundaryTimes.end( ) );
+    return boundaryTimes;
+}
+
+} // namespace electro_magnetism
+
+} // namespace tudat
@@ -0,0 +1,239 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#ifndef TUDAT_OCCULTATION_EVENTS_H
+#define TUDAT_OCCULTATION_EVENTS_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace electro_magnetism
+{
+
+//! Enum defining the occultation phase of a target, w.r.t. a single occulting body.
+enum OccultationPhase
+{
+    no_occultation_phase,
+    partial_occultation_phase,
+    total_occultation_phase,
+    unknown_occultation_phase
+};
+
+//! Function to compute the functions of which the zeroes define the start and end of partial and total occultation.
+/*!
+ *  Function to compute the functions of which the zeroes define the start and end of partial and total occultation
+ *  of a source body by an occulting body, as seen from a target. The functions are the apparent separation of the
+ *  centers of both bodies, minus the sum and the absolute difference of their apparent radii, respectively
+ *  (Montenbruck and Gill, 2005, Section 3.4). The occultation is partial when the first value is negative, and total
+ *  (i.e. shadow function zero, see mission_geometry::computeShadowFunction) when the second value is negative.
+ *  \param sourcePosition Position of the source (occulted) body.
+ *  \param sourceRadius Radius of the source body.
+ *  \param occultingBodyPosition Position of the occulting body.
+ *  \param occultingBodyRadius Radius of the occulting body.
+ *  \param targetPosition Position of the target.
+ *  \return Pair with the partial occultation (first) and total occultation (second) functions (in rad).
+ */
+std::pair< double, double > computeOccultationConditionFunctions(
+        const Eigen::Vector3d& sourcePosition,
+        const double sourceRadius,
+        const Eigen::Vector3d& occultingBodyPosition,
+        const double occultingBodyRadius,
+        const Eigen::Vector3d& targetPosition );
+
+//! Time interval in which a target is (partially) occulted by a single occulting body.
+struct OccultationInterval
+{
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param partialOccultationStartTime Time at which the partial occultation starts.
+     *  \param totalOccultationStartTime Time at which the total occultation starts (NaN if no total occultation).
+     *  \param totalOccultationEndTime Time at which the total occultation ends (NaN if no total occultation).
+     *  \param partialOccultationEndTime Time at which the partial occultation ends.
+     */
+    OccultationInterval( const double partialOccultationStartTime,
+                         const double totalOccultationStartTime,
+                         const double totalOccultationEndTime,
+                         const double partialOccultationEndTime ):
+        partialOccultationStartTime_( partialOccultationStartTime ),
+        totalOccultationStartTime_( totalOccultationStartTime ),
+        totalOccultationEndTime_( totalOccultationEndTime ),
+        partialOccultationEndTime_( partialOccultationEndTime ){ }
+
+    //! Time at which the partial occultation starts (e.g. penumbra entry).
+    double partialOccultationStartTime_;
+
+    //! Time at which the total occultation starts (e.g. umbra entry), NaN if no total occultation takes place.
+    double totalOccultationStartTime_;
+
+    //! Time at which the total occultation ends (e.g. umbra exit), NaN if no total occultation takes place.
+    double totalOccultationEndTime_;
+
+    //! Time at which the partial occultation ends (e.g. penumbra exit).
+    double partialOccultationEndTime_;
+};
+
+//! Class in which the occultation intervals of a target w.r.t. a set of occulting bodies are precomputed.
+/*!
+ *  Class in which the occultation intervals (e.g. penumbra and umbra entry and exit times) of a target w.r.t. a set of
+ *  occulting bodies are precomputed over a given time interval, from functions returning the positions of all bodies
+ *  as a function of time (e.g. from ephemerides, and a previously propagated or tabulated trajectory of the target).
+ *  The start and end times of the occultations are detected from sign changes of the functions computed by
+ *  computeOccultationConditionFunctions at a constant search time step, and refined using the bisection root finder.
+ *  Occultations that start and end within a single search time step are not detected, so the search time step should
+ *  be small w.r.t. the shortest occultation (typically 30 to 60 s for satellites in low orbits).
+ *
+ *  The resulting occultation phases can be used to skip the evaluation of the shadow function when the target is not
+ *  or totally occulted (see RadiationPressureInterfaceSettings::setOccultationEventTable), and the start and end times
+ *  can be used as breakpoints of a variable step-size integrator (see RungeKuttaVariableStepSizeBaseSettings). Once
+ *  created, an object of this class is not modified, so that it can be shared by multiple threads.
+ */
+class OccultationEventTable
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, in which the occultation intervals are computed.
+     *  \param sourcePositionFunction Function returning the position of the source body as a function of time.
+     *  \param sourceRadius Radius of the source body.
+     *  \param occultingBodyPositionFunctions List of functions returning the positions of the occulting bodies as a
+     *  function of time.
+     *  \param occultingBodyRadii List of radii of the occulting bodies.
+     *  \param targetPositionFunction Function returning the position of the target as a function of time.
+     *  \param startTime Start time of the interval in which the occultations are computed.
+     *  \param endTime End time of the interval in which the occultations are computed.
+     *  \param searchTimeStep Time step at which the occultation condition functions are evaluated.
+     *  \param timeTolerance Absolute tolerance of the computed start and end times of the occultations.
+     *  \param boundaryTimeMargin Margin around the start and end times of the occultations, within which the
+     *  occultation phase is considered to be partial (to account for the time tolerance, as well as for differences
+     *  between the target trajectory used to create this object and the trajectory for which it is used).
+     */
+    OccultationEventTable(
+            const std::function< Eigen::Vector3d( const double ) > sourcePositionFunction,
+            const double sourceRadius,
+            const std::vector< std::function< Eigen::Vector3d( const double ) > >& occultingBodyPositionFunctions,
+            const std::vector< double >& occultingBodyRadii,
+            const std::function< Eigen::Vector3d( const double ) > targetPositionFunction,
+            const double startTime,
+            const double endTime,
+            const double searchTimeStep,
+            const double timeTolerance = 1.0E-3,
+            const double boundaryTimeMargin = 1.0 );
+
+    //! Function to return the occultation phase of the target w.r.t. a single occulting body.
+    /*!
+     *  Function to return the occultation phase of the target w.r.t. a single occulting body. The phase is partial
+     *  within the occultation intervals (except for the total occultation), and within the boundary time margin of
+     *  any start or end time. Outside the time interval for which this object was created, the phase is unknown.
+     *  The occultation interval is searched for starting from the interval index provided by the caller, so that
+     *  consecutive calls with nearby times (and the same index variable) are handled in constant time.
+     *  \param time Time at which the occultation phase is to be determined.
+     *  \param occultingBodyIndex Index of the occulting body (in the list passed to the constructor).
+     *  \param intervalIndex Index of the occultation interval from which the search is started, set to the index of
+     *  the last interval that starts (minus the boundary time margin) before the requested time (returned by
+     *  reference).
+     *  \return Occultation phase of the target w.r.t. the occulting body.
+     */
+    OccultationPhase getOccultationPhase( const double time, const int occultingBodyIndex, int& intervalIndex ) const;
+
+    //! Function to return the occultation phase of the target w.r.t. a single occulting body.
+    /*!
+     *  Function to return the occultation phase of the target w.r.t. a single occulting body, see the overload taking
+     *  an interval index, using a binary search for the occultation interval.
+     *  \param time Time at which the occultation phase is to be determined.
+     *  \param occultingBodyIndex Index of the occulting body (in the list passed to the constructor).
+     *  \return Occultation phase of the target w.r.t. the occulting body.
+     */
+    OccultationPhase getOccultationPhase( const double time, const int occultingBodyIndex ) const;
+
+    //! Function to return the occultation intervals of the target w.r.t. a single occulting body.
+    /*!
+     *  Function to return the occultation intervals of the target w.r.t. a single occulting body, ordered by time.
+     *  Occultations that are in progress at the start (end) time of the table start (end) at that time.
+     *  \param occultingBodyIndex Index of the occulting body (in the list passed to the constructor).
+     *  \return Occultation intervals of the target w.r.t. the occulting body.
+     */
+    const std::vector< OccultationInterval >& getOccultationIntervals( const int occultingBodyIndex ) const
+    {
+        return occultationIntervals_.at( occultingBodyIndex );
+    }
+
+    //! Function to return the start and end times of all occultations, for use as integrator step breakpoints.
+    /*!
+     *  Function to return the start and end times of all partial and total occultations, ordered by time, at which
+     *  the radiation pressure is not a smooth function of time (see NumericalIntegrator::setStepBreakpoints). Times
+     *  that coincide with the start or end time of the table (for occultations in progress at these times) are
+     *  excluded.
+     *  \return Start and end times of all partial and total occultations.
+     */
+    std::vector< double > getOccultationBoundaryTimes( ) const;
+
+    //! Function to return the number of occulting bodies.
+    /*!
+     *  Function to return the number of occulting bodies.
+     *  \return Number of occulting bodies.
+     */
+    int getNumberOfOccultingBodies( ) const
+    {
+        return static_cast< int >( occultationIntervals_.size( ) );
+    }
+
+    //! Function to return the start time of the interval in which the occultations are computed.
+    /*!
+     *  Function to return the start time of the interval in which the occultations are computed.
+     *  \return Start time of the interval in which the occultations are computed.
+     */
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to return the end time of the interval in which the occultations are computed.
+    /*!
+     *  Function to return the end time of the interval in which the occultations are computed.
+     *  \return End time of the interval in which the occultations are computed.
+     */
+    double getEndTime( ) const
+    {
+        return endTime_;
+    }
+
+private:
+
+    //! Start time of the interval in which the occultations are computed.
+    double startTime_;
+
+    //! End time of the interval in which the occultations are computed.
+    double endTime_;
+
+    //! Margin around the start and end times of the occultations, within which the phase is considered partial.
+    double boundaryTimeMargin_;
+
+    //! Occultation intervals per occulting body, ordered by time.
+    std::vector< std::vector< OccultationInterval > > occultationIntervals_;
+};
+
+} // namespace electro_magnetism
+
+} // namespace tudat
+
+#endif // TUDAT_OCCULTATION_EVENTS_H
@@ -9,6 +9,8 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
@@ -39,22 +41,99 @@ void RadiationPressureInterface::updateInterfaceBase(
     currentRadiationPressure_ = calculateRadiationPressure(
                 sourcePower_( ), distanceFromSource );
 
-    // Calculate total shadowing due to occulting body; note that multiple concurrent
-    // occultations are not completely correctly (prints warning).
+    // Calculate total shadowing due to occulting bodies, skipping the bodies that do not occult the source (or
+    // totally occult it) according to the occultation event table (if any).
     double shadowFunction = 1.0;
-    double currentShadowFunction = 1.0;
-    for( unsigned int i = 0; i < occultingBodyPositions_.size( ); i++ )
+    std::vector< std::pair< Eigen::Vector3d, double > > partiallyOccultingBodies;
+    std::vector< double > partialShadowFunctions;
+    if( occultingBodyPositions_.size( ) > 0 )
     {
-        currentShadowFunction *= mission_geometry::computeShadowFunction(
-                    sourcePositionFunction_( ), sourceRadius_, occultingBodyPositions_[ i ]( ),
-                    occultingBodyRadii_[ i ], targetPositionFunction_( ) );
+        const Eigen::Vector3d sourcePosition = sourcePositionFunction_( );
+        const Eigen::Vector3d targetPosition = targetPositionFunction_( );
+        for( unsigned int i = 0; i < occultingBodyPositions_.size( ); i++ )
+        {
+            const OccultationPhase occultationPhase =
+                    ( occultationEventTable_ != nullptr && currentTime == currentTime ) ?
+                        occultationEventTable_->getOccultationPhase(
+                            currentTime, i, occultationIntervalIndices_[ i ] ) : unknown_occultation_phase;
+            if( occultationPhase == no_occultation_phase )
+            {
+                continue;
+            }
+            else if( occultationPhase == total_occultation_phase )
+            {
+                shadowFunction = 0.0;
+                break;
+            }
+
+            const Eigen::Vector3d occultingBodyPosition = occultingBodyPositions_[ i ]( );
+            const double currentShadowFunction = mission_geometry::computeShadowFunction(
+                        sourcePosition, sourceRadius_, occultingBodyPosition, occultingBodyRadii_[ i ],
+                        targetPosition );
+            if( currentShadowFunction == 0.0 )
+            {
+                shadowFunction = 0.0;
+                break;
+            }
+            else if( currentShadowFunction < 1.0 )
+            {
+                partiallyOccultingBodies.push_back(
+                            std::make_pair( occultingBodyPosition - targetPosition,
+                                            std::asin( std::min( occultingBodyRadii_[ i ] /
+                                                                 ( occultingBodyPosition - targetPosition ).norm( ),
+                                                                 1.0 ) ) ) );
+                partialShadowFunctions.push_back( currentShadowFunction );
+            }
+        }
 
-        if( currentShadowFunction != 1.0 && shadowFunction != 1.0 )
+        if( shadowFunction > 0.0 && partialShadowFunctions.size( ) == 1 )
         {
-            std::cerr << "Warning, multiple occultation occured in radiation pressure interface, results may be slightly in error" << std::endl;
+            shadowFunction = partialShadowFunctions.at( 0 );
         }
+        else if( shadowFunction > 0.0 && partialShadowFunctions.size( ) > 1 )
+        {
+            // Check whether the occulting bodies overlap, as seen from the target.
+            bool doOccultingBodiesOverlap = false;
+            for( unsigned int i = 0; i < partiallyOccultingBodies.size( ); i++ )
+            {
+                for( unsigned int j = i + 1; j < partiallyOccultingBodies.size( ); j++ )
+                {
+                    const double apparentSeparation = std::acos( std::max( std::min(
+                        partiallyOccultingBodies.at( i ).first.normalized( ).dot(
+                            partiallyOccultingBodies.at( j ).first.normalized( ) ), 1.0 ), -1.0 ) );
+                    if( apparentSeparation <
+                            partiallyOccultingBodies.at( i ).second + partiallyOccultingBodies.at( j ).second )
+                    {
+                        doOccultingBodiesOverlap = true;
+                    }
+                }
+            }
+
+            // If the occulting bodies do not overlap, the occulted parts of the source are disjoint, and the occulted
+            // fractions can be added. Otherwise, the occultations are approximated as being independent.
+            if( !doOccultingBodiesOverlap )
+            {
+                for( unsigned int i = 0; i < partialShadowFunctions.size( ); i++ )
+                {
+                    shadowFunction -= ( 1.0 - partialShadowFunctions.at( i ) );
+                }
+                shadowFunction = std::max( shadowFunction, 0.0 );
+            }
+            else
+            {
+                for( unsigned int i = 0; i < partialShadowFunctions.size( ); i++ )
+                {
+                    shadowFunction *= partialShadowFunctions.at( i );
+                }
 
-        shadowFunction *= currentShadowFunction;
+                if( !isMultipleOccultationWarningPrinted_ )
+                {
+                    std::cerr << "Warning, multiple overlapping occultations occured in radiation pressure interface, "
+                                 "results may be slightly in error" << std::endl;
+                    isMultipleOccultationWarningPrinted_ = true;
+                }
+            }
+        }
     }
 
     currentRadiationPressure_ *= shadowFunction;
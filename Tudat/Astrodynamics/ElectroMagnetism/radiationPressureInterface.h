@@ -14,6 +14,8 @@
 
 #include <vector>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 
 #include <functional>
 #include <boost/lambda/lambda.hpp>
@@ -22,6 +24,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/occultationEvents.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 namespace tudat
@@ -59,8 +62,8 @@ public:
      *  \param radiationPressureCoefficient Reflectivity coefficient of the target body.
      *  \param area Reflecting area of the target body.
      *  \param occultingBodyPositions List of functions returning the positions of the bodies
-     *  causing occultations (default none) NOTE: Multiple concurrent occultations may currently
-     *  result in slighlty underestimted radiation pressure.
+     *  causing occultations (default none) NOTE: Multiple concurrent occultations, of which the occulting bodies
+     *  overlap as seen from the target, may result in slighlty underestimted radiation pressure.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
      */
@@ -84,7 +87,8 @@ public:
         sourceRadius_( sourceRadius ),
         currentRadiationPressure_( TUDAT_NAN ),
         currentSolarVector_( Eigen::Vector3d::Zero( ) ),
-        currentTime_( TUDAT_NAN ){ }
+        currentTime_( TUDAT_NAN ),
+        isMultipleOccultationWarningPrinted_( false ){ }
 
     //! Destructor
     virtual ~RadiationPressureInterface( ){ }
@@ -243,6 +247,39 @@ public:
         return sourceRadius_;
     }
 
+    //! Function to set the table of precomputed occultation intervals of the target.
+    /*!
+     *  Function to set the table of precomputed occultation intervals of the target, w.r.t. the occulting bodies of
+     *  this interface (in the same order). When set, the shadow function is only evaluated at times at which the target is
+     *  (according to the table) partially occulted, or at which the occultation phase is unknown (outside the time
+     *  interval of the table). The table should be created with the same source and occulting bodies, and a target
+     *  trajectory that is close to the propagated trajectory (w.r.t. the boundary time margin of the table).
+     *  \param occultationEventTable Table of precomputed occultation intervals (nullptr to evaluate the shadow
+     *  function at each update).
+     */
+    void setOccultationEventTable( const std::shared_ptr< OccultationEventTable > occultationEventTable )
+    {
+        if( occultationEventTable != nullptr &&
+                occultationEventTable->getNumberOfOccultingBodies( ) !=
+                static_cast< int >( occultingBodyPositions_.size( ) ) )
+        {
+            throw std::runtime_error( "Error when setting occultation event table of radiation pressure interface, "
+                                      "number of occulting bodies is inconsistent." );
+        }
+        occultationEventTable_ = occultationEventTable;
+        occultationIntervalIndices_.assign( occultingBodyPositions_.size( ), 0 );
+    }
+
+    //! Function to return the table of precomputed occultation intervals of the target.
+    /*!
+     *  Function to return the table of precomputed occultation intervals of the target (nullptr if not set).
+     *  \return Table of precomputed occultation intervals of the target.
+     */
+    std::shared_ptr< OccultationEventTable > getOccultationEventTable( )
+    {
+        return occultationEventTable_;
+    }
+
 
 protected:
 
@@ -281,6 +318,15 @@ protected:
 
     //! Current time of interface (i.e. time of last updateInterface call).
     double currentTime_;
+
+    //! Table of precomputed occultation intervals of the target (nullptr if not used).
+    std::shared_ptr< OccultationEventTable > occultationEventTable_;
+
+    //! Index of the interval of occultationEventTable_ found in the last update, per occulting body.
+    std::vector< int > occultationIntervalIndices_;
+
+    //! Boolean denoting whether the warning for approximated multiple concurrent occultations has been printed.
+    bool isMultipleOccultationWarningPrinted_;
 };
 
 
@@ -311,8 +357,8 @@ public:
      *  \param rotationFromLocalToPropagationFrame  Vector containing the functions that return the rotation
      *  from body-fixed to propagation frame for each panel.
      *  \param occultingBodyPositions List of functions returning the positions of the bodies
-     *  causing occultations (default none) NOTE: Multiple concurrent occultations may currently
-     *  result in slighlty underestimted radiation pressure.
+     *  causing occultations (default none) NOTE: Multiple concurrent occultations, of which the occulting bodies
+     *  overlap as seen from the target, may result in slighlty underestimted radiation pressure.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
      */
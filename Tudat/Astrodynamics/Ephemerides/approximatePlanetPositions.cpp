@@ -47,114 +47,115 @@ Eigen::Vector6d ApproximatePlanetPositions::getKeplerianStateFromEphemeris(
     using std::cos;
     using namespace orbital_element_conversions;
 
+    // All intermediate quantities are local variables, so that the ephemeris can be queried
+    // concurrently from multiple threads.
+    Eigen::Vector6d planetKeplerianElementsAtGivenJulianDate;
+
     // Set Julian date.
-    julianDate_ = basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+    const double julianDate = basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
                 secondsSinceEpoch, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
 
     // Compute number of centuries past J2000.
-    numberOfCenturiesPastJ2000_ = ( julianDate_ - 2451545.0 ) / 36525.0;
+    const double numberOfCenturiesPastJ2000 = ( julianDate - 2451545.0 ) / 36525.0;
 
     // Compute and set semi-major axis of planet at given Julian date.
-    planetKeplerianElementsAtGivenJulianDate_( semiMajorAxisIndex )
+    planetKeplerianElementsAtGivenJulianDate( semiMajorAxisIndex )
             = approximatePlanetPositionsDataContainer_.semiMajorAxis_
             + ( approximatePlanetPositionsDataContainer_
-                .rateOfChangeOfSemiMajorAxis_ * numberOfCenturiesPastJ2000_ );
+                .rateOfChangeOfSemiMajorAxis_ * numberOfCenturiesPastJ2000 );
 
     // Compute and set eccentricity of planet at given Julian date.
-    planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex )
+    planetKeplerianElementsAtGivenJulianDate( eccentricityIndex )
             = approximatePlanetPositionsDataContainer_.eccentricity_
             + ( approximatePlanetPositionsDataContainer_
-                .rateOfChangeOfEccentricity_ * numberOfCenturiesPastJ2000_ );
+                .rateOfChangeOfEccentricity_ * numberOfCenturiesPastJ2000 );
 
     // Compute and set inclination of planet at given Julian date.
-    planetKeplerianElementsAtGivenJulianDate_( inclinationIndex )
+    planetKeplerianElementsAtGivenJulianDate( inclinationIndex )
             = approximatePlanetPositionsDataContainer_.inclination_
             + ( approximatePlanetPositionsDataContainer_
-                .rateOfChangeOfInclination_ * numberOfCenturiesPastJ2000_ );
+                .rateOfChangeOfInclination_ * numberOfCenturiesPastJ2000 );
 
     // Compute and set longitude of ascending node of planet at given Julian date.
-    planetKeplerianElementsAtGivenJulianDate_( longitudeOfAscendingNodeIndex )
+    planetKeplerianElementsAtGivenJulianDate( longitudeOfAscendingNodeIndex )
             = approximatePlanetPositionsDataContainer_.longitudeOfAscendingNode_
             + ( approximatePlanetPositionsDataContainer_
-                .rateOfChangeOfLongitudeOfAscendingNode_ * numberOfCenturiesPastJ2000_ );
+                .rateOfChangeOfLongitudeOfAscendingNode_ * numberOfCenturiesPastJ2000 );
 
     // Compute longitude of perihelion of planet at given Julian date.
-    longitudeOfPerihelionAtGivenJulianDate_
+    const double longitudeOfPerihelionAtGivenJulianDate
             = approximatePlanetPositionsDataContainer_.longitudeOfPerihelion_
             + ( approximatePlanetPositionsDataContainer_.rateOfChangeOfLongitudeOfPerihelion_
-                * numberOfCenturiesPastJ2000_ );
+                * numberOfCenturiesPastJ2000 );
 
     // Compute and set argument of periapsis of planet at given Julian date.
-    planetKeplerianElementsAtGivenJulianDate_( argumentOfPeriapsisIndex )
-            = longitudeOfPerihelionAtGivenJulianDate_
-            - planetKeplerianElementsAtGivenJulianDate_( longitudeOfAscendingNodeIndex );
+    planetKeplerianElementsAtGivenJulianDate( argumentOfPeriapsisIndex )
+            = longitudeOfPerihelionAtGivenJulianDate
+            - planetKeplerianElementsAtGivenJulianDate( longitudeOfAscendingNodeIndex );
 
     // Compute mean longitude of planet at given Julian date.
-    meanLongitudeAtGivenJulianDate_ = approximatePlanetPositionsDataContainer_.meanLongitude_
+    const double meanLongitudeAtGivenJulianDate = approximatePlanetPositionsDataContainer_.meanLongitude_
             + ( approximatePlanetPositionsDataContainer_.rateOfChangeOfMeanLongitude_
-                * numberOfCenturiesPastJ2000_ );
+                * numberOfCenturiesPastJ2000 );
 
     // Compute mean anomaly of planet at given Julian date.
-    meanAnomalyAtGivenJulianDate_ = meanLongitudeAtGivenJulianDate_
-            - longitudeOfPerihelionAtGivenJulianDate_
+    double meanAnomalyAtGivenJulianDate = meanLongitudeAtGivenJulianDate
+            - longitudeOfPerihelionAtGivenJulianDate
             + ( approximatePlanetPositionsDataContainer_.additionalTermB_
-                * pow( numberOfCenturiesPastJ2000_, 2.0 ) )
+                * pow( numberOfCenturiesPastJ2000, 2.0 ) )
             + ( approximatePlanetPositionsDataContainer_.additionalTermC_
                 * cos( unit_conversions::convertDegreesToRadians(approximatePlanetPositionsDataContainer_.additionalTermF_ *
-                       numberOfCenturiesPastJ2000_ )) )
+                       numberOfCenturiesPastJ2000 )) )
             + ( approximatePlanetPositionsDataContainer_.additionalTermS_
                 * sin( unit_conversions::convertDegreesToRadians(approximatePlanetPositionsDataContainer_.additionalTermF_ *
-                       numberOfCenturiesPastJ2000_) ) );
+                       numberOfCenturiesPastJ2000) ) );
 
     // Compute modulo of mean anomaly for interval :
-    // 0 <= meanAnomalyAtGivenJulianDate_ < 360.
-    meanAnomalyAtGivenJulianDate_ = basic_mathematics::computeModulo(
-                meanAnomalyAtGivenJulianDate_, 360.0 );
+    // 0 <= meanAnomalyAtGivenJulianDate < 360.
+    meanAnomalyAtGivenJulianDate = basic_mathematics::computeModulo(
+                meanAnomalyAtGivenJulianDate, 360.0 );
 
     // Translate mean anomaly to:
-    // -180 < meanAnomalyAtGivenJulianDate_ <= 180 bounds.
-    if ( meanAnomalyAtGivenJulianDate_ > 180.0 )
+    // -180 < meanAnomalyAtGivenJulianDate <= 180 bounds.
+    if ( meanAnomalyAtGivenJulianDate > 180.0 )
     {
-        meanAnomalyAtGivenJulianDate_ -= 360.0;
+        meanAnomalyAtGivenJulianDate -= 360.0;
     }
 
     // Convert mean anomaly to eccentric anomaly.
-    eccentricAnomalyAtGivenJulianDate_ = convertMeanAnomalyToEccentricAnomaly(
-                planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex ),
+    const double eccentricAnomalyAtGivenJulianDate = convertMeanAnomalyToEccentricAnomaly(
+                planetKeplerianElementsAtGivenJulianDate( eccentricityIndex ),
                 unit_conversions::convertDegreesToRadians(
-                    meanAnomalyAtGivenJulianDate_ ) );
+                    meanAnomalyAtGivenJulianDate ) );
 
     // Convert eccentric anomaly to true anomaly and set in planet elements.
-    trueAnomalyAtGivenJulianData_
+    planetKeplerianElementsAtGivenJulianDate( trueAnomalyIndex )
             = orbital_element_conversions::convertEccentricAnomalyToTrueAnomaly(
-                eccentricAnomalyAtGivenJulianDate_,
-                planetKeplerianElementsAtGivenJulianDate_( eccentricityIndex ) );
-
-    planetKeplerianElementsAtGivenJulianDate_( trueAnomalyIndex )
-            = trueAnomalyAtGivenJulianData_;
+                eccentricAnomalyAtGivenJulianDate,
+                planetKeplerianElementsAtGivenJulianDate( eccentricityIndex ) );
 
     // Convert Keplerian elements to standard units.
     // Convert semi-major axis from AU to meters.
-    planetKeplerianElementsAtGivenJulianDate_( semiMajorAxisIndex )
+    planetKeplerianElementsAtGivenJulianDate( semiMajorAxisIndex )
             = unit_conversions::convertAstronomicalUnitsToMeters(
-                planetKeplerianElementsAtGivenJulianDate_( semiMajorAxisIndex ) );
+                planetKeplerianElementsAtGivenJulianDate( semiMajorAxisIndex ) );
 
     // Convert inclination from degrees to radians.
-    planetKeplerianElementsAtGivenJulianDate_( inclinationIndex )
+    planetKeplerianElementsAtGivenJulianDate( inclinationIndex )
             = unit_conversions::convertDegreesToRadians(
-                planetKeplerianElementsAtGivenJulianDate_( inclinationIndex ) );
+                planetKeplerianElementsAtGivenJulianDate( inclinationIndex ) );
 
     // Convert longitude of ascending node from degrees to radians.
-    planetKeplerianElementsAtGivenJulianDate_( longitudeOfAscendingNodeIndex )
+    planetKeplerianElementsAtGivenJulianDate( longitudeOfAscendingNodeIndex )
             = unit_conversions::convertDegreesToRadians(
-                planetKeplerianElementsAtGivenJulianDate_( longitudeOfAscendingNodeIndex ) );
+                planetKeplerianElementsAtGivenJulianDate( longitudeOfAscendingNodeIndex ) );
 
     // Convert argument of periapsis from degrees to radians.
-    planetKeplerianElementsAtGivenJulianDate_( argumentOfPeriapsisIndex )
+    planetKeplerianElementsAtGivenJulianDate( argumentOfPeriapsisIndex )
             = unit_conversions::convertDegreesToRadians(
-                planetKeplerianElementsAtGivenJulianDate_( argumentOfPeriapsisIndex ) );
+                planetKeplerianElementsAtGivenJulianDate( argumentOfPeriapsisIndex ) );
 
-    return planetKeplerianElementsAtGivenJulianDate_;
+    return planetKeplerianElementsAtGivenJulianDate;
 }
 
 } // namespace ephemerides
@@ -43,8 +43,7 @@ public:
     //! Default constructor.
     /*!
      * Default constructor that initializes the class from the body for which the position is
-     * approximated and the gravitational parameter of the Sun (default 1.32712440018e20). Other
-     * members are initialized to default values (NAN).
+     * approximated and the gravitational parameter of the Sun (default 1.32712440018e20).
      *
      * \param bodyWithEphemerisData The body for which the position is approximated.
      * \param sunGravitationalParameter The gravitational parameter of the Sun [m^3/s^2].
@@ -52,22 +51,14 @@ public:
      */
     ApproximatePlanetPositions( BodiesWithEphemerisData bodyWithEphemerisData,
                                 const double sunGravitationalParameter = 1.32712440018e20 )
-        : ApproximatePlanetPositionsBase( sunGravitationalParameter ),
-          eccentricAnomalyAtGivenJulianDate_( TUDAT_NAN ),
-          longitudeOfPerihelionAtGivenJulianDate_( TUDAT_NAN ),
-          meanAnomalyAtGivenJulianDate_( TUDAT_NAN ),
-          trueAnomalyAtGivenJulianData_( TUDAT_NAN )
+        : ApproximatePlanetPositionsBase( sunGravitationalParameter )
     {
         setPlanet( bodyWithEphemerisData );
     }
 
     ApproximatePlanetPositions( const std::string& bodyName,
                                 const double sunGravitationalParameter = 1.32712440018e20 )
-        : ApproximatePlanetPositionsBase( sunGravitationalParameter ),
-          eccentricAnomalyAtGivenJulianDate_( TUDAT_NAN ),
-          longitudeOfPerihelionAtGivenJulianDate_( TUDAT_NAN ),
-          meanAnomalyAtGivenJulianDate_( TUDAT_NAN ),
-          trueAnomalyAtGivenJulianData_( TUDAT_NAN )
+        : ApproximatePlanetPositionsBase( sunGravitationalParameter )
     {
         BodiesWithEphemerisData bodyWithEphemerisData = ApproximatePlanetPositionsBase::getBodiesWithEphemerisDataId(
                     bodyName );
@@ -76,7 +67,8 @@ public:
 
     //! Get cartesian state from ephemeris.
     /*!
-     * Returns cartesian state from ephemeris.
+     * Returns cartesian state from ephemeris. This function does not modify the object, so that it may be called
+     * concurrently from multiple threads.
      * \param secondsSinceEpoch Seconds since epoch.
      * \return State in Cartesian elements from ephemeris.
      */
@@ -92,33 +84,6 @@ public:
     Eigen::Vector6d getKeplerianStateFromEphemeris(
             const double secondsSinceEpoch );
 
-protected:
-
-private:
-
-    //! Eccentric anomaly at given Julian date.
-    /*!
-     * Eccentric anomaly of planet at given Julian date.
-     */
-    double eccentricAnomalyAtGivenJulianDate_;
-
-    //! Longitude of perihelion at given Julian date.
-    /*!
-     * Longitude of perihelion of planet at given Julian date.
-     */
-    double longitudeOfPerihelionAtGivenJulianDate_;
-
-    //! Mean anomaly at given Julian date.
-    /*!
-     * Mean anomaly of planet at given Julian date.
-     */
-    double meanAnomalyAtGivenJulianDate_;
-
-    //! True anomaly at given Julian date.
-    /*!
-     * True anomaly of planet at given Julian date.
-     */
-    double trueAnomalyAtGivenJulianData_;
 };
 
 //! Typedef for shared-pointer to ApproximatePlanetPositions object.
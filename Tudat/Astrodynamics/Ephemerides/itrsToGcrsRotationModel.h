@@ -20,6 +20,7 @@
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesTable.h"
 
 namespace tudat
 {
@@ -64,17 +65,36 @@ public:
      *  \param anglesCalculator Class performing calculation to obtain earth orientation angle.
      *  \param timeScale Time scale in which input to this class (in getRotationToBaseFrame, getDerivativeOfRotationFromFrame) is provided,
      *  needed for correct input to EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs.
+     *  \param baseFrame Name of base frame (GCRS or J2000)
+     *  \param anglesTable Precomputed table of Earth orientation angles, used instead of anglesCalculator for double-precision
+     *  time input if provided (default none). Time scale of table must be equal to inputTimeScale.
      */
     GcrsToItrsRotationModel( const std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator,
                              const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale,
-                             const std::string& baseFrame = "GCRS" ):
-        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), inputTimeScale_( inputTimeScale ),
-        frameBias_( Eigen::Matrix3d::Identity( ) )
+                             const std::string& baseFrame = "GCRS",
+                             const std::shared_ptr< earth_orientation::EarthOrientationAnglesTable > anglesTable = nullptr ):
+        RotationalEphemeris( baseFrame, "ITRS" ), anglesCalculator_( anglesCalculator ), anglesTable_( anglesTable ),
+        inputTimeScale_( inputTimeScale ), frameBias_( Eigen::Matrix3d::Identity( ) )
 
     {
-        functionToGetRotationAngles = std::bind(
-                    &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
-                    anglesCalculator, std::placeholders::_1, inputTimeScale );
+        if( anglesTable_ != nullptr )
+        {
+            if( anglesTable_->getTimeScale( ) != inputTimeScale_ )
+            {
+                throw std::runtime_error( "Error in GCRS<->ITRS model, time scale of Earth orientation table is inconsistent" );
+            }
+
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::EarthOrientationAnglesTable::getRotationAnglesFromItrsToGcrs,
+                        anglesTable_, std::placeholders::_1 );
+        }
+        else
+        {
+            functionToGetRotationAngles = std::bind(
+                        &earth_orientation::EarthOrientationAnglesCalculator::getRotationAnglesFromItrsToGcrs< double >,
+                        anglesCalculator, std::placeholders::_1, inputTimeScale );
+        }
+
         if( baseFrame == "J2000" )
         {
             frameBias_ = sofa_interface::getFrameBias(
@@ -95,8 +115,7 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return Eigen::Quaterniond( frameBias_ ) * earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    functionToGetRotationAngles( ephemerisTime ), ephemerisTime );
     }
 
     //! Function to calculate the rotation quaternion from ITRS to base frame
@@ -162,6 +181,44 @@ public:
         return getDerivativeOfRotationToBaseFrame( ephemerisTime ).transpose( );
     }
 
+    //! Function to calculate the full rotational state at given time
+    /*!
+     * Function to calculate the full rotational state at given time (rotation matrix, derivative of rotation matrix
+     * and angular velocity vector). If an Earth orientation table is used, the rotation angles are retrieved only once,
+     * and the rotation and its derivative are computed together.
+     * \param currentRotationToLocalFrame Current rotation to local frame (returned by reference)
+     * \param currentRotationToLocalFrameDerivative Current derivative of rotation matrix to local frame
+     * (returned by reference)
+     * \param currentAngularVelocityVectorInGlobalFrame Current angular velocity vector, expressed in global frame
+     * (returned by reference)
+     * \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     */
+    void getFullRotationalQuantitiesToTargetFrame(
+            Eigen::Quaterniond& currentRotationToLocalFrame,
+            Eigen::Matrix3d& currentRotationToLocalFrameDerivative,
+            Eigen::Vector3d& currentAngularVelocityVectorInGlobalFrame,
+            const double secondsSinceEpoch )
+    {
+        if( anglesTable_ == nullptr )
+        {
+            RotationalEphemeris::getFullRotationalQuantitiesToTargetFrame(
+                        currentRotationToLocalFrame, currentRotationToLocalFrameDerivative,
+                        currentAngularVelocityVectorInGlobalFrame, secondsSinceEpoch );
+        }
+        else
+        {
+            Eigen::Quaterniond rotationToGcrs;
+            Eigen::Matrix3d rotationToGcrsDerivative;
+            anglesTable_->getRotationAndDerivativeFromItrsToGcrs(
+                        secondsSinceEpoch, rotationToGcrs, rotationToGcrsDerivative );
+
+            currentRotationToLocalFrame = ( Eigen::Quaterniond( frameBias_ ) * rotationToGcrs ).inverse( );
+            currentRotationToLocalFrameDerivative = ( frameBias_ * rotationToGcrsDerivative ).transpose( );
+            currentAngularVelocityVectorInGlobalFrame = getRotationalVelocityVectorInBaseFrameFromMatrices(
+                        Eigen::Matrix3d( currentRotationToLocalFrame ), currentRotationToLocalFrameDerivative.transpose( ) );
+        }
+    }
+
     //! Function to retrieve object responsible for computing the various rotation angles (precession, nutation, polar motion, etc.)
     /*!
      * Function to retrieve object responsible for computing the various rotation angles (precession, nutation, polar motion, etc.)
@@ -172,6 +229,16 @@ public:
         return anglesCalculator_;
     }
 
+    //! Function to retrieve precomputed table of Earth orientation angles (nullptr if none is used)
+    /*!
+     * Function to retrieve precomputed table of Earth orientation angles (nullptr if none is used)
+     * \return Precomputed table of Earth orientation angles
+     */
+    std::shared_ptr< earth_orientation::EarthOrientationAnglesTable > getAnglesTable( )
+    {
+        return anglesTable_;
+    }
+
     //! Function to retrieve time scale in which the input time for class functions are interpreted
     /*!
      * Function to retrieve time scale in which the input time for class functions are interpreted
@@ -200,6 +267,9 @@ private:
      */
     std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
+    //! Precomputed table of Earth orientation angles, used for double-precision time input (if not nullptr).
+    std::shared_ptr< earth_orientation::EarthOrientationAnglesTable > anglesTable_;
+
     //! Time scale in which the input time for class functions are interpreted
     basic_astrodynamics::TimeScales inputTimeScale_;
 
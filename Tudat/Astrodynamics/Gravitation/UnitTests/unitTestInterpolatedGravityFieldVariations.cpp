@@ -0,0 +1,240 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Astrodynamics/Gravitation/gravityFieldVariations.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_interpolated_gravity_field_variations )
+
+using namespace tudat::gravitation;
+using mathematical_constants::PI;
+
+//! Function returning a circular orbit in the xy-plane, rotated about the x-axis by a given inclination.
+Eigen::Vector6d getCircularOrbitState( const double time, const double radius, const double period,
+                                       const double inclination )
+{
+    double angle = 2.0 * PI * time / period;
+    Eigen::Vector6d state = Eigen::Vector6d::Zero( );
+    state.segment( 0, 3 ) = Eigen::AngleAxisd( inclination, Eigen::Vector3d::UnitX( ) ) *
+            Eigen::Vector3d( radius * std::cos( angle ), radius * std::sin( angle ), 0.0 );
+    return state;
+}
+
+//! Solid body tide with amplitude scaled by a constant factor, to test use of redefined tidal amplitude.
+class ScaledSolidBodyTideGravityFieldVariations: public BasicSolidBodyTideGravityFieldVariations
+{
+public:
+    using BasicSolidBodyTideGravityFieldVariations::BasicSolidBodyTideGravityFieldVariations;
+
+protected:
+    void calculateTidalAmplitudeAndArgument(
+            const int degree, const int order,
+            const double currentSineOfLatitude, const std::complex< double > currentILongitude,
+            double& currentTideAmplitude, std::complex< double >& currentTideArgument ) const
+    {
+        BasicSolidBodyTideGravityFieldVariations::calculateTidalAmplitudeAndArgument(
+                    degree, order, currentSineOfLatitude, currentILongitude,
+                    currentTideAmplitude, currentTideArgument );
+        currentTideAmplitude *= 2.0;
+    }
+};
+
+//! Function to create solid body tide of the Earth, raised by the Moon and Sun on simplified orbits.
+template< typename VariationType = BasicSolidBodyTideGravityFieldVariations >
+std::shared_ptr< VariationType > getEarthSolidBodyTide( )
+{
+    std::vector< std::function< Eigen::Vector6d( const double ) > > deformingBodyStateFunctions;
+    deformingBodyStateFunctions.push_back(
+                std::bind( &getCircularOrbitState, std::placeholders::_1, 3.844E8, 27.32 * 86400.0, 0.09 ) );
+    deformingBodyStateFunctions.push_back(
+                std::bind( &getCircularOrbitState, std::placeholders::_1, 1.496E11, 365.25 * 86400.0, 0.41 ) );
+
+    std::vector< std::function< double( ) > > deformingBodyMasses;
+    deformingBodyMasses.push_back( [ ]( ){ return 4.9028E12; } );
+    deformingBodyMasses.push_back( [ ]( ){ return 1.32712E20; } );
+
+    std::vector< std::vector< std::complex< double > > > loveNumbers;
+    loveNumbers.push_back( std::vector< std::complex< double > >( 3, std::complex< double >( 0.3, 0.0 ) ) );
+    loveNumbers.push_back( std::vector< std::complex< double > >( 4, std::complex< double >( 0.09, 0.0 ) ) );
+
+    return std::make_shared< VariationType >(
+                [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); },
+                [ ]( const double time ){ return Eigen::Quaterniond(
+                        Eigen::AngleAxisd( -7.292115E-5 * time, Eigen::Vector3d::UnitZ( ) ) ); },
+                deformingBodyStateFunctions, 6378137.0, [ ]( ){ return 3.986004418E14; },
+                deformingBodyMasses, loveNumbers, std::vector< std::string >( { "Moon", "Sun" } ) );
+}
+
+//! Test whether corrections calculated (in parallel) at a list of times match those calculated at single times.
+BOOST_AUTO_TEST_CASE( testSolidBodyTideCorrectionsAtTimes )
+{
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > solidBodyTide = getEarthSolidBodyTide( );
+
+    std::vector< double > times;
+    for( int i = 0; i < 50; i++ )
+    {
+        times.push_back( 1.0E4 + 3217.0 * static_cast< double >( i ) );
+    }
+
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > corrections =
+            solidBodyTide->calculateSphericalHarmonicsCorrectionsAtTimes( times, 4 );
+    BOOST_CHECK_EQUAL( corrections.size( ), times.size( ) );
+
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > directCorrections =
+                solidBodyTide->calculateSphericalHarmonicsCorrections( times.at( i ) );
+
+        BOOST_CHECK_EQUAL( corrections.at( i ).first.rows( ), directCorrections.first.rows( ) );
+        BOOST_CHECK_EQUAL( corrections.at( i ).first.cols( ), directCorrections.first.cols( ) );
+
+        double correctionMagnitude = directCorrections.first.cwiseAbs( ).maxCoeff( );
+        BOOST_CHECK( correctionMagnitude > 1.0E-10 );
+        for( int j = 0; j < directCorrections.first.rows( ); j++ )
+        {
+            for( int k = 0; k < directCorrections.first.cols( ); k++ )
+            {
+                BOOST_CHECK_SMALL( corrections.at( i ).first( j, k ) - directCorrections.first( j, k ),
+                                   10.0 * correctionMagnitude * std::numeric_limits< double >::epsilon( ) );
+                BOOST_CHECK_SMALL( corrections.at( i ).second( j, k ) - directCorrections.second( j, k ),
+                                   10.0 * correctionMagnitude * std::numeric_limits< double >::epsilon( ) );
+            }
+        }
+    }
+}
+
+//! Test whether a redefined tidal amplitude is used both for single times and for a list of times.
+BOOST_AUTO_TEST_CASE( testRedefinedTidalAmplitude )
+{
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > solidBodyTide = getEarthSolidBodyTide( );
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > scaledSolidBodyTide =
+            getEarthSolidBodyTide< ScaledSolidBodyTideGravityFieldVariations >( );
+
+    std::vector< double > times = { 1.0E4, 5.0E4, 2.0E5 };
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > scaledCorrections =
+            scaledSolidBodyTide->calculateSphericalHarmonicsCorrectionsAtTimes( times, 2 );
+
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > directCorrections =
+                solidBodyTide->calculateSphericalHarmonicsCorrections( times.at( i ) );
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > directScaledCorrections =
+                scaledSolidBodyTide->calculateSphericalHarmonicsCorrections( times.at( i ) );
+
+        // Check that redefined amplitude is used for single times.
+        double tolerance = 10.0 * directCorrections.first.cwiseAbs( ).maxCoeff( ) *
+                std::numeric_limits< double >::epsilon( );
+        BOOST_CHECK_SMALL( ( directScaledCorrections.first - 2.0 * directCorrections.first ).cwiseAbs( ).maxCoeff( ),
+                           tolerance );
+        BOOST_CHECK_SMALL( ( directScaledCorrections.second - 2.0 * directCorrections.second ).cwiseAbs( ).maxCoeff( ),
+                           tolerance );
+
+        // Check that redefined amplitude is used for list of times.
+        Eigen::MatrixXd cosineDifference = scaledCorrections.at( i ).first - directScaledCorrections.first;
+        Eigen::MatrixXd sineDifference = scaledCorrections.at( i ).second - directScaledCorrections.second;
+        BOOST_CHECK_SMALL( cosineDifference.cwiseAbs( ).maxCoeff( ), tolerance );
+        BOOST_CHECK_SMALL( sineDifference.cwiseAbs( ).maxCoeff( ), tolerance );
+    }
+}
+
+//! Test interpolated solid body tide corrections, and the estimate of their error.
+BOOST_AUTO_TEST_CASE( testInterpolatedSolidBodyTideCorrections )
+{
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > solidBodyTide = getEarthSolidBodyTide( );
+
+    double initialTime = 0.0;
+    double finalTime = 2.0 * 86400.0;
+    double correctionMagnitude = solidBodyTide->calculateSphericalHarmonicsCorrections(
+                initialTime ).first.cwiseAbs( ).maxCoeff( );
+
+    // Check that interpolated corrections are exact at tabulated times.
+    std::function< void( const double, Eigen::MatrixXd&, Eigen::MatrixXd& ) > interpolatedCorrectionFunction =
+            createInterpolatedSphericalHarmonicCorrectionFunctions(
+                solidBodyTide, initialTime, finalTime, 3600.0 );
+    {
+        Eigen::MatrixXd sineCorrections = Eigen::MatrixXd::Zero( 4, 4 );
+        Eigen::MatrixXd cosineCorrections = Eigen::MatrixXd::Zero( 4, 4 );
+        interpolatedCorrectionFunction( 7200.0, sineCorrections, cosineCorrections );
+
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > directCorrections =
+                solidBodyTide->calculateSphericalHarmonicsCorrections( 7200.0 );
+        BOOST_CHECK_SMALL( ( cosineCorrections.block( 2, 0, 2, 4 ) - directCorrections.first ).cwiseAbs( ).maxCoeff( ),
+                           10.0 * correctionMagnitude * std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_SMALL( ( sineCorrections.block( 2, 0, 2, 4 ) - directCorrections.second ).cwiseAbs( ).maxCoeff( ),
+                           10.0 * correctionMagnitude * std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check that error estimate of linear interpolation scales quadratically with time step.
+    double coarseError = estimateInterpolatedSphericalHarmonicCorrectionError(
+                solidBodyTide, interpolatedCorrectionFunction, initialTime, finalTime, 3600.0 );
+    double fineError = estimateInterpolatedSphericalHarmonicCorrectionError(
+                solidBodyTide, createInterpolatedSphericalHarmonicCorrectionFunctions(
+                    solidBodyTide, initialTime, finalTime, 1800.0 ), initialTime, finalTime, 1800.0 );
+    BOOST_CHECK( coarseError > 1.0E-3 * correctionMagnitude );
+    BOOST_CHECK( coarseError < 0.1 * correctionMagnitude );
+    BOOST_CHECK_CLOSE_FRACTION( coarseError / fineError, 4.0, 0.1 );
+
+    // Check that error estimate is consistent with error at arbitrary time.
+    {
+        Eigen::MatrixXd sineCorrections = Eigen::MatrixXd::Zero( 4, 4 );
+        Eigen::MatrixXd cosineCorrections = Eigen::MatrixXd::Zero( 4, 4 );
+        interpolatedCorrectionFunction( 45678.9, sineCorrections, cosineCorrections );
+
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > directCorrections =
+                solidBodyTide->calculateSphericalHarmonicsCorrections( 45678.9 );
+        BOOST_CHECK( ( cosineCorrections.block( 2, 0, 2, 4 ) - directCorrections.first ).cwiseAbs( ).maxCoeff( ) <
+                     1.1 * coarseError );
+        BOOST_CHECK( ( sineCorrections.block( 2, 0, 2, 4 ) - directCorrections.second ).cwiseAbs( ).maxCoeff( ) <
+                     1.1 * coarseError );
+    }
+
+    // Check error estimate of higher-order interpolation (limited by cubic spline interpolation at boundaries).
+    double lagrangeError = estimateInterpolatedSphericalHarmonicCorrectionError(
+                solidBodyTide, createInterpolatedSphericalHarmonicCorrectionFunctions(
+                    solidBodyTide, initialTime, finalTime, 900.0,
+                    std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) ),
+                initialTime, finalTime, 900.0 );
+    BOOST_CHECK( lagrangeError < fineError );
+
+    // Check that error estimate is provided by variation set, if requested.
+    {
+        GravityFieldVariationsSet variationsSet(
+                    { solidBodyTide }, { basic_solid_body }, { "" },
+                    { { 0, std::make_shared< interpolators::InterpolatorSettings >(
+                            interpolators::linear_interpolator, interpolators::huntingAlgorithm ) } },
+                    { { 0, initialTime } }, { { 0, finalTime } }, { { 0, 3600.0 } }, { { 0, 2 } }, { { 0, true } } );
+        BOOST_CHECK_EQUAL( variationsSet.getInterpolationErrors( ).size( ), 0 );
+
+        variationsSet.getVariationFunctions( );
+        BOOST_CHECK_EQUAL( variationsSet.getInterpolationErrors( ).size( ), 1 );
+        BOOST_CHECK_CLOSE_FRACTION( variationsSet.getInterpolationErrors( ).at( 0 ), coarseError,
+                                    std::numeric_limits< double >::epsilon( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
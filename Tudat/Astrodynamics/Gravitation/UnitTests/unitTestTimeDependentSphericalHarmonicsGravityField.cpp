@@ -0,0 +1,154 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_time_dependent_spherical_harmonics_gravity_field )
+
+using namespace tudat::gravitation;
+using mathematical_constants::PI;
+
+//! Function returning the state of a body on a circular orbit in the xy-plane.
+Eigen::Vector6d getCircularOrbitState( const double time )
+{
+    double angle = 2.0 * PI * time / ( 27.32 * 86400.0 );
+    Eigen::Vector6d state = Eigen::Vector6d::Zero( );
+    state.segment( 0, 3 ) = 3.844E8 * Eigen::Vector3d( std::cos( angle ), std::sin( angle ), 0.0 );
+    return state;
+}
+
+//! Test whether the incremental update of the coefficients is equal to a full recomputation.
+BOOST_AUTO_TEST_CASE( testIncrementalCoefficientUpdate )
+{
+    // Define nominal coefficients.
+    Eigen::MatrixXd nominalCosineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( 21, 21 );
+    Eigen::MatrixXd nominalSineCoefficients = 1.0E-6 * Eigen::MatrixXd::Random( 21, 21 );
+    nominalCosineCoefficients( 0, 0 ) = 1.0;
+
+    // Create degree 2 and 3 solid body tide.
+    std::vector< std::vector< std::complex< double > > > loveNumbers;
+    loveNumbers.push_back( std::vector< std::complex< double > >( 3, std::complex< double >( 0.3, 0.0 ) ) );
+    loveNumbers.push_back( std::vector< std::complex< double > >( 4, std::complex< double >( 0.09, 0.0 ) ) );
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > solidBodyTide =
+            std::make_shared< BasicSolidBodyTideGravityFieldVariations >(
+                [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); },
+                [ ]( const double time ){ return Eigen::Quaterniond(
+                        Eigen::AngleAxisd( -7.292115E-5 * time, Eigen::Vector3d::UnitZ( ) ) ); },
+                std::vector< std::function< Eigen::Vector6d( const double ) > >( { &getCircularOrbitState } ),
+                6378137.0, [ ]( ){ return 3.986004418E14; },
+                std::vector< std::function< double( ) > >( { [ ]( ){ return 4.9028E12; } } ),
+                loveNumbers, std::vector< std::string >( { "Moon" } ) );
+
+    std::shared_ptr< TimeDependentSphericalHarmonicsGravityField > gravityField =
+            std::make_shared< TimeDependentSphericalHarmonicsGravityField >(
+                3.986004418E14, 6378137.0, nominalCosineCoefficients, nominalSineCoefficients,
+                std::make_shared< GravityFieldVariationsSet >(
+                    std::vector< std::shared_ptr< GravityFieldVariations > >( { solidBodyTide } ),
+                    std::vector< BodyDeformationTypes >( { basic_solid_body } ),
+                    std::vector< std::string >( { "BasicTidal" } ) ) );
+
+    // Create acceleration model that only retrieves coefficients when modified.
+    Eigen::Vector3d satellitePosition( 5.0E6, 3.0E6, 2.0E6 );
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > accelerationModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ = ]( ){ return satellitePosition; }, [ ]( ){ return 3.986004418E14; }, 6378137.0,
+                std::bind( &SphericalHarmonicsGravityField::getCosineCoefficientsBlock, gravityField, 20, 20 ),
+                std::bind( &SphericalHarmonicsGravityField::getSineCoefficientsBlock, gravityField, 20, 20 ) );
+    accelerationModel->setCoefficientUpdateIndexFunction(
+                std::bind( &SphericalHarmonicsGravityField::getCoefficientUpdateIndex, gravityField ) );
+
+    // Function to check current coefficients and acceleration against full recomputation.
+    auto checkCoefficients = [ & ]( const double time )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > corrections =
+                solidBodyTide->calculateSphericalHarmonicsCorrections( time );
+        Eigen::MatrixXd expectedCosineCoefficients = nominalCosineCoefficients;
+        Eigen::MatrixXd expectedSineCoefficients = nominalSineCoefficients;
+        expectedCosineCoefficients.block( 2, 0, 2, 4 ) += corrections.first;
+        expectedSineCoefficients.block( 2, 0, 2, 4 ) += corrections.second;
+
+        BOOST_CHECK_SMALL(
+                    ( gravityField->getCosineCoefficients( ) - expectedCosineCoefficients ).cwiseAbs( ).maxCoeff( ),
+                    std::numeric_limits< double >::epsilon( ) );
+        BOOST_CHECK_SMALL(
+                    ( gravityField->getSineCoefficients( ) - expectedSineCoefficients ).cwiseAbs( ).maxCoeff( ),
+                    std::numeric_limits< double >::epsilon( ) );
+
+        accelerationModel->resetTime( TUDAT_NAN );
+        accelerationModel->updateMembers( time );
+        SphericalHarmonicsGravitationalAccelerationModel expectedAccelerationModel(
+                    [ = ]( ){ return satellitePosition; }, 3.986004418E14, 6378137.0,
+                    expectedCosineCoefficients, expectedSineCoefficients );
+        BOOST_CHECK_SMALL( ( accelerationModel->getAcceleration( ) -
+                             expectedAccelerationModel.getAcceleration( ) ).norm( ),
+                           1.0E-15 * expectedAccelerationModel.getAcceleration( ).norm( ) );
+    };
+
+    // Check updates to different times.
+    gravityField->update( 1000.0 );
+    checkCoefficients( 1000.0 );
+    gravityField->update( 25000.0 );
+    checkCoefficients( 25000.0 );
+
+    // Check that update to same time is skipped.
+    unsigned int coefficientUpdateIndex = gravityField->getCoefficientUpdateIndex( );
+    gravityField->update( 25000.0 );
+    BOOST_CHECK_EQUAL( gravityField->getCoefficientUpdateIndex( ), coefficientUpdateIndex );
+
+    // Check that update to same time is performed after reset of time.
+    gravityField->resetCurrentTime( );
+    gravityField->update( 25000.0 );
+    BOOST_CHECK_EQUAL( gravityField->getCoefficientUpdateIndex( ), coefficientUpdateIndex + 1 );
+    checkCoefficients( 25000.0 );
+
+    // Check that update to same time is performed after modification of Love numbers.
+    solidBodyTide->resetLoveNumbersOfDegree(
+                std::vector< std::complex< double > >( 3, std::complex< double >( 0.6, 0.0 ) ), 2 );
+    gravityField->update( 25000.0 );
+    checkCoefficients( 25000.0 );
+
+    // Check that modified nominal coefficients outside of variation block are used.
+    nominalCosineCoefficients( 10, 5 ) = 2.0E-6;
+    nominalSineCoefficients( 12, 7 ) = -2.0E-6;
+    gravityField->setNominalCosineCoefficients( nominalCosineCoefficients );
+    gravityField->setNominalSineCoefficient( 12, 7, -2.0E-6 );
+    gravityField->update( 25000.0 );
+    checkCoefficients( 25000.0 );
+
+    // Check that coefficients are fully reset after direct modification.
+    gravityField->setCosineCoefficients( Eigen::MatrixXd::Zero( 21, 21 ) );
+    gravityField->update( 25000.0 );
+    checkCoefficients( 25000.0 );
+    gravityField->setSineCoefficients( Eigen::MatrixXd::Zero( 21, 21 ) );
+    gravityField->update( 40000.0 );
+    checkCoefficients( 40000.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
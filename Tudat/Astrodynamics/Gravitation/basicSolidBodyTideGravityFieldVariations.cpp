@@ -10,6 +10,7 @@
 
 #include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
 
 namespace tudat
@@ -176,43 +177,107 @@ calculateBasicSphericalHarmonicsCorrections(
     return std::make_pair( cTermCorrections, sTermCorrections );
 }
 
-//! Calculates basic solid body gravity field corrections due to single body.
-void BasicSolidBodyTideGravityFieldVariations::addBasicSolidBodyTideCorrections(
-        Eigen::MatrixXd& cTermCorrections,
-        Eigen::MatrixXd& sTermCorrections )
+//! Derived function for calculating spherical harmonic coefficient corrections at a list of times.
+std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > >
+BasicSolidBodyTideGravityFieldVariations::calculateSphericalHarmonicsCorrectionsAtTimes(
+        const std::vector< double >& times, const int numberOfThreads )
 {
-//    // Initialize power of radiusRatio^(N+1) (calculation starts at N=2)
-    radiusRatioPower = radiusRatio * radiusRatio * radiusRatio;
+    // Calculate corrections serially if additional correction functions are used.
+    if( correctionFunctions.size( ) != 1 )
+    {
+        return GravityFieldVariations::calculateSphericalHarmonicsCorrectionsAtTimes( times, numberOfThreads );
+    }
 
-    currentCosineCorrections_.setZero( );
-    currentSineCorrections_.setZero( );
+    // Calculate current geometry and masses of all bodies at all times.
+    unsigned int numberOfDeformingBodies = deformingBodyStateFunctions_.size( );
+    std::vector< double > radiusRatios( times.size( ) * numberOfDeformingBodies );
+    std::vector< double > sinesOfLatitude( times.size( ) * numberOfDeformingBodies );
+    std::vector< std::complex< double > > iLongitudes( times.size( ) * numberOfDeformingBodies );
+    std::vector< double > massRatios( times.size( ) * numberOfDeformingBodies );
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < numberOfDeformingBodies; j++ )
+        {
+            setBodyGeometryParameters( j, times.at( i ) );
+            radiusRatios[ i * numberOfDeformingBodies + j ] = radiusRatio;
+            sinesOfLatitude[ i * numberOfDeformingBodies + j ] = sineOfLatitude;
+            iLongitudes[ i * numberOfDeformingBodies + j ] = iLongitude;
+            massRatios[ i * numberOfDeformingBodies + j ] = deformingBodyMasses_[ j ]( ) / deformedBodyMass_( );
+        }
+    }
 
-    //    // Iterate over all love
-    std::complex< double > stokesCoefficientCorrection( 0.0, 0.0 );
+    // Calculate corrections at all times, in parallel.
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > corrections( times.size( ) );
+    utilities::executeParallelLoop(
+                static_cast< int >( times.size( ) ), [ & ]( const int i )
+    {
+        Eigen::MatrixXd cTermCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
+        Eigen::MatrixXd sTermCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
+        for( unsigned int j = 0; j < numberOfDeformingBodies; j++ )
+        {
+            unsigned int index = i * numberOfDeformingBodies + j;
+            addBasicSolidBodyTideCorrectionsFromGeometry(
+                        radiusRatios[ index ], sinesOfLatitude[ index ], iLongitudes[ index ], massRatios[ index ],
+                        cTermCorrections, sTermCorrections );
+        }
+        corrections[ i ] = std::make_pair( cTermCorrections, sTermCorrections );
+    }, numberOfThreads );
 
+    return corrections;
+}
+
+//! Calculates basic solid body gravity field corrections due to single body, from its geometry.
+void BasicSolidBodyTideGravityFieldVariations::addBasicSolidBodyTideCorrectionsFromGeometry(
+        const double currentRadiusRatio,
+        const double currentSineOfLatitude,
+        const std::complex< double > currentILongitude,
+        const double currentMassRatio,
+        Eigen::MatrixXd& cTermCorrections,
+        Eigen::MatrixXd& sTermCorrections ) const
+{
+    // Initialize power of radiusRatio^(N+1) (calculation starts at N=2)
+    double currentRadiusRatioPower = currentRadiusRatio * currentRadiusRatio * currentRadiusRatio;
+
+    double currentTideAmplitude;
+    std::complex< double > currentTideArgument;
+    std::complex< double > stokesCoefficientCorrection( 0.0, 0.0 );
     for( unsigned int n = 2; n < loveNumbers_.size( ) + 2; n++ )
     {
         for( unsigned int m = 0; ( m <= n && m < loveNumbers_.at( n - 2 ).size( ) ); m++ )
         {
-            updateTidalAmplitudeAndArgument( n, m );
+            calculateTidalAmplitudeAndArgument(
+                        n, m, currentSineOfLatitude, currentILongitude,
+                        currentTideAmplitude, currentTideArgument );
 
             // Calculate and add coefficients.
             stokesCoefficientCorrection =
                     calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude(
-                        loveNumbers_[ n - 2 ][ m ], massRatio, radiusRatioPower, tideAmplitude,
-                    tideArgument, n, m );
-
+                        loveNumbers_[ n - 2 ][ m ], currentMassRatio, currentRadiusRatioPower,
+                        currentTideAmplitude, currentTideArgument, n, m );
 
-            currentCosineCorrections_( n - 2, m ) += stokesCoefficientCorrection.real( );
+            cTermCorrections( n - 2, m ) += stokesCoefficientCorrection.real( );
             if( m != 0 )
             {
-                currentSineCorrections_( n - 2, m ) -= stokesCoefficientCorrection.imag( );
+                sTermCorrections( n - 2, m ) -= stokesCoefficientCorrection.imag( );
             }
         }
 
         // Increment radius ratio power.
-        radiusRatioPower *= radiusRatio;
+        currentRadiusRatioPower *= currentRadiusRatio;
     }
+}
+
+//! Calculates basic solid body gravity field corrections due to single body.
+void BasicSolidBodyTideGravityFieldVariations::addBasicSolidBodyTideCorrections(
+        Eigen::MatrixXd& cTermCorrections,
+        Eigen::MatrixXd& sTermCorrections )
+{
+    currentCosineCorrections_.setZero( );
+    currentSineCorrections_.setZero( );
+
+    addBasicSolidBodyTideCorrectionsFromGeometry(
+                radiusRatio, sineOfLatitude, iLongitude, massRatio,
+                currentCosineCorrections_, currentSineCorrections_ );
 
     cTermCorrections.block( 0, 0, maximumDegree_ - minimumDegree_ + 1, maximumOrder_  - minimumOrder_ + 1 ) +=
             currentCosineCorrections_;
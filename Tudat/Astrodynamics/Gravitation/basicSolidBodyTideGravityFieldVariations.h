@@ -209,6 +209,23 @@ public:
         return calculateBasicSphericalHarmonicsCorrections( time );
     }
 
+    //! Derived function for calculating spherical harmonic coefficient corrections at a list of times.
+    /*!
+     *  Derived function for calculating spherical harmonic coefficient corrections at a list of times. The states,
+     *  orientation and masses of the bodies are first evaluated serially by setBodyGeometryParameters (as the
+     *  associated functions need not be thread-safe), after which the corrections are calculated from the resulting
+     *  geometry by addBasicSolidBodyTideCorrectionsFromGeometry (as is done by calculateSphericalHarmonicsCorrections),
+     *  distributed over the requested number of threads. If correction functions have been added to the basic solid
+     *  body tide (by a derived class), the corrections are calculated serially by
+     *  calculateSphericalHarmonicsCorrections.
+     *  \param times Times at which variations are to be calculated.
+     *  \param numberOfThreads Maximum number of threads that may be used for the calculation.
+     *  \return List of pairs of matrices containing variations in (cosine, sine) coefficients, with entries
+     *  corresponding to those of the times input.
+     */
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > calculateSphericalHarmonicsCorrectionsAtTimes(
+            const std::vector< double >& times, const int numberOfThreads );
+
     //! Function to retrieve the love numbers at given degree.
     /*!
      *  Function to retrieve the love numbers at given degree. Returns a vector containing (complex)
@@ -248,6 +265,7 @@ public:
             if( loveNumbers.size( ) <= static_cast< unsigned int >( degree + 1 ) )
             {
                 loveNumbers_[ degree - 2 ] = loveNumbers;
+                modelUpdateIndex_++;
             }
             else
             {                               
@@ -396,20 +414,44 @@ protected:
     std::vector< std::function< void( Eigen::MatrixXd&, Eigen::MatrixXd& ) > >
     correctionFunctions;
 
+    //! Calculates basic solid body gravity field corrections due to single body, from its geometry.
+    /*!
+     *  Calculates basic solid body gravity field corrections due to single body, from its geometry w.r.t. the body
+     *  being deformed (as set by setBodyGeometryParameters), without modifying any member variables (so that it may be
+     *  called concurrently). The tidal amplitude and argument at each degree and order are obtained from
+     *  calculateTidalAmplitudeAndArgument.
+     *  \param currentRadiusRatio Ratio of equatorial radius of body being deformed over distance to body causing
+     *  deformation.
+     *  \param currentSineOfLatitude Sine of latitude of body causing deformation in frame fixed to body being deformed.
+     *  \param currentILongitude i (sqrt(-1)) times longitude of body causing deformation in frame fixed to body being
+     *  deformed.
+     *  \param currentMassRatio Ratio of masses of body causing deformation and body being deformed.
+     *  \param cTermCorrections Cosine coefficient corrections, to which corrections are added (returned by reference).
+     *  \param sTermCorrections Sine coefficient corrections, to which corrections are added (returned by reference).
+     */
+    void addBasicSolidBodyTideCorrectionsFromGeometry(
+            const double currentRadiusRatio,
+            const double currentSineOfLatitude,
+            const std::complex< double > currentILongitude,
+            const double currentMassRatio,
+            Eigen::MatrixXd& cTermCorrections,
+            Eigen::MatrixXd& sTermCorrections ) const;
+
     //! Calculates basic solid body gravity field corrections due to single body.
     /*!
      *  Calculates basic solid body gravity field corrections for all degrees and orders set.
      *  The arguments are modified as they are passed by reference, through which the corrections
      *  are returned.
      *  Class variables denoting properties of currently considered body must have been set before
-     *  this function is called.
+     *  this function is called. The corrections are computed by addBasicSolidBodyTideCorrectionsFromGeometry, which is
+     *  also used when calculating the corrections at a list of times.
      *  \param cTermCorrections Corrections to cosine terms
      *  (passed by reference; correction added to input value).
      *  \param sTermCorrections Corrections to sine terms.
      *
      *  (passed by reference; correction added to input value).
      */
-    virtual void addBasicSolidBodyTideCorrections(
+    void addBasicSolidBodyTideCorrections(
             Eigen::MatrixXd& cTermCorrections, Eigen::MatrixXd& sTermCorrections );
 
     //! Sets current properties (mass state) of body causing tidal deformation.
@@ -422,18 +464,27 @@ protected:
     virtual void setBodyGeometryParameters(
             const int bodyIndex, const double evaluationTime);
 
-    //! Calculate tidal amplitude and argument at current degree and order.
+    //! Calculate tidal amplitude and argument at given degree and order.
     /*!
-     * Calculate tidal amplitude and argument at current degree and order.
+     * Calculate tidal amplitude and argument at given degree and order, from the geometry of the body causing
+     * deformation. Derived classes redefining this function must not modify any member variables, as the function may
+     * be called concurrently (see calculateSphericalHarmonicsCorrectionsAtTimes).
      * \param degree Degree of tide.
      * \param order Order of tide.
-     */
-    virtual void updateTidalAmplitudeAndArgument(
-            const int degree, const int order )
+     * \param currentSineOfLatitude Sine of latitude of body causing deformation in frame fixed to body being deformed.
+     * \param currentILongitude i (sqrt(-1)) times longitude of body causing deformation in frame fixed to body being
+     * deformed.
+     * \param currentTideAmplitude Amplitude of the tide (returned by reference).
+     * \param currentTideArgument Argument of the tide (returned by reference).
+     */
+    virtual void calculateTidalAmplitudeAndArgument(
+            const int degree, const int order,
+            const double currentSineOfLatitude, const std::complex< double > currentILongitude,
+            double& currentTideAmplitude, std::complex< double >& currentTideArgument ) const
     {
-        tideAmplitude = basic_mathematics::computeLegendrePolynomialExplicit(
-                    degree, order, sineOfLatitude );
-        tideArgument = static_cast< double >( order ) * iLongitude;
+        currentTideAmplitude = basic_mathematics::computeLegendrePolynomialExplicit(
+                    degree, order, currentSineOfLatitude );
+        currentTideArgument = static_cast< double >( order ) * currentILongitude;
     }
 
 
@@ -506,14 +557,6 @@ protected:
      */
     double radiusRatio;
 
-    //! Ratio of radii in current calculation step to the power (degree+1).
-    /*!
-     *  Ratio of equatorial radius of body being deformed over distance between center of body
-     *  being deformed to center of body causing deformation, to the power (degree+1), in current
-     *  calculation step
-     */
-    double radiusRatioPower;
-
     //! Sine of latitude of currently considered body in current calculation step
     /*!
      *  Sine of latitude of body causing deformation in frame fixed to body being deformed in
@@ -528,21 +571,6 @@ protected:
      */
     std::complex< double > iLongitude;
 
-    //! Current argument of the tide.
-    /*!
-     *  Current argument of the tide, to be used as input to
-     *  calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude, modulates the tide as
-     *  exp( -tideArgument).
-     */
-    std::complex< double > tideArgument;
-
-    //! Current amplitude of the tide.
-    /*!
-     *  Current amplitude of the tide, to be used as input to
-     *  calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude.
-     */
-    double tideAmplitude;
-
     //! Current position of body being deformed.
     Eigen::Vector3d deformedBodyPosition;
 
@@ -150,6 +150,59 @@ Eigen::Vector3d computeGravitationalAccelerationZonalSum(
     return gravitationalAccelerationSum;
 }
 
+//! Compute central, J2, J3 and J4 gravitational accelerations for a batch of bodies.
+void computeCentralJ2J3J4GravitationalAccelerations(
+        const Eigen::ArrayXXd& relativePositionsOfBodiesSubjectToAcceleration,
+        const double gravitationalParameterOfBodyExertingAcceleration,
+        const double equatorialRadiusOfBodyExertingAcceleration,
+        const double j2CoefficientOfGravityField,
+        const double j3CoefficientOfGravityField,
+        const double j4CoefficientOfGravityField,
+        Eigen::ArrayXXd& gravitationalAccelerations )
+{
+    if( relativePositionsOfBodiesSubjectToAcceleration.cols( ) != 3 )
+    {
+        throw std::runtime_error( "Error when computing batch of J2, J3, J4 accelerations, positions must have 3 columns" );
+    }
+
+    const int numberOfBodies = relativePositionsOfBodiesSubjectToAcceleration.rows( );
+    gravitationalAccelerations.resize( numberOfBodies, 3 );
+
+    // Set values reused for computation of acceleration components, in the same manner as single-body functions.
+    const Eigen::ArrayXd inverseDistance =
+            relativePositionsOfBodiesSubjectToAcceleration.square( ).rowwise( ).sum( ).sqrt( ).inverse( );
+    const Eigen::ArrayXd scaledZCoordinate =
+            relativePositionsOfBodiesSubjectToAcceleration.col( orbital_element_conversions::zCartesianPositionIndex ) *
+            inverseDistance;
+    const Eigen::ArrayXd scaledZCoordinateSquared = scaledZCoordinate.square( );
+    const Eigen::ArrayXd scaledRadius = equatorialRadiusOfBodyExertingAcceleration * inverseDistance;
+    const Eigen::ArrayXd scaledRadiusSquared = scaledRadius.square( );
+    const Eigen::ArrayXd preMultiplier =
+            gravitationalParameterOfBodyExertingAcceleration * inverseDistance.square( );
+
+    const Eigen::ArrayXd j2Multiplier = 1.5 * j2CoefficientOfGravityField * scaledRadiusSquared;
+    const Eigen::ArrayXd j3Multiplier = 2.5 * j3CoefficientOfGravityField * scaledRadiusSquared * scaledRadius;
+    const Eigen::ArrayXd j4Multiplier = 4.375 * j4CoefficientOfGravityField * scaledRadiusSquared.square( );
+
+    // Compute factor multiplying (scaled) x- and y-coordinates, summing all terms.
+    const Eigen::ArrayXd factorForXAndYDirections = preMultiplier * inverseDistance * (
+                -1.0 - j2Multiplier * ( 1.0 - 5.0 * scaledZCoordinateSquared )
+                - j3Multiplier * ( 3.0 - 7.0 * scaledZCoordinateSquared ) * scaledZCoordinate
+                + j4Multiplier * ( 3.0 / 7.0 + scaledZCoordinateSquared * ( -6.0 + 9.0 * scaledZCoordinateSquared ) ) );
+
+    gravitationalAccelerations.col( orbital_element_conversions::xCartesianPositionIndex ) =
+            relativePositionsOfBodiesSubjectToAcceleration.col( orbital_element_conversions::xCartesianPositionIndex ) *
+            factorForXAndYDirections;
+    gravitationalAccelerations.col( orbital_element_conversions::yCartesianPositionIndex ) =
+            relativePositionsOfBodiesSubjectToAcceleration.col( orbital_element_conversions::yCartesianPositionIndex ) *
+            factorForXAndYDirections;
+    gravitationalAccelerations.col( orbital_element_conversions::zCartesianPositionIndex ) = preMultiplier * (
+                ( -1.0 - j2Multiplier * ( 3.0 - 5.0 * scaledZCoordinateSquared ) ) * scaledZCoordinate
+                - j3Multiplier * ( -0.6 + scaledZCoordinateSquared * ( 6.0 - 7.0 * scaledZCoordinateSquared ) )
+                + j4Multiplier * ( 15.0 / 7.0 + scaledZCoordinateSquared * ( -10.0 + 9.0 * scaledZCoordinateSquared ) ) *
+                scaledZCoordinate );
+}
+
 //! Get gravitational acceleration.
 Eigen::Vector3d CentralJ2J3J4GravitationalAccelerationModel::getAcceleration( )
 {
@@ -110,6 +110,34 @@ Eigen::Vector3d computeGravitationalAccelerationZonalSum(
         const std::map< int, double > zonalCoefficientsOfGravityField,
         const Eigen::Vector3d& positionOfBodyExertingAcceleration );
 
+//! Compute central, J2, J3 and J4 gravitational accelerations for a batch of bodies.
+/*!
+ * Computes the sum of the central, J2, J3 and J4 gravitational accelerations (see
+ * computeGravitationalAcceleration, computeGravitationalAccelerationDueToJ2,
+ * computeGravitationalAccelerationDueToJ3 and computeGravitationalAccelerationDueToJ4) experienced by a batch of
+ * bodies, due to a single body exerting the acceleration. The positions are provided in structure-of-arrays form
+ * (one row per body, one column per Cartesian component), so that the computation is vectorized over all bodies.
+ * \param relativePositionsOfBodiesSubjectToAcceleration Positions of bodies subject to acceleration w.r.t. body
+ *          exerting acceleration, one row per body (size Nx3) [m].
+ * \param gravitationalParameterOfBodyExertingAcceleration Gravitational parameter of body exerting
+ *          acceleration [m^3 s^-2].
+ * \param equatorialRadiusOfBodyExertingAcceleration Equatorial radius of body exerting acceleration, in
+ *          formulation of spherical harmonics expansion [m].
+ * \param j2CoefficientOfGravityField J2-coefficient of gravity field of body exerting acceleration [-].
+ * \param j3CoefficientOfGravityField J3-coefficient of gravity field of body exerting acceleration [-].
+ * \param j4CoefficientOfGravityField J4-coefficient of gravity field of body exerting acceleration [-].
+ * \param gravitationalAccelerations Gravitational accelerations of bodies subject to acceleration (returned by
+ *          reference, resized to Nx3 if required) [m s^-2].
+ */
+void computeCentralJ2J3J4GravitationalAccelerations(
+        const Eigen::ArrayXXd& relativePositionsOfBodiesSubjectToAcceleration,
+        const double gravitationalParameterOfBodyExertingAcceleration,
+        const double equatorialRadiusOfBodyExertingAcceleration,
+        const double j2CoefficientOfGravityField,
+        const double j3CoefficientOfGravityField,
+        const double j4CoefficientOfGravityField,
+        Eigen::ArrayXXd& gravitationalAccelerations );
+
 //! Central + J2 + J3 + J4 gravitational acceleration model class.
 /*!
  * This class implements a gravitational acceleration model that includes the central, J2, J3, and
@@ -125,38 +125,44 @@ createInterpolatedSphericalHarmonicCorrectionFunctions(
         const double initialTime,
         const double finalTime,
         const double timeStep,
-        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings )
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings,
+        const int numberOfThreads )
 {
-    // Declare map of combined cosine and since corrections, to be filled and passed to interpolator
-    std::map< double, Eigen::MatrixXd > cosineSineCorrectionsMap;
-
-    // Perform once for matrices size determination.
+    // Set all times at which corrections are to be calculated.
+    std::vector< double > correctionTimes;
     double currentTime = initialTime;
-    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > singleCorrections;
-    singleCorrections = variationObject->calculateSphericalHarmonicsCorrections( currentTime );
-    int correctionDegrees = singleCorrections.first.rows( );
-    int correctionOrders = singleCorrections.first.cols( );
-
-    // Loop over all times at which corrections are to be calculated.
-    Eigen::MatrixXd cosineSineCorrections;
     while( currentTime < finalTime )
     {
-        // Calculate current corrections.
-        singleCorrections = variationObject->calculateSphericalHarmonicsCorrections( currentTime );
+        correctionTimes.push_back( currentTime );
+        currentTime += timeStep;
+    }
+
+    if( correctionTimes.size( ) == 0 )
+    {
+        throw std::runtime_error(
+                    "Error when interpolating gravity field variations, no corrections in interpolation interval." );
+    }
 
+    // Calculate corrections at all times.
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > corrections =
+            variationObject->calculateSphericalHarmonicsCorrectionsAtTimes( correctionTimes, numberOfThreads );
+    int correctionDegrees = corrections.at( 0 ).first.rows( );
+    int correctionOrders = corrections.at( 0 ).first.cols( );
+
+    // Declare map of combined cosine and since corrections, to be filled and passed to interpolator
+    std::map< double, Eigen::MatrixXd > cosineSineCorrectionsMap;
+    Eigen::MatrixXd cosineSineCorrections;
+    for( unsigned int i = 0; i < correctionTimes.size( ); i++ )
+    {
         // Set current corrections in single block.
         cosineSineCorrections = Eigen::MatrixXd::Zero( correctionDegrees, 2 * correctionOrders );
         cosineSineCorrections.block( 0, 0, correctionDegrees, correctionOrders ) +=
-                singleCorrections.first;
+                corrections.at( i ).first;
         cosineSineCorrections.block( 0, correctionOrders, correctionDegrees, correctionOrders ) +=
-                singleCorrections.second;
-        cosineSineCorrectionsMap[ currentTime ] = cosineSineCorrections;
-
-        // Increment time.
-        currentTime += timeStep;
+                corrections.at( i ).second;
+        cosineSineCorrectionsMap[ correctionTimes.at( i ) ] = cosineSineCorrections;
     }
 
-
     // Create interpolator
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
             cosineSineCorrectionInterpolator =
@@ -175,6 +181,57 @@ createInterpolatedSphericalHarmonicCorrectionFunctions(
                         interpolationInterface, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 );
 }
 
+//! Function to estimate the error of interpolated sine and cosine correction coefficients.
+double estimateInterpolatedSphericalHarmonicCorrectionError(
+        std::shared_ptr< GravityFieldVariations > variationObject,
+        const std::function< void( const double, Eigen::MatrixXd&, Eigen::MatrixXd& ) > interpolatedCorrectionFunction,
+        const double initialTime,
+        const double finalTime,
+        const double timeStep,
+        const int numberOfThreads )
+{
+    // Set times halfway between subsequent tabulated corrections (within interpolation interval).
+    std::vector< double > testTimes;
+    double currentTime = initialTime;
+    while( currentTime + timeStep < finalTime )
+    {
+        testTimes.push_back( currentTime + timeStep / 2.0 );
+        currentTime += timeStep;
+    }
+
+    // Calculate corrections directly at test times.
+    std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > corrections =
+            variationObject->calculateSphericalHarmonicsCorrectionsAtTimes( testTimes, numberOfThreads );
+
+    // Compare with interpolated corrections.
+    int minimumDegree = variationObject->getMinimumDegree( );
+    int minimumOrder = variationObject->getMinimumOrder( );
+    int numberOfDegrees = variationObject->getNumberOfDegrees( );
+    int numberOfOrders = variationObject->getNumberOfOrders( );
+
+    double maximumError = 0.0;
+    Eigen::MatrixXd interpolatedSineCorrections, interpolatedCosineCorrections;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        interpolatedSineCorrections.setZero(
+                    minimumDegree + numberOfDegrees, minimumOrder + numberOfOrders );
+        interpolatedCosineCorrections.setZero(
+                    minimumDegree + numberOfDegrees, minimumOrder + numberOfOrders );
+        interpolatedCorrectionFunction( testTimes.at( i ), interpolatedSineCorrections, interpolatedCosineCorrections );
+
+        maximumError = std::max(
+                    maximumError, ( interpolatedCosineCorrections.block(
+                                        minimumDegree, minimumOrder, numberOfDegrees, numberOfOrders ) -
+                                    corrections.at( i ).first ).cwiseAbs( ).maxCoeff( ) );
+        maximumError = std::max(
+                    maximumError, ( interpolatedSineCorrections.block(
+                                        minimumDegree, minimumOrder, numberOfDegrees, numberOfOrders ) -
+                                    corrections.at( i ).second ).cwiseAbs( ).maxCoeff( ) );
+    }
+
+    return maximumError;
+}
+
 //! Class constructor.
 GravityFieldVariationsSet::GravityFieldVariationsSet(
         const std::vector< std::shared_ptr< GravityFieldVariations > > variationObjects,
@@ -184,11 +241,14 @@ GravityFieldVariationsSet::GravityFieldVariationsSet(
         createInterpolator,
         const std::map< int, double > initialTimes,
         const std::map< int, double > finalTimes,
-        const std::map< int, double > timeSteps ):
+        const std::map< int, double > timeSteps,
+        const std::map< int, int > numberOfThreads,
+        const std::map< int, bool > estimateInterpolationErrors ):
     variationObjects_( variationObjects ), variationType_( variationType ),
     variationIdentifier_( variationIdentifier ),
     createInterpolator_( createInterpolator ),
-    initialTimes_( initialTimes ), finalTimes_( finalTimes ), timeSteps_( timeSteps )
+    initialTimes_( initialTimes ), finalTimes_( finalTimes ), timeSteps_( timeSteps ),
+    numberOfThreads_( numberOfThreads ), estimateInterpolationErrors_( estimateInterpolationErrors )
 {
     // Check consistency of input data vector sizes.
     if( variationObjects_.size( ) != variationType_.size( ) )
@@ -243,15 +303,26 @@ GravityFieldVariationsSet::getVariationFunctions( )
             variationFunctions;
 
     // Iterate over all corrections and add correction function.
+    interpolationErrors_.clear( );
     for( unsigned int i = 0; i < variationObjects_.size( ); i++ )
     {
         // If current variation is to be interpolated, create interpolation function and add to list
         if( createInterpolator_.count( i ) > 0 )
         {
+            int currentNumberOfThreads = ( numberOfThreads_.count( i ) > 0 ) ?
+                        numberOfThreads_.at( i ) : utilities::getDefaultNumberOfThreads( );
             variationFunctions.push_back(
                         createInterpolatedSphericalHarmonicCorrectionFunctions(
                             variationObjects_[ i ], initialTimes_[ i ], finalTimes_[ i ],
-                            timeSteps_[ i ], createInterpolator_[ i ] ) );
+                            timeSteps_[ i ], createInterpolator_[ i ], currentNumberOfThreads ) );
+
+            // Estimate error of interpolated corrections, if requested.
+            if( estimateInterpolationErrors_.count( i ) > 0 && estimateInterpolationErrors_.at( i ) )
+            {
+                interpolationErrors_[ i ] = estimateInterpolatedSphericalHarmonicCorrectionError(
+                            variationObjects_[ i ], variationFunctions.back( ), initialTimes_[ i ], finalTimes_[ i ],
+                            timeSteps_[ i ], currentNumberOfThreads );
+            }
         }
         // If current variation is to not be interpolated, create function directly by function
         // pointer by to current GravityFieldVariations object.
@@ -15,6 +15,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 
 namespace tudat
@@ -146,7 +147,7 @@ public:
                             const int maximumDegree, const int maximumOrder ):
         minimumDegree_( minimumDegree ), minimumOrder_( minimumOrder ),
 
-                maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder )
+                maximumDegree_( maximumDegree ), maximumOrder_( maximumOrder ), modelUpdateIndex_( 0 )
     {
         numberOfDegrees_ = maximumDegree_ - minimumDegree_ + 1;
         numberOfOrders_ = maximumOrder_ - minimumOrder_ + 1;
@@ -171,6 +172,28 @@ public:
     virtual std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSphericalHarmonicsCorrections(
             const double time ) = 0;
 
+    //! Function for calculating corrections at a list of times.
+    /*!
+     *  Function for calculating corrections at a list of times, used to tabulate the corrections up front (see
+     *  createInterpolatedSphericalHarmonicCorrectionFunctions). By default, the corrections are calculated serially by
+     *  calculateSphericalHarmonicsCorrections. Derived classes may redefine this function to distribute the
+     *  computations over a number of threads.
+     *  \param times Times at which variations are to be calculated.
+     *  \param numberOfThreads Maximum number of threads that may be used for the calculation.
+     *  \return List of pairs of matrices containing variations in (cosine, sine) coefficients, with entries
+     *  corresponding to those of the times input.
+     */
+    virtual std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > calculateSphericalHarmonicsCorrectionsAtTimes(
+            const std::vector< double >& times, const int numberOfThreads )
+    {
+        std::vector< std::pair< Eigen::MatrixXd, Eigen::MatrixXd > > corrections;
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            corrections.push_back( calculateSphericalHarmonicsCorrections( times.at( i ) ) );
+        }
+        return corrections;
+    }
+
     //! Function to add sine and cosine corrections at given time to coefficient matrices.
     /*!
      *  Function to add sine and cosine corrections at given time to coefficient matrices.
@@ -241,6 +264,18 @@ public:
         return numberOfOrders_;
     }
 
+    //! Function to return the index denoting the number of times the model parameters have been modified.
+    /*!
+     *  Function to return the index denoting the number of times the model parameters (e.g. Love numbers) have been
+     *  modified, used by TimeDependentSphericalHarmonicsGravityField to determine whether the corrections need to be
+     *  recomputed when updating to the same time.
+     *  \return Index denoting the number of times the model parameters have been modified.
+     */
+    unsigned int getModelUpdateIndex( )
+    {
+        return modelUpdateIndex_;
+    }
+
     //! Function to retrieve correction to cosine coefficients, as computed by last call to addSphericalHarmonicsCorrections
     /*!
      *  Function to retrieve correction to cosine coefficients, as computed by last call to addSphericalHarmonicsCorrections
@@ -304,6 +339,9 @@ protected:
 
     //! Latest correction to sine coefficients, as computed by last call to addSphericalHarmonicsCorrections
     Eigen::MatrixXd lastSineCorrection_;
+
+    //! Index denoting the number of times the model parameters have been modified (see getModelUpdateIndex).
+    unsigned int modelUpdateIndex_;
 };
 
 //! Function to create a function linearly interpolating the sine and cosine correction coefficients
@@ -319,6 +357,9 @@ protected:
  *  \param initialTime Start time of interpolator.
  *  \param finalTime End time of interpolator.
  *  \param timeStep Time step between subsequent evaluations of coefficient corrections
+ *  \param interpolatorSettings Settings for the interpolator of the corrections.
+ *  \param numberOfThreads Maximum number of threads that may be used for the calculation of the corrections (see
+ *  GravityFieldVariations::calculateSphericalHarmonicsCorrectionsAtTimes).
  *  \return Function pointer to function mimicing the addSphericalHarmonicsCorrections
  *  function of GravityFieldVariations.
  */
@@ -330,7 +371,31 @@ createInterpolatedSphericalHarmonicCorrectionFunctions(
         const double timeStep,
         const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
         std::make_shared< interpolators::InterpolatorSettings >(
-            interpolators::linear_interpolator, interpolators::huntingAlgorithm ) );
+            interpolators::linear_interpolator, interpolators::huntingAlgorithm ),
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Function to estimate the error of interpolated sine and cosine correction coefficients.
+/*!
+ *  Function to estimate the error of a function interpolating the sine and cosine correction coefficients produced by
+ *  an object of GravityFieldVariations type (as created by createInterpolatedSphericalHarmonicCorrectionFunctions).
+ *  The interpolated corrections are compared to the directly calculated corrections halfway between the times at
+ *  which the corrections were tabulated, where the interpolation error is typically largest.
+ *  \param variationObject Object generating cosine and sine coefficient corrections.
+ *  \param interpolatedCorrectionFunction Function adding interpolated corrections to (sine, cosine) coefficients.
+ *  \param initialTime Start time of interpolator.
+ *  \param finalTime End time of interpolator.
+ *  \param timeStep Time step between subsequent evaluations of coefficient corrections
+ *  \param numberOfThreads Maximum number of threads that may be used for the direct calculation of the corrections.
+ *  \return Maximum absolute difference between interpolated and directly calculated corrections, over all
+ *  coefficients and test times.
+ */
+double estimateInterpolatedSphericalHarmonicCorrectionError(
+        std::shared_ptr< GravityFieldVariations > variationObject,
+        const std::function< void( const double, Eigen::MatrixXd&, Eigen::MatrixXd& ) > interpolatedCorrectionFunction,
+        const double initialTime,
+        const double finalTime,
+        const double timeStep,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
 
 //! Container class containing all gravity field variations for a single Body
 //! (and TimeDependentSphericalHarmonicsGravityField).
@@ -365,6 +430,12 @@ public:
      *  (map key denotes index of variationObjects) for which createInterpolator is true.
      *  \param timeSteps Time steps for interpolation, must contain an entry for each variation
      *  (map key denotes index of variationObjects) for which createInterpolator is true.
+     *  \param numberOfThreads Maximum number of threads to use when tabulating the corrections for interpolation
+     *  (map key denotes index of variationObjects). If no entry is given for an interpolated variation, the default
+     *  number of threads is used.
+     *  \param estimateInterpolationErrors Booleans denoting whether to estimate the error of the interpolated
+     *  corrections (map key denotes index of variationObjects). If no entry is given for an interpolated variation, no
+     *  error estimate is made.
      */
     GravityFieldVariationsSet(
             const std::vector< std::shared_ptr< GravityFieldVariations > > variationObjects,
@@ -375,7 +446,9 @@ public:
             std::map< int, std::shared_ptr< interpolators::InterpolatorSettings > >( ),
             const std::map< int, double > initialTimes = std::map< int, double >( ),
             const std::map< int, double > finalTimes = std::map< int, double >( ),
-            const std::map< int, double > timeSteps = std::map< int, double >( ) );
+            const std::map< int, double > timeSteps = std::map< int, double >( ),
+            const std::map< int, int > numberOfThreads = std::map< int, int >( ),
+            const std::map< int, bool > estimateInterpolationErrors = std::map< int, bool >( ) );
 
     //! Function to retrieve a variation object of given type (and name if necessary).
     /*!
@@ -397,7 +470,9 @@ public:
     /*!
      *  Function to retrieve list of variation functions, entries are either created using function
      *  pointer binding to PairInterpolationInterface (if given variation is to be interpolated)
-     *  or to GravityFieldVariations directly (if no interpolation requested).
+     *  or to GravityFieldVariations directly (if no interpolation requested). If requested, the error of each
+     *  interpolated variation is estimated (see estimateInterpolatedSphericalHarmonicCorrectionError), and may be
+     *  retrieved afterwards by getInterpolationErrors.
      *  \return List of gravity field coefficient variation functions, matching the interface of
      *  GravityFieldVariations::addSphericalHarmonicsCorrections
      */
@@ -414,6 +489,18 @@ public:
         return variationObjects_;
     }
 
+    //! Function to retrieve the estimated errors of the interpolated variations.
+    /*!
+     * Function to retrieve the estimated errors of the interpolated variations, as computed by the last call to
+     * getVariationFunctions, for each variation for which an error estimate was requested.
+     * \return Maximum absolute error of interpolated coefficient corrections (map key denotes index of
+     * variationObjects).
+     */
+    std::map< int, double > getInterpolationErrors( )
+    {
+        return interpolationErrors_;
+    }
+
     //! Function to retrieve the tidal gravity field variation with the specified bodies causing deformation
     /*!
      * Function to retrieve the tidal gravity field variation with the specified bodies causing deformation. If the
@@ -486,6 +573,27 @@ private:
      *  (map key denotes index of variationObjects) for which createInterpolator is true.
      */
     std::map< int, double > timeSteps_;
+
+    //! Maximum number of threads to use when tabulating the corrections for interpolation.
+    /*!
+     *  Maximum number of threads to use when tabulating the corrections for interpolation (map key denotes index of
+     *  variationObjects). Default number of threads is used for interpolated variations without an entry.
+     */
+    std::map< int, int > numberOfThreads_;
+
+    //! Booleans denoting whether to estimate the error of the interpolated corrections.
+    /*!
+     *  Booleans denoting whether to estimate the error of the interpolated corrections (map key denotes index of
+     *  variationObjects).
+     */
+    std::map< int, bool > estimateInterpolationErrors_;
+
+    //! Estimated errors of the interpolated variations.
+    /*!
+     *  Maximum absolute errors of the interpolated coefficient corrections (map key denotes index of
+     *  variationObjects), as computed by the last call to getVariationFunctions.
+     */
+    std::map< int, double > interpolationErrors_;
 };
 
 } // namespace gravitation
@@ -88,7 +88,7 @@ public:
             const std::function< void( ) > updateInertiaTensor = std::function< void( ) > ( ) )
         : GravityFieldModel( gravitationalParameter, updateInertiaTensor ), referenceRadius_( referenceRadius ),
           cosineCoefficients_( cosineCoefficients ), sineCoefficients_( sineCoefficients ),
-          fixedReferenceFrame_( fixedReferenceFrame )
+          fixedReferenceFrame_( fixedReferenceFrame ), coefficientUpdateIndex_( 0 )
     {
         sphericalHarmonicsCache_ = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder( cosineCoefficients_.rows( ) + 1,
@@ -139,6 +139,7 @@ public:
     void setCosineCoefficients( const Eigen::MatrixXd& cosineCoefficients )
     {
         cosineCoefficients_ = cosineCoefficients;
+        coefficientUpdateIndex_++;
 
         if( !( updateInertiaTensor_ == nullptr ) )
         {
@@ -154,12 +155,27 @@ public:
     void setSineCoefficients( const Eigen::MatrixXd& sineCoefficients )
     {
         sineCoefficients_ = sineCoefficients;
+        coefficientUpdateIndex_++;
+
         if( !( updateInertiaTensor_ == nullptr ) )
         {
             updateInertiaTensor_( );
         }
     }
 
+    //! Function to get the index denoting the number of times the coefficients have been modified.
+    /*!
+     *  Function to get the index denoting the number of times the coefficients have been modified, which is incremented
+     *  each time the cosine and/or sine coefficients are modified. Users of the coefficients (e.g.
+     *  SphericalHarmonicsGravitationalAccelerationModel) may use it to retrieve the coefficients only when they have
+     *  changed.
+     *  \return Index denoting the number of times the coefficients have been modified.
+     */
+    unsigned int getCoefficientUpdateIndex( )
+    {
+        return coefficientUpdateIndex_;
+    }
+
     //! Function to get a cosine spherical harmonic coefficient block (geodesy normalized)
     /*!
      *  Function to get a cosine spherical harmonic coefficient block (geodesy normalized)
@@ -343,6 +359,9 @@ protected:
 
     //! Cache object for potential calculations.
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
+
+    //! Index denoting the number of times the coefficients have been modified (see getCoefficientUpdateIndex).
+    unsigned int coefficientUpdateIndex_;
 };
 
 //! Function to determine a body's inertia tensor from its degree two unnormalized gravity field coefficients
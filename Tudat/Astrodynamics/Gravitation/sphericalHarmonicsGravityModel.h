@@ -220,7 +220,8 @@ public:
               rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
           currentAcceleration_( Eigen::Vector3d::Zero( ) ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          areCoefficientsUpToDate_( false ), lastCoefficientUpdateIndex_( 0 )
     {
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
@@ -283,7 +284,8 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
           currentAcceleration_( Eigen::Vector3d::Zero( ) ),
-          saveSphericalHarmonicTermsSeparately_( false )
+          saveSphericalHarmonicTermsSeparately_( false ),
+          areCoefficientsUpToDate_( false ), lastCoefficientUpdateIndex_( 0 )
     {
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
@@ -329,8 +331,23 @@ public:
         if( !( this->currentTime_ == currentTime ) )
         {
 
-            cosineHarmonicCoefficients = getCosineHarmonicsCoefficients( );
-            sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
+            // Retrieve coefficients, if they may have been modified.
+            if( coefficientUpdateIndexFunction_ == nullptr )
+            {
+                cosineHarmonicCoefficients = getCosineHarmonicsCoefficients( );
+                sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
+            }
+            else
+            {
+                unsigned int currentCoefficientUpdateIndex = coefficientUpdateIndexFunction_( );
+                if( !areCoefficientsUpToDate_ || currentCoefficientUpdateIndex != lastCoefficientUpdateIndex_ )
+                {
+                    cosineHarmonicCoefficients = getCosineHarmonicsCoefficients( );
+                    sineHarmonicCoefficients = getSineHarmonicsCoefficients( );
+                    lastCoefficientUpdateIndex_ = currentCoefficientUpdateIndex;
+                    areCoefficientsUpToDate_ = true;
+                }
+            }
 
             rotationToIntegrationFrame_ = rotationFromBodyFixedToIntegrationFrameFunction_( );
             this->updateBaseMembers( );
@@ -475,6 +492,21 @@ public:
         return getSineHarmonicsCoefficients;
     }
 
+    //! Function to set the function returning the number of times the coefficients were modified.
+    /*!
+     *  Function to set the function returning the index that denotes the number of times the coefficients were
+     *  modified (typically SphericalHarmonicsGravityField::getCoefficientUpdateIndex). If set, the coefficients are
+     *  only retrieved from getCosineHarmonicsCoefficients and getSineHarmonicsCoefficients when this index has changed,
+     *  instead of for each update of this object.
+     *  \param coefficientUpdateIndexFunction Function returning the index that denotes the number of times the
+     *  coefficients were modified.
+     */
+    void setCoefficientUpdateIndexFunction( const std::function< unsigned int( ) > coefficientUpdateIndexFunction )
+    {
+        coefficientUpdateIndexFunction_ = coefficientUpdateIndexFunction;
+        areCoefficientsUpToDate_ = false;
+    }
+
     //! Function to retrieve the current rotation from body-fixed frame to integration frame, in the form of a quaternion.
     /*!
      *  Function to retrieve the current rotation from body-fixed frame to integration frame, in the form of a quaternion.
@@ -620,6 +652,15 @@ private:
     //! Maximum order of gravity field expansion
     int maximumOrder_;
 
+    //! Function returning the index that denotes the number of times the coefficients were modified (may be empty).
+    std::function< unsigned int( ) > coefficientUpdateIndexFunction_;
+
+    //! Boolean denoting whether the coefficients were retrieved since coefficientUpdateIndexFunction_ was set.
+    bool areCoefficientsUpToDate_;
+
+    //! Value returned by coefficientUpdateIndexFunction_ when the coefficients were last retrieved.
+    unsigned int lastCoefficientUpdateIndex_;
+
 };
 
 
@@ -41,6 +41,7 @@ void TabulatedGravityFieldVariations::resetCoefficientInterpolator(
     // Set current coefficient tables.
     cosineCoefficientCorrections_ = cosineCoefficientCorrections;
     sineCoefficientCorrections_ = sineCoefficientCorrections;
+    modelUpdateIndex_++;
 
     // Check consistency of map sizes.
     if( cosineCoefficientCorrections_.size( ) != sineCoefficientCorrections_.size( ) )
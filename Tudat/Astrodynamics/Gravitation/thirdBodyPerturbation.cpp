@@ -13,6 +13,8 @@
  *
  */
 
+#include <stdexcept>
+
 #include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
 
@@ -38,5 +40,34 @@ Eigen::Vector3d computeThirdBodyPerturbingAcceleration(
                                               positionOfPerturbingBody );
 }
 
+//! Compute perturbing accelerations by third body for a batch of bodies.
+void addThirdBodyPerturbingAccelerations(
+        const double gravitationalParameterOfPerturbingBody,
+        const Eigen::ArrayXXd& positionsOfPerturbingBody,
+        const Eigen::ArrayXXd& positionsOfAffectedBodies,
+        Eigen::ArrayXXd& perturbingAccelerations )
+{
+    if( positionsOfPerturbingBody.rows( ) != positionsOfAffectedBodies.rows( ) ||
+            perturbingAccelerations.rows( ) != positionsOfAffectedBodies.rows( ) ||
+            positionsOfPerturbingBody.cols( ) != 3 || positionsOfAffectedBodies.cols( ) != 3 ||
+            perturbingAccelerations.cols( ) != 3 )
+    {
+        throw std::runtime_error( "Error when computing batch of third-body accelerations, inconsistent input sizes" );
+    }
+
+    // Compute scaling of direct and indirect terms.
+    const Eigen::ArrayXXd relativePositions = positionsOfPerturbingBody - positionsOfAffectedBodies;
+    const Eigen::ArrayXd directTermMultiplier = gravitationalParameterOfPerturbingBody *
+            relativePositions.square( ).rowwise( ).sum( ).pow( -1.5 );
+    const Eigen::ArrayXd indirectTermMultiplier = gravitationalParameterOfPerturbingBody *
+            positionsOfPerturbingBody.square( ).rowwise( ).sum( ).pow( -1.5 );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        perturbingAccelerations.col( i ) += relativePositions.col( i ) * directTermMultiplier -
+                positionsOfPerturbingBody.col( i ) * indirectTermMultiplier;
+    }
+}
+
 } // namespace gravitation
 } // namespace tudat
@@ -65,6 +65,27 @@ Eigen::Vector3d computeThirdBodyPerturbingAcceleration(
         const Eigen::Vector3d& positionOfAffectedBody,
         const Eigen::Vector3d& positionOfCentralBody = Eigen::Vector3d::Zero( ) );
 
+//! Compute perturbing accelerations by third body for a batch of bodies.
+/*!
+ * Computes the perturbing accelerations (see computeThirdBodyPerturbingAcceleration) on a batch of point masses in
+ * orbit about a central body, caused by a third body, and adds them to the input accelerations. The positions are
+ * provided in structure-of-arrays form (one row per body, one column per Cartesian component), so that the
+ * computation is vectorized over all bodies. The position of the perturbing body is provided per affected body, so
+ * that bodies may be evaluated at different epochs.
+ * \param gravitationalParameterOfPerturbingBody The gravitational parameter of the perturbing body [m^3/s^2]
+ * \param positionsOfPerturbingBody Positions of the perturbing body w.r.t. the central body, one row per affected
+ *          body (size Nx3) [m]
+ * \param positionsOfAffectedBodies Positions of the affected bodies w.r.t. the central body, one row per affected
+ *          body (size Nx3) [m]
+ * \param perturbingAccelerations Accelerations (size Nx3) to which the perturbing accelerations are added
+ *          (returned by reference) [m/s^2]
+ */
+void addThirdBodyPerturbingAccelerations(
+        const double gravitationalParameterOfPerturbingBody,
+        const Eigen::ArrayXXd& positionsOfPerturbingBody,
+        const Eigen::ArrayXXd& positionsOfAffectedBodies,
+        Eigen::ArrayXXd& perturbingAccelerations );
+
 //! Class for calculating third-body (gravitational) accelerations.
 /*!
  *  Class for calculating third-body (gravitational accelerations),
@@ -38,15 +38,83 @@ void TimeDependentSphericalHarmonicsGravityField::clearVariations( )
 {
     gravityFieldVariationsSet_ = std::shared_ptr< GravityFieldVariationsSet >( );
     correctionFunctions_.clear( );
+    setVariationBlock( );
+}
+
+//! Function to set the block of coefficients that is modified by the correction functions.
+void TimeDependentSphericalHarmonicsGravityField::setVariationBlock( )
+{
+    variationObjects_.clear( );
+    if( gravityFieldVariationsSet_ != nullptr )
+    {
+        variationObjects_ = gravityFieldVariationsSet_->getVariationObjects( );
+    }
+
+    // Determine smallest block containing correction blocks of all variations.
+    int endDegree = 0, endOrder = 0;
+    variationBlockStartDegree_ = 0;
+    variationBlockStartOrder_ = 0;
+    for( unsigned int i = 0; i < variationObjects_.size( ); i++ )
+    {
+        if( i == 0 || variationObjects_.at( i )->getMinimumDegree( ) < variationBlockStartDegree_ )
+        {
+            variationBlockStartDegree_ = variationObjects_.at( i )->getMinimumDegree( );
+        }
+        if( i == 0 || variationObjects_.at( i )->getMinimumOrder( ) < variationBlockStartOrder_ )
+        {
+            variationBlockStartOrder_ = variationObjects_.at( i )->getMinimumOrder( );
+        }
+        endDegree = std::max( endDegree, variationObjects_.at( i )->getMaximumDegree( ) + 1 );
+        endOrder = std::max( endOrder, variationObjects_.at( i )->getMaximumOrder( ) + 1 );
+    }
+
+    variationBlockNumberOfDegrees_ = std::max( endDegree - variationBlockStartDegree_, 0 );
+    variationBlockNumberOfOrders_ = std::max( endOrder - variationBlockStartOrder_, 0 );
+    isFullCoefficientResetRequired_ = true;
 }
 
 
 //! Update gravity field to current time.
 void TimeDependentSphericalHarmonicsGravityField::update( const double time )
 {
+    // Check if coefficients have been modified since last update (other than by this function).
+    if( coefficientUpdateIndex_ != lastCoefficientUpdateIndex_ )
+    {
+        isFullCoefficientResetRequired_ = true;
+    }
+
+    // Check if update is needed.
+    unsigned int variationModelUpdateIndex = 0;
+    for( unsigned int i = 0; i < variationObjects_.size( ); i++ )
+    {
+        variationModelUpdateIndex += variationObjects_.at( i )->getModelUpdateIndex( );
+    }
+
+    if( currentTime_ == time && !isFullCoefficientResetRequired_ &&
+            variationModelUpdateIndex == lastVariationModelUpdateIndex_ )
+    {
+        return;
+    }
+
     // Initialize current coefficients to nominal values.
-    sineCoefficients_ = nominalSineCoefficients_;
-    cosineCoefficients_ = nominalCosineCoefficients_;
+    if( isFullCoefficientResetRequired_ ||
+            variationBlockStartDegree_ + variationBlockNumberOfDegrees_ > nominalCosineCoefficients_.rows( ) ||
+            variationBlockStartOrder_ + variationBlockNumberOfOrders_ > nominalCosineCoefficients_.cols( ) )
+    {
+        sineCoefficients_ = nominalSineCoefficients_;
+        cosineCoefficients_ = nominalCosineCoefficients_;
+    }
+    else
+    {
+        sineCoefficients_.block( variationBlockStartDegree_, variationBlockStartOrder_,
+                                 variationBlockNumberOfDegrees_, variationBlockNumberOfOrders_ ) =
+                nominalSineCoefficients_.block( variationBlockStartDegree_, variationBlockStartOrder_,
+                                                variationBlockNumberOfDegrees_, variationBlockNumberOfOrders_ );
+        cosineCoefficients_.block( variationBlockStartDegree_, variationBlockStartOrder_,
+                                   variationBlockNumberOfDegrees_, variationBlockNumberOfOrders_ ) =
+                nominalCosineCoefficients_.block( variationBlockStartDegree_, variationBlockStartOrder_,
+                                                  variationBlockNumberOfDegrees_, variationBlockNumberOfOrders_ );
+    }
 
     // Iterate over all corrections.
     for( unsigned int i = 0; i < correctionFunctions_.size( ); i++ )
@@ -54,6 +122,13 @@ void TimeDependentSphericalHarmonicsGravityField::update( const double time )
         // Add correction of this iteration to current coefficients.
         correctionFunctions_[ i ]( time, sineCoefficients_, cosineCoefficients_ );
     }
+
+    // Signal modification of coefficients.
+    currentTime_ = time;
+    isFullCoefficientResetRequired_ = false;
+    coefficientUpdateIndex_++;
+    lastCoefficientUpdateIndex_ = coefficientUpdateIndex_;
+    lastVariationModelUpdateIndex_ = variationModelUpdateIndex;
 }
 
 } // namespace gravitation
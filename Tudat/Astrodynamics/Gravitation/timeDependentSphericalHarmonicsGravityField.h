@@ -16,6 +16,7 @@
 
 #include <vector>
 
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
 
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
@@ -69,7 +70,10 @@ public:
             gravitationalParameter, referenceRadius, nominalCosineCoefficients,
             nominalSineCoefficients, fixedReferenceFrame, updateInertiaTensor ),
         nominalSineCoefficients_( nominalSineCoefficients ),
-        nominalCosineCoefficients_( nominalCosineCoefficients )
+        nominalCosineCoefficients_( nominalCosineCoefficients ),
+        currentTime_( TUDAT_NAN ), isFullCoefficientResetRequired_( true ), lastCoefficientUpdateIndex_( 0 ),
+        lastVariationModelUpdateIndex_( 0 ), variationBlockStartDegree_( 0 ), variationBlockStartOrder_( 0 ),
+        variationBlockNumberOfDegrees_( 0 ), variationBlockNumberOfOrders_( 0 )
     { }
 
     //! Full class constructor.
@@ -97,7 +101,10 @@ public:
             nominalCosineCoefficients, nominalSineCoefficients, fixedReferenceFrame ),
         nominalSineCoefficients_( nominalSineCoefficients ),
         nominalCosineCoefficients_( nominalCosineCoefficients ),
-        gravityFieldVariationsSet_( gravityFieldVariationUpdateSettings )
+        gravityFieldVariationsSet_( gravityFieldVariationUpdateSettings ),
+        currentTime_( TUDAT_NAN ), isFullCoefficientResetRequired_( true ), lastCoefficientUpdateIndex_( 0 ),
+        lastVariationModelUpdateIndex_( 0 ), variationBlockStartDegree_( 0 ), variationBlockStartOrder_( 0 ),
+        variationBlockNumberOfDegrees_( 0 ), variationBlockNumberOfOrders_( 0 )
     {
         updateCorrectionFunctions( );
     }
@@ -111,11 +118,30 @@ public:
     //! Update gravity field to current time.
     /*!
      *  Update gravity field coefficient corrections to current time. All correction functions are
-     *  called and subsequently added to the nominal value.
+     *  called and subsequently added to the nominal value. Only the block of coefficients that is
+     *  modified by the correction functions is reset to its nominal value, unless the nominal
+     *  coefficients, the variations or the coefficients themselves have been changed since the
+     *  previous update. If the time is equal to that of the previous update, and neither these, nor
+     *  the parameters of the variation models (see GravityFieldVariations::getModelUpdateIndex) have
+     *  been changed, no update is performed. If the variations depend on other quantities that may
+     *  have changed (e.g. the states of tide-raising bodies), resetCurrentTime should be called first.
      *  \param time Current time.
      */
     void update( const double time );
 
+    //! Function to reset the current time of the gravity field.
+    /*!
+     *  Function to reset the current time of the gravity field. This function is typically used to
+     *  set the current time to NaN, indicating the need to recompute the coefficients at the next
+     *  call to update (for instance because the states of bodies on which the variations depend
+     *  have changed).
+     *  \param currentTime New current time.
+     */
+    void resetCurrentTime( const double currentTime = TUDAT_NAN )
+    {
+        currentTime_ = currentTime;
+    }
+
     //! Update correction functions.
     /*!
      *  Update correction functions, for instance to account for changed changed environmental
@@ -132,6 +158,7 @@ public:
         {
             // Reset correction functions.
             correctionFunctions_ = gravityFieldVariationsSet_->getVariationFunctions( );
+            setVariationBlock( );
         }
 
     }
@@ -203,6 +230,7 @@ public:
     void setNominalCosineCoefficients( Eigen::MatrixXd nominalCosineCoefficients )
     {
         nominalCosineCoefficients_ = nominalCosineCoefficients;
+        isFullCoefficientResetRequired_ = true;
     }
 
     //! Set nominal (i.e. with zero variations) cosine coefficient of given degree and order.
@@ -218,6 +246,7 @@ public:
                 order <= nominalCosineCoefficients_.cols( ) )
         {
             nominalCosineCoefficients_( degree, order ) = coefficient;
+            isFullCoefficientResetRequired_ = true;
         }
         else
         {
@@ -243,6 +272,7 @@ public:
     void setNominalSineCoefficients( const Eigen::MatrixXd& nominalSineCoefficients )
     {
         nominalSineCoefficients_ = nominalSineCoefficients;
+        isFullCoefficientResetRequired_ = true;
     }
 
     //! Set nominal (i.e. with zero variations) sine coefficient of given degree and order.
@@ -258,6 +288,7 @@ public:
                 order <= nominalSineCoefficients_.cols( ) )
         {
             nominalSineCoefficients_( degree, order ) = coefficient;
+            isFullCoefficientResetRequired_ = true;
         }
         else
         {
@@ -276,6 +307,14 @@ public:
 
 private:
 
+    //! Function to set the block of coefficients that is modified by the correction functions.
+    /*!
+     *  Function to set the block of coefficients that is modified by the correction functions, as the smallest block
+     *  containing the correction blocks of all gravity field variations, and to signal that the full coefficients
+     *  are to be reset at the next update.
+     */
+    void setVariationBlock( );
+
     //! Nominal (i.e. with zero variations) cosine coefficients.
     /*!
      *  Nominal (i.e. with zero variations) cosine coefficients. When calling the update function,
@@ -309,6 +348,33 @@ private:
      */
     std::shared_ptr< GravityFieldVariationsSet > gravityFieldVariationsSet_;
 
+    //! Time of the last update of the coefficients (NaN if coefficients are to be recomputed at next update).
+    double currentTime_;
+
+    //! Boolean denoting whether the full coefficients (instead of only the variation block) are reset at next update.
+    bool isFullCoefficientResetRequired_;
+
+    //! Value of coefficientUpdateIndex_ after the last update.
+    unsigned int lastCoefficientUpdateIndex_;
+
+    //! List of gravity field variation objects (empty if gravityFieldVariationsSet_ is not set).
+    std::vector< std::shared_ptr< GravityFieldVariations > > variationObjects_;
+
+    //! Sum of the model update indices of the variation objects at the last update.
+    unsigned int lastVariationModelUpdateIndex_;
+
+    //! Degree where the block of coefficients modified by the correction functions starts.
+    int variationBlockStartDegree_;
+
+    //! Order where the block of coefficients modified by the correction functions starts.
+    int variationBlockStartOrder_;
+
+    //! Size of the block of coefficients modified by the correction functions in the degree direction.
+    int variationBlockNumberOfDegrees_;
+
+    //! Size of the block of coefficients modified by the correction functions in the order direction.
+    int variationBlockNumberOfOrders_;
+
 };
 
 } // namespace gravitation
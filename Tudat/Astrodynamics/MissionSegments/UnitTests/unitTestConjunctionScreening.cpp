@@ -0,0 +1,298 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/MissionSegments/conjunctionScreening.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace mission_segments;
+
+static const double earthGravitationalParameter = 3.986004418E14;
+
+//! Function to create a function returning the Cartesian state of a Kepler orbit, for given elements at t = 0.
+std::function< Eigen::Vector6d( const double ) > getKeplerOrbitStateFunction( const Eigen::Vector6d& keplerianElements )
+{
+    return [ = ]( const double time )
+    {
+        return orbital_element_conversions::convertKeplerianToCartesianElements(
+                    orbital_element_conversions::propagateKeplerOrbit(
+                        keplerianElements, time, earthGravitationalParameter ), earthGravitationalParameter );
+    };
+}
+
+//! Function to create a concatenated state history from a set of state functions.
+std::map< double, Eigen::VectorXd > getConcatenatedStateHistory(
+        const std::vector< std::function< Eigen::Vector6d( const double ) > >& stateFunctions,
+        const double startTime, const double endTime, const double timeStep )
+{
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( int k = 0; startTime + k * timeStep <= endTime; k++ )
+    {
+        Eigen::VectorXd concatenatedState( 6 * stateFunctions.size( ) );
+        for( unsigned int i = 0; i < stateFunctions.size( ); i++ )
+        {
+            concatenatedState.segment( 6 * i, 6 ) = stateFunctions.at( i )( startTime + k * timeStep );
+        }
+        stateHistory[ startTime + k * timeStep ] = concatenatedState;
+    }
+    return stateHistory;
+}
+
+BOOST_AUTO_TEST_SUITE( test_conjunction_screening )
+
+//! Test detection of a single, known, close approach.
+BOOST_AUTO_TEST_CASE( testSingleCloseApproach )
+{
+    // Create two circular orbits, with a difference in radius of 500 m, with both objects at the ascending node of the
+    // second orbit at t = 3000 s, so that the velocities are perpendicular to the relative position at that time.
+    const double semiMajorAxis = 7.0E6;
+    const double timeOfClosestApproach = 3000.0;
+    Eigen::Vector6d firstOrbitElements, secondOrbitElements;
+    firstOrbitElements << semiMajorAxis, 0.0, 0.0, 0.0, 0.0, 0.0;
+    secondOrbitElements << semiMajorAxis + 500.0, 0.0, 1.0, 0.0, 0.0, 0.0;
+    firstOrbitElements = orbital_element_conversions::propagateKeplerOrbit(
+                firstOrbitElements, -timeOfClosestApproach, earthGravitationalParameter );
+    secondOrbitElements = orbital_element_conversions::propagateKeplerOrbit(
+                secondOrbitElements, -timeOfClosestApproach, earthGravitationalParameter );
+
+    std::vector< std::function< Eigen::Vector6d( const double ) > > stateFunctions =
+    { getKeplerOrbitStateFunction( firstOrbitElements ), getKeplerOrbitStateFunction( secondOrbitElements ) };
+
+    // Screen state functions and state history.
+    std::vector< std::vector< CloseApproach > > closeApproachSets;
+    closeApproachSets.push_back( findCloseApproaches( stateFunctions, 1000.0, 5000.0, 30.0, 5.0E3, 1.0E-4 ) );
+    closeApproachSets.push_back( findCloseApproaches(
+                                     getConcatenatedStateHistory( stateFunctions, 1000.0, 5000.0, 30.0 ),
+                                     5.0E3, 1.0E-4 ) );
+    for( unsigned int i = 0; i < closeApproachSets.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( closeApproachSets.at( i ).size( ), 1 );
+        if( closeApproachSets.at( i ).size( ) == 1 )
+        {
+            CloseApproach closeApproach = closeApproachSets.at( i ).at( 0 );
+            BOOST_CHECK_EQUAL( closeApproach.firstObjectIndex_, 0 );
+            BOOST_CHECK_EQUAL( closeApproach.secondObjectIndex_, 1 );
+            BOOST_CHECK_SMALL( closeApproach.timeOfClosestApproach_ - timeOfClosestApproach, 1.0E-2 );
+            BOOST_CHECK_SMALL( closeApproach.missDistance_ - 500.0, 0.1 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        closeApproach.relativeSpeed_,
+                        ( stateFunctions.at( 1 )( timeOfClosestApproach ) -
+                          stateFunctions.at( 0 )( timeOfClosestApproach ) ).segment( 3, 3 ).norm( ), 1.0E-6 );
+        }
+    }
+
+    // Check that no close approach is found for a smaller screening distance.
+    BOOST_CHECK_EQUAL( findCloseApproaches( stateFunctions, 1000.0, 5000.0, 30.0, 400.0 ).size( ), 0 );
+
+    // Check that close approaches at the start (distance increasing) and end (distance decreasing) of the screening are
+    // reported at these epochs.
+    const std::vector< std::pair< double, double > > boundaryScreeningIntervals =
+    { { timeOfClosestApproach + 0.5, 5000.0 }, { 1000.0, timeOfClosestApproach - 0.5 } };
+    for( unsigned int i = 0; i < boundaryScreeningIntervals.size( ); i++ )
+    {
+        const double boundaryEpoch =
+                ( i == 0 ) ? boundaryScreeningIntervals.at( i ).first : boundaryScreeningIntervals.at( i ).second;
+        const std::vector< CloseApproach > boundaryCloseApproaches = findCloseApproaches(
+                    stateFunctions, boundaryScreeningIntervals.at( i ).first, boundaryScreeningIntervals.at( i ).second,
+                    30.0, 5.0E3 );
+        BOOST_CHECK_EQUAL( boundaryCloseApproaches.size( ), 1 );
+        if( boundaryCloseApproaches.size( ) == 1 )
+        {
+            BOOST_CHECK_SMALL( boundaryCloseApproaches.at( 0 ).timeOfClosestApproach_ - boundaryEpoch, 1.0E-9 );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        boundaryCloseApproaches.at( 0 ).missDistance_,
+                        ( stateFunctions.at( 1 )( boundaryEpoch ) - stateFunctions.at( 0 )( boundaryEpoch ) ).segment(
+                            0, 3 ).norm( ), 1.0E-10 );
+        }
+    }
+}
+
+//! Test screening of a population of objects against a brute-force search.
+BOOST_AUTO_TEST_CASE( testPopulationScreening )
+{
+    const int numberOfObjects = 200;
+    const double startTime = 0.0;
+    const double endTime = 7200.0;
+    const double screeningDistance = 50.0E3;
+
+    // Create population of objects in low Earth orbit, and one in geostationary orbit.
+    std::mt19937 randomGenerator( 42 );
+    std::uniform_real_distribution< double > semiMajorAxisDistribution( 6.9E6, 7.0E6 );
+    std::uniform_real_distribution< double > eccentricityDistribution( 0.0, 0.01 );
+    std::uniform_real_distribution< double > inclinationDistribution( 0.0, mathematical_constants::PI );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * mathematical_constants::PI );
+    std::vector< std::function< Eigen::Vector6d( const double ) > > stateFunctions;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        Eigen::Vector6d keplerianElements;
+        keplerianElements << semiMajorAxisDistribution( randomGenerator ), eccentricityDistribution( randomGenerator ),
+                inclinationDistribution( randomGenerator ), angleDistribution( randomGenerator ),
+                angleDistribution( randomGenerator ), angleDistribution( randomGenerator );
+        if( i == numberOfObjects - 1 )
+        {
+            keplerianElements( 0 ) = 4.2164E7;
+        }
+        stateFunctions.push_back( getKeplerOrbitStateFunction( keplerianElements ) );
+    }
+
+    // Screen population, using different numbers of threads and input types.
+    std::vector< CloseApproach > closeApproaches = findCloseApproaches(
+                stateFunctions, startTime, endTime, 20.0, screeningDistance, 1.0E-3, 1 );
+    std::vector< std::vector< CloseApproach > > alternativeCloseApproachSets;
+    alternativeCloseApproachSets.push_back( findCloseApproaches(
+                                                stateFunctions, startTime, endTime, 20.0, screeningDistance,
+                                                1.0E-3, 4 ) );
+    alternativeCloseApproachSets.push_back( findCloseApproaches(
+                                                getConcatenatedStateHistory( stateFunctions, startTime, endTime, 20.0 ),
+                                                screeningDistance, 1.0E-3, 3 ) );
+    for( unsigned int i = 0; i < alternativeCloseApproachSets.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( alternativeCloseApproachSets.at( i ).size( ), closeApproaches.size( ) );
+        for( unsigned int j = 0; j < std::min( closeApproaches.size( ), alternativeCloseApproachSets.at( i ).size( ) );
+             j++ )
+        {
+            BOOST_CHECK_EQUAL( alternativeCloseApproachSets.at( i ).at( j ).firstObjectIndex_,
+                               closeApproaches.at( j ).firstObjectIndex_ );
+            BOOST_CHECK_EQUAL( alternativeCloseApproachSets.at( i ).at( j ).secondObjectIndex_,
+                               closeApproaches.at( j ).secondObjectIndex_ );
+            BOOST_CHECK_EQUAL( alternativeCloseApproachSets.at( i ).at( j ).timeOfClosestApproach_,
+                               closeApproaches.at( j ).timeOfClosestApproach_ );
+        }
+    }
+
+    // Check close approaches with the exact distance between the objects.
+    for( unsigned int j = 0; j < closeApproaches.size( ); j++ )
+    {
+        const CloseApproach& closeApproach = closeApproaches.at( j );
+        BOOST_CHECK( closeApproach.firstObjectIndex_ < closeApproach.secondObjectIndex_ );
+        BOOST_CHECK( closeApproach.missDistance_ < screeningDistance );
+        for( int k = -1; k <= 1; k++ )
+        {
+            // Skip epochs outside of the screening interval, for close approaches at its start or end.
+            if( closeApproach.timeOfClosestApproach_ + 0.1 * k < startTime ||
+                    closeApproach.timeOfClosestApproach_ + 0.1 * k > endTime )
+            {
+                continue;
+            }
+
+            const double distance = (
+                        stateFunctions.at( closeApproach.secondObjectIndex_ )(
+                            closeApproach.timeOfClosestApproach_ + 0.1 * k ) -
+                        stateFunctions.at( closeApproach.firstObjectIndex_ )(
+                            closeApproach.timeOfClosestApproach_ + 0.1 * k ) ).segment( 0, 3 ).norm( );
+            BOOST_CHECK_SMALL( distance - closeApproach.missDistance_, ( k == 0 ) ? 1.0 : 1.0E3 );
+            BOOST_CHECK( distance > closeApproach.missDistance_ - 1.0 );
+        }
+    }
+
+    // Find close approaches by brute force, from the distances between all pairs at a time step of 2 s.
+    const double bruteForceTimeStep = 2.0;
+    std::vector< Eigen::Matrix3Xd > positions;
+    for( int k = 0; startTime + k * bruteForceTimeStep <= endTime; k++ )
+    {
+        positions.push_back( Eigen::Matrix3Xd( 3, numberOfObjects ) );
+        for( int i = 0; i < numberOfObjects; i++ )
+        {
+            positions.back( ).col( i ) = stateFunctions.at( i )( startTime + k * bruteForceTimeStep ).segment( 0, 3 );
+        }
+    }
+
+    std::vector< CloseApproach > bruteForceCloseApproaches;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        for( int j = i + 1; j < numberOfObjects; j++ )
+        {
+            for( unsigned int k = 1; k + 1 < positions.size( ); k++ )
+            {
+                const double distance = ( positions.at( k ).col( j ) - positions.at( k ).col( i ) ).norm( );
+                if( distance < screeningDistance &&
+                        distance < ( positions.at( k - 1 ).col( j ) - positions.at( k - 1 ).col( i ) ).norm( ) &&
+                        distance <= ( positions.at( k + 1 ).col( j ) - positions.at( k + 1 ).col( i ) ).norm( ) )
+                {
+                    bruteForceCloseApproaches.push_back(
+                                CloseApproach( i, j, startTime + k * bruteForceTimeStep, distance, TUDAT_NAN ) );
+                }
+            }
+        }
+    }
+    BOOST_CHECK( bruteForceCloseApproaches.size( ) > 20 );
+
+    // Check whether each close approach from the brute-force search is found by the screening (except those that are
+    // marginally within the screening distance), and vice versa (except those at the ends of the interval).
+    for( unsigned int l = 0; l < bruteForceCloseApproaches.size( ); l++ )
+    {
+        const CloseApproach& bruteForceCloseApproach = bruteForceCloseApproaches.at( l );
+        bool isCloseApproachFound = false;
+        for( unsigned int m = 0; m < closeApproaches.size( ); m++ )
+        {
+            if( closeApproaches.at( m ).firstObjectIndex_ == bruteForceCloseApproach.firstObjectIndex_ &&
+                    closeApproaches.at( m ).secondObjectIndex_ == bruteForceCloseApproach.secondObjectIndex_ &&
+                    std::fabs( closeApproaches.at( m ).timeOfClosestApproach_ -
+                               bruteForceCloseApproach.timeOfClosestApproach_ ) <= bruteForceTimeStep )
+            {
+                isCloseApproachFound = true;
+                BOOST_CHECK( closeApproaches.at( m ).missDistance_ <= bruteForceCloseApproach.missDistance_ );
+            }
+        }
+        BOOST_CHECK( isCloseApproachFound || bruteForceCloseApproach.missDistance_ > 0.99 * screeningDistance );
+    }
+
+    for( unsigned int m = 0; m < closeApproaches.size( ); m++ )
+    {
+        const CloseApproach& closeApproach = closeApproaches.at( m );
+        bool isCloseApproachFound = false;
+        for( unsigned int l = 0; l < bruteForceCloseApproaches.size( ); l++ )
+        {
+            if( bruteForceCloseApproaches.at( l ).firstObjectIndex_ == closeApproach.firstObjectIndex_ &&
+                    bruteForceCloseApproaches.at( l ).secondObjectIndex_ == closeApproach.secondObjectIndex_ &&
+                    std::fabs( bruteForceCloseApproaches.at( l ).timeOfClosestApproach_ -
+                               closeApproach.timeOfClosestApproach_ ) <= bruteForceTimeStep )
+            {
+                isCloseApproachFound = true;
+            }
+        }
+        BOOST_CHECK( isCloseApproachFound || closeApproach.missDistance_ > 0.99 * screeningDistance ||
+                     closeApproach.timeOfClosestApproach_ < startTime + bruteForceTimeStep ||
+                     closeApproach.timeOfClosestApproach_ > endTime - bruteForceTimeStep );
+    }
+}
+
+//! Test whether invalid input is rejected.
+BOOST_AUTO_TEST_CASE( testConjunctionScreeningErrors )
+{
+    std::map< double, Eigen::VectorXd > stateHistory;
+    stateHistory[ 0.0 ] = Eigen::VectorXd::Zero( 8 );
+    stateHistory[ 10.0 ] = Eigen::VectorXd::Zero( 8 );
+    BOOST_CHECK_THROW( findCloseApproaches( stateHistory, 1.0E3 ), std::runtime_error );
+
+    std::vector< std::function< Eigen::Vector6d( const double ) > > stateFunctions( 2 );
+    BOOST_CHECK_THROW( findCloseApproaches( stateFunctions, 0.0, 10.0, 0.0, 1.0E3 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
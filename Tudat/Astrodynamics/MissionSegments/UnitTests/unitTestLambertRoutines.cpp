@@ -27,6 +27,10 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cmath>
+#include <random>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 
 #include <Eigen/Core>
@@ -36,6 +40,7 @@
 #include "Tudat/Basics/testMacros.h"
 
 #include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/porkchopPlot.h"
 
 namespace tudat
 {
@@ -545,6 +550,176 @@ BOOST_AUTO_TEST_CASE( testsolveLambertProblemGoodingElliptical )
     BOOST_CHECK_SMALL( testInertialVelocityAtArrival.z( ), tolerance );
 }
 
+//! Test that batch solutions of Lambert problems are identical to single solutions.
+BOOST_AUTO_TEST_CASE( testSolveLambertProblemsIzzo )
+{
+    // Generate random heliocentric transfers, including retrograde and hyperbolic ones.
+    const double sunGravitationalParameter = 1.32712440018E20;
+    const double astronomicalUnit = 1.495978707E11;
+    const int numberOfProblems = 1000;
+    std::mt19937 randomGenerator( 42 );
+    std::uniform_real_distribution< double > unitDistribution( -1.0, 1.0 );
+    std::uniform_real_distribution< double > radiusDistribution( 0.3 * astronomicalUnit, 5.0 * astronomicalUnit );
+    std::uniform_real_distribution< double > timeOfFlightDistribution( 5.0 * 86400.0, 1000.0 * 86400.0 );
+
+    Eigen::Matrix3Xd positionsAtDeparture( 3, numberOfProblems ), positionsAtArrival( 3, numberOfProblems );
+    Eigen::VectorXd timesOfFlight( numberOfProblems );
+    for ( int i = 0; i < numberOfProblems; i++ )
+    {
+        positionsAtDeparture.col( i ) = radiusDistribution( randomGenerator ) * Eigen::Vector3d(
+                    unitDistribution( randomGenerator ), unitDistribution( randomGenerator ),
+                    0.1 * unitDistribution( randomGenerator ) ).normalized( );
+        positionsAtArrival.col( i ) = radiusDistribution( randomGenerator ) * Eigen::Vector3d(
+                    unitDistribution( randomGenerator ), unitDistribution( randomGenerator ),
+                    0.1 * unitDistribution( randomGenerator ) ).normalized( );
+        timesOfFlight( i ) = timeOfFlightDistribution( randomGenerator );
+    }
+
+    // Add problem with invalid time-of-flight.
+    timesOfFlight( 10 ) = -1.0;
+
+    for ( int isRetrograde = 0; isRetrograde < 2; isRetrograde++ )
+    {
+        for ( int numberOfThreads = 1; numberOfThreads <= 3; numberOfThreads++ )
+        {
+            Eigen::Matrix3Xd velocitiesAtDeparture, velocitiesAtArrival;
+            mission_segments::solveLambertProblemsIzzo(
+                        positionsAtDeparture, positionsAtArrival, timesOfFlight, sunGravitationalParameter,
+                        velocitiesAtDeparture, velocitiesAtArrival, isRetrograde, 1.0E-9, 50, numberOfThreads );
+            BOOST_CHECK_EQUAL( velocitiesAtDeparture.cols( ), numberOfProblems );
+
+            for ( int i = 0; i < numberOfProblems; i++ )
+            {
+                Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+                bool isSolved = true;
+                try
+                {
+                    mission_segments::solveLambertProblemIzzo(
+                                positionsAtDeparture.col( i ), positionsAtArrival.col( i ), timesOfFlight( i ),
+                                sunGravitationalParameter, velocityAtDeparture, velocityAtArrival, isRetrograde );
+                }
+                catch ( std::runtime_error& )
+                {
+                    isSolved = false;
+                }
+
+                if ( isSolved )
+                {
+                    for ( int j = 0; j < 3; j++ )
+                    {
+                        BOOST_CHECK_EQUAL( velocitiesAtDeparture( j, i ), velocityAtDeparture( j ) );
+                        BOOST_CHECK_EQUAL( velocitiesAtArrival( j, i ), velocityAtArrival( j ) );
+                    }
+                }
+                else
+                {
+                    BOOST_CHECK( velocitiesAtDeparture.col( i ).hasNaN( ) );
+                    BOOST_CHECK( velocitiesAtArrival.col( i ).hasNaN( ) );
+                }
+            }
+            BOOST_CHECK( velocitiesAtDeparture.col( 10 ).hasNaN( ) );
+        }
+    }
+
+    // Check that an exception is thrown for inconsistent input sizes.
+    Eigen::Matrix3Xd velocitiesAtDeparture, velocitiesAtArrival;
+    BOOST_CHECK_THROW( mission_segments::solveLambertProblemsIzzo(
+                           positionsAtDeparture, positionsAtArrival, timesOfFlight.segment( 0, 10 ),
+                           sunGravitationalParameter, velocitiesAtDeparture, velocitiesAtArrival ),
+                       std::runtime_error );
+}
+
+//! Test the computation of a porkchop plot.
+BOOST_AUTO_TEST_CASE( testPorkchopPlot )
+{
+    // Set circular, coplanar orbits of departure and arrival body.
+    const double sunGravitationalParameter = 1.32712440018E20;
+    const double departureRadius = 1.495978707E11;
+    const double arrivalRadius = 1.524 * departureRadius;
+    const std::function< Eigen::Vector6d( const double ) > departureBodyStateFunction =
+            [ = ]( const double time )
+    {
+        const double meanMotion = std::sqrt( sunGravitationalParameter / std::pow( departureRadius, 3.0 ) );
+        const double velocity = meanMotion * departureRadius;
+        return ( Eigen::Vector6d( ) << departureRadius * std::cos( meanMotion * time ),
+                 departureRadius * std::sin( meanMotion * time ), 0.0,
+                 -velocity * std::sin( meanMotion * time ), velocity * std::cos( meanMotion * time ), 0.0 ).finished( );
+    };
+    const std::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction =
+            [ = ]( const double time )
+    {
+        const double meanMotion = std::sqrt( sunGravitationalParameter / std::pow( arrivalRadius, 3.0 ) );
+        const double velocity = meanMotion * arrivalRadius;
+        return ( Eigen::Vector6d( ) << arrivalRadius * std::cos( meanMotion * time + 1.0 ),
+                 arrivalRadius * std::sin( meanMotion * time + 1.0 ), 0.0,
+                 -velocity * std::sin( meanMotion * time + 1.0 ), velocity * std::cos( meanMotion * time + 1.0 ),
+                 0.0 ).finished( );
+    };
+
+    std::vector< double > departureTimes, arrivalTimes;
+    for ( int i = 0; i < 30; i++ )
+    {
+        departureTimes.push_back( i * 10.0 * 86400.0 );
+    }
+    for ( int j = 0; j < 40; j++ )
+    {
+        arrivalTimes.push_back( ( 100.0 + j * 10.0 ) * 86400.0 );
+    }
+
+    for ( int numberOfThreads = 1; numberOfThreads <= 2; numberOfThreads++ )
+    {
+        const Eigen::MatrixXd deltaVs = mission_segments::computePorkchopPlotDeltaVs(
+                    departureBodyStateFunction, arrivalBodyStateFunction, departureTimes, arrivalTimes,
+                    sunGravitationalParameter, numberOfThreads );
+        BOOST_CHECK_EQUAL( deltaVs.rows( ), 30 );
+        BOOST_CHECK_EQUAL( deltaVs.cols( ), 40 );
+
+        // Compare with single solutions of Lambert problems.
+        for ( unsigned int i = 0; i < departureTimes.size( ); i++ )
+        {
+            for ( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+            {
+                if ( arrivalTimes.at( j ) <= departureTimes.at( i ) )
+                {
+                    BOOST_CHECK( deltaVs( i, j ) != deltaVs( i, j ) );
+                    continue;
+                }
+
+                const Eigen::Vector6d departureState = departureBodyStateFunction( departureTimes.at( i ) );
+                const Eigen::Vector6d arrivalState = arrivalBodyStateFunction( arrivalTimes.at( j ) );
+                Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+                mission_segments::solveLambertProblemIzzo(
+                            departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ),
+                            arrivalTimes.at( j ) - departureTimes.at( i ), sunGravitationalParameter,
+                            velocityAtDeparture, velocityAtArrival );
+                BOOST_CHECK_EQUAL( deltaVs( i, j ),
+                                   ( velocityAtDeparture - departureState.segment( 3, 3 ) ).norm( ) +
+                                   ( velocityAtArrival - arrivalState.segment( 3, 3 ) ).norm( ) );
+            }
+        }
+
+        // Check that the minimum Delta V is close to that of a Hohmann transfer (about 5.6 km/s).
+        const double hohmannDeltaV =
+                std::sqrt( sunGravitationalParameter / departureRadius ) *
+                ( std::sqrt( 2.0 * arrivalRadius / ( departureRadius + arrivalRadius ) ) - 1.0 ) +
+                std::sqrt( sunGravitationalParameter / arrivalRadius ) *
+                ( 1.0 - std::sqrt( 2.0 * departureRadius / ( departureRadius + arrivalRadius ) ) );
+        double minimumDeltaV = TUDAT_NAN;
+        for ( int i = 0; i < deltaVs.rows( ); i++ )
+        {
+            for ( int j = 0; j < deltaVs.cols( ); j++ )
+            {
+                if ( deltaVs( i, j ) == deltaVs( i, j ) && !( minimumDeltaV <= deltaVs( i, j ) ) )
+                {
+                    minimumDeltaV = deltaVs( i, j );
+                }
+            }
+        }
+        BOOST_CHECK( minimumDeltaV >= hohmannDeltaV * ( 1.0 - 1.0E-6 ) );
+        BOOST_CHECK( minimumDeltaV < 1.1 * hohmannDeltaV );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,540 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Astrodynamics/MissionSegments/conjunctionScreening.h"
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+#include "Tudat/Mathematics/RootFinders/terminationConditions.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Typedef for the (mapped) states of all objects at a single epoch, one per column.
+typedef Eigen::Map< const Eigen::Matrix< double, 6, Eigen::Dynamic > > StateArrayMap;
+
+//! Function to compute the relative state of two objects in a sampling interval, from cubic Hermite interpolation.
+/*!
+ *  Function to compute the relative state of two objects in a sampling interval, from cubic Hermite interpolation of
+ *  the relative states at the boundaries of the interval.
+ *  \param initialRelativeState Relative state at the start of the interval.
+ *  \param finalRelativeState Relative state at the end of the interval.
+ *  \param intervalLength Length of the interval.
+ *  \param timeSinceStartOfInterval Time since the start of the interval at which the relative state is computed.
+ *  \return Interpolated relative state.
+ */
+static Eigen::Vector6d interpolateRelativeState(
+        const Eigen::Vector6d& initialRelativeState, const Eigen::Vector6d& finalRelativeState,
+        const double intervalLength, const double timeSinceStartOfInterval )
+{
+    const double s = timeSinceStartOfInterval / intervalLength;
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+
+    Eigen::Vector6d relativeState;
+    relativeState.segment( 0, 3 ) =
+            ( 2.0 * s3 - 3.0 * s2 + 1.0 ) * initialRelativeState.segment( 0, 3 ) +
+            ( s3 - 2.0 * s2 + s ) * intervalLength * initialRelativeState.segment( 3, 3 ) +
+            ( -2.0 * s3 + 3.0 * s2 ) * finalRelativeState.segment( 0, 3 ) +
+            ( s3 - s2 ) * intervalLength * finalRelativeState.segment( 3, 3 );
+    relativeState.segment( 3, 3 ) =
+            ( 6.0 * s2 - 6.0 * s ) / intervalLength *
+            ( initialRelativeState.segment( 0, 3 ) - finalRelativeState.segment( 0, 3 ) ) +
+            ( 3.0 * s2 - 4.0 * s + 1.0 ) * initialRelativeState.segment( 3, 3 ) +
+            ( 3.0 * s2 - 2.0 * s ) * finalRelativeState.segment( 3, 3 );
+    return relativeState;
+}
+
+//! Number of bits used to store the index of a grid cell along each axis.
+const static int numberOfBitsPerCellIndex = 21;
+
+//! Function to compute the index of the grid cell along a single axis that contains a given coordinate.
+/*!
+ *  Function to compute the index of the grid cell along a single axis that contains a given coordinate. Indices are
+ *  offset such that cell zero is centered on the origin, and are clipped to [0, 2^21 - 1], so that coordinates that
+ *  lie outside this range are collected in the outer cells (which only leads to additional candidate pairs).
+ *  \param coordinate Coordinate along the axis, divided by the cell size.
+ *  \return Index of the grid cell.
+ */
+static inline long long getGridCellIndex( const double coordinate )
+{
+    const double maximumIndex = static_cast< double >( ( 1LL << numberOfBitsPerCellIndex ) - 1 );
+    return static_cast< long long >( std::min( std::max(
+        std::floor( coordinate ) + static_cast< double >( 1LL << ( numberOfBitsPerCellIndex - 1 ) ), 0.0 ),
+                                                maximumIndex ) );
+}
+
+//! Function to compute the key of the grid cell with given indices.
+/*!
+ *  Function to compute the key of the grid cell with given indices along each axis. The keys of cells that are
+ *  adjacent along the z-axis are consecutive, so that neighbouring cells along the z-axis are adjacent in a sorted list
+ *  of keys.
+ *  \param xIndex Index of cell along x-axis.
+ *  \param yIndex Index of cell along y-axis.
+ *  \param zIndex Index of cell along z-axis.
+ *  \return Key of the grid cell.
+ */
+static inline unsigned long long getGridCellKey(
+        const long long xIndex, const long long yIndex, const long long zIndex )
+{
+    return ( static_cast< unsigned long long >( xIndex ) << ( 2 * numberOfBitsPerCellIndex ) ) |
+            ( static_cast< unsigned long long >( yIndex ) << numberOfBitsPerCellIndex ) |
+            static_cast< unsigned long long >( zIndex );
+}
+
+//! Function to find the closest approach of two objects in a sampling interval.
+/*!
+ *  Function to find the closest approach of two objects in a sampling interval, if the range rate changes sign from
+ *  negative to positive in the interval and the distance at the closest approach is below the screening distance. In
+ *  the first interval of the screening, a non-negative range rate at its start denotes a closest approach at the start
+ *  of the interval, and in the last interval, a negative range rate at its end denotes a closest approach at the end
+ *  of the interval (checked in this order, so that at most one close approach is found). The relative motion is represented by a cubic Hermite polynomial (see interpolateRelativeState), which deviates from the
+ *  chord between the relative positions at the boundaries of the interval by at most a quarter of the interval length
+ *  times the maximum difference between the relative velocities at the boundaries and the mean relative velocity. This
+ *  bound is used to reject most pairs before computing the time of closest approach with the root finder.
+ *  \param initialRelativeState Relative state at the start of the interval.
+ *  \param finalRelativeState Relative state at the end of the interval.
+ *  \param intervalLength Length of the interval.
+ *  \param screeningDistance Distance below which a close approach is reported.
+ *  \param rootFinder Bisection root finder used to compute the time of closest approach.
+ *  \param isFirstInterval Whether the interval is the first interval of the screening.
+ *  \param isLastInterval Whether the interval is the last interval of the screening.
+ *  \param timeOfClosestApproach Time of closest approach, since the start of the interval (returned by reference).
+ *  \param relativeStateAtClosestApproach Relative state at the time of closest approach (returned by reference).
+ *  \return True if a close approach below the screening distance is found, false otherwise.
+ */
+static bool findCloseApproachInInterval(
+        const Eigen::Vector6d& initialRelativeState, const Eigen::Vector6d& finalRelativeState,
+        const double intervalLength, const double screeningDistance,
+        const std::shared_ptr< root_finders::BisectionCore< double > > rootFinder,
+        const bool isFirstInterval, const bool isLastInterval,
+        double& timeOfClosestApproach, Eigen::Vector6d& relativeStateAtClosestApproach )
+{
+    const double initialRangeRate = initialRelativeState.segment( 0, 3 ).dot( initialRelativeState.segment( 3, 3 ) );
+    const double finalRangeRate = finalRelativeState.segment( 0, 3 ).dot( finalRelativeState.segment( 3, 3 ) );
+
+    // Check for closest approach at the start or end of the screening (distance not decreasing at the start, or still
+    // decreasing at the end).
+    if( isFirstInterval && !( initialRangeRate < 0.0 ) )
+    {
+        timeOfClosestApproach = 0.0;
+        relativeStateAtClosestApproach = initialRelativeState;
+        return relativeStateAtClosestApproach.segment( 0, 3 ).norm( ) < screeningDistance;
+    }
+    else if( isLastInterval && finalRangeRate < 0.0 )
+    {
+        timeOfClosestApproach = intervalLength;
+        relativeStateAtClosestApproach = finalRelativeState;
+        return relativeStateAtClosestApproach.segment( 0, 3 ).norm( ) < screeningDistance;
+    }
+
+    // Check whether the range rate changes sign from negative to positive.
+    if( !( initialRangeRate < 0.0 && finalRangeRate >= 0.0 ) )
+    {
+        return false;
+    }
+
+    // Check minimum distance of chord, minus maximum deviation of relative motion from chord.
+    const Eigen::Vector3d meanRelativeVelocity =
+            ( finalRelativeState.segment( 0, 3 ) - initialRelativeState.segment( 0, 3 ) ) / intervalLength;
+    const double maximumDeviationFromChord = 0.25 * intervalLength * std::max(
+                ( initialRelativeState.segment( 3, 3 ) - meanRelativeVelocity ).norm( ),
+                ( finalRelativeState.segment( 3, 3 ) - meanRelativeVelocity ).norm( ) );
+    const double chordFraction = std::min( 1.0, std::max( 0.0, -initialRelativeState.segment( 0, 3 ).dot(
+                                                               meanRelativeVelocity ) /
+                                                           ( meanRelativeVelocity.squaredNorm( ) * intervalLength ) ) );
+    if( ( initialRelativeState.segment( 0, 3 ) + chordFraction * intervalLength * meanRelativeVelocity ).norm( ) -
+            maximumDeviationFromChord >= screeningDistance )
+    {
+        return false;
+    }
+
+    // Compute time of closest approach.
+    std::shared_ptr< basic_mathematics::FunctionProxy< double, double > > rangeRateFunction =
+            std::make_shared< basic_mathematics::FunctionProxy< double, double > >(
+                [ & ]( const double timeSinceStartOfInterval )
+    {
+        const Eigen::Vector6d relativeState = interpolateRelativeState(
+                    initialRelativeState, finalRelativeState, intervalLength, timeSinceStartOfInterval );
+        return relativeState.segment( 0, 3 ).dot( relativeState.segment( 3, 3 ) );
+    } );
+    rootFinder->resetBoundaries( 0.0, intervalLength );
+    timeOfClosestApproach = rootFinder->execute( rangeRateFunction );
+
+    relativeStateAtClosestApproach = interpolateRelativeState(
+                initialRelativeState, finalRelativeState, intervalLength, timeOfClosestApproach );
+    return relativeStateAtClosestApproach.segment( 0, 3 ).norm( ) < screeningDistance;
+}
+
+//! Function to determine which objects pass the radial (apogee/perigee) filter over a block of epochs.
+/*!
+ *  Function to determine which objects pass the radial (apogee/perigee) filter over a block of epochs: objects of which
+ *  the range of radial distances overlaps, up to the screening distance, with that of at least one other object.
+ *  \param epochs Sampling epochs.
+ *  \param states States of all objects at the sampling epochs.
+ *  \param speedBounds Upper bounds of the speed of all objects in the sampling intervals (one column per interval).
+ *  \param screeningDistance Distance below which a close approach is reported.
+ *  \param numberOfThreads Maximum number of threads used for the computation of the radial ranges.
+ *  \return Booleans denoting for each object whether it passes the filter.
+ */
+static std::vector< bool > applyRadialFilter(
+        const std::vector< double >& epochs, const std::vector< StateArrayMap >& states,
+        const Eigen::MatrixXd& speedBounds, const double screeningDistance, const int numberOfThreads )
+{
+    const int numberOfObjects = static_cast< int >( speedBounds.rows( ) );
+    std::vector< double > minimumRadii( numberOfObjects ), maximumRadii( numberOfObjects );
+
+    // Compute range of radial distances, including the maximum excursion between the sampling epochs.
+    utilities::executeParallelLoop( numberOfObjects, [ & ]( const int i )
+    {
+        double minimumRadius = std::numeric_limits< double >::infinity( );
+        double maximumRadius = 0.0;
+        double maximumExcursion = 0.0;
+        for( unsigned int k = 0; k < epochs.size( ); k++ )
+        {
+            const double radius = states.at( k ).block( 0, i, 3, 1 ).norm( );
+            minimumRadius = std::min( minimumRadius, radius );
+            maximumRadius = std::max( maximumRadius, radius );
+            if( k + 1 < epochs.size( ) )
+            {
+                maximumExcursion = std::max(
+                            maximumExcursion, 0.5 * speedBounds( i, k ) * ( epochs.at( k + 1 ) - epochs.at( k ) ) );
+            }
+        }
+        minimumRadii[ i ] = minimumRadius - maximumExcursion;
+        maximumRadii[ i ] = maximumRadius + maximumExcursion;
+    }, std::max( 1, std::min( numberOfThreads, numberOfObjects / 256 ) ) );
+
+    // Sweep over objects, sorted by minimum radius, to find objects with overlapping ranges.
+    std::vector< int > objectOrder( numberOfObjects );
+    std::iota( objectOrder.begin( ), objectOrder.end( ), 0 );
+    std::sort( objectOrder.begin( ), objectOrder.end( ), [ & ]( const int i, const int j )
+    {
+        return minimumRadii[ i ] < minimumRadii[ j ];
+    } );
+
+    std::vector< bool > objectPassesFilter( numberOfObjects, false );
+    double maximumPreviousRadius = -std::numeric_limits< double >::infinity( );
+    for( int sortedIndex = 0; sortedIndex < numberOfObjects; sortedIndex++ )
+    {
+        const int i = objectOrder[ sortedIndex ];
+
+        // Check overlap with previous object of largest radius, and with next object.
+        if( minimumRadii[ i ] - screeningDistance <= maximumPreviousRadius ||
+                ( sortedIndex + 1 < numberOfObjects &&
+                  minimumRadii[ objectOrder[ sortedIndex + 1 ] ] - screeningDistance <= maximumRadii[ i ] ) )
+        {
+            objectPassesFilter[ i ] = true;
+        }
+        maximumPreviousRadius = std::max( maximumPreviousRadius, maximumRadii[ i ] );
+    }
+    return objectPassesFilter;
+}
+
+//! Function to find the close approaches in a block of sampled states.
+/*!
+ *  Function to find the close approaches in a block of sampled states, as described in the notes of
+ *  conjunctionScreening.h.
+ *  \param epochs Sampling epochs (strictly increasing).
+ *  \param states States of all objects at the sampling epochs.
+ *  \param screeningDistance Distance below which a close approach is reported.
+ *  \param timeTolerance Absolute tolerance of the times of closest approach.
+ *  \param numberOfThreads Maximum number of threads used for the screening.
+ *  \param isFirstBlock Whether the block starts at the start of the screening.
+ *  \param isLastBlock Whether the block ends at the end of the screening.
+ *  \param closeApproaches Close approaches found in the sampling intervals, appended in order of sampling interval.
+ */
+static void findCloseApproachesInStateBlock(
+        const std::vector< double >& epochs, const std::vector< StateArrayMap >& states,
+        const double screeningDistance, const double timeTolerance, const int numberOfThreads,
+        const bool isFirstBlock, const bool isLastBlock, std::vector< CloseApproach >& closeApproaches )
+{
+    const int numberOfIntervals = static_cast< int >( epochs.size( ) ) - 1;
+    const int numberOfObjects = static_cast< int >( states.at( 0 ).cols( ) );
+    if( numberOfIntervals < 1 || numberOfObjects < 2 )
+    {
+        return;
+    }
+
+    // Compute upper bound of the speed of each object in each interval (speed at the boundaries, plus the change in
+    // velocity over the interval).
+    Eigen::MatrixXd speedBounds( numberOfObjects, numberOfIntervals );
+    for( int k = 0; k < numberOfIntervals; k++ )
+    {
+        speedBounds.col( k ) =
+                ( states.at( k ).block( 3, 0, 3, numberOfObjects ).colwise( ).norm( ).array( ).max(
+                      states.at( k + 1 ).block( 3, 0, 3, numberOfObjects ).colwise( ).norm( ).array( ) ) +
+                  ( states.at( k + 1 ).block( 3, 0, 3, numberOfObjects ) -
+                    states.at( k ).block( 3, 0, 3, numberOfObjects ) ).colwise( ).norm( ).array( ) ).transpose( );
+    }
+
+    std::vector< bool > objectPassesFilter = applyRadialFilter(
+                epochs, states, speedBounds, screeningDistance, numberOfThreads );
+    std::vector< int > filteredObjects;
+    for( int i = 0; i < numberOfObjects; i++ )
+    {
+        if( objectPassesFilter[ i ] )
+        {
+            filteredObjects.push_back( i );
+        }
+    }
+    const int numberOfFilteredObjects = static_cast< int >( filteredObjects.size( ) );
+    if( numberOfFilteredObjects < 2 )
+    {
+        return;
+    }
+
+    // Screen sampling intervals concurrently, with each task handling a contiguous range of intervals.
+    std::vector< std::vector< CloseApproach > > intervalCloseApproaches( numberOfIntervals );
+    const int numberOfTasks = std::max( 1, std::min( numberOfThreads, numberOfIntervals ) );
+    utilities::executeParallelLoop( numberOfTasks, [ & ]( const int taskIndex )
+    {
+        Eigen::Matrix3Xd midpointPositions( 3, numberOfFilteredObjects );
+        Eigen::Matrix< long long, 3, Eigen::Dynamic > cellIndices( 3, numberOfFilteredObjects );
+        std::vector< std::pair< unsigned long long, int > > cellEntries( numberOfFilteredObjects );
+
+        std::shared_ptr< root_finders::BisectionCore< double > > rootFinder =
+                std::make_shared< root_finders::BisectionCore< double > >(
+                    std::bind( &root_finders::termination_conditions::RootAbsoluteToleranceTerminationCondition<
+                               double >::checkTerminationCondition,
+                               std::make_shared< root_finders::termination_conditions::
+                               RootAbsoluteToleranceTerminationCondition< double > >( timeTolerance, 100, false ),
+                               std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                               std::placeholders::_4, std::placeholders::_5 ) );
+
+        for( int k = taskIndex * numberOfIntervals / numberOfTasks;
+             k < ( taskIndex + 1 ) * numberOfIntervals / numberOfTasks; k++ )
+        {
+            const StateArrayMap& initialStates = states.at( k );
+            const StateArrayMap& finalStates = states.at( k + 1 );
+            const double intervalLength = epochs.at( k + 1 ) - epochs.at( k );
+
+            // Compute positions halfway the interval, and the resulting cell size of the grid.
+            double maximumSpeedBound = 0.0;
+            for( int l = 0; l < numberOfFilteredObjects; l++ )
+            {
+                const int i = filteredObjects[ l ];
+                midpointPositions.col( l ) =
+                        0.5 * ( initialStates.block( 0, i, 3, 1 ) + finalStates.block( 0, i, 3, 1 ) ) +
+                        intervalLength / 8.0 * ( initialStates.block( 3, i, 3, 1 ) - finalStates.block( 3, i, 3, 1 ) );
+                maximumSpeedBound = std::max( maximumSpeedBound, speedBounds( i, k ) );
+            }
+            const double cellSize = screeningDistance + maximumSpeedBound * intervalLength;
+
+            // Sort objects into grid cells.
+            for( int l = 0; l < numberOfFilteredObjects; l++ )
+            {
+                for( int axis = 0; axis < 3; axis++ )
+                {
+                    cellIndices( axis, l ) = getGridCellIndex( midpointPositions( axis, l ) / cellSize );
+                }
+                cellEntries[ l ] = std::make_pair(
+                            getGridCellKey( cellIndices( 0, l ), cellIndices( 1, l ), cellIndices( 2, l ) ), l );
+            }
+            std::sort( cellEntries.begin( ), cellEntries.end( ) );
+
+            // Check all pairs of objects in neighbouring cells, retrieving the three neighbouring cells along the z-axis
+            // at once.
+            const long long maximumCellIndex = ( 1LL << numberOfBitsPerCellIndex ) - 1;
+            for( int l = 0; l < numberOfFilteredObjects; l++ )
+            {
+                const int i = filteredObjects[ l ];
+                for( long long xIndex = std::max( cellIndices( 0, l ) - 1, 0LL );
+                     xIndex <= std::min( cellIndices( 0, l ) + 1, maximumCellIndex ); xIndex++ )
+                {
+                    for( long long yIndex = std::max( cellIndices( 1, l ) - 1, 0LL );
+                         yIndex <= std::min( cellIndices( 1, l ) + 1, maximumCellIndex ); yIndex++ )
+                    {
+                        const unsigned long long lowerKey = getGridCellKey(
+                                    xIndex, yIndex, std::max( cellIndices( 2, l ) - 1, 0LL ) );
+                        const unsigned long long upperKey = getGridCellKey(
+                                    xIndex, yIndex, std::min( cellIndices( 2, l ) + 1, maximumCellIndex ) );
+                        for( auto entryIterator = std::lower_bound(
+                                 cellEntries.begin( ), cellEntries.end( ), std::make_pair( lowerKey, -1 ) );
+                             entryIterator != cellEntries.end( ) && entryIterator->first <= upperKey; entryIterator++ )
+                        {
+                            const int n = entryIterator->second;
+                            const int j = filteredObjects[ n ];
+                            if( j <= i || ( midpointPositions.col( n ) - midpointPositions.col( l ) ).norm( ) >
+                                    screeningDistance + 0.5 * ( speedBounds( i, k ) + speedBounds( j, k ) ) *
+                                    intervalLength )
+                            {
+                                continue;
+                            }
+
+                            Eigen::Vector6d relativeState;
+                            double timeOfClosestApproach = TUDAT_NAN;
+                            if( findCloseApproachInInterval(
+                                        initialStates.col( j ) - initialStates.col( i ),
+                                        finalStates.col( j ) - finalStates.col( i ), intervalLength,
+                                        screeningDistance, rootFinder, isFirstBlock && k == 0,
+                                        isLastBlock && k == numberOfIntervals - 1,
+                                        timeOfClosestApproach, relativeState ) )
+                            {
+                                intervalCloseApproaches[ k ].push_back(
+                                            CloseApproach( i, j, epochs.at( k ) + timeOfClosestApproach,
+                                                           relativeState.segment( 0, 3 ).norm( ),
+                                                           relativeState.segment( 3, 3 ).norm( ) ) );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }, numberOfTasks );
+
+    for( int k = 0; k < numberOfIntervals; k++ )
+    {
+        closeApproaches.insert( closeApproaches.end( ), intervalCloseApproaches[ k ].begin( ),
+                                intervalCloseApproaches[ k ].end( ) );
+    }
+}
+
+//! Function to sort close approaches by time of closest approach (and object indices).
+static void sortCloseApproaches( std::vector< CloseApproach >& closeApproaches )
+{
+    std::sort( closeApproaches.begin( ), closeApproaches.end( ),
+               [ ]( const CloseApproach& firstApproach, const CloseApproach& secondApproach )
+    {
+        if( firstApproach.timeOfClosestApproach_ != secondApproach.timeOfClosestApproach_ )
+        {
+            return firstApproach.timeOfClosestApproach_ < secondApproach.timeOfClosestApproach_;
+        }
+        else if( firstApproach.firstObjectIndex_ != secondApproach.firstObjectIndex_ )
+        {
+            return firstApproach.firstObjectIndex_ < secondApproach.firstObjectIndex_;
+        }
+        return firstApproach.secondObjectIndex_ < secondApproach.secondObjectIndex_;
+    } );
+}
+
+//! Function to find the close approaches between objects from their concatenated state history.
+std::vector< CloseApproach > findCloseApproaches(
+        const std::map< double, Eigen::VectorXd >& concatenatedStateHistory,
+        const double screeningDistance,
+        const double timeTolerance,
+        const int numberOfThreads )
+{
+    std::vector< CloseApproach > closeApproaches;
+    if( concatenatedStateHistory.size( ) < 2 )
+    {
+        return closeApproaches;
+    }
+
+    const long numberOfStateEntries = concatenatedStateHistory.begin( )->second.rows( );
+    if( numberOfStateEntries % 6 != 0 )
+    {
+        throw std::runtime_error( "Error when screening state history for close approaches, state size " +
+                                  std::to_string( numberOfStateEntries ) + " is not a multiple of 6." );
+    }
+
+    std::vector< double > epochs;
+    std::vector< StateArrayMap > states;
+    for( auto stateIterator = concatenatedStateHistory.begin( ); stateIterator != concatenatedStateHistory.end( );
+         stateIterator++ )
+    {
+        if( stateIterator->second.rows( ) != numberOfStateEntries )
+        {
+            throw std::runtime_error( "Error when screening state history for close approaches, state size is not "
+                                      "constant." );
+        }
+        epochs.push_back( stateIterator->first );
+        states.push_back( StateArrayMap( stateIterator->second.data( ), 6, numberOfStateEntries / 6 ) );
+    }
+
+    // Screen blocks of epochs, with subsequent blocks sharing their boundary epoch.
+    const int numberOfIntervals = static_cast< int >( epochs.size( ) ) - 1;
+    for( int firstEpochIndex = 0; firstEpochIndex < numberOfIntervals;
+         firstEpochIndex += numberOfEpochsPerScreeningBlock - 1 )
+    {
+        const int lastEpochIndex = std::min( firstEpochIndex + numberOfEpochsPerScreeningBlock - 1, numberOfIntervals );
+        findCloseApproachesInStateBlock(
+                    std::vector< double >( epochs.begin( ) + firstEpochIndex, epochs.begin( ) + lastEpochIndex + 1 ),
+                    std::vector< StateArrayMap >(
+                        states.begin( ) + firstEpochIndex, states.begin( ) + lastEpochIndex + 1 ),
+                    screeningDistance, timeTolerance, numberOfThreads, firstEpochIndex == 0,
+                    lastEpochIndex == numberOfIntervals, closeApproaches );
+    }
+
+    sortCloseApproaches( closeApproaches );
+    return closeApproaches;
+}
+
+//! Function to find the close approaches between objects from functions returning their states.
+std::vector< CloseApproach > findCloseApproaches(
+        const std::vector< std::function< Eigen::Vector6d( const double ) > >& stateFunctions,
+        const double startTime,
+        const double endTime,
+        const double samplingTimeStep,
+        const double screeningDistance,
+        const double timeTolerance,
+        const int numberOfThreads )
+{
+    if( !( samplingTimeStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when screening states for close approaches, sampling time step must be "
+                                  "positive." );
+    }
+
+    std::vector< CloseApproach > closeApproaches;
+    const int numberOfObjects = static_cast< int >( stateFunctions.size( ) );
+    if( numberOfObjects < 2 || !( endTime > startTime ) )
+    {
+        return closeApproaches;
+    }
+
+    const int numberOfIntervals = static_cast< int >( std::ceil( ( endTime - startTime ) / samplingTimeStep ) );
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > stateBlock(
+                numberOfEpochsPerScreeningBlock, Eigen::Matrix< double, 6, Eigen::Dynamic >( 6, numberOfObjects ) );
+    for( int firstEpochIndex = 0; firstEpochIndex < numberOfIntervals;
+         firstEpochIndex += numberOfEpochsPerScreeningBlock - 1 )
+    {
+        std::vector< double > epochs;
+        for( int k = firstEpochIndex; k <= std::min( firstEpochIndex + numberOfEpochsPerScreeningBlock - 1,
+                                                    numberOfIntervals ); k++ )
+        {
+            epochs.push_back( ( k == numberOfIntervals ) ? endTime : startTime + k * samplingTimeStep );
+        }
+
+        // Sample states, with each object handled by a single thread.
+        utilities::executeParallelLoop( numberOfObjects, [ & ]( const int i )
+        {
+            for( unsigned int k = 0; k < epochs.size( ); k++ )
+            {
+                stateBlock[ k ].col( i ) = stateFunctions.at( i )( epochs.at( k ) );
+            }
+        }, numberOfThreads );
+
+        std::vector< StateArrayMap > states;
+        for( unsigned int k = 0; k < epochs.size( ); k++ )
+        {
+            states.push_back( StateArrayMap( stateBlock[ k ].data( ), 6, numberOfObjects ) );
+        }
+        findCloseApproachesInStateBlock(
+                    epochs, states, screeningDistance, timeTolerance, numberOfThreads, firstEpochIndex == 0,
+                    firstEpochIndex + static_cast< int >( epochs.size( ) ) - 1 == numberOfIntervals, closeApproaches );
+    }
+
+    sortCloseApproaches( closeApproaches );
+    return closeApproaches;
+}
+
+} // namespace mission_segments
+} // namespace tudat
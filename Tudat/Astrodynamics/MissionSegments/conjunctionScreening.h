@@ -0,0 +1,174 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The screening is performed on states sampled at a set of epochs, and consists of three stages:
+ *        1. Radial (apogee/perigee) filter: for each block of epochs, the range of radial distances of each object is
+ *           determined. Objects of which the range does not overlap (up to the screening distance) with that of any
+ *           other object are excluded, using a sort-and-sweep over the lower bounds of the ranges.
+ *        2. Spatial grid filter: for each sampling interval, the remaining objects are sorted into a grid of cubic
+ *           cells, based on their positions halfway the interval. The cell size is the screening distance plus the
+ *           maximum distance that two objects can approach each other w.r.t. these positions in half an interval, so
+ *           that only pairs of objects in neighbouring cells need to be considered.
+ *        3. Refinement: for each candidate pair, the motion of both objects in the interval is represented by cubic
+ *           Hermite polynomials of the states at its boundaries. If the range rate changes sign from negative to
+ *           positive in the interval, the time of closest approach is computed with the bisection root finder. A pair
+ *           of which the distance is not decreasing at the start of the screening, or is still decreasing at its end,
+ *           has its closest approach at that epoch.
+ *      Since at most one close approach of a pair is detected per sampling interval, the sampling interval should be
+ *      small w.r.t. the orbital periods of the objects (typically 10 to 60 s for objects in low Earth orbit).
+ *
+ */
+
+#ifndef TUDAT_CONJUNCTION_SCREENING_H
+#define TUDAT_CONJUNCTION_SCREENING_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/parallelLoop.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Number of sampling epochs of which the states are screened at once.
+/*!
+ *  Number of sampling epochs of which the states are screened at once, determining the memory use when screening
+ *  state functions and the time span over which the radial filter is applied.
+ */
+const static int numberOfEpochsPerScreeningBlock = 65;
+
+//! Close approach between two objects, as found by the conjunction screening.
+struct CloseApproach
+{
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param firstObjectIndex Index of the first object (lowest index of the two).
+     *  \param secondObjectIndex Index of the second object.
+     *  \param timeOfClosestApproach Time of closest approach.
+     *  \param missDistance Distance between the objects at the time of closest approach.
+     *  \param relativeSpeed Relative speed of the objects at the time of closest approach.
+     */
+    CloseApproach( const int firstObjectIndex, const int secondObjectIndex, const double timeOfClosestApproach,
+                   const double missDistance, const double relativeSpeed ):
+        firstObjectIndex_( firstObjectIndex ), secondObjectIndex_( secondObjectIndex ),
+        timeOfClosestApproach_( timeOfClosestApproach ), missDistance_( missDistance ),
+        relativeSpeed_( relativeSpeed ){ }
+
+    //! Index of the first object (lowest index of the two).
+    int firstObjectIndex_;
+
+    //! Index of the second object.
+    int secondObjectIndex_;
+
+    //! Time of closest approach.
+    double timeOfClosestApproach_;
+
+    //! Distance between the objects at the time of closest approach.
+    double missDistance_;
+
+    //! Relative speed of the objects at the time of closest approach.
+    double relativeSpeed_;
+};
+
+//! Function to find the close approaches between objects from their concatenated state history.
+/*!
+ *  Function to find the close approaches between objects from their concatenated state history, as produced by the
+ *  numerical propagation of multiple bodies (e.g. SingleArcDynamicsSimulator::getEquationsOfMotionNumericalSolution)
+ *  or by the BatchAnalyticalOrbitPropagator. The history is screened as described in the file notes, using the epochs
+ *  of the history as sampling epochs.
+ *  \param concatenatedStateHistory Concatenated Cartesian states (size 6N) of all objects, w.r.t. a common origin, as
+ *  a function of time. The index of an object is the index of its state in the concatenated state.
+ *  \param screeningDistance Distance below which a close approach is reported.
+ *  \param timeTolerance Absolute tolerance of the times of closest approach.
+ *  \param numberOfThreads Maximum number of threads used for the screening.
+ *  \return Close approaches (local minima of the distance between two objects below the screening distance), ordered
+ *  by time of closest approach.
+ */
+std::vector< CloseApproach > findCloseApproaches(
+        const std::map< double, Eigen::VectorXd >& concatenatedStateHistory,
+        const double screeningDistance,
+        const double timeTolerance = 1.0E-3,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Function to find the close approaches between objects from functions returning their states.
+/*!
+ *  Function to find the close approaches between objects from functions returning their states, which are sampled at
+ *  a constant time step (and at the end time). The states are sampled and screened in blocks of
+ *  numberOfEpochsPerScreeningBlock epochs. The states of different objects are sampled concurrently, with each state
+ *  function called by at most one thread at a time, so that the state functions of different objects must be
+ *  independent of each other, but need not be thread-safe themselves.
+ *  \param stateFunctions Functions returning the Cartesian states of the objects, w.r.t. a common origin, as a function
+ *  of time. The index of an object is the index of its state function.
+ *  \param startTime Start time of the screening interval.
+ *  \param endTime End time of the screening interval.
+ *  \param samplingTimeStep Time step at which the states are sampled.
+ *  \param screeningDistance Distance below which a close approach is reported.
+ *  \param timeTolerance Absolute tolerance of the times of closest approach.
+ *  \param numberOfThreads Maximum number of threads used for the screening.
+ *  \return Close approaches (local minima of the distance between two objects below the screening distance), ordered
+ *  by time of closest approach.
+ */
+std::vector< CloseApproach > findCloseApproaches(
+        const std::vector< std::function< Eigen::Vector6d( const double ) > >& stateFunctions,
+        const double startTime,
+        const double endTime,
+        const double samplingTimeStep,
+        const double screeningDistance,
+        const double timeTolerance = 1.0E-3,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Function to find the close approaches between objects from their ephemerides.
+/*!
+ *  Function to find the close approaches between objects from their ephemerides (e.g. TabulatedCartesianEphemeris
+ *  objects created from propagated state histories), see the overload taking state functions. Each ephemeris object is
+ *  used by at most one thread at a time, so the ephemerides must be distinct objects.
+ *  \param ephemerides Ephemerides of the objects, all w.r.t. the same origin. The index of an object is the index of
+ *  its ephemeris.
+ *  \param startTime Start time of the screening interval.
+ *  \param endTime End time of the screening interval.
+ *  \param samplingTimeStep Time step at which the states are sampled.
+ *  \param screeningDistance Distance below which a close approach is reported.
+ *  \param timeTolerance Absolute tolerance of the times of closest approach.
+ *  \param numberOfThreads Maximum number of threads used for the screening.
+ *  \return Close approaches (local minima of the distance between two objects below the screening distance), ordered
+ *  by time of closest approach.
+ */
+inline std::vector< CloseApproach > findCloseApproaches(
+        const std::vector< std::shared_ptr< ephemerides::Ephemeris > >& ephemerides,
+        const double startTime,
+        const double endTime,
+        const double samplingTimeStep,
+        const double screeningDistance,
+        const double timeTolerance = 1.0E-3,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) )
+{
+    std::vector< std::function< Eigen::Vector6d( const double ) > > stateFunctions;
+    for( unsigned int i = 0; i < ephemerides.size( ); i++ )
+    {
+        std::shared_ptr< ephemerides::Ephemeris > ephemeris = ephemerides.at( i );
+        stateFunctions.push_back( [ = ]( const double time ){ return ephemeris->getCartesianState( time ); } );
+    }
+    return findCloseApproaches( stateFunctions, startTime, endTime, samplingTimeStep, screeningDistance,
+                                timeTolerance, numberOfThreads );
+}
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_CONJUNCTION_SCREENING_H
@@ -16,8 +16,10 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
@@ -39,133 +41,125 @@ namespace mission_segments
 
 using namespace root_finders;
 
-//! Solve Lambert Problem using Izzo's algorithm.
-void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
-                              const Eigen::Vector3d& cartesianPositionAtArrival,
-                              const double timeOfFlight,
-                              const double gravitationalParameter,
-                              Eigen::Vector3d& cartesianVelocityAtDeparture,
-                              Eigen::Vector3d& cartesianVelocityAtArrival,
-                              const bool isRetrograde,
-                              const double convergenceTolerance,
-                              const unsigned int maximumNumberOfIterations )
+//! Transfer geometry of a Lambert problem, in adimensional units, as used in Izzo's algorithm.
+struct LambertTransferGeometryIzzo
 {
-    // Sanity check for specified time-of-flight.
-    if ( timeOfFlight <= 0.0 )
+    //! Constructor, computes the transfer geometry.
+    LambertTransferGeometryIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                 const Eigen::Vector3d& cartesianPositionAtArrival,
+                                 const double timeOfFlight,
+                                 const double gravitationalParameter,
+                                 const bool isRetrograde )
     {
-        // Throw exception.
-        throw std::runtime_error( "Specified time-of-flight must be strictly positive: " + std::to_string( timeOfFlight ) + " days." );
-    }
+        // Compute normalizing values.
+        distanceNormalizingValue = cartesianPositionAtDeparture.norm( );
+        velocityNormalizingValue = std::sqrt( gravitationalParameter / distanceNormalizingValue );
+        const double timeNormalizingValue = distanceNormalizingValue / velocityNormalizingValue;
+
+        // Compute transfer geometry parameters in adimensional units.
+        // Cosine of transfer angle.
+        const double cosineOfTransferAngle =
+                cartesianPositionAtDeparture.dot( cartesianPositionAtArrival )
+                / (distanceNormalizingValue * cartesianPositionAtArrival.norm( ) );
+
+        // Normalized Cartesian position at arrival.
+        normalizedRadiusAtArrival = cartesianPositionAtArrival.norm( ) / distanceNormalizingValue;
+
+        // Chord.
+        chord = std::sqrt( 1.0 + normalizedRadiusAtArrival
+                           * ( normalizedRadiusAtArrival - 2.0 * cosineOfTransferAngle ) );
+
+        // Semi-perimeter.
+        semiPerimeter = ( 1.0 + normalizedRadiusAtArrival + chord ) / 2.0;
+
+        // Assuming a prograde motion, determine whether the transfer corresponds to the long- or the
+        // short-way solution: longway if x1*y2 - x2*y1 < 0.
+        isLongway = false;
+        if ( cartesianPositionAtDeparture.x( ) * cartesianPositionAtArrival.y( )
+             - cartesianPositionAtDeparture.y( ) * cartesianPositionAtArrival.x( ) < 0.0 )
+        {
+            isLongway = true;
+        }
 
-    // Compute normalizing values.
-    const double distanceNormalizingValue = cartesianPositionAtDeparture.norm( );
-    const double velocityNormalizingValue = std::sqrt( gravitationalParameter /
-                                                       distanceNormalizingValue );
-    const double timeNormalizingValue = distanceNormalizingValue / velocityNormalizingValue;
+        // If retrograde is true, switch longway flag.
+        if ( isRetrograde )
+        {
+            isLongway = !isLongway;
+        }
 
-    // Compute transfer geometry parameters in adimensional units.
-    // Cosine of transfer angle.
-    const double cosineOfTransferAngle =
-            cartesianPositionAtDeparture.dot( cartesianPositionAtArrival )
-            / (distanceNormalizingValue * cartesianPositionAtArrival.norm( ) );
-
-    // Normalized Cartesian position at arrival.
-    const double normalizedRadiusAtArrival = cartesianPositionAtArrival.norm( )
-            / distanceNormalizingValue;
-
-    // Chord.
-    const double chord = std::sqrt( 1.0 + normalizedRadiusAtArrival
-                                    * ( normalizedRadiusAtArrival - 2.0 * cosineOfTransferAngle ) );
-
-    // Semi-perimeter.
-    const double semiPerimeter = ( 1.0 + normalizedRadiusAtArrival + chord ) / 2.0;
-
-    // Assuming a prograde motion, determine whether the transfer corresponds to the long- or the
-    // short-way solution: longway if x1*y2 - x2*y1 < 0.
-    bool isLongway = false;
-    if ( cartesianPositionAtDeparture.x( ) * cartesianPositionAtArrival.y( )
-         - cartesianPositionAtDeparture.y( ) * cartesianPositionAtArrival.x( ) < 0.0 )
-    {
-        isLongway = true;
-    }
+        // Semi-major axis of the minimum energy ellipse.
+        semiMajorAxisOfTheMinimumEnergyEllipse = semiPerimeter / 2.0;
 
-    // If retrograde is true, switch longway flag.
-    if ( isRetrograde )
-    {
-        isLongway = !isLongway;
-    }
+        // Transfer angle.
+        transferAngle = std::acos( cosineOfTransferAngle );
+        if ( isLongway )
+        {
+            transferAngle = 2.0 * mathematical_constants::PI - transferAngle;
+        }
 
-    // Semi-major axis of the minimum energy ellipse.
-    const double semiMajorAxisOfTheMinimumEnergyEllipse = semiPerimeter / 2.0;
+        // Lambda parameter.
+        lambdaParameter = std::sqrt( normalizedRadiusAtArrival )
+                * std::cos( transferAngle / 2.0 ) / semiPerimeter;
 
-    // Transfer angle.
-    double transferAngle = std::acos( cosineOfTransferAngle );
-    if ( isLongway )
-    {
-        transferAngle = 2.0 * mathematical_constants::PI - transferAngle;
+        // Optimize log(t_spec).
+        const double normalizedSpecifiedTimeOfFlight = timeOfFlight / timeNormalizingValue;
+        logarithmOfTheSpecifiedTimeOfFlight = std::log( normalizedSpecifiedTimeOfFlight );
     }
 
-    // Lambda parameter.
-    const double lambdaParameter = std::sqrt( normalizedRadiusAtArrival )
-            * std::cos( transferAngle / 2.0 ) / semiPerimeter;
-
-    // Optimize log(t_spec).
-    const double normalizedSpecifiedTimeOfFlight = timeOfFlight / timeNormalizingValue;
-    const double logarithmOfTheSpecifiedTimeOfFlight = std::log( normalizedSpecifiedTimeOfFlight );
-
-    // Secant Method.
-    // Define initial guesses for abcissae (x) and ordinates (y).
-    double x1 = std::log( 0.5 ), x2 = std::log( 1.5 );
+    //! Function to compute the root function of the secant method, log( t( x ) ) - log( t_spec ).
+    double computeTimeOfFlightError( const double xParameter ) const
+    {
+        return std::log( computeTimeOfFlightIzzo( xParameter, semiPerimeter, chord, isLongway,
+                                                  semiMajorAxisOfTheMinimumEnergyEllipse ) )
+                - logarithmOfTheSpecifiedTimeOfFlight;
+    }
 
-    double y1 = std::log( computeTimeOfFlightIzzo( -0.5, semiPerimeter, chord, isLongway,
-                                                   semiMajorAxisOfTheMinimumEnergyEllipse ) )
-            - logarithmOfTheSpecifiedTimeOfFlight;
+    //! Distance normalizing value (norm of position at departure).
+    double distanceNormalizingValue;
 
-    double y2 = std::log( computeTimeOfFlightIzzo( 0.5, semiPerimeter, chord, isLongway,
-                                                   semiMajorAxisOfTheMinimumEnergyEllipse ) )
-            - logarithmOfTheSpecifiedTimeOfFlight;
+    //! Velocity normalizing value.
+    double velocityNormalizingValue;
 
-    // Declare and initialize root-finding parameters.
-    double rootFindingError = 1.0, xNew = 0.0, yNew = 0.0;
-    unsigned int iterator = 0;
+    //! Normalized norm of position at arrival.
+    double normalizedRadiusAtArrival;
 
+    //! Chord.
+    double chord;
 
-    // Root-finding loop.
-    while ( ( rootFindingError > convergenceTolerance ) && (y1 != y2)
-            && ( iterator < maximumNumberOfIterations ) )
-    {
-        // Update iterator.
-        iterator++;
+    //! Semi-perimeter.
+    double semiPerimeter;
 
-        // Compute new x-value.
-        xNew = ( x1 * y2 - y1 * x2 ) / ( y2 - y1 );
+    //! Boolean denoting whether the transfer is long-way.
+    bool isLongway;
 
-        // Compute corresponding y-value.
-        yNew = std::log( computeTimeOfFlightIzzo( std::exp( xNew ) - 1.0, semiPerimeter, chord,
-                                                  isLongway,
-                                                  semiMajorAxisOfTheMinimumEnergyEllipse ) )
-                - logarithmOfTheSpecifiedTimeOfFlight;
+    //! Semi-major axis of the minimum energy ellipse.
+    double semiMajorAxisOfTheMinimumEnergyEllipse;
 
-        // Update abcissae and ordinates.
-        x1 = x2;
-        y1 = y2;
-        x2 = xNew;
-        y2 = yNew;
+    //! Transfer angle.
+    double transferAngle;
 
-        // Compute root-finding error.
-        rootFindingError = std::fabs( x1 - xNew );
-    }
+    //! Lambda parameter.
+    double lambdaParameter;
 
-    // Verify that root-finder has converged.
-    if ( iterator == maximumNumberOfIterations )
-    {
-        std::string errorMessage = "Lambert Solver did not converge within the maximum number of iterations: " +
-                std::to_string( maximumNumberOfIterations );
-        throw std::runtime_error( errorMessage );
-    }
+    //! Logarithm of the normalized specified time-of-flight.
+    double logarithmOfTheSpecifiedTimeOfFlight;
+};
 
-    // Revert to x parameter.
-    const double xParameter = std::exp( xNew ) - 1.0;
+//! Compute velocities at departure and arrival from the converged x parameter in Izzo's algorithm.
+static void computeLambertVelocitiesIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                          const Eigen::Vector3d& cartesianPositionAtArrival,
+                                          const LambertTransferGeometryIzzo& geometry,
+                                          const double xParameter,
+                                          Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                          Eigen::Vector3d& cartesianVelocityAtArrival )
+{
+    const double semiPerimeter = geometry.semiPerimeter;
+    const double chord = geometry.chord;
+    const bool isLongway = geometry.isLongway;
+    const double semiMajorAxisOfTheMinimumEnergyEllipse = geometry.semiMajorAxisOfTheMinimumEnergyEllipse;
+    const double normalizedRadiusAtArrival = geometry.normalizedRadiusAtArrival;
+    const double transferAngle = geometry.transferAngle;
+    const double lambdaParameter = geometry.lambdaParameter;
 
     // Determine semi-major axis of the conic.
     const double semiMajorAxis = semiMajorAxisOfTheMinimumEnergyEllipse
@@ -290,9 +284,220 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
             - transverseVelocityAtArrival * transverseUnitVectorAtArrival.z( );
 
     // Return dimensions.
-    cartesianVelocityAtDeparture *= velocityNormalizingValue;
-    cartesianVelocityAtArrival *= velocityNormalizingValue;
+    cartesianVelocityAtDeparture *= geometry.velocityNormalizingValue;
+    cartesianVelocityAtArrival *= geometry.velocityNormalizingValue;
+}
 
+//! Solve Lambert Problem using Izzo's algorithm.
+void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                              const double timeOfFlight,
+                              const double gravitationalParameter,
+                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                              const bool isRetrograde,
+                              const double convergenceTolerance,
+                              const unsigned int maximumNumberOfIterations )
+{
+    // Sanity check for specified time-of-flight.
+    if ( timeOfFlight <= 0.0 )
+    {
+        // Throw exception.
+        throw std::runtime_error( "Specified time-of-flight must be strictly positive: " + std::to_string( timeOfFlight ) + " days." );
+    }
+
+    // Compute transfer geometry parameters in adimensional units.
+    const LambertTransferGeometryIzzo geometry(
+                cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight, gravitationalParameter,
+                isRetrograde );
+
+    // Secant Method.
+    // Define initial guesses for abcissae (x) and ordinates (y).
+    double x1 = std::log( 0.5 ), x2 = std::log( 1.5 );
+
+    double y1 = geometry.computeTimeOfFlightError( -0.5 );
+
+    double y2 = geometry.computeTimeOfFlightError( 0.5 );
+
+    // Declare and initialize root-finding parameters.
+    double rootFindingError = 1.0, xNew = 0.0, yNew = 0.0;
+    unsigned int iterator = 0;
+
+
+    // Root-finding loop.
+    while ( ( rootFindingError > convergenceTolerance ) && (y1 != y2)
+            && ( iterator < maximumNumberOfIterations ) )
+    {
+        // Update iterator.
+        iterator++;
+
+        // Compute new x-value.
+        xNew = ( x1 * y2 - y1 * x2 ) / ( y2 - y1 );
+
+        // Compute corresponding y-value.
+        yNew = geometry.computeTimeOfFlightError( std::exp( xNew ) - 1.0 );
+
+        // Update abcissae and ordinates.
+        x1 = x2;
+        y1 = y2;
+        x2 = xNew;
+        y2 = yNew;
+
+        // Compute root-finding error.
+        rootFindingError = std::fabs( x1 - xNew );
+    }
+
+    // Verify that root-finder has converged.
+    if ( iterator == maximumNumberOfIterations )
+    {
+        std::string errorMessage = "Lambert Solver did not converge within the maximum number of iterations: " +
+                std::to_string( maximumNumberOfIterations );
+        throw std::runtime_error( errorMessage );
+    }
+
+    // Revert to x parameter and compute velocities.
+    computeLambertVelocitiesIzzo( cartesianPositionAtDeparture, cartesianPositionAtArrival, geometry,
+                                  std::exp( xNew ) - 1.0, cartesianVelocityAtDeparture,
+                                  cartesianVelocityAtArrival );
+}
+
+//! Solve multiple Lambert problems using Izzo's algorithm.
+void solveLambertProblemsIzzo( const Eigen::Matrix3Xd& cartesianPositionsAtDeparture,
+                               const Eigen::Matrix3Xd& cartesianPositionsAtArrival,
+                               const Eigen::VectorXd& timesOfFlight,
+                               const double gravitationalParameter,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtDeparture,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtArrival,
+                               const bool isRetrograde,
+                               const double convergenceTolerance,
+                               const unsigned int maximumNumberOfIterations,
+                               const int numberOfThreads )
+{
+    const int numberOfProblems = static_cast< int >( timesOfFlight.rows( ) );
+    if ( cartesianPositionsAtDeparture.cols( ) != numberOfProblems ||
+         cartesianPositionsAtArrival.cols( ) != numberOfProblems )
+    {
+        throw std::runtime_error( "Error when solving multiple Lambert problems, inconsistent number of positions ("
+                                  + std::to_string( cartesianPositionsAtDeparture.cols( ) ) + ", "
+                                  + std::to_string( cartesianPositionsAtArrival.cols( ) ) + ") and times-of-flight ("
+                                  + std::to_string( numberOfProblems ) + ")." );
+    }
+
+    cartesianVelocitiesAtDeparture.resize( 3, numberOfProblems );
+    cartesianVelocitiesAtArrival.resize( 3, numberOfProblems );
+
+    // Solve blocks of problems concurrently; each block writes only to its own columns of the output.
+    const int numberOfBlocks = ( numberOfProblems + numberOfLambertProblemsPerBlock - 1 )
+            / numberOfLambertProblemsPerBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int firstProblem = blockIndex * numberOfLambertProblemsPerBlock;
+        solveLambertProblemBlockIzzo(
+                    cartesianPositionsAtDeparture.data( ) + 3 * firstProblem,
+                    cartesianPositionsAtArrival.data( ) + 3 * firstProblem,
+                    timesOfFlight.data( ) + firstProblem,
+                    std::min( numberOfLambertProblemsPerBlock, numberOfProblems - firstProblem ),
+                    gravitationalParameter,
+                    cartesianVelocitiesAtDeparture.data( ) + 3 * firstProblem,
+                    cartesianVelocitiesAtArrival.data( ) + 3 * firstProblem,
+                    isRetrograde, convergenceTolerance, maximumNumberOfIterations );
+    }, numberOfThreads );
+}
+
+//! Solve a contiguous block of Lambert problems using Izzo's algorithm.
+void solveLambertProblemBlockIzzo( const double* cartesianPositionsAtDeparture,
+                                   const double* cartesianPositionsAtArrival,
+                                   const double* timesOfFlight,
+                                   const int numberOfProblems,
+                                   const double gravitationalParameter,
+                                   double* cartesianVelocitiesAtDeparture,
+                                   double* cartesianVelocitiesAtArrival,
+                                   const bool isRetrograde,
+                                   const double convergenceTolerance,
+                                   const unsigned int maximumNumberOfIterations )
+{
+    const int numberOfLanes = numberOfLambertProblemLanes;
+
+    // Iteration state of the secant method, per lane.
+    double x1[ numberOfLanes ], x2[ numberOfLanes ], y1[ numberOfLanes ], y2[ numberOfLanes ];
+    double xNew[ numberOfLanes ], rootFindingError[ numberOfLanes ];
+    unsigned int iterator[ numberOfLanes ];
+    bool isLaneActive[ numberOfLanes ];
+    std::vector< LambertTransferGeometryIzzo > geometries;
+    geometries.reserve( numberOfLanes );
+
+    for ( int firstProblem = 0; firstProblem < numberOfProblems; firstProblem += numberOfLanes )
+    {
+        const int numberOfUsedLanes = std::min( numberOfLanes, numberOfProblems - firstProblem );
+
+        // Compute transfer geometries and initial guesses.
+        geometries.clear( );
+        for ( int lane = 0; lane < numberOfUsedLanes; lane++ )
+        {
+            const int problem = firstProblem + lane;
+            geometries.push_back( LambertTransferGeometryIzzo(
+                                      Eigen::Map< const Eigen::Vector3d >( cartesianPositionsAtDeparture + 3 * problem ),
+                                      Eigen::Map< const Eigen::Vector3d >( cartesianPositionsAtArrival + 3 * problem ),
+                                      timesOfFlight[ problem ], gravitationalParameter, isRetrograde ) );
+            x1[ lane ] = std::log( 0.5 );
+            x2[ lane ] = std::log( 1.5 );
+            y1[ lane ] = geometries[ lane ].computeTimeOfFlightError( -0.5 );
+            y2[ lane ] = geometries[ lane ].computeTimeOfFlightError( 0.5 );
+            xNew[ lane ] = 0.0;
+            rootFindingError[ lane ] = 1.0;
+            iterator[ lane ] = 0;
+            isLaneActive[ lane ] = ( timesOfFlight[ problem ] > 0.0 );
+        }
+
+        // Iterate all lanes simultaneously, until each lane has met its termination condition (identical to that
+        // of solveLambertProblemIzzo). Lanes that have terminated are masked, and no longer updated.
+        bool isAnyLaneActive = true;
+        while ( isAnyLaneActive )
+        {
+            isAnyLaneActive = false;
+            for ( int lane = 0; lane < numberOfUsedLanes; lane++ )
+            {
+                isLaneActive[ lane ] = isLaneActive[ lane ] && ( rootFindingError[ lane ] > convergenceTolerance )
+                        && ( y1[ lane ] != y2[ lane ] ) && ( iterator[ lane ] < maximumNumberOfIterations );
+                if ( isLaneActive[ lane ] )
+                {
+                    isAnyLaneActive = true;
+                    iterator[ lane ]++;
+                    xNew[ lane ] = ( x1[ lane ] * y2[ lane ] - y1[ lane ] * x2[ lane ] ) / ( y2[ lane ] - y1[ lane ] );
+                    const double yNew = geometries[ lane ].computeTimeOfFlightError( std::exp( xNew[ lane ] ) - 1.0 );
+                    x1[ lane ] = x2[ lane ];
+                    y1[ lane ] = y2[ lane ];
+                    x2[ lane ] = xNew[ lane ];
+                    y2[ lane ] = yNew;
+                    rootFindingError[ lane ] = std::fabs( x1[ lane ] - xNew[ lane ] );
+                }
+            }
+        }
+
+        // Compute velocities; problems that could not be solved yield NaN velocities.
+        for ( int lane = 0; lane < numberOfUsedLanes; lane++ )
+        {
+            const int problem = firstProblem + lane;
+            Eigen::Vector3d cartesianVelocityAtDeparture, cartesianVelocityAtArrival;
+            if ( timesOfFlight[ problem ] > 0.0 && iterator[ lane ] != maximumNumberOfIterations )
+            {
+                computeLambertVelocitiesIzzo(
+                            Eigen::Map< const Eigen::Vector3d >( cartesianPositionsAtDeparture + 3 * problem ),
+                            Eigen::Map< const Eigen::Vector3d >( cartesianPositionsAtArrival + 3 * problem ),
+                            geometries[ lane ], std::exp( xNew[ lane ] ) - 1.0,
+                            cartesianVelocityAtDeparture, cartesianVelocityAtArrival );
+            }
+            else
+            {
+                cartesianVelocityAtDeparture.setConstant( TUDAT_NAN );
+                cartesianVelocityAtArrival.setConstant( TUDAT_NAN );
+            }
+            Eigen::Map< Eigen::Vector3d >( cartesianVelocitiesAtDeparture + 3 * problem ) =
+                    cartesianVelocityAtDeparture;
+            Eigen::Map< Eigen::Vector3d >( cartesianVelocitiesAtArrival + 3 * problem ) =
+                    cartesianVelocityAtArrival;
+        }
+    }
 }
 
 //! Compute time-of-flight using Lagrange's equation.
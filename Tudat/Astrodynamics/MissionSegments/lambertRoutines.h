@@ -23,6 +23,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 #include "Tudat/Mathematics/RootFinders/rootFinder.h"
 #include "Tudat/Mathematics/RootFinders/terminationConditions.h"
@@ -67,6 +68,71 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
                               const double convergenceTolerance = 1e-9,
                               const unsigned int maximumNumberOfIterations = 50 );
 
+//! Number of Lambert problems that are iterated simultaneously by solveLambertProblemBlockIzzo.
+const static int numberOfLambertProblemLanes = 8;
+
+//! Number of Lambert problems per block that is solved by a single thread in solveLambertProblemsIzzo.
+const static int numberOfLambertProblemsPerBlock = 256;
+
+//! Solve multiple Lambert problems using Izzo's algorithm.
+/*!
+ * Solves multiple Lambert problems using Izzo's algorithm (see solveLambertProblemIzzo), distributing blocks of
+ * problems over multiple threads. Within a block, the secant iterations of numberOfLambertProblemLanes problems are
+ * performed simultaneously, with each problem (lane) terminating independently. The velocities are identical to those
+ * computed by solveLambertProblemIzzo. Problems with a non-positive time-of-flight, or for which the root-finder did
+ * not converge, do not throw an exception (as solveLambertProblemIzzo does), but yield NaN velocities.
+ * \param cartesianPositionsAtDeparture Cartesian positions at departure, one column per problem. [Input]
+ * \param cartesianPositionsAtArrival Cartesian positions at arrival, one column per problem. [Input]
+ * \param timesOfFlight Times-of-flight between departure and arrival, one entry per problem. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocitiesAtDeparture Velocities at departure, one column per problem. [Output]
+ * \param cartesianVelocitiesAtArrival Velocities at arrival, one column per problem. [Output]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ *          [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ *          [Input, Optional]
+ * \param numberOfThreads Maximum number of threads used to solve the problems. [Input, Optional]
+ */
+void solveLambertProblemsIzzo( const Eigen::Matrix3Xd& cartesianPositionsAtDeparture,
+                               const Eigen::Matrix3Xd& cartesianPositionsAtArrival,
+                               const Eigen::VectorXd& timesOfFlight,
+                               const double gravitationalParameter,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtDeparture,
+                               Eigen::Matrix3Xd& cartesianVelocitiesAtArrival,
+                               const bool isRetrograde = false,
+                               const double convergenceTolerance = 1e-9,
+                               const unsigned int maximumNumberOfIterations = 50,
+                               const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+//! Solve a contiguous block of Lambert problems using Izzo's algorithm.
+/*!
+ * Solves a contiguous block of Lambert problems using Izzo's algorithm, on the calling thread, with the same results
+ * as solveLambertProblemsIzzo. Vectors are stored consecutively (x, y, z per problem), as in the columns of an
+ * Eigen::Matrix3Xd. This function allows callers that distribute work over threads themselves to solve (parts of)
+ * their problems without intermediate copies.
+ * \param cartesianPositionsAtDeparture Cartesian positions at departure (3 entries per problem). [Input]
+ * \param cartesianPositionsAtArrival Cartesian positions at arrival (3 entries per problem). [Input]
+ * \param timesOfFlight Times-of-flight between departure and arrival (1 entry per problem). [Input]
+ * \param numberOfProblems Number of problems in block. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocitiesAtDeparture Velocities at departure (3 entries per problem). [Output]
+ * \param cartesianVelocitiesAtArrival Velocities at arrival (3 entries per problem). [Output]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input]
+ * \param convergenceTolerance Convergence tolerance for the root-finding process. [Input]
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process. [Input]
+ */
+void solveLambertProblemBlockIzzo( const double* cartesianPositionsAtDeparture,
+                                   const double* cartesianPositionsAtArrival,
+                                   const double* timesOfFlight,
+                                   const int numberOfProblems,
+                                   const double gravitationalParameter,
+                                   double* cartesianVelocitiesAtDeparture,
+                                   double* cartesianVelocitiesAtArrival,
+                                   const bool isRetrograde,
+                                   const double convergenceTolerance,
+                                   const unsigned int maximumNumberOfIterations );
+
 //! Compute time-of-flight using Lagrange's equation.
 /*!
  * Computes the time-of-flight according to Lagrange's equation as a function of the x-parameter.
@@ -0,0 +1,89 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/porkchopPlot.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Function to compute the Delta V of direct transfers on a grid of departure and arrival times (porkchop plot).
+Eigen::MatrixXd computePorkchopPlotDeltaVs(
+        const std::function< Eigen::Vector6d( const double ) >& departureBodyStateFunction,
+        const std::function< Eigen::Vector6d( const double ) >& arrivalBodyStateFunction,
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& arrivalTimes,
+        const double centralBodyGravitationalParameter,
+        const int numberOfThreads )
+{
+    const int numberOfDepartureTimes = static_cast< int >( departureTimes.size( ) );
+    const int numberOfArrivalTimes = static_cast< int >( arrivalTimes.size( ) );
+
+    // Compute states of bodies once per epoch.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureBodyStates( 6, numberOfDepartureTimes );
+    for ( int i = 0; i < numberOfDepartureTimes; i++ )
+    {
+        departureBodyStates.col( i ) = departureBodyStateFunction( departureTimes.at( i ) );
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > arrivalBodyStates( 6, numberOfArrivalTimes );
+    for ( int j = 0; j < numberOfArrivalTimes; j++ )
+    {
+        arrivalBodyStates.col( j ) = arrivalBodyStateFunction( arrivalTimes.at( j ) );
+    }
+
+    // Solve Lambert problems of blocks of grid points concurrently; each block writes only to its own entries.
+    Eigen::MatrixXd deltaVs( numberOfDepartureTimes, numberOfArrivalTimes );
+    const int numberOfGridPoints = numberOfDepartureTimes * numberOfArrivalTimes;
+    const int numberOfBlocks = ( numberOfGridPoints + numberOfLambertProblemsPerBlock - 1 )
+            / numberOfLambertProblemsPerBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int firstGridPoint = blockIndex * numberOfLambertProblemsPerBlock;
+        const int numberOfProblems = std::min( numberOfLambertProblemsPerBlock, numberOfGridPoints - firstGridPoint );
+
+        Eigen::Matrix3Xd positionsAtDeparture( 3, numberOfProblems ), positionsAtArrival( 3, numberOfProblems );
+        Eigen::VectorXd timesOfFlight( numberOfProblems );
+        for ( int k = 0; k < numberOfProblems; k++ )
+        {
+            const int departureIndex = ( firstGridPoint + k ) / numberOfArrivalTimes;
+            const int arrivalIndex = ( firstGridPoint + k ) % numberOfArrivalTimes;
+            positionsAtDeparture.col( k ) = departureBodyStates.block( 0, departureIndex, 3, 1 );
+            positionsAtArrival.col( k ) = arrivalBodyStates.block( 0, arrivalIndex, 3, 1 );
+            timesOfFlight( k ) = arrivalTimes[ arrivalIndex ] - departureTimes[ departureIndex ];
+        }
+
+        Eigen::Matrix3Xd velocitiesAtDeparture( 3, numberOfProblems ), velocitiesAtArrival( 3, numberOfProblems );
+        solveLambertProblemBlockIzzo( positionsAtDeparture.data( ), positionsAtArrival.data( ), timesOfFlight.data( ),
+                                      numberOfProblems, centralBodyGravitationalParameter,
+                                      velocitiesAtDeparture.data( ), velocitiesAtArrival.data( ),
+                                      false, 1.0E-9, 50 );
+
+        for ( int k = 0; k < numberOfProblems; k++ )
+        {
+            const int departureIndex = ( firstGridPoint + k ) / numberOfArrivalTimes;
+            const int arrivalIndex = ( firstGridPoint + k ) % numberOfArrivalTimes;
+            deltaVs( departureIndex, arrivalIndex ) =
+                    ( velocitiesAtDeparture.col( k ) - departureBodyStates.block( 3, departureIndex, 3, 1 ) ).norm( ) +
+                    ( velocitiesAtArrival.col( k ) - arrivalBodyStates.block( 3, arrivalIndex, 3, 1 ) ).norm( );
+        }
+    }, numberOfThreads );
+
+    return deltaVs;
+}
+
+} // namespace mission_segments
+} // namespace tudat
@@ -0,0 +1,59 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_PORKCHOP_PLOT_H
+#define TUDAT_PORKCHOP_PLOT_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/parallelLoop.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Function to compute the Delta V of direct transfers on a grid of departure and arrival times (porkchop plot).
+/*!
+ * Function to compute the Delta V of direct (zero-revolution, prograde) transfers between two bodies on a grid of
+ * departure and arrival times, as used for porkchop plots and as a first stage of trajectory optimization. The Delta V
+ * of a transfer is the sum of the norms of the velocity differences w.r.t. the departure body at departure and w.r.t.
+ * the arrival body at arrival, with the transfer velocities computed by solveLambertProblemsIzzo. The states of the
+ * bodies are computed once per departure and arrival time (sequentially, so the state functions need not be
+ * thread-safe), after which the Lambert problems of all grid points are solved concurrently.
+ * \param departureBodyStateFunction Function returning the Cartesian state of the departure body, w.r.t. the central
+ * body, as a function of time.
+ * \param arrivalBodyStateFunction Function returning the Cartesian state of the arrival body, w.r.t. the central
+ * body, as a function of time.
+ * \param departureTimes Departure times of grid.
+ * \param arrivalTimes Arrival times of grid.
+ * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+ * \param numberOfThreads Maximum number of threads used to solve the Lambert problems.
+ * \return Delta V of transfers, with the departure time index as row index and the arrival time index as column
+ * index. Entries for which the arrival time does not exceed the departure time, or for which the Lambert problem could
+ * not be solved, are NaN.
+ */
+Eigen::MatrixXd computePorkchopPlotDeltaVs(
+        const std::function< Eigen::Vector6d( const double ) >& departureBodyStateFunction,
+        const std::function< Eigen::Vector6d( const double ) >& arrivalBodyStateFunction,
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& arrivalTimes,
+        const double centralBodyGravitationalParameter,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_PORKCHOP_PLOT_H
@@ -0,0 +1,214 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Propagators/batchAnalyticalOrbitPropagator.h"
+#include "Tudat/Astrodynamics/Propagators/batchCowellStateDerivative.h"
+#include "Tudat/Mathematics/BasicMathematics/basicMathematicsFunctions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace orbital_element_conversions;
+using namespace propagators;
+
+static const double earthGravitationalParameter = 3.986004418E14;
+static const double earthEquatorialRadius = 6378137.0;
+static const double earthJ2 = 1.0826E-3;
+
+//! Function to create the initial Keplerian states of a set of satellites in various elliptical orbits.
+Eigen::Matrix< double, 6, Eigen::Dynamic > getInitialKeplerianStates( const int numberOfSatellites )
+{
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStates( 6, numberOfSatellites );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        keplerianStates.col( i ) << 7.0E6 + 1.0E6 * ( i % 7 ), 0.02 + 0.05 * ( i % 5 ), 0.1 + 0.25 * ( i % 11 ),
+                0.5 * i, 1.0 + 0.3 * i, 0.7 * i;
+    }
+    return keplerianStates;
+}
+
+//! Function to compute the difference between two angles, in the range [-pi, pi).
+double computeAngleDifference( const double angle, const double referenceAngle )
+{
+    return basic_mathematics::computeModulo( angle - referenceAngle + mathematical_constants::PI,
+                                             2.0 * mathematical_constants::PI ) - mathematical_constants::PI;
+}
+
+BOOST_AUTO_TEST_SUITE( test_batch_analytical_orbit_propagation )
+
+//! Test whether Kepler propagation is consistent with the single-body Kepler propagator.
+BOOST_AUTO_TEST_CASE( testBatchKeplerPropagation )
+{
+    const int numberOfSatellites = 200;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialKeplerianStates = getInitialKeplerianStates( numberOfSatellites );
+
+    // Add a hyperbolic orbit.
+    initialKeplerianStates.col( 3 ) << -2.0E7, 1.5, 0.3, 1.0, 2.0, 0.4;
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialCartesianStates;
+    convertKeplerianToCartesianStates( initialKeplerianStates, earthGravitationalParameter, initialCartesianStates );
+
+    const double initialEpoch = 1.0E6;
+    BatchAnalyticalOrbitPropagator propagator(
+                initialCartesianStates, initialEpoch, earthGravitationalParameter );
+    BOOST_CHECK_EQUAL( propagator.getNumberOfBodies( ), numberOfSatellites );
+
+    std::vector< double > epochs = { initialEpoch + 3600.0, initialEpoch - 1800.0, initialEpoch + 86400.0 };
+    std::map< double, Eigen::VectorXd > cartesianStateHistory = propagator.propagateCartesianStates( epochs );
+    BOOST_CHECK_EQUAL( cartesianStateHistory.size( ), epochs.size( ) );
+
+    for( unsigned int j = 0; j < epochs.size( ); j++ )
+    {
+        BOOST_CHECK_EQUAL( cartesianStateHistory.count( epochs.at( j ) ), 1 );
+        Eigen::VectorXd concatenatedStates = cartesianStateHistory.at( epochs.at( j ) );
+        BOOST_CHECK_EQUAL( concatenatedStates.rows( ), 6 * numberOfSatellites );
+
+        for( int i = 0; i < numberOfSatellites; i++ )
+        {
+            Eigen::Vector6d expectedState = convertKeplerianToCartesianElements(
+                        propagateKeplerOrbit< double >(
+                            propagator.getInitialKeplerianStates( ).col( i ), epochs.at( j ) - initialEpoch,
+                            earthGravitationalParameter ), earthGravitationalParameter );
+            for( int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( concatenatedStates( 6 * i + k ) - expectedState( k ) ), 1.0E-4 );
+                BOOST_CHECK_SMALL( std::fabs( concatenatedStates( 6 * i + k + 3 ) - expectedState( k + 3 ) ), 1.0E-7 );
+            }
+        }
+    }
+
+    // Check whether the results are independent of the number of threads.
+    std::map< double, Eigen::VectorXd > singleThreadStateHistory = propagator.propagateCartesianStates( epochs, 1 );
+    std::map< double, Eigen::VectorXd > multiThreadStateHistory = propagator.propagateCartesianStates( epochs, 4 );
+    for( unsigned int j = 0; j < epochs.size( ); j++ )
+    {
+        BOOST_CHECK( singleThreadStateHistory.at( epochs.at( j ) ) == cartesianStateHistory.at( epochs.at( j ) ) );
+        BOOST_CHECK( multiThreadStateHistory.at( epochs.at( j ) ) == cartesianStateHistory.at( epochs.at( j ) ) );
+    }
+
+    // Check whether the initial states are recovered at the initial epoch.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    propagator.computeCartesianStates( initialEpoch, cartesianStates );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        for( int k = 0; k < 3; k++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( cartesianStates( k, i ) - initialCartesianStates( k, i ) ), 1.0E-6 );
+            BOOST_CHECK_SMALL( std::fabs( cartesianStates( k + 3, i ) - initialCartesianStates( k + 3, i ) ),
+                               1.0E-9 );
+        }
+    }
+}
+
+//! Test secular J2 rates for a sun-synchronous orbit, and w.r.t. a numerical propagation of the J2 dynamics.
+BOOST_AUTO_TEST_CASE( testBatchJ2Propagation )
+{
+    // Check nodal precession of a sun-synchronous orbit (Vallado, 2013, Example 9-4 uses a = 7346.846 km).
+    {
+        const double semiMajorAxis = 7078.0E3;
+        const double inclination = 98.19 * mathematical_constants::PI / 180.0;
+        Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianState( 6, 1 );
+        keplerianState << semiMajorAxis, 1.0E-3, inclination, 0.5, 1.0, 0.0;
+        Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianState;
+        convertKeplerianToCartesianStates( keplerianState, earthGravitationalParameter, cartesianState );
+
+        BatchAnalyticalOrbitPropagator propagator(
+                    cartesianState, 0.0, earthGravitationalParameter, earthEquatorialRadius, earthJ2 );
+        BOOST_CHECK_CLOSE_FRACTION(
+                    propagator.getLongitudeOfAscendingNodeRates( )( 0 ),
+                    2.0 * mathematical_constants::PI / physical_constants::SIDEREAL_YEAR, 5.0E-3 );
+    }
+
+    // Compare drift of node and argument of periapsis with numerical propagation.
+    const int numberOfSatellites = 6;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialKeplerianStates = getInitialKeplerianStates( numberOfSatellites );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialCartesianStates;
+    convertKeplerianToCartesianStates( initialKeplerianStates, earthGravitationalParameter, initialCartesianStates );
+
+    const double propagationTime = 10.0 * 86400.0;
+    BatchAnalyticalOrbitPropagator propagator(
+                initialCartesianStates, 0.0, earthGravitationalParameter, earthEquatorialRadius, earthJ2 );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > analyticalFinalStates;
+    propagator.computeKeplerianStates( propagationTime, analyticalFinalStates );
+
+    BatchCowellStateDerivative stateDerivative(
+                earthGravitationalParameter, earthEquatorialRadius, earthJ2, 0.0, 0.0,
+                std::vector< double >( ), std::vector< std::function< Eigen::Vector3d( const double ) > >( ) );
+    numerical_integrators::BatchRungeKuttaVariableStepSizeIntegrator integrator(
+                numerical_integrators::RungeKuttaCoefficients::get(
+                    numerical_integrators::RungeKuttaCoefficients::rungeKuttaFehlberg78 ),
+                stateDerivative.getStateDerivativeFunction( ), 0.0,
+                initialCartesianStates.transpose( ).array( ), 10.0,
+                std::numeric_limits< double >::epsilon( ), 3600.0, 1.0E-12, 1.0E-12 );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > numericalFinalStates =
+            integrator.integrateTo( propagationTime ).transpose( ).matrix( );
+    convertCartesianToKeplerianStates( numericalFinalStates, earthGravitationalParameter, numericalFinalStates );
+
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        // Secular drift of the node is (much) larger than its short-period variations over the propagation time. The
+        // short-period variations of the argument of periapsis scale with J2 / e, and are added to its tolerance.
+        const double analyticalNodeDrift = propagator.getLongitudeOfAscendingNodeRates( )( i ) * propagationTime;
+        const double analyticalPeriapsisDrift = propagator.getArgumentOfPeriapsisRates( )( i ) * propagationTime;
+        BOOST_CHECK_SMALL( computeAngleDifference(
+                               analyticalFinalStates( longitudeOfAscendingNodeIndex, i ),
+                               numericalFinalStates( longitudeOfAscendingNodeIndex, i ) ),
+                           0.02 * std::fabs( analyticalNodeDrift ) );
+        BOOST_CHECK_SMALL( computeAngleDifference(
+                               analyticalFinalStates( argumentOfPeriapsisIndex, i ),
+                               numericalFinalStates( argumentOfPeriapsisIndex, i ) ),
+                           0.02 * std::fabs( analyticalPeriapsisDrift ) +
+                           earthJ2 / initialKeplerianStates( eccentricityIndex, i ) );
+
+        // Shape and orientation of the orbit are constant.
+        BOOST_CHECK_EQUAL( analyticalFinalStates( semiMajorAxisIndex, i ),
+                           propagator.getInitialKeplerianStates( )( semiMajorAxisIndex, i ) );
+        BOOST_CHECK_EQUAL( analyticalFinalStates( eccentricityIndex, i ),
+                           propagator.getInitialKeplerianStates( )( eccentricityIndex, i ) );
+        BOOST_CHECK_EQUAL( analyticalFinalStates( inclinationIndex, i ),
+                           propagator.getInitialKeplerianStates( )( inclinationIndex, i ) );
+    }
+}
+
+//! Test whether unsupported orbits are rejected.
+BOOST_AUTO_TEST_CASE( testBatchAnalyticalPropagationErrors )
+{
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStates = getInitialKeplerianStates( 2 );
+    keplerianStates.col( 1 ) << -2.0E7, 1.5, 0.3, 1.0, 2.0, 0.4;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    convertKeplerianToCartesianStates( keplerianStates, earthGravitationalParameter, cartesianStates );
+
+    BOOST_CHECK_NO_THROW( BatchAnalyticalOrbitPropagator(
+                              cartesianStates, 0.0, earthGravitationalParameter ) );
+    BOOST_CHECK_THROW( BatchAnalyticalOrbitPropagator(
+                           cartesianStates, 0.0, earthGravitationalParameter, earthEquatorialRadius, earthJ2 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,201 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Gravitation/centralJ2J3J4GravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Propagators/batchCowellStateDerivative.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace propagators;
+
+static const double earthGravitationalParameter = 3.986004418E14;
+static const double earthEquatorialRadius = 6378137.0;
+static const double earthJ2 = 1.0826E-3;
+static const double earthJ3 = -2.532E-6;
+static const double earthJ4 = -1.6199E-6;
+static const double moonGravitationalParameter = 4.9028E12;
+
+//! Function to compute an (approximate) circular, inclined orbit of the Moon w.r.t. the Earth.
+Eigen::Vector3d getMoonPosition( const double time )
+{
+    const double moonOrbitRadius = 3.844E8;
+    const double moonMeanMotion = 2.0 * mathematical_constants::PI / ( 27.32 * 86400.0 );
+    const double moonInclination = 5.0 * mathematical_constants::PI / 180.0;
+    return ( Eigen::Vector3d( ) <<
+             moonOrbitRadius * std::cos( moonMeanMotion * time ),
+             moonOrbitRadius * std::sin( moonMeanMotion * time ) * std::cos( moonInclination ),
+             moonOrbitRadius * std::sin( moonMeanMotion * time ) * std::sin( moonInclination ) ).finished( );
+}
+
+//! Function to compute the state derivative of a single satellite, using the single-body acceleration functions.
+Eigen::VectorXd computeSingleSatelliteStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    Eigen::Vector3d position = state.segment( 0, 3 );
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) =
+            gravitation::computeGravitationalAcceleration( position, earthGravitationalParameter ) +
+            gravitation::computeGravitationalAccelerationDueToJ2(
+                position, earthGravitationalParameter, earthEquatorialRadius, earthJ2, Eigen::Vector3d::Zero( ) ) +
+            gravitation::computeGravitationalAccelerationDueToJ3(
+                position, earthGravitationalParameter, earthEquatorialRadius, earthJ3, Eigen::Vector3d::Zero( ) ) +
+            gravitation::computeGravitationalAccelerationDueToJ4(
+                position, earthGravitationalParameter, earthEquatorialRadius, earthJ4, Eigen::Vector3d::Zero( ) ) +
+            gravitation::computeThirdBodyPerturbingAcceleration(
+                moonGravitationalParameter, getMoonPosition( time ), position );
+    return stateDerivative;
+}
+
+//! Function to create the initial states of a set of satellites in various orbits.
+Eigen::ArrayXXd getInitialStates( const int numberOfSatellites )
+{
+    Eigen::ArrayXXd initialStates( numberOfSatellites, 6 );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        Eigen::Vector6d keplerianElements;
+        keplerianElements << 7.0E6 + 2.0E6 * i, 0.01 + 0.02 * ( i % 5 ), 0.2 * i, 0.5 * i, 1.0 + 0.3 * i, 0.7 * i;
+        initialStates.row( i ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    keplerianElements, earthGravitationalParameter ).transpose( ).array( );
+    }
+    return initialStates;
+}
+
+BOOST_AUTO_TEST_SUITE( test_batch_cowell_propagation )
+
+//! Test whether vectorized state derivatives are consistent with single-body acceleration functions
+BOOST_AUTO_TEST_CASE( testBatchCowellStateDerivative )
+{
+    const int numberOfSatellites = 12;
+    Eigen::ArrayXXd states = getInitialStates( numberOfSatellites );
+    Eigen::ArrayXd times( numberOfSatellites );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        times( i ) = 1000.0 * static_cast< double >( i / 3 );
+    }
+
+    BatchCowellStateDerivative batchStateDerivative(
+                earthGravitationalParameter, earthEquatorialRadius, earthJ2, earthJ3, earthJ4,
+    { moonGravitationalParameter }, { &getMoonPosition } );
+    Eigen::ArrayXXd stateDerivatives;
+    batchStateDerivative.computeStateDerivatives( times, states, stateDerivatives );
+
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        Eigen::VectorXd expectedStateDerivative = computeSingleSatelliteStateDerivative(
+                    times( i ), states.row( i ).transpose( ).matrix( ) );
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( stateDerivatives( i, j ), expectedStateDerivative( j ),
+                                        1.0E-14 );
+        }
+    }
+}
+
+//! Test whether batch integration is consistent with integration of each satellite separately.
+BOOST_AUTO_TEST_CASE( testBatchRungeKuttaIntegration )
+{
+    const int numberOfSatellites = 12;
+    const double initialTime = 0.0;
+    const double finalTime = 86400.0;
+    const double initialStepSize = 10.0;
+    Eigen::ArrayXXd initialStates = getInitialStates( numberOfSatellites );
+
+    RungeKuttaCoefficients coefficients =
+            RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg78 );
+
+    BatchCowellStateDerivative batchStateDerivative(
+                earthGravitationalParameter, earthEquatorialRadius, earthJ2, earthJ3, earthJ4,
+    { moonGravitationalParameter }, { &getMoonPosition } );
+
+    // Test variable and fixed step size integration
+    for( int testCase = 0; testCase < 2; testCase++ )
+    {
+        bool useStepSizeControl = ( testCase == 0 );
+
+        BatchRungeKuttaVariableStepSizeIntegrator batchIntegrator(
+                    coefficients, batchStateDerivative.getStateDerivativeFunction( ), initialTime, initialStates,
+                    initialStepSize, std::numeric_limits< double >::epsilon( ), 3600.0, 1.0E-10, 1.0E-10 );
+        batchIntegrator.setStepSizeControl( useStepSizeControl );
+        Eigen::ArrayXXd batchFinalStates = batchIntegrator.integrateTo( finalTime );
+
+        // Check whether all satellites are at the final time
+        for( int i = 0; i < numberOfSatellites; i++ )
+        {
+            BOOST_CHECK_EQUAL( batchIntegrator.getCurrentIndependentVariables( )( i ), finalTime );
+        }
+
+        int numberOfSingleSatelliteSteps = 0;
+        for( int i = 0; i < numberOfSatellites; i++ )
+        {
+            RungeKuttaVariableStepSizeIntegrator< double, Eigen::VectorXd > singleSatelliteIntegrator(
+                        coefficients, &computeSingleSatelliteStateDerivative, initialTime,
+                        initialStates.row( i ).transpose( ).matrix( ),
+                        std::numeric_limits< double >::epsilon( ), 3600.0, 1.0E-10, 1.0E-10 );
+            singleSatelliteIntegrator.setStepSizeControl( useStepSizeControl );
+
+            double stepSize = initialStepSize;
+            while( singleSatelliteIntegrator.getCurrentIndependentVariable( ) < finalTime )
+            {
+                stepSize = std::min( stepSize, finalTime - singleSatelliteIntegrator.getCurrentIndependentVariable( ) );
+                double previousTime = singleSatelliteIntegrator.getCurrentIndependentVariable( );
+                singleSatelliteIntegrator.performIntegrationStep( stepSize );
+                stepSize = singleSatelliteIntegrator.getNextStepSize( );
+                if( singleSatelliteIntegrator.getCurrentIndependentVariable( ) != previousTime )
+                {
+                    numberOfSingleSatelliteSteps++;
+                }
+            }
+
+            Eigen::VectorXd singleSatelliteFinalState = singleSatelliteIntegrator.getCurrentState( );
+
+            // Results differ only due to order of floating point operations (and resulting differences in step sizes).
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( batchFinalStates( i, j ) - singleSatelliteFinalState( j ) ),
+                                   useStepSizeControl ? 1.0E-3 : 1.0E-4 );
+                BOOST_CHECK_SMALL( std::fabs( batchFinalStates( i, j + 3 ) - singleSatelliteFinalState( j + 3 ) ),
+                                   useStepSizeControl ? 1.0E-6 : 1.0E-7 );
+            }
+        }
+
+        // Check number of steps (identical in case of fixed step)
+        if( !useStepSizeControl )
+        {
+            BOOST_CHECK_EQUAL( batchIntegrator.getNumberOfAcceptedSteps( ), numberOfSingleSatelliteSteps );
+        }
+        else
+        {
+            BOOST_CHECK_SMALL( std::fabs( static_cast< double >(
+                                              batchIntegrator.getNumberOfAcceptedSteps( ) - numberOfSingleSatelliteSteps ) ),
+                               0.01 * numberOfSingleSatelliteSteps );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -34,6 +34,28 @@ namespace unit_tests
 
 using namespace tudat;
 
+//! Function to check whether the results of two full propagations of a patched conics trajectory are identical.
+template< typename StateType >
+void checkPatchedConicsResultsAreIdentical(
+        const std::map< int, std::map< double, StateType > >& expectedResults,
+        const std::map< int, std::map< double, StateType > >& computedResults )
+{
+    BOOST_CHECK_EQUAL( computedResults.size( ), expectedResults.size( ) );
+    for( auto legIterator : expectedResults )
+    {
+        BOOST_CHECK_EQUAL( computedResults.at( legIterator.first ).size( ), legIterator.second.size( ) );
+        for( auto stateIterator : legIterator.second )
+        {
+            const StateType& computedState = computedResults.at( legIterator.first ).at( stateIterator.first );
+            BOOST_CHECK_EQUAL( computedState.rows( ), stateIterator.second.rows( ) );
+            for( int i = 0; i < stateIterator.second.rows( ); i++ )
+            {
+                BOOST_CHECK_EQUAL( computedState( i ), stateIterator.second( i ) );
+            }
+        }
+    }
+}
+
 //! Test of the full propagation of a trajectory
 BOOST_AUTO_TEST_SUITE( testFullPropagationTrajectory )
 
@@ -159,6 +181,36 @@ BOOST_AUTO_TEST_CASE( testFullPropagationMGA )
                 semiMajorAxes, eccentricities, integratorSettings, patchedConicsResultForEachLeg, fullProblemResultForEachLeg,
                 dependentVariableResultForEachLeg, static_cast< bool >( terminationType ) );
 
+        // Check that the concurrent propagation of all legs gives identical results, with the ephemerides of the transfer
+        // bodies shared between the environments of all threads.
+        for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            std::map< int, std::map< double, Eigen::Vector6d > > concurrentPatchedConicsResultForEachLeg;
+            std::map< int, std::map< double, Eigen::Vector6d > > concurrentFullProblemResultForEachLeg;
+            std::map< int, std::map< double, Eigen::VectorXd > > concurrentDependentVariableResultForEachLeg;
+
+            propagators::fullPropagationPatchedConicsTrajectory(
+                        [ & ]( )
+            {
+                return propagators::setupBodyMapFromUserDefinedEphemeridesForPatchedConicsTrajectory(
+                            centralBody[0], bodyToPropagate, nameBodiesTrajectory, ephemerisVectorTransferBodies,
+                        gravitationalParametersTransferBodies, "ECLIPJ2000" );
+            },
+            [ & ]( const simulation_setup::NamedBodyMap& currentBodyMap )
+            {
+                return propagators::setupAccelerationMapPatchedConicsTrajectory(
+                            nameBodiesTrajectory.size( ), centralBody[0], bodyToPropagate, currentBodyMap );
+            }, nameBodiesTrajectory, centralBody[0], bodyToPropagate, legTypeVector, variableVector, minimumPericenterRadii,
+            semiMajorAxes, eccentricities, integratorSettings, concurrentPatchedConicsResultForEachLeg,
+            concurrentFullProblemResultForEachLeg, concurrentDependentVariableResultForEachLeg, numberOfThreads,
+            static_cast< bool >( terminationType ) );
+
+            checkPatchedConicsResultsAreIdentical( patchedConicsResultForEachLeg, concurrentPatchedConicsResultForEachLeg );
+            checkPatchedConicsResultsAreIdentical( fullProblemResultForEachLeg, concurrentFullProblemResultForEachLeg );
+            checkPatchedConicsResultsAreIdentical(
+                        dependentVariableResultForEachLeg, concurrentDependentVariableResultForEachLeg );
+        }
+
         for( auto itr : patchedConicsResultForEachLeg )
         {
             for( auto innerItr : itr.second )
@@ -338,6 +390,34 @@ BOOST_AUTO_TEST_CASE( testFullPropagationMGAwithDSM )
                 fullProblemResultForEachLeg, dependentVariableResultForEachLeg,
                 static_cast< bool >( terminationType ) );
 
+        // Check that the concurrent propagation of all legs gives identical results.
+        for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            std::map< int, std::map< double, Eigen::Vector6d > > concurrentPatchedConicsResultForEachLeg;
+            std::map< int, std::map< double, Eigen::Vector6d > > concurrentFullProblemResultForEachLeg;
+            std::map< int, std::map< double, Eigen::VectorXd > > concurrentDependentVariableResultForEachLeg;
+
+            propagators::fullPropagationPatchedConicsTrajectory(
+                        [ & ]( )
+            {
+                return propagators::setupBodyMapFromEphemeridesForPatchedConicsTrajectory(
+                            centralBody[0], bodyToPropagate, transferBodyTrajectory );
+            },
+            [ & ]( const simulation_setup::NamedBodyMap& currentBodyMap )
+            {
+                return propagators::setupAccelerationMapPatchedConicsTrajectory(
+                            transferBodyTrajectory.size( ), centralBody[0], bodyToPropagate, currentBodyMap );
+            }, transferBodyTrajectory, centralBody[0], bodyToPropagate, legTypeVector, variableVector, minimumPericenterRadii,
+            semiMajorAxes, eccentricities, integratorSettings, concurrentPatchedConicsResultForEachLeg,
+            concurrentFullProblemResultForEachLeg, concurrentDependentVariableResultForEachLeg, numberOfThreads,
+            static_cast< bool >( terminationType ) );
+
+            checkPatchedConicsResultsAreIdentical( patchedConicsResultForEachLeg, concurrentPatchedConicsResultForEachLeg );
+            checkPatchedConicsResultsAreIdentical( fullProblemResultForEachLeg, concurrentFullProblemResultForEachLeg );
+            checkPatchedConicsResultsAreIdentical(
+                        dependentVariableResultForEachLeg, concurrentDependentVariableResultForEachLeg );
+        }
+
         for( auto itr : patchedConicsResultForEachLeg )
         {
             for( auto innerItr : itr.second )
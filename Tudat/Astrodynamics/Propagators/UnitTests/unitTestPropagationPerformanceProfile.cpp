@@ -0,0 +1,152 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::simulation_setup;
+using namespace tudat::numerical_integrators;
+using namespace tudat::utilities;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_performance_profile )
+
+//! Function to retrieve the profiling results of a component with given type and name.
+ProfiledComponentSummary getComponentSummary(
+        const std::shared_ptr< PerformanceProfiler > profiler, const ProfiledComponentType componentType,
+        const std::string& componentName )
+{
+    std::vector< ProfiledComponentSummary > summary = profiler->getSummary( );
+    for( unsigned int i = 0; i < summary.size( ); i++ )
+    {
+        if( summary.at( i ).componentType == componentType && summary.at( i ).componentName == componentName )
+        {
+            return summary.at( i );
+        }
+    }
+    throw std::runtime_error( "Error in profiling test, component " + componentName + " not found." );
+}
+
+//! Test whether the individual components of a propagation are profiled consistently.
+BOOST_AUTO_TEST_CASE( testPropagationPerformanceProfile )
+{
+    // Create bodies, with constant ephemerides.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = std::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+
+    Eigen::Vector6d moonState = Eigen::Vector6d::Zero( );
+    moonState( 0 ) = 3.844E8;
+    bodyMap[ "Moon" ] = std::make_shared< Body >( );
+    bodyMap[ "Moon" ]->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                         moonState, "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Moon" ]->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >( 4.9028E12 ) );
+
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create accelerations.
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    accelerationSettingsMap[ "Vehicle" ][ "Moon" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::map< std::string, std::string > centralBodies;
+    centralBodies[ "Vehicle" ] = "Earth";
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, centralBodies );
+
+    // Create propagation settings, with profiling and dependent variables.
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState( 0 ) = 7.0E6;
+    initialState( 4 ) = 7.5E3;
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back(
+                std::make_shared< SingleDependentVariableSaveSettings >(
+                    total_acceleration_dependent_variable, "Vehicle" ) );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                std::vector< std::string >{ "Earth" }, accelerationModelMap, std::vector< std::string >{ "Vehicle" },
+                initialState, 3600.0, cowell,
+                std::make_shared< DependentVariableSaveSettings >( dependentVariables, false ) );
+    propagatorSettings->setPerformanceProfiling( true, false );
+
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+
+    // Propagate twice, to check that profile is reset for each propagation.
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    BOOST_CHECK( dynamicsSimulator.getPerformanceProfiler( ) != nullptr );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+
+        std::shared_ptr< PerformanceProfiler > profiler = dynamicsSimulator.getPerformanceProfiler( );
+        ProfiledComponentSummary stateDerivativeSummary = getComponentSummary(
+                    profiler, state_derivative_profiled_component, "full state derivative" );
+
+        // Each state derivative evaluation contains a single evaluation of each acceleration and environment update.
+        unsigned int numberOfFunctionEvaluations = dynamicsSimulator.getDynamicsStateDerivative( )->
+                getNumberOfFunctionEvaluations( );
+        BOOST_CHECK_EQUAL( stateDerivativeSummary.numberOfCalls, numberOfFunctionEvaluations );
+        BOOST_CHECK_EQUAL( getComponentSummary(
+                               profiler, acceleration_model_profiled_component,
+                               "central gravity on Vehicle by Earth" ).numberOfCalls,
+                           numberOfFunctionEvaluations );
+        BOOST_CHECK_EQUAL( getComponentSummary(
+                               profiler, acceleration_model_profiled_component,
+                               "third-body central gravity on Vehicle by Moon" ).numberOfCalls,
+                           numberOfFunctionEvaluations );
+        BOOST_CHECK_EQUAL( getComponentSummary(
+                               profiler, environment_update_profiled_component,
+                               "translational state of Moon" ).numberOfCalls,
+                           numberOfFunctionEvaluations );
+
+        // Dependent variables are evaluated once per saved state.
+        BOOST_CHECK_EQUAL( getComponentSummary(
+                               profiler, dependent_variable_profiled_component,
+                               "all dependent variables" ).numberOfCalls,
+                           dynamicsSimulator.getDependentVariableHistory( ).size( ) );
+
+        // Check consistency of nested timings.
+        BOOST_CHECK( profiler->getTotalTime( acceleration_model_profiled_component ) +
+                     profiler->getTotalTime( environment_update_profiled_component ) <=
+                     stateDerivativeSummary.totalTime );
+        ProfiledComponentSummary overheadSummary = getComponentSummary(
+                    profiler, integrator_overhead_profiled_component, "integrator and propagation loop" );
+        BOOST_CHECK_EQUAL( overheadSummary.numberOfCalls, 1 );
+        BOOST_CHECK( overheadSummary.totalTime > 0.0 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
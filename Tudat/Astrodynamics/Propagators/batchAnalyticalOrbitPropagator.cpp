@@ -0,0 +1,214 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Astrodynamics/Propagators/batchAnalyticalOrbitPropagator.h"
+#include "Tudat/Mathematics/BasicMathematics/basicMathematicsFunctions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+using namespace orbital_element_conversions;
+
+//! Constructor.
+BatchAnalyticalOrbitPropagator::BatchAnalyticalOrbitPropagator(
+        const Eigen::Matrix< double, 6, Eigen::Dynamic >& initialCartesianStates,
+        const double initialEpoch,
+        const double centralBodyGravitationalParameter,
+        const double centralBodyEquatorialRadius,
+        const double j2Coefficient,
+        const int numberOfThreads ):
+    initialEpoch_( initialEpoch ),
+    centralBodyGravitationalParameter_( centralBodyGravitationalParameter )
+{
+    convertCartesianToKeplerianStates(
+                initialCartesianStates, centralBodyGravitationalParameter, initialKeplerianStates_, numberOfThreads );
+
+    const int numberOfBodies = getNumberOfBodies( );
+    initialMeanAnomalies_.setZero( numberOfBodies );
+    meanAnomalyRates_.setZero( numberOfBodies );
+    argumentOfPeriapsisRates_.setZero( numberOfBodies );
+    longitudeOfAscendingNodeRates_.setZero( numberOfBodies );
+
+    for( int i = 0; i < numberOfBodies; i++ )
+    {
+        const double semiMajorAxis = initialKeplerianStates_( semiMajorAxisIndex, i );
+        const double eccentricity = initialKeplerianStates_( eccentricityIndex, i );
+
+        if( eccentricity > 1.0 && j2Coefficient == 0.0 )
+        {
+            hyperbolicOrbitIndices_.push_back( i );
+        }
+        else if( !( eccentricity < 1.0 ) )
+        {
+            throw std::runtime_error(
+                        "Error in batch analytical orbit propagation, eccentricity of body " + std::to_string( i ) +
+                        " is " + std::to_string( eccentricity ) + "; only elliptical orbits are supported" +
+                        ( ( j2Coefficient == 0.0 ) ? " (and hyperbolic orbits)." : " for J2 propagation." ) );
+        }
+        else
+        {
+            initialMeanAnomalies_( i ) = convertEllipticalEccentricAnomalyToMeanAnomaly(
+                        convertTrueAnomalyToEllipticalEccentricAnomaly(
+                            initialKeplerianStates_( trueAnomalyIndex, i ), eccentricity ), eccentricity );
+
+            // Compute secular rates due to J2 (Vallado, 2013, Eqs. 9-41).
+            const double meanMotion = std::sqrt( centralBodyGravitationalParameter / (
+                                                     semiMajorAxis * semiMajorAxis * semiMajorAxis ) );
+            const double semiLatusRectum = semiMajorAxis * ( 1.0 - eccentricity * eccentricity );
+            const double j2RateFactor = 1.5 * j2Coefficient * meanMotion *
+                    ( centralBodyEquatorialRadius * centralBodyEquatorialRadius ) /
+                    ( semiLatusRectum * semiLatusRectum );
+            const double cosineOfInclination = std::cos( initialKeplerianStates_( inclinationIndex, i ) );
+            const double squaredSineOfInclination = 1.0 - cosineOfInclination * cosineOfInclination;
+
+            meanAnomalyRates_( i ) = meanMotion + j2RateFactor * std::sqrt( 1.0 - eccentricity * eccentricity ) *
+                    ( 1.0 - 1.5 * squaredSineOfInclination );
+            argumentOfPeriapsisRates_( i ) = j2RateFactor * ( 2.0 - 2.5 * squaredSineOfInclination );
+            longitudeOfAscendingNodeRates_( i ) = -j2RateFactor * cosineOfInclination;
+        }
+    }
+}
+
+//! Function to compute the Keplerian states of all bodies at a given epoch.
+void BatchAnalyticalOrbitPropagator::computeKeplerianStates(
+        const double epoch, Eigen::Matrix< double, 6, Eigen::Dynamic >& keplerianStates,
+        const int numberOfThreads ) const
+{
+    const double twoPi = 2.0 * mathematical_constants::PI;
+    const double timeSinceInitialEpoch = epoch - initialEpoch_;
+    const int numberOfBodies = getNumberOfBodies( );
+    keplerianStates.resize( 6, numberOfBodies );
+
+    // Propagate elliptical orbits, using the secular rates of the angles.
+    const int numberOfBlocks = ( numberOfBodies + numberOfStatesPerConversionBlock - 1 ) /
+            numberOfStatesPerConversionBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int lastBody = std::min( ( blockIndex + 1 ) * numberOfStatesPerConversionBlock, numberOfBodies );
+        for( int i = blockIndex * numberOfStatesPerConversionBlock; i < lastBody; i++ )
+        {
+            const double eccentricity = initialKeplerianStates_( eccentricityIndex, i );
+            if( eccentricity < 1.0 )
+            {
+                const double eccentricAnomaly = solveKeplersEquationForEllipticalOrbits(
+                            eccentricity, basic_mathematics::computeModulo(
+                                initialMeanAnomalies_( i ) + meanAnomalyRates_( i ) * timeSinceInitialEpoch,
+                                twoPi ) );
+
+                keplerianStates( semiMajorAxisIndex, i ) = initialKeplerianStates_( semiMajorAxisIndex, i );
+                keplerianStates( eccentricityIndex, i ) = eccentricity;
+                keplerianStates( inclinationIndex, i ) = initialKeplerianStates_( inclinationIndex, i );
+                keplerianStates( argumentOfPeriapsisIndex, i ) = basic_mathematics::computeModulo(
+                            initialKeplerianStates_( argumentOfPeriapsisIndex, i ) +
+                            argumentOfPeriapsisRates_( i ) * timeSinceInitialEpoch, twoPi );
+                keplerianStates( longitudeOfAscendingNodeIndex, i ) = basic_mathematics::computeModulo(
+                            initialKeplerianStates_( longitudeOfAscendingNodeIndex, i ) +
+                            longitudeOfAscendingNodeRates_( i ) * timeSinceInitialEpoch, twoPi );
+                keplerianStates( trueAnomalyIndex, i ) = basic_mathematics::computeModulo(
+                            std::atan2( std::sqrt( 1.0 - eccentricity * eccentricity ) *
+                                        std::sin( eccentricAnomaly ), std::cos( eccentricAnomaly ) - eccentricity ),
+                            twoPi );
+            }
+        }
+    }, getNumberOfThreadsForStateConversion( numberOfBodies, numberOfThreads ) );
+
+    // Propagate hyperbolic orbits.
+    for( unsigned int i = 0; i < hyperbolicOrbitIndices_.size( ); i++ )
+    {
+        const int bodyIndex = hyperbolicOrbitIndices_.at( i );
+        keplerianStates.col( bodyIndex ) = propagateKeplerOrbit< double >(
+                    initialKeplerianStates_.col( bodyIndex ), timeSinceInitialEpoch,
+                    centralBodyGravitationalParameter_ );
+    }
+}
+
+//! Function to compute the Cartesian states of all bodies at a given epoch.
+void BatchAnalyticalOrbitPropagator::computeCartesianStates(
+        const double epoch, Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+        const int numberOfThreads ) const
+{
+    computeKeplerianStates( epoch, cartesianStates, numberOfThreads );
+    convertKeplerianToCartesianStates(
+                cartesianStates, centralBodyGravitationalParameter_, cartesianStates, numberOfThreads );
+}
+
+//! Function to propagate the Cartesian states of all bodies to a set of epochs.
+std::map< double, Eigen::VectorXd > BatchAnalyticalOrbitPropagator::propagateCartesianStates(
+        const std::vector< double >& epochs, const int numberOfThreads ) const
+{
+    return propagateStates( epochs, true, numberOfThreads );
+}
+
+//! Function to propagate the Keplerian states of all bodies to a set of epochs.
+std::map< double, Eigen::VectorXd > BatchAnalyticalOrbitPropagator::propagateKeplerianStates(
+        const std::vector< double >& epochs, const int numberOfThreads ) const
+{
+    return propagateStates( epochs, false, numberOfThreads );
+}
+
+//! Function to propagate the states of all bodies to a set of epochs.
+std::map< double, Eigen::VectorXd > BatchAnalyticalOrbitPropagator::propagateStates(
+        const std::vector< double >& epochs, const bool useCartesianStates, const int numberOfThreads ) const
+{
+    // Create output entries sequentially, so that they can be filled concurrently.
+    std::map< double, Eigen::VectorXd > stateHistory;
+    for( unsigned int i = 0; i < epochs.size( ); i++ )
+    {
+        stateHistory[ epochs.at( i ) ];
+    }
+
+    std::vector< double > uniqueEpochs;
+    std::vector< Eigen::VectorXd* > outputStates;
+    for( auto& stateIterator : stateHistory )
+    {
+        stateIterator.second.resize( 6 * getNumberOfBodies( ) );
+        uniqueEpochs.push_back( stateIterator.first );
+        outputStates.push_back( &stateIterator.second );
+    }
+
+    // Compute states at each epoch, distributing the epochs over the threads (or the bodies, if there are fewer
+    // epochs than threads).
+    const int numberOfEpochs = static_cast< int >( uniqueEpochs.size( ) );
+    const int numberOfThreadsPerEpoch = ( numberOfEpochs < numberOfThreads ) ? numberOfThreads : 1;
+    utilities::executeParallelLoop( numberOfEpochs, [ & ]( const int epochIndex )
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > states;
+        if( useCartesianStates )
+        {
+            computeCartesianStates( uniqueEpochs.at( epochIndex ), states, numberOfThreadsPerEpoch );
+        }
+        else
+        {
+            computeKeplerianStates( uniqueEpochs.at( epochIndex ), states, numberOfThreadsPerEpoch );
+        }
+        *outputStates.at( epochIndex ) = Eigen::Map< const Eigen::VectorXd >( states.data( ), states.size( ) );
+    }, numberOfThreads );
+
+    return stateHistory;
+}
+
+} // namespace propagators
+
+} // namespace tudat
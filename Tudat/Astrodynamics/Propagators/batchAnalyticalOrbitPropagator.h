@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Vallado, D.A. Fundamentals of Astrodynamics and Applications, 4th edition, Microcosm Press, 2013.
+ *
+ */
+
+#ifndef TUDAT_BATCH_ANALYTICAL_ORBIT_PROPAGATOR_H
+#define TUDAT_BATCH_ANALYTICAL_ORBIT_PROPAGATOR_H
+
+#include <map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelLoop.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Analytical propagator for the orbits of a batch of bodies, subject to central body and secular J2 effects.
+/*!
+ *  Analytical propagator for the orbits of a batch of bodies about a single central body, without numerical
+ *  integration or environment updates. The orbits are propagated either as unperturbed Kepler orbits, or with the
+ *  first-order secular J2 drift of the mean anomaly, argument of periapsis and longitude of the ascending node
+ *  (Vallado, 2013, Section 9.6). In the latter case, the initial osculating elements are used as mean elements, so
+ *  that the short-period J2 effects are neglected. The propagator is intended for screening applications (e.g.
+ *  coverage or conjunction screening) with large numbers of bodies and epochs, of which the results are subsequently
+ *  refined with a numerical propagation using the full dynamics.
+ *
+ *  States are stored and returned as the columns of a 6xN matrix (one column per body, see
+ *  batchOrbitalElementConversions.h), and state histories are returned in the same form as the numerical solution of a
+ *  SingleArcDynamicsSimulator: a map with the concatenated states of all bodies as a function of time.
+ *  Elliptical orbits are propagated using the direct solution of Kepler's equation. Hyperbolic orbits are supported
+ *  for Kepler propagation only, and are propagated using propagateKeplerOrbit.
+ */
+class BatchAnalyticalOrbitPropagator
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor, converts the initial states to Keplerian elements and computes the secular rates of the
+     *  elements. For a J2-coefficient of zero (default), the orbits are propagated as unperturbed Kepler orbits.
+     *  \param initialCartesianStates Cartesian states of the bodies w.r.t. the central body at the initial epoch, in
+     *  an inertial frame of which the z-axis is aligned with the central body's rotation axis (one column per body).
+     *  \param initialEpoch Epoch at which the initial states are defined.
+     *  \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     *  \param centralBodyEquatorialRadius Equatorial radius of the central body, in formulation of its J2-coefficient.
+     *  \param j2Coefficient J2-coefficient (unnormalized) of the central body's gravity field.
+     *  \param numberOfThreads Maximum number of threads used for the conversion of the initial states.
+     */
+    BatchAnalyticalOrbitPropagator(
+            const Eigen::Matrix< double, 6, Eigen::Dynamic >& initialCartesianStates,
+            const double initialEpoch,
+            const double centralBodyGravitationalParameter,
+            const double centralBodyEquatorialRadius = 0.0,
+            const double j2Coefficient = 0.0,
+            const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+    //! Function to compute the Keplerian states of all bodies at a given epoch.
+    /*!
+     *  Function to compute the Keplerian states of all bodies at a given epoch, with all angles in the range
+     *  [0, 2 pi) (true anomalies of hyperbolic orbits in the range (-pi, pi]).
+     *  \param epoch Epoch at which the states are to be computed.
+     *  \param keplerianStates Keplerian states of all bodies, one per column (returned by reference, resized if
+     *  needed).
+     *  \param numberOfThreads Maximum number of threads used for the computation.
+     */
+    void computeKeplerianStates( const double epoch, Eigen::Matrix< double, 6, Eigen::Dynamic >& keplerianStates,
+                                 const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+    //! Function to compute the Cartesian states of all bodies at a given epoch.
+    /*!
+     *  Function to compute the Cartesian states of all bodies w.r.t. the central body at a given epoch.
+     *  \param epoch Epoch at which the states are to be computed.
+     *  \param cartesianStates Cartesian states of all bodies, one per column (returned by reference, resized if
+     *  needed).
+     *  \param numberOfThreads Maximum number of threads used for the computation.
+     */
+    void computeCartesianStates( const double epoch, Eigen::Matrix< double, 6, Eigen::Dynamic >& cartesianStates,
+                                 const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+    //! Function to propagate the Cartesian states of all bodies to a set of epochs.
+    /*!
+     *  Function to propagate the Cartesian states of all bodies to a set of epochs. The epochs need not be ordered,
+     *  and may be before the initial epoch.
+     *  \param epochs Epochs at which the states are to be computed.
+     *  \param numberOfThreads Maximum number of threads used for the computation (the epochs are distributed over the
+     *  threads).
+     *  \return Concatenated Cartesian states of all bodies (size 6N), as a function of epoch.
+     */
+    std::map< double, Eigen::VectorXd > propagateCartesianStates(
+            const std::vector< double >& epochs,
+            const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+    //! Function to propagate the Keplerian states of all bodies to a set of epochs.
+    /*!
+     *  Function to propagate the Keplerian states of all bodies to a set of epochs (see computeKeplerianStates).
+     *  \param epochs Epochs at which the states are to be computed.
+     *  \param numberOfThreads Maximum number of threads used for the computation (the epochs are distributed over the
+     *  threads).
+     *  \return Concatenated Keplerian states of all bodies (size 6N), as a function of epoch.
+     */
+    std::map< double, Eigen::VectorXd > propagateKeplerianStates(
+            const std::vector< double >& epochs,
+            const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+    //! Function to retrieve the number of bodies that are propagated.
+    /*!
+     *  Function to retrieve the number of bodies that are propagated.
+     *  \return Number of bodies that are propagated.
+     */
+    int getNumberOfBodies( ) const
+    {
+        return static_cast< int >( initialKeplerianStates_.cols( ) );
+    }
+
+    //! Function to retrieve the Keplerian states of all bodies at the initial epoch.
+    /*!
+     *  Function to retrieve the Keplerian states of all bodies at the initial epoch.
+     *  \return Keplerian states of all bodies at the initial epoch, one per column.
+     */
+    const Eigen::Matrix< double, 6, Eigen::Dynamic >& getInitialKeplerianStates( ) const
+    {
+        return initialKeplerianStates_;
+    }
+
+    //! Function to retrieve the secular rates of the argument of periapsis of all bodies.
+    /*!
+     *  Function to retrieve the secular rates of the argument of periapsis of all bodies.
+     *  \return Secular rates of the argument of periapsis of all bodies [rad/s].
+     */
+    const Eigen::ArrayXd& getArgumentOfPeriapsisRates( ) const
+    {
+        return argumentOfPeriapsisRates_;
+    }
+
+    //! Function to retrieve the secular rates of the longitude of the ascending node of all bodies.
+    /*!
+     *  Function to retrieve the secular rates of the longitude of the ascending node of all bodies.
+     *  \return Secular rates of the longitude of the ascending node of all bodies [rad/s].
+     */
+    const Eigen::ArrayXd& getLongitudeOfAscendingNodeRates( ) const
+    {
+        return longitudeOfAscendingNodeRates_;
+    }
+
+    //! Function to retrieve the mean anomaly rates of all bodies.
+    /*!
+     *  Function to retrieve the mean anomaly rates of all bodies, including the secular J2 effect.
+     *  \return Mean anomaly rates of all bodies [rad/s].
+     */
+    const Eigen::ArrayXd& getMeanAnomalyRates( ) const
+    {
+        return meanAnomalyRates_;
+    }
+
+private:
+
+    //! Function to propagate the states of all bodies to a set of epochs.
+    /*!
+     *  Function to propagate the states of all bodies to a set of epochs, in Cartesian or Keplerian elements.
+     *  \param epochs Epochs at which the states are to be computed.
+     *  \param useCartesianStates Boolean denoting whether Cartesian (true) or Keplerian (false) states are computed.
+     *  \param numberOfThreads Maximum number of threads used for the computation.
+     *  \return Concatenated states of all bodies (size 6N), as a function of epoch.
+     */
+    std::map< double, Eigen::VectorXd > propagateStates(
+            const std::vector< double >& epochs, const bool useCartesianStates, const int numberOfThreads ) const;
+
+    //! Epoch at which the initial states are defined.
+    double initialEpoch_;
+
+    //! Gravitational parameter of the central body.
+    double centralBodyGravitationalParameter_;
+
+    //! Keplerian states of all bodies at the initial epoch, one per column.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialKeplerianStates_;
+
+    //! Mean anomalies of all bodies at the initial epoch (zero for hyperbolic orbits, which use propagateKeplerOrbit).
+    Eigen::ArrayXd initialMeanAnomalies_;
+
+    //! Mean anomaly rates of all bodies, including the secular J2 effect.
+    Eigen::ArrayXd meanAnomalyRates_;
+
+    //! Secular rates of the argument of periapsis of all bodies.
+    Eigen::ArrayXd argumentOfPeriapsisRates_;
+
+    //! Secular rates of the longitude of the ascending node of all bodies.
+    Eigen::ArrayXd longitudeOfAscendingNodeRates_;
+
+    //! Indices of the bodies in hyperbolic orbits.
+    std::vector< int > hyperbolicOrbitIndices_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_ANALYTICAL_ORBIT_PROPAGATOR_H
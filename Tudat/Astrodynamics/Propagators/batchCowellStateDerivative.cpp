@@ -0,0 +1,83 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Gravitation/centralJ2J3J4GravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Propagators/batchCowellStateDerivative.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Constructor.
+BatchCowellStateDerivative::BatchCowellStateDerivative(
+        const double centralBodyGravitationalParameter,
+        const double centralBodyEquatorialRadius,
+        const double j2Coefficient,
+        const double j3Coefficient,
+        const double j4Coefficient,
+        const std::vector< double >& thirdBodyGravitationalParameters,
+        const std::vector< std::function< Eigen::Vector3d( const double ) > >& thirdBodyPositionFunctions ):
+    centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
+    centralBodyEquatorialRadius_( centralBodyEquatorialRadius ),
+    j2Coefficient_( j2Coefficient ),
+    j3Coefficient_( j3Coefficient ),
+    j4Coefficient_( j4Coefficient ),
+    thirdBodyGravitationalParameters_( thirdBodyGravitationalParameters ),
+    thirdBodyPositionFunctions_( thirdBodyPositionFunctions )
+{
+    if( thirdBodyGravitationalParameters_.size( ) != thirdBodyPositionFunctions_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating batch Cowell state derivative, third body input is inconsistent" );
+    }
+}
+
+//! Function to compute the state derivatives of all bodies.
+void BatchCowellStateDerivative::computeStateDerivatives(
+        const Eigen::ArrayXd& times, const Eigen::ArrayXXd& states, Eigen::ArrayXXd& stateDerivatives )
+{
+    const int numberOfBodies = states.rows( );
+    stateDerivatives.resize( numberOfBodies, 6 );
+
+    // Compute central body point-mass and zonal accelerations.
+    positions_ = states.leftCols( 3 );
+    gravitation::computeCentralJ2J3J4GravitationalAccelerations(
+                positions_, centralBodyGravitationalParameter_, centralBodyEquatorialRadius_,
+                j2Coefficient_, j3Coefficient_, j4Coefficient_, accelerations_ );
+
+    // Add third-body accelerations, evaluating the third-body position once for each distinct time.
+    thirdBodyPositions_.resize( numberOfBodies, 3 );
+    for( unsigned int i = 0; i < thirdBodyPositionFunctions_.size( ); i++ )
+    {
+        Eigen::Vector3d currentThirdBodyPosition;
+        for( int j = 0; j < numberOfBodies; j++ )
+        {
+            if( j == 0 || times( j ) != times( j - 1 ) )
+            {
+                currentThirdBodyPosition = thirdBodyPositionFunctions_.at( i )( times( j ) );
+            }
+            thirdBodyPositions_.row( j ) = currentThirdBodyPosition.transpose( ).array( );
+        }
+        gravitation::addThirdBodyPerturbingAccelerations(
+                    thirdBodyGravitationalParameters_.at( i ), thirdBodyPositions_, positions_, accelerations_ );
+    }
+
+    stateDerivatives.leftCols( 3 ) = states.rightCols( 3 );
+    stateDerivatives.rightCols( 3 ) = accelerations_;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,124 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_BATCH_COWELL_STATE_DERIVATIVE_H
+#define TUDAT_BATCH_COWELL_STATE_DERIVATIVE_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/batchRungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! State derivative model for Cowell propagation of a batch of bodies subject to zonal and third-body gravity.
+/*!
+ *  State derivative model for Cowell propagation of a batch of bodies (e.g. satellites of a constellation, or debris
+ *  objects), all subject to the same point-mass, J2, J3 and J4 gravitational acceleration of a central body, and the
+ *  third-body accelerations of any number of point masses. The states (Cartesian, w.r.t. the central body, in an
+ *  inertial frame with the z-axis aligned with the central body's rotation axis) are provided in
+ *  structure-of-arrays form (one row per body), such that the accelerations are vectorized over all bodies. This
+ *  class is to be used in combination with the BatchRungeKuttaVariableStepSizeIntegrator (see
+ *  getStateDerivativeFunction).
+ */
+class BatchCowellStateDerivative
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor
+     *  \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     *  \param centralBodyEquatorialRadius Equatorial radius of the central body, in formulation of its zonal
+     *  gravity field coefficients.
+     *  \param j2Coefficient J2-coefficient of the central body's gravity field.
+     *  \param j3Coefficient J3-coefficient of the central body's gravity field.
+     *  \param j4Coefficient J4-coefficient of the central body's gravity field.
+     *  \param thirdBodyGravitationalParameters Gravitational parameters of the third bodies.
+     *  \param thirdBodyPositionFunctions Functions returning the position of each third body w.r.t. the central body
+     *  as a function of time.
+     */
+    BatchCowellStateDerivative(
+            const double centralBodyGravitationalParameter,
+            const double centralBodyEquatorialRadius,
+            const double j2Coefficient,
+            const double j3Coefficient,
+            const double j4Coefficient,
+            const std::vector< double >& thirdBodyGravitationalParameters =
+            std::vector< double >( ),
+            const std::vector< std::function< Eigen::Vector3d( const double ) > >& thirdBodyPositionFunctions =
+            std::vector< std::function< Eigen::Vector3d( const double ) > >( ) );
+
+    //! Function to compute the state derivatives of all bodies.
+    /*!
+     *  Function to compute the state derivatives of all bodies. The third body positions are evaluated once for each
+     *  distinct time in the input (all times are typically identical when integrating with a fixed step size).
+     *  \param times Times at which the state of each body is given.
+     *  \param states Cartesian states of all bodies (one row per body, size Nx6).
+     *  \param stateDerivatives State derivatives of all bodies (returned by reference, size Nx6).
+     */
+    void computeStateDerivatives( const Eigen::ArrayXd& times, const Eigen::ArrayXXd& states,
+                                  Eigen::ArrayXXd& stateDerivatives );
+
+    //! Function to retrieve the state derivative function, for use in the BatchRungeKuttaVariableStepSizeIntegrator.
+    numerical_integrators::BatchRungeKuttaVariableStepSizeIntegrator::BatchStateDerivativeFunction
+    getStateDerivativeFunction( )
+    {
+        return std::bind( &BatchCowellStateDerivative::computeStateDerivatives, this,
+                          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 );
+    }
+
+private:
+
+    //! Gravitational parameter of the central body.
+    double centralBodyGravitationalParameter_;
+
+    //! Equatorial radius of the central body.
+    double centralBodyEquatorialRadius_;
+
+    //! J2-coefficient of the central body's gravity field.
+    double j2Coefficient_;
+
+    //! J3-coefficient of the central body's gravity field.
+    double j3Coefficient_;
+
+    //! J4-coefficient of the central body's gravity field.
+    double j4Coefficient_;
+
+    //! Gravitational parameters of the third bodies.
+    std::vector< double > thirdBodyGravitationalParameters_;
+
+    //! Functions returning the position of each third body w.r.t. the central body as a function of time.
+    std::vector< std::function< Eigen::Vector3d( const double ) > > thirdBodyPositionFunctions_;
+
+    //! Positions of the bodies that are propagated (pre-allocated workspace, size Nx3).
+    Eigen::ArrayXXd positions_;
+
+    //! Accelerations of the bodies that are propagated (pre-allocated workspace, size Nx3).
+    Eigen::ArrayXXd accelerations_;
+
+    //! Position of current third body, evaluated at the time of each body that is propagated (pre-allocated
+    //! workspace, size Nx3).
+    Eigen::ArrayXXd thirdBodyPositions_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_COWELL_STATE_DERIVATIVE_H
@@ -147,6 +147,10 @@ public:
     {
 //        std::cout << "Computing state derivative: " <<time<<" "<<state.transpose( ) << std::endl;
 
+        // Profile full state derivative computation (no-op if profiler not set).
+        utilities::ScopedProfilerTimer stateDerivativeTimer(
+                    performanceProfiler_.get( ), stateDerivativeProfilerIndex_ );
+
         // Initialize state derivative
         if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
         {
@@ -219,6 +223,9 @@ public:
         // If variational equations are to be integrated: evaluate and set.
         if( evaluateVariationalEquations_ )
         {
+            utilities::ScopedProfilerTimer variationalEquationsTimer(
+                        performanceProfiler_.get( ), variationalEquationsProfilerIndex_ );
+
             variationalEquations_->updatePartials( time, currentStatesPerTypeInConventionalRepresentation_ );
 
             variationalEquations_->evaluateVariationalEquations< StateScalarType >(
@@ -575,6 +582,50 @@ public:
         cumulativeFunctionEvaluationCounter_.clear( );
     }
 
+    //! Function to set the object used to profile the computation of the state derivative
+    /*!
+     * Function to set the object used to profile the computation of the state derivative. The full state derivative
+     * computation and the evaluation of the variational equations are registered as components, and the profiler is
+     * passed to all state derivative models, which may register their constituent models (e.g. acceleration models).
+     * Note that the profiler is not passed to the environment update function, which must be set separately
+     * (see EnvironmentUpdater::setPerformanceProfiler).
+     * \param performanceProfiler Object used to profile the computations (nullptr to disable profiling).
+     */
+    void setPerformanceProfiler( const std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler )
+    {
+        performanceProfiler_ = performanceProfiler;
+        if( performanceProfiler_ != nullptr )
+        {
+            stateDerivativeProfilerIndex_ = performanceProfiler_->addComponent(
+                        utilities::state_derivative_profiled_component, "full state derivative" );
+            if( variationalEquations_ != nullptr )
+            {
+                variationalEquationsProfilerIndex_ = performanceProfiler_->addComponent(
+                            utilities::state_derivative_profiled_component, "variational equations" );
+            }
+        }
+
+        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+             stateDerivativeModelsIterator_++ )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            {
+                stateDerivativeModelsIterator_->second.at( i )->setPerformanceProfiler( performanceProfiler );
+            }
+        }
+    }
+
+    //! Function to retrieve the object used to profile the computation of the state derivative
+    /*!
+     * Function to retrieve the object used to profile the computation of the state derivative
+     * \return Object used to profile the computation of the state derivative (nullptr if no profiling is done).
+     */
+    std::shared_ptr< utilities::PerformanceProfiler > getPerformanceProfiler( )
+    {
+        return performanceProfiler_;
+    }
+
 private:
 
     //! Function to convert the to the conventional form in the global frame per dynamics type.
@@ -701,6 +752,15 @@ private:
 
     //! Variable to keep track of the number of calls to the computeStateDerivative function per time step
     std::map< TimeType, unsigned int > cumulativeFunctionEvaluationCounter_;
+
+    //! Object used to profile the computation of the state derivative (nullptr if no profiling is done).
+    std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler_;
+
+    //! Index in performanceProfiler_ of the component for the full state derivative computation.
+    unsigned int stateDerivativeProfilerIndex_ = 0;
+
+    //! Index in performanceProfiler_ of the component for the evaluation of the variational equations.
+    unsigned int variationalEquationsProfilerIndex_ = 0;
 };
 
 extern template class DynamicsStateDerivativeModel< double, double >;
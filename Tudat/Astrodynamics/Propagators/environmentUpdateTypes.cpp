@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <stdexcept>
 #include "Tudat/Astrodynamics/Propagators/environmentUpdateTypes.h"
 
 namespace tudat
@@ -17,6 +18,37 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to retrieve a string describing a type of environment model update.
+std::string getEnvironmentModelUpdateName( const EnvironmentModelsToUpdate environmentModelToUpdate )
+{
+    std::string updateName;
+    switch( environmentModelToUpdate )
+    {
+    case body_translational_state_update:
+        updateName = "translational state";
+        break;
+    case body_rotational_state_update:
+        updateName = "rotational state";
+        break;
+    case body_mass_update:
+        updateName = "mass";
+        break;
+    case spherical_harmonic_gravity_field_update:
+        updateName = "spherical harmonic gravity field";
+        break;
+    case vehicle_flight_conditions_update:
+        updateName = "flight conditions";
+        break;
+    case radiation_pressure_interface_update:
+        updateName = "radiation pressure interface";
+        break;
+    default:
+        throw std::runtime_error( "Error, environment model update type " + std::to_string( environmentModelToUpdate ) +
+                                  " not recognized when retrieving name." );
+    }
+    return updateName;
+}
+
 //! Function to extend existing list of required environment update types
 void addEnvironmentUpdates( std::map< propagators::EnvironmentModelsToUpdate,
                             std::vector< std::string > >& environmentUpdateList,
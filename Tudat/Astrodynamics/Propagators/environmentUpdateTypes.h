@@ -33,6 +33,14 @@ enum EnvironmentModelsToUpdate
     radiation_pressure_interface_update = 5
 };
 
+//! Function to retrieve a string describing a type of environment model update.
+/*!
+ * Function to retrieve a string describing a type of environment model update.
+ * \param environmentModelToUpdate Type of environment model update.
+ * \return String describing the type of environment model update.
+ */
+std::string getEnvironmentModelUpdateName( const EnvironmentModelsToUpdate environmentModelToUpdate );
+
 //! Function to extend existing list of required environment update types
 /*!
  * Function to extend existing list of required environment update types
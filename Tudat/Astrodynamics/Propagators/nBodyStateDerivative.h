@@ -18,6 +18,7 @@
 #include <memory>
 #include <functional>
 
+#include "Tudat/Basics/performanceProfiler.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
@@ -187,9 +188,74 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
-        for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+        if( performanceProfiler_ == nullptr )
+        {
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                accelerationModelList_.at( i )->updateMembers( currentTime );
+            }
+        }
+        else
         {
-            accelerationModelList_.at( i )->updateMembers( currentTime );
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                utilities::ScopedProfilerTimer accelerationTimer(
+                            performanceProfiler_.get( ), accelerationProfilerIndices_.at( i ) );
+                accelerationModelList_.at( i )->updateMembers( currentTime );
+            }
+        }
+    }
+
+    //! Function to set the object used to profile the computation of each acceleration model.
+    /*!
+     * Function to set the object used to profile the computation of each acceleration model. Each acceleration model is
+     * registered as a separate component in the profiler, named by its type, the body undergoing and the body exerting
+     * the acceleration.
+     * \param performanceProfiler Object used to profile the computations (nullptr to disable profiling).
+     */
+    void setPerformanceProfiler( const std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler )
+    {
+        performanceProfiler_ = performanceProfiler;
+        accelerationProfilerIndices_.clear( );
+        if( performanceProfiler_ == nullptr )
+        {
+            return;
+        }
+
+        // Register acceleration models, in the same order as in createAccelerationModelList.
+        for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
+             outerAccelerationIterator != accelerationModelsPerBody_.end( ); outerAccelerationIterator++ )
+        {
+            for( innerAccelerationIterator  = outerAccelerationIterator->second.begin( );
+                 innerAccelerationIterator != outerAccelerationIterator->second.end( );
+                 innerAccelerationIterator++ )
+            {
+                for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
+                {
+                    std::string accelerationName;
+                    try
+                    {
+                        accelerationName = basic_astrodynamics::getAccelerationModelName(
+                                    basic_astrodynamics::getAccelerationModelType(
+                                        innerAccelerationIterator->second.at( j ) ) );
+                    }
+                    catch( const std::runtime_error& )
+                    {
+                        accelerationName = "unidentified acceleration";
+                    }
+                    accelerationName.erase( accelerationName.find_last_not_of( ' ' ) + 1 );
+                    accelerationName += " on " + outerAccelerationIterator->first +
+                            " by " + innerAccelerationIterator->first;
+                    if( innerAccelerationIterator->second.size( ) > 1 )
+                    {
+                        accelerationName += " (" + std::to_string( j ) + ")";
+                    }
+
+                    accelerationProfilerIndices_.push_back(
+                                performanceProfiler_->addComponent(
+                                    utilities::acceleration_model_profiled_component, accelerationName ) );
+                }
+            }
         }
     }
 
@@ -438,6 +504,12 @@ protected:
     //! Vector of acceleration models, containing all entries of accelerationModelsPerBody_.
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModelList_;
 
+    //! Object used to profile the computation of each acceleration model (nullptr if no profiling is done).
+    std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler_;
+
+    //! Index in performanceProfiler_ of each entry of accelerationModelList_.
+    std::vector< unsigned int > accelerationProfilerIndices_;
+
     //! Object responsible for providing the current integration origins from the global origins.
     std::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData_;
 
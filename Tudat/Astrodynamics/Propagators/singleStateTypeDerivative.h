@@ -12,9 +12,11 @@
 #define TUDAT_STATEDERIVATIVE_H
 
 #include <map>
+#include <memory>
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/performanceProfiler.h"
 #include "Tudat/Basics/timeType.h"
 #include <Tudat/Basics/utilityMacros.h>
 
@@ -229,6 +231,17 @@ public:
         return false;
     }
 
+    //! Function to set the object used to profile the computations of the individual models of the state derivative.
+    /*!
+     * Function to set the object used to profile the computations of the individual models (e.g. acceleration models) of
+     * the state derivative. Default implementation is empty (no profiling of individual models).
+     * \param performanceProfiler Object used to profile the computations (nullptr to disable profiling).
+     */
+    virtual void setPerformanceProfiler( const std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler )
+    {
+        TUDAT_UNUSED_PARAMETER( performanceProfiler );
+    }
+
 protected:
 
     //! Type of dynamics for which the state derivative is calculated.
@@ -244,6 +244,16 @@ public:
         return centralBodyName_;
     }
 
+    //! Function to retrieve whether a function to update the orientation angles (e.g. from a guidance object) is set.
+    /*!
+     * Function to retrieve whether a function to update the orientation angles (e.g. from a guidance object) is set.
+     * \return True if a function to update the orientation angles is set.
+     */
+    bool isAngleUpdateFunctionSet( )
+    {
+        return !( angleUpdateFunction_ == nullptr );
+    }
+
     //! Function to get the current airspeed-based body-fixed state of vehicle, as set by previous call to update( ).
     /*!
      * Function to get the current airspeed-based body-fixed state of vehicle, as set by previous call to update( ).
@@ -494,6 +494,107 @@ BOOST_AUTO_TEST_CASE( testUpdateMGA1DSMVFTrajectory )
     BOOST_CHECK_CLOSE_FRACTION( expectedDeltaV, resultingDeltaV, tolerance );
 }
 
+//! Test repeated and concurrent evaluation of trajectories with different variable vectors.
+BOOST_AUTO_TEST_CASE( testTrajectoryBatchEvaluation )
+{
+    // Define the Messenger MGA-1DSM Velocity Formulation trajectory model (see testMGA1DSMVFTrajectory1).
+    const int numberOfLegs = 5;
+    std::vector< TransferLegType > legTypeVector( numberOfLegs );
+    legTypeVector[0] = mga1DsmVelocity_Departure; legTypeVector[1] = mga1DsmVelocity_Swingby;
+    legTypeVector[2] = mga1DsmVelocity_Swingby; legTypeVector[3] = mga1DsmVelocity_Swingby;
+    legTypeVector[4] = capture;
+
+    std::vector< ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData > bodies =
+    { ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::earthMoonBarycenter,
+      ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::earthMoonBarycenter,
+      ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::venus,
+      ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::venus,
+      ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData::mercury };
+
+    Eigen::VectorXd gravitationalParameterVector( numberOfLegs );
+    gravitationalParameterVector << 3.9860119e14, 3.9860119e14, 3.24860e14, 3.24860e14, 2.2321e13;
+
+    Eigen::VectorXd nominalVariableVector ( 1 + numberOfLegs + 4 * ( numberOfLegs - 1 ) );
+    nominalVariableVector << 1171.64503236 * physical_constants::JULIAN_DAY,
+                             399.999999715 * physical_constants::JULIAN_DAY,
+                             178.372255301 * physical_constants::JULIAN_DAY,
+                             299.223139512 * physical_constants::JULIAN_DAY,
+                             180.510754824 * physical_constants::JULIAN_DAY,
+                             1,
+                             0.234594654679, 1408.99421278, 0.37992647165 * 2 * 3.14159265358979,
+                             std::acos(  2 * 0.498004040298 - 1. ) - 3.14159265358979 / 2,
+                             0.0964769387134, 1.35077257078, 1.80629232251 * 6.378e6, 0.0,
+                             0.829948744508, 1.09554368115, 3.04129845698 * 6.052e6, 0.0,
+                             0.317174785637, 1.34317576594, 1.10000000891 * 6.052e6, 0.0;
+
+    const double sunGravitationalParameter = 1.32712428e20;
+    Eigen::VectorXd minimumPericenterRadii = Eigen::VectorXd::Constant( numberOfLegs, TUDAT_NAN );
+    Eigen::VectorXd semiMajorAxes = Eigen::VectorXd::Constant( 2, std::numeric_limits< double >::infinity( ) );
+    Eigen::VectorXd eccentricities = Eigen::VectorXd::Zero( 2 );
+
+    // Function to create a trajectory object, with its own ephemerides.
+    auto createTrajectory = [ & ]( const Eigen::VectorXd& variableVector )
+    {
+        std::vector< ephemerides::EphemerisPointer > ephemerisVector( numberOfLegs );
+        for ( int i = 0; i < numberOfLegs; i++ )
+        {
+            ephemerisVector[ i ] = std::make_shared< ephemerides::ApproximatePlanetPositions >( bodies[ i ] );
+        }
+        return std::make_shared< Trajectory >(
+                    numberOfLegs, legTypeVector, ephemerisVector, gravitationalParameterVector, variableVector,
+                    sunGravitationalParameter, minimumPericenterRadii, semiMajorAxes, eccentricities );
+    };
+
+    // Create a population of variable vectors, by perturbing the epochs, times of flight and DSM variables.
+    const int populationSize = 17;
+    Eigen::MatrixXd population( nominalVariableVector.rows( ), populationSize );
+    for ( int i = 0; i < populationSize; i++ )
+    {
+        population.col( i ) = nominalVariableVector;
+        population.block( 0, i, numberOfLegs, 1 ) *= 1.0 + 0.002 * ( i - populationSize / 2 );
+        population( 6 + 4 * ( i % 4 ), i ) = 0.1 + 0.05 * i;
+    }
+
+    // Compute the Delta V of each member with a newly created trajectory object.
+    Eigen::VectorXd expectedDeltaVs( populationSize );
+    for ( int i = 0; i < populationSize; i++ )
+    {
+        createTrajectory( population.col( i ) )->calculateTrajectory( expectedDeltaVs( i ) );
+    }
+
+    // Check that re-using a single trajectory object gives identical results.
+    std::shared_ptr< Trajectory > reusedTrajectory = createTrajectory( nominalVariableVector );
+    for ( int i = 0; i < populationSize; i++ )
+    {
+        double resultingDeltaV;
+        reusedTrajectory->calculateTrajectory( population.col( i ), resultingDeltaV );
+        BOOST_CHECK_EQUAL( resultingDeltaV, expectedDeltaVs( i ) );
+    }
+
+    // Check that concurrent evaluation gives identical results, for different numbers of threads.
+    for ( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads++ )
+    {
+        std::vector< std::shared_ptr< Trajectory > > trajectories;
+        for ( int i = 0; i < numberOfThreads; i++ )
+        {
+            trajectories.push_back( createTrajectory( nominalVariableVector ) );
+        }
+
+        const Eigen::VectorXd resultingDeltaVs = calculateTrajectoryDeltaVs( trajectories, population );
+        for ( int i = 0; i < populationSize; i++ )
+        {
+            BOOST_CHECK_EQUAL( resultingDeltaVs( i ), expectedDeltaVs( i ) );
+        }
+    }
+
+    // Check that an error is thrown for variable vectors of incorrect size.
+    double resultingDeltaV;
+    BOOST_CHECK_THROW( reusedTrajectory->calculateTrajectory( nominalVariableVector.segment( 0, 6 ), resultingDeltaV ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( calculateTrajectoryDeltaVs( { reusedTrajectory }, population.topRows( 6 ) ),
+                       std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
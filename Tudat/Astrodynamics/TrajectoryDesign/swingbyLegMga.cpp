@@ -27,7 +27,8 @@ void SwingbyLegMga::calculateLeg( Eigen::Vector3d& velocityBeforeArrivalBody,
                                                departureBodyVelocity_,
                                                ( *velocityBeforeDepartureBodyPtr_ ),
                                                velocityAfterDeparture_,
-                                               minimumPericenterRadius_ );
+                                               minimumPericenterRadius_,
+                                               true, 1.0e-6, rootFinder_ );
 
     // Return the deltaV
     deltaV = deltaV_;
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include <Tudat/Mathematics/BasicMathematics/mathematicalConstants.h>
+#include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 
 #include "Tudat/Astrodynamics/TrajectoryDesign/swingbyLeg.h"
 
@@ -67,7 +68,8 @@ public:
                     centralBodyGravitationalParameter,
                     swingbyBodyGravitationalParameter,
                     velocityBeforeDepartureBodyPtr),
-        minimumPericenterRadius_( minimumPericenterRadius )
+        minimumPericenterRadius_( minimumPericenterRadius ),
+        rootFinder_( std::make_shared< root_finders::NewtonRaphson >( 1.0e-12, 1000 ) )
     {
         velocityAfterDeparture_( 0 ) = TUDAT_NAN;
     }
@@ -128,6 +130,13 @@ private:
      */
     double minimumPericenterRadius_;
 
+    //! Root finder used to match the bending angle of the swing-by.
+    /*!
+     * Root finder used to match the bending angle of the swing-by, created once such that it is not re-created each
+     * time the leg is calculated.
+     */
+    root_finders::RootFinderPointer rootFinder_;
+
 };
 } // namespace transfer_trajectories
 } // namespace tudat
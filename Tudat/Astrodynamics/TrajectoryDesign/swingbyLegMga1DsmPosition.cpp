@@ -40,7 +40,8 @@ void SwingbyLegMga1DsmPosition::calculateLeg( Eigen::Vector3d& velocityBeforeArr
                                                       departureBodyVelocity_,
                                                       ( *velocityBeforeDepartureBodyPtr_ ),
                                                       velocityAfterDeparture_,
-                                                      minimumPericenterRadius_ );
+                                                      minimumPericenterRadius_,
+                                                      true, 1.0e-6, rootFinder_ );
 
     //Calculate the deltaV originating from the DSM.
     deltaVDsm_ = ( velocityAfterDsm_ - velocityBeforeDsm_ ).norm( );
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include <Tudat/Mathematics/BasicMathematics/mathematicalConstants.h>
+#include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 
 #include "Tudat/Astrodynamics/TrajectoryDesign/swingbyLeg.h"
 
@@ -82,7 +83,8 @@ public:
         dsmTimeOfFlightFraction_( dsmTimeOfFlightFraction ),
         dimensionlessRadiusDsm_( dimensionlessRadiusDsm ),
         inPlaneAngle_( inPlaneAngle ),
-        outOfPlaneAngle_( outOfPlaneAngle )
+        outOfPlaneAngle_( outOfPlaneAngle ),
+        rootFinder_( std::make_shared< root_finders::NewtonRaphson >( 1.0e-12, 1000 ) )
     {
         velocityAfterDeparture_( 0 ) = TUDAT_NAN;
     }
@@ -150,6 +152,13 @@ private:
      */
     double minimumPericenterRadius_;
 
+    //! Root finder used to match the bending angle of the swing-by.
+    /*!
+     * Root finder used to match the bending angle of the swing-by, created once such that it is not re-created each
+     * time the leg is calculated.
+     */
+    root_finders::RootFinderPointer rootFinder_;
+
     //! The fraction of the time of flight of the DSM
     /*!
      * The fraction of the time of flight of the corresponding leg at which the DSM is performed.
@@ -1,3 +1,8 @@
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Basics/parallelLoop.h"
+
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
@@ -33,6 +38,21 @@ void Trajectory::calculateTrajectory( double& totalDeltaV )
     }
 }
 
+//! Calculate the legs for a new trajectory variable vector.
+void Trajectory::calculateTrajectory( const Eigen::VectorXd& trajectoryVariableVector, double& totalDeltaV )
+{
+    if ( trajectoryVariableVector.size( ) != trajectoryVariableVector_.size( ) )
+    {
+        throw std::runtime_error( "Error when calculating trajectory, variable vector has size " +
+                                  std::to_string( trajectoryVariableVector.size( ) ) + ", expected " +
+                                  std::to_string( trajectoryVariableVector_.size( ) ) );
+    }
+
+    updateVariableVector( trajectoryVariableVector );
+    updateEphemeris( );
+    calculateTrajectory( totalDeltaV );
+}
+
 //! Returns intermediate points along the trajectory.
 void Trajectory::intermediatePoints( double maximumTimeStep,
                                      std::vector < Eigen::Vector3d >& positionVector,
@@ -164,6 +184,44 @@ void Trajectory::updateEphemeris( )
     // Calculate the ephemeris and store it in the corresponding variables in this class.
     extractEphemeris( );
 
+    updateLegEphemerides( );
+}
+
+//! Update the ephemeris using given planet states.
+void Trajectory::updateEphemeris( const Eigen::VectorXd& planetStates )
+{
+    if ( planetStates.size( ) != 6 * numberOfLegs_ )
+    {
+        throw std::runtime_error( "Error when updating trajectory ephemeris, planet state vector has incorrect size." );
+    }
+
+    for ( int counter = 0; counter < numberOfLegs_ ; counter++ )
+    {
+        planetPositionVector_[ counter ] = planetStates.segment( 6 * counter, 3 );
+        planetVelocityVector_[ counter ] = planetStates.segment( 6 * counter + 3, 3 );
+    }
+
+    updateLegEphemerides( );
+}
+
+//! Return the planet states at the visitation times.
+Eigen::VectorXd Trajectory::getPlanetStates( const Eigen::VectorXd& trajectoryVariableVector )
+{
+    Eigen::VectorXd planetStates( 6 * static_cast< int >( numberOfLegs_ ) );
+
+    // Obtain the states at the visitation times, as in extractEphemeris.
+    double time = 0.0;
+    for ( int counter = 0; counter < numberOfLegs_ ; counter++ )
+    {
+        time = time + trajectoryVariableVector[ counter ];
+        planetStates.segment( 6 * counter, 6 ) = ephemerisVector_[ counter ]->getCartesianState( time );
+    }
+    return planetStates;
+}
+
+//! Update the ephemeris variables of the legs.
+void Trajectory::updateLegEphemerides( )
+{
     // Loop through all the mission legs and update their ephemeris variables.
     for ( int counter = 0; counter < numberOfLegs_; counter++ )
     {
@@ -184,28 +242,23 @@ void Trajectory::updateVariableVector( const Eigen::VectorXd& trajectoryVariable
     // variables describing trajectories including DSMs.
     int additionalVariableCounter = 0;
 
-    // Initialize a vector in which the variables that have to be passed will be stored temporarily.
-    Eigen::VectorXd tempVector;
-
     // Loop through all the mission legs and update their defining variables.
     for ( int counter = 0; counter < numberOfLegs_; counter++ )
     {
         switch ( legTypeVector_[ counter ] )
         {
             case mga_Departure: case mga_Swingby: case capture:
-                tempVector.resize( 1 );
-                tempVector << trajectoryVariableVector_[ 1 /*jump over t_0*/ + counter ];
+                legVariableVectors_[ counter ]( 0 ) = trajectoryVariableVector_[ 1 /*jump over t_0*/ + counter ];
                 break;
             case mga1DsmPosition_Departure: case mga1DsmPosition_Swingby:
             case mga1DsmVelocity_Departure: case mga1DsmVelocity_Swingby:
-                tempVector.resize( 5 );
-                tempVector << trajectoryVariableVector_[ 1 + counter ],
-                              trajectoryVariableVector_.segment( 1 + numberOfLegs_ +
-                                                                 additionalVariableCounter, 4 );
+                legVariableVectors_[ counter ]( 0 ) = trajectoryVariableVector_[ 1 + counter ];
+                legVariableVectors_[ counter ].segment( 1, 4 ) = trajectoryVariableVector_.segment(
+                            1 + numberOfLegs_ + additionalVariableCounter, 4 );
                 additionalVariableCounter += 4;
                 break;
         }
-        missionLegPtrVector_[ counter ]->updateDefiningVariables( tempVector );
+        missionLegPtrVector_[ counter ]->updateDefiningVariables( legVariableVectors_[ counter ] );
     }
 }
 
@@ -259,6 +312,22 @@ void Trajectory::prepareVelocityAndPositionVectors( )
     spacecraftVelocityPtrVector_.resize( numberOfLegs_ );
     deltaVVector_.resize( numberOfLegs_ );
 
+    // Size the defining variables of each leg, based on the leg type.
+    legVariableVectors_.resize( numberOfLegs_ );
+    for ( int counter = 0; counter < numberOfLegs_; counter++ )
+    {
+        switch ( legTypeVector_[ counter ] )
+        {
+            case mga1DsmPosition_Departure: case mga1DsmPosition_Swingby:
+            case mga1DsmVelocity_Departure: case mga1DsmVelocity_Swingby:
+                legVariableVectors_[ counter ].resize( 5 );
+                break;
+            default:
+                legVariableVectors_[ counter ].resize( 1 );
+                break;
+        }
+    }
+
     // Prepare empty contents for the spacecraft velocity vector.
     Eigen::Vector3d temp ( TUDAT_NAN, TUDAT_NAN, TUDAT_NAN );
     for ( int counter = 0; counter < numberOfLegs_; counter++)
@@ -545,5 +614,49 @@ void Trajectory::getLaunchConditions( Eigen::Vector3d& departureBodyPosition,
                                                              velocityAfterDeparture );
 }
 
+//! Calculate the total Delta V of a number of trajectories concurrently.
+Eigen::VectorXd calculateTrajectoryDeltaVs( const std::vector< std::shared_ptr< Trajectory > >& trajectories,
+                                            const Eigen::MatrixXd& trajectoryVariableVectors )
+{
+    if ( trajectories.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when calculating trajectories, no Trajectory objects provided." );
+    }
+
+    const int numberOfTrajectoryVariables = trajectories.at( 0 )->getNumberOfTrajectoryVariables( );
+    if ( trajectoryVariableVectors.rows( ) != numberOfTrajectoryVariables )
+    {
+        throw std::runtime_error( "Error when calculating trajectories, variable vectors have size " +
+                                  std::to_string( trajectoryVariableVectors.rows( ) ) + ", expected " +
+                                  std::to_string( numberOfTrajectoryVariables ) );
+    }
+
+    // Extract the planet states sequentially, as the ephemerides need not be thread-safe.
+    const int numberOfTrajectories = trajectoryVariableVectors.cols( );
+    std::vector< Eigen::VectorXd > planetStates( numberOfTrajectories );
+    for ( int i = 0; i < numberOfTrajectories; i++ )
+    {
+        planetStates[ i ] = trajectories.at( 0 )->getPlanetStates( trajectoryVariableVectors.col( i ) );
+    }
+
+    // Calculate the trajectories, with each thread using its own Trajectory object.
+    Eigen::VectorXd totalDeltaVs( numberOfTrajectories );
+    const int numberOfThreads = std::min< int >( trajectories.size( ), numberOfTrajectories );
+    utilities::executeParallelLoop( numberOfThreads, [ & ]( const int threadIndex )
+    {
+        Trajectory& trajectory = *trajectories.at( threadIndex );
+        Eigen::VectorXd trajectoryVariableVector( numberOfTrajectoryVariables );
+        for ( int i = threadIndex; i < numberOfTrajectories; i += numberOfThreads )
+        {
+            trajectoryVariableVector = trajectoryVariableVectors.col( i );
+            trajectory.updateVariableVector( trajectoryVariableVector );
+            trajectory.updateEphemeris( planetStates[ i ] );
+            trajectory.calculateTrajectory( totalDeltaVs( i ) );
+        }
+    }, numberOfThreads );
+
+    return totalDeltaVs;
+}
+
 } // namespace transfer_trajectories
 } // namespace tudat
@@ -138,6 +138,16 @@ public:
      */
     void calculateTrajectory( double& totalDeltaV );
 
+    //! Calculate the legs for a new trajectory variable vector.
+    /*!
+     * Updates the trajectory variable vector and the ephemeris, and performs all the calculations required for the
+     * trajectory. The legs are not re-created, and no memory is allocated (apart from any allocations done by the
+     * ephemerides and legs themselves), so that this function is suited to repeated evaluation in an optimizer.
+     * \param trajectoryVariableVector the new variable vector.
+     * \param totalDeltaV the total delta V needed for the trajectory.
+     */
+    void calculateTrajectory( const Eigen::VectorXd& trajectoryVariableVector, double& totalDeltaV );
+
     //! Function to retrieve the value of the capture Delta V.
     /*!
      *  Function to retrieve the value of the capture Delta V.
@@ -213,6 +223,34 @@ public:
      */
     void updateEphemeris( );
 
+    //! Update the ephemeris using given planet states.
+    /*!
+     * Sets all the positions and the velocities of the trajectory class and the underlying mission leg classes to new
+     * values, as for updateEphemeris( ), but with the planet states provided, instead of extracted from the ephemeris.
+     * \param planetStates the Cartesian states of the planets at the visitation times, concatenated in one vector
+     * (as returned by getPlanetStates).
+     */
+    void updateEphemeris( const Eigen::VectorXd& planetStates );
+
+    //! Return the planet states at the visitation times.
+    /*!
+     * Returns the Cartesian states of the planets at the visitation times defined by a trajectory variable vector,
+     * extracted from the ephemeris. The state of this object is not modified.
+     * \param trajectoryVariableVector the variable vector defining the visitation times.
+     * \return the Cartesian states of the planets, concatenated in one vector (six entries per leg).
+     */
+    Eigen::VectorXd getPlanetStates( const Eigen::VectorXd& trajectoryVariableVector );
+
+    //! Return the size of the trajectory variable vector.
+    /*!
+     * Returns the size of the trajectory variable vector, as determined by the leg types.
+     * \return the size of the trajectory variable vector.
+     */
+    int getNumberOfTrajectoryVariables( )
+    {
+        return checkTrajectoryVariableVectorSize( );
+    }
+
     //! Update the variable vector.
     /*!
      * Sets the trajectory defining variable vector to the newly specified values. Also sets all
@@ -264,6 +302,13 @@ private:
      */
     Eigen::VectorXd trajectoryVariableVector_;
 
+    //! The defining variables of the individual legs.
+    /*!
+     * The defining variables of each of the legs, extracted from the trajectory variable vector. These are sized once
+     * (based on the leg types), such that the variable vector can be updated without allocating memory.
+     */
+    std::vector< Eigen::VectorXd > legVariableVectors_;
+
     //! The planet positions vector.
     /*!
      * In this vector the positions of the planets at the visitation times are stored.
@@ -385,8 +430,28 @@ private:
      */
     void extractEphemeris( );
 
+    //! Update the ephemeris variables of the legs.
+    /*!
+     * Sets the positions and velocities of the planets in the mission legs to the values stored in this class.
+     */
+    void updateLegEphemerides( );
+
 };
 
+//! Calculate the total Delta V of a number of trajectories concurrently.
+/*!
+ * Calculates the total Delta V of a population of trajectory variable vectors (e.g. one generation of an optimizer),
+ * distributing the trajectories over a number of threads. Each thread uses its own Trajectory object, so the objects
+ * provided must be distinct, but must all define the same trajectory (leg types, bodies, etc.). Since ephemerides are
+ * in general not thread-safe, the planet states for all variable vectors are first extracted sequentially, using the
+ * ephemerides of the first Trajectory object, after which the legs are calculated concurrently.
+ * \param trajectories the Trajectory objects to use, one per thread.
+ * \param trajectoryVariableVectors the trajectory variable vectors, one per column.
+ * \return the total Delta V of each of the trajectories.
+ */
+Eigen::VectorXd calculateTrajectoryDeltaVs( const std::vector< std::shared_ptr< Trajectory > >& trajectories,
+                                            const Eigen::MatrixXd& trajectoryVariableVectors );
+
 } // namespace transfer_trajectories
 
 } // namespace tudat
@@ -0,0 +1,127 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/parallelLoop.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_parallel_loop )
+
+//! Test whether each iteration of a parallel loop is executed exactly once, for various numbers of threads
+BOOST_AUTO_TEST_CASE( testParallelLoopIterations )
+{
+    int numberOfIterations = 1000;
+    for( int numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads *= 2 )
+    {
+        std::vector< int > numberOfCalls( numberOfIterations, 0 );
+        std::vector< double > results( numberOfIterations, 0.0 );
+        utilities::executeParallelLoop(
+                    numberOfIterations, [ & ]( const int index )
+        {
+            numberOfCalls[ index ]++;
+            results[ index ] = std::sqrt( static_cast< double >( index ) );
+        }, numberOfThreads );
+
+        for( int i = 0; i < numberOfIterations; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfCalls[ i ], 1 );
+            BOOST_CHECK_EQUAL( results[ i ], std::sqrt( static_cast< double >( i ) ) );
+        }
+    }
+
+    // Check that loop without iterations is handled.
+    bool isLoopBodyCalled = false;
+    utilities::executeParallelLoop( 0, [ & ]( const int ){ isLoopBodyCalled = true; }, 4 );
+    BOOST_CHECK_EQUAL( isLoopBodyCalled, false );
+}
+
+//! Test whether exceptions thrown inside a parallel loop are propagated to the calling thread
+BOOST_AUTO_TEST_CASE( testParallelLoopExceptions )
+{
+    bool isExceptionCaught = false;
+    try
+    {
+        utilities::executeParallelLoop(
+                    100, [ ]( const int index )
+        {
+            if( index == 37 )
+            {
+                throw std::runtime_error( "Error in iteration" );
+            }
+        }, 4 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test whether a persistent loop executor executes each iteration of repeated loops exactly once, and propagates
+//! exceptions to the calling thread
+BOOST_AUTO_TEST_CASE( testParallelLoopExecutor )
+{
+    int numberOfIterations = 100;
+    for( int numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads *= 2 )
+    {
+        utilities::ParallelLoopExecutor loopExecutor( numberOfThreads );
+        BOOST_CHECK_EQUAL( loopExecutor.getNumberOfThreads( ), numberOfThreads );
+
+        // Execute a number of consecutive loops with the same threads.
+        for( int loopIndex = 0; loopIndex < 50; loopIndex++ )
+        {
+            std::vector< int > numberOfCalls( numberOfIterations, 0 );
+            loopExecutor.executeLoop( numberOfIterations, [ & ]( const int index ){ numberOfCalls[ index ]++; } );
+
+            for( int i = 0; i < numberOfIterations; i++ )
+            {
+                BOOST_CHECK_EQUAL( numberOfCalls[ i ], 1 );
+            }
+        }
+
+        // Check that exception is propagated, and that executor can be used afterwards.
+        bool isExceptionCaught = false;
+        try
+        {
+            loopExecutor.executeLoop( numberOfIterations, [ ]( const int index )
+            {
+                if( index == 37 )
+                {
+                    throw std::runtime_error( "Error in iteration" );
+                }
+            } );
+        }
+        catch( std::runtime_error const& )
+        {
+            isExceptionCaught = true;
+        }
+        BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+        int numberOfCalls = 0;
+        loopExecutor.executeLoop( 1, [ & ]( const int ){ numberOfCalls++; } );
+        BOOST_CHECK_EQUAL( numberOfCalls, 1 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
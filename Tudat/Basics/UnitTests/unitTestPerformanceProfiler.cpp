@@ -0,0 +1,107 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/performanceProfiler.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_performance_profiler )
+
+using namespace utilities;
+
+//! Test registration of components and accumulation of measurements.
+BOOST_AUTO_TEST_CASE( testPerformanceProfilerMeasurements )
+{
+    PerformanceProfiler profiler;
+    unsigned int firstIndex = profiler.addComponent( acceleration_model_profiled_component, "First" );
+    unsigned int secondIndex = profiler.addComponent( acceleration_model_profiled_component, "Second" );
+    unsigned int environmentIndex = profiler.addComponent( environment_update_profiled_component, "First" );
+
+    // Check that re-registering a component returns the existing index.
+    BOOST_CHECK_EQUAL( profiler.addComponent( acceleration_model_profiled_component, "First" ), firstIndex );
+    BOOST_CHECK( firstIndex != secondIndex );
+    BOOST_CHECK( firstIndex != environmentIndex );
+
+    profiler.addMeasurement( firstIndex, 1.0, 2 );
+    profiler.addMeasurement( firstIndex, 0.5, 1 );
+    profiler.addMeasurement( secondIndex, 2.0 );
+    profiler.addMeasurement( environmentIndex, 0.25 );
+
+    BOOST_CHECK_EQUAL( profiler.getComponentSummary( firstIndex ).numberOfCalls, 2 );
+    BOOST_CHECK_EQUAL( profiler.getComponentSummary( firstIndex ).totalTime, 1.5 );
+    BOOST_CHECK_EQUAL( profiler.getComponentSummary( firstIndex ).numberOfAllocations, 3 );
+    BOOST_CHECK_EQUAL( profiler.getTotalTime( acceleration_model_profiled_component ), 3.5 );
+    BOOST_CHECK_EQUAL( profiler.getTotalNumberOfAllocations( acceleration_model_profiled_component ), 3 );
+
+    // Check ordering of summary: by type, then by decreasing time.
+    std::vector< ProfiledComponentSummary > summary = profiler.getSummary( );
+    BOOST_CHECK_EQUAL( summary.size( ), 3 );
+    BOOST_CHECK_EQUAL( summary.at( 0 ).componentType, environment_update_profiled_component );
+    BOOST_CHECK_EQUAL( summary.at( 1 ).componentName, "Second" );
+    BOOST_CHECK_EQUAL( summary.at( 2 ).componentName, "First" );
+
+    std::ostringstream summaryStream;
+    profiler.printSummary( summaryStream );
+    BOOST_CHECK( summaryStream.str( ).find( "Acceleration model" ) != std::string::npos );
+
+    // Check that measurements are reset, but components retained.
+    profiler.resetMeasurements( );
+    BOOST_CHECK_EQUAL( profiler.getComponentSummary( secondIndex ).numberOfCalls, 0 );
+    BOOST_CHECK_EQUAL( profiler.getComponentSummary( secondIndex ).totalTime, 0.0 );
+    BOOST_CHECK_EQUAL( profiler.getSummary( ).size( ), 3 );
+}
+
+//! Test measurements by scoped timer.
+BOOST_AUTO_TEST_CASE( testScopedProfilerTimer )
+{
+    PerformanceProfiler profiler;
+    unsigned int componentIndex = profiler.addComponent( custom_profiled_component, "Sleep" );
+
+    {
+        ScopedProfilerTimer timer( &profiler, componentIndex );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+
+        std::vector< double >* allocatedVector = new std::vector< double >( 10 );
+        delete allocatedVector;
+    }
+
+    // Timer without profiler does nothing.
+    {
+        ScopedProfilerTimer timer( nullptr, componentIndex );
+    }
+
+    BOOST_CHECK_EQUAL( profiler.getComponentSummary( componentIndex ).numberOfCalls, 1 );
+    BOOST_CHECK( profiler.getComponentSummary( componentIndex ).totalTime >= 0.015 );
+    if( areAllocationsCounted( ) )
+    {
+        BOOST_CHECK( profiler.getComponentSummary( componentIndex ).numberOfAllocations >= 2 );
+    }
+    else
+    {
+        BOOST_CHECK_EQUAL( profiler.getComponentSummary( componentIndex ).numberOfAllocations, 0 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -10,6 +10,9 @@
 
 #define BOOST_TEST_MAIN
 
+#include <limits>
+#include <stdexcept>
+
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Basics/testMacros.h"
@@ -404,6 +407,80 @@ BOOST_AUTO_TEST_CASE( testComparisonOperators )
     }
 }
 
+//! Test if Time retains sub-femtosecond resolution over long periods of time, and for accumulated operations
+BOOST_AUTO_TEST_CASE( testLongPeriodResolution )
+{
+    // Define epoch about 30 years after reference epoch.
+    const int numberOfHours = 30 * 8766;
+    Time epoch( numberOfHours, 1234.5L );
+
+    // Check if a sub-femtosecond difference is retained.
+    Time shiftedEpoch = epoch + 1.0E-17;
+    BOOST_CHECK( shiftedEpoch > epoch );
+    BOOST_CHECK( epoch < shiftedEpoch );
+    BOOST_CHECK( shiftedEpoch != epoch );
+    Time timeDifference = shiftedEpoch - epoch;
+    BOOST_CHECK_EQUAL( timeDifference.getFullPeriods( ), 0 );
+    BOOST_CHECK_CLOSE_FRACTION( timeDifference.getSeconds< long double >( ), 1.0E-17L, 1.0E-10L );
+
+    // Accumulate 2^20 millisecond steps, and compare to analytical result (product is exact in double precision).
+    Time accumulatedTime( numberOfHours, 0.0L );
+    const double timeStep = 1.0E-3;
+    const int numberOfSteps = 1048576;
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        accumulatedTime += timeStep;
+    }
+    Time expectedTime = Time( numberOfHours, 0.0L ) + static_cast< double >( numberOfSteps ) * timeStep;
+    BOOST_CHECK_SMALL( std::fabs( ( accumulatedTime - expectedTime ).getSeconds< long double >( ) ), 1.0E-18L );
+
+    // Check consistency of >= and <= operators when full periods are equal.
+    Time laterTime( numberOfHours, 1234.6L );
+    BOOST_CHECK( !( epoch >= laterTime ) );
+    BOOST_CHECK( laterTime >= epoch );
+    BOOST_CHECK( epoch <= laterTime );
+    BOOST_CHECK( !( laterTime <= epoch ) );
+
+    // Check consistency of compound and binary division/multiplication operators.
+    Time dividedTime = epoch;
+    dividedTime /= 7.0;
+    BOOST_CHECK( dividedTime == epoch / 7.0 );
+    dividedTime *= 7.0;
+    BOOST_CHECK_SMALL( std::fabs( ( dividedTime - epoch ).getSeconds< long double >( ) ), 1.0E-18L );
+
+    // Check normalization for negative times and for values exactly at end of period.
+    Time negativeTime( 0, -1.0E-20L );
+    BOOST_CHECK_EQUAL( negativeTime.getFullPeriods( ), -1 );
+    BOOST_CHECK( negativeTime.getSecondsIntoFullPeriod( ) <= TIME_NORMALIZATION_TERM );
+    BOOST_CHECK( negativeTime < Time( 0, 0.0L ) );
+    Time endOfPeriodTime( 3, TIME_NORMALIZATION_TERM );
+    BOOST_CHECK_EQUAL( endOfPeriodTime.getFullPeriods( ), 4 );
+    BOOST_CHECK_EQUAL( endOfPeriodTime.getSecondsIntoFullPeriod( ), 0.0L );
+    BOOST_CHECK_EQUAL( endOfPeriodTime.getFractionOfTick( ), 0.0 );
+
+    // Check multiplication for number of ticks that is not exactly representable as double (about 10,000 years).
+    Time distantEpoch( 10000 * 8766, 1.0L );
+    distantEpoch += 3.0 / TIME_TICKS_PER_SECOND;
+    BOOST_CHECK( distantEpoch.getNumberOfTicks( ) > 9007199254740992LL );
+    BOOST_CHECK( static_cast< long long >( static_cast< double >( distantEpoch.getNumberOfTicks( ) ) ) !=
+                 distantEpoch.getNumberOfTicks( ) );
+    Time tripledEpoch = distantEpoch * 3.0;
+    BOOST_CHECK_EQUAL( tripledEpoch.getNumberOfTicks( ), 3 * distantEpoch.getNumberOfTicks( ) );
+    BOOST_CHECK_EQUAL( tripledEpoch.getFractionOfTick( ), 0.0 );
+    Time halvedEpoch = distantEpoch * 0.5;
+    BOOST_CHECK_EQUAL( halvedEpoch.getNumberOfTicks( ), distantEpoch.getNumberOfTicks( ) / 2 );
+    BOOST_CHECK_EQUAL( halvedEpoch.getFractionOfTick( ), 0.5 );
+
+    // Check that NaN is propagated, and that infinite and out-of-range values are rejected.
+    Time nanTime = epoch;
+    nanTime += TUDAT_NAN;
+    BOOST_CHECK( !( nanTime.getSeconds< double >( ) == nanTime.getSeconds< double >( ) ) );
+    BOOST_CHECK( !( nanTime == nanTime ) );
+    Time invalidTime = epoch;
+    BOOST_CHECK_THROW( invalidTime *= 1.0E300, std::runtime_error );
+    BOOST_CHECK_THROW( Time( 0, std::numeric_limits< long double >::infinity( ) ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,306 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLELLOOP_H
+#define TUDAT_PARALLELLOOP_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the default number of threads to be used for parallel computations
+/*!
+ *  Function to retrieve the default number of threads to be used for parallel computations, equal to the number of
+ *  concurrent threads supported by the hardware (or 1 if this number cannot be determined).
+ *  \return Default number of threads to be used for parallel computations
+ */
+inline int getDefaultNumberOfThreads( )
+{
+    unsigned int numberOfHardwareThreads = std::thread::hardware_concurrency( );
+    return ( numberOfHardwareThreads > 0 ) ? static_cast< int >( numberOfHardwareThreads ) : 1;
+}
+
+//! Function to execute the body of a loop over a range of indices, distributed over a number of threads
+/*!
+ *  Function to execute the body of a loop over a range of indices (0 to numberOfIterations-1), distributed over a number
+ *  of threads. Indices are handed out to the threads one at a time, so that iterations of unequal cost are balanced
+ *  over the threads. The order in which the iterations are executed is not defined, so the loop body must be safe to
+ *  call concurrently for different indices (typically, by only writing to output entries associated with the index).
+ *  The calling thread participates in the execution of the loop. If any iteration throws an exception, no new
+ *  iterations are started, and the first exception that was thrown is rethrown once all threads have finished.
+ *  \param numberOfIterations Number of iterations of the loop
+ *  \param loopBody Function (or function object) that executes a single iteration, with the index as input
+ *  \param numberOfThreads Maximum number of threads that is used (if 1 or less, the loop is executed serially)
+ */
+template< typename LoopBody >
+void executeParallelLoop( const int numberOfIterations, LoopBody loopBody,
+                          const int numberOfThreads = getDefaultNumberOfThreads( ) )
+{
+    int numberOfWorkers = std::min( numberOfThreads, numberOfIterations );
+
+    // Execute loop serially, if required.
+    if( numberOfWorkers <= 1 )
+    {
+        for( int i = 0; i < numberOfIterations; i++ )
+        {
+            loopBody( i );
+        }
+        return;
+    }
+
+    std::atomic< int > nextIndex( 0 );
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    // Define function executed by each thread, handling iterations until none are left.
+    auto executeIterations = [ & ]( )
+    {
+        int currentIndex;
+        while( ( currentIndex = nextIndex++ ) < numberOfIterations )
+        {
+            try
+            {
+                loopBody( currentIndex );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > exceptionLock( exceptionMutex );
+                if( !firstException )
+                {
+                    firstException = std::current_exception( );
+                }
+                nextIndex = numberOfIterations;
+            }
+        }
+    };
+
+    // Start worker threads, and participate in the loop from the calling thread.
+    std::vector< std::thread > workerThreads;
+    for( int i = 0; i < numberOfWorkers - 1; i++ )
+    {
+        workerThreads.push_back( std::thread( executeIterations ) );
+    }
+    executeIterations( );
+
+    for( unsigned int i = 0; i < workerThreads.size( ); i++ )
+    {
+        workerThreads.at( i ).join( );
+    }
+
+    if( firstException )
+    {
+        std::rethrow_exception( firstException );
+    }
+}
+
+//! Class to repeatedly execute loops over a range of indices, distributed over a persistent set of threads
+/*!
+ *  Class to repeatedly execute loops over a range of indices, distributed over a set of worker threads that is created
+ *  once, upon construction, and kept alive (waiting) between loops. This avoids the overhead of starting new threads for
+ *  each loop, as done by executeParallelLoop, when many short loops are executed (e.g. once per integration step). The
+ *  scheduling of the iterations and the handling of exceptions is identical to that of executeParallelLoop. The
+ *  executeLoop function may only be called from one thread at a time, and may not be called from inside a loop body.
+ */
+class ParallelLoopExecutor
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, starts the worker threads.
+     *  \param numberOfThreads Maximum number of threads that is used, including the calling thread (if 1 or less, loops
+     *  are executed serially, and no worker threads are started).
+     */
+    ParallelLoopExecutor( const int numberOfThreads ):
+        numberOfIterations_( 0 ), nextIndex_( 0 ), loopCounter_( 0 ), numberOfBusyWorkers_( 0 ),
+        isStopRequested_( false )
+    {
+        for( int i = 0; i < numberOfThreads - 1; i++ )
+        {
+            workerThreads_.push_back( std::thread( &ParallelLoopExecutor::runWorker, this ) );
+        }
+    }
+
+    //! Destructor, stops and joins the worker threads.
+    ~ParallelLoopExecutor( )
+    {
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            isStopRequested_ = true;
+        }
+        startCondition_.notify_all( );
+
+        for( unsigned int i = 0; i < workerThreads_.size( ); i++ )
+        {
+            workerThreads_.at( i ).join( );
+        }
+    }
+
+    ParallelLoopExecutor( const ParallelLoopExecutor& ) = delete;
+
+    ParallelLoopExecutor& operator=( const ParallelLoopExecutor& ) = delete;
+
+    //! Function to execute the body of a loop over a range of indices, distributed over the threads
+    /*!
+     *  Function to execute the body of a loop over a range of indices (0 to numberOfIterations-1), distributed over the
+     *  worker threads and the calling thread (see executeParallelLoop). The function returns once all iterations have
+     *  finished. If any iteration throws an exception, the first exception that was thrown is rethrown.
+     *  \param numberOfIterations Number of iterations of the loop
+     *  \param loopBody Function that executes a single iteration, with the index as input
+     */
+    void executeLoop( const int numberOfIterations, const std::function< void( const int ) >& loopBody )
+    {
+        // Execute loop serially, if required.
+        if( workerThreads_.size( ) == 0 || numberOfIterations <= 1 )
+        {
+            for( int i = 0; i < numberOfIterations; i++ )
+            {
+                loopBody( i );
+            }
+            return;
+        }
+
+        // Set current loop, and start workers.
+        {
+            std::lock_guard< std::mutex > lock( mutex_ );
+            loopBody_ = loopBody;
+            numberOfIterations_ = numberOfIterations;
+            nextIndex_ = 0;
+            firstException_ = nullptr;
+            numberOfBusyWorkers_ = workerThreads_.size( );
+            loopCounter_++;
+        }
+        startCondition_.notify_all( );
+
+        // Participate in the loop from the calling thread, and wait for the workers to finish.
+        executeIterations( );
+        std::exception_ptr firstException;
+        {
+            std::unique_lock< std::mutex > lock( mutex_ );
+            finishCondition_.wait( lock, [ & ]( ){ return numberOfBusyWorkers_ == 0; } );
+            loopBody_ = nullptr;
+            firstException = firstException_;
+        }
+
+        if( firstException )
+        {
+            std::rethrow_exception( firstException );
+        }
+    }
+
+    //! Function to retrieve the maximum number of threads that is used, including the calling thread.
+    int getNumberOfThreads( ) const
+    {
+        return workerThreads_.size( ) + 1;
+    }
+
+private:
+
+    //! Function executed by each worker thread, executing the iterations of each new loop until stopped.
+    void runWorker( )
+    {
+        unsigned int lastLoopCounter = 0;
+        while( true )
+        {
+            {
+                std::unique_lock< std::mutex > lock( mutex_ );
+                startCondition_.wait( lock, [ & ]( ){ return isStopRequested_ || loopCounter_ != lastLoopCounter; } );
+                if( isStopRequested_ )
+                {
+                    return;
+                }
+                lastLoopCounter = loopCounter_;
+            }
+
+            executeIterations( );
+
+            {
+                std::lock_guard< std::mutex > lock( mutex_ );
+                numberOfBusyWorkers_--;
+            }
+            finishCondition_.notify_one( );
+        }
+    }
+
+    //! Function to execute iterations of the current loop, until none are left.
+    void executeIterations( )
+    {
+        int currentIndex;
+        while( ( currentIndex = nextIndex_++ ) < numberOfIterations_ )
+        {
+            try
+            {
+                loopBody_( currentIndex );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > exceptionLock( exceptionMutex_ );
+                if( !firstException_ )
+                {
+                    firstException_ = std::current_exception( );
+                }
+                nextIndex_ = numberOfIterations_;
+            }
+        }
+    }
+
+    //! Worker threads (the calling thread of executeLoop participates in addition to these).
+    std::vector< std::thread > workerThreads_;
+
+    //! Body of the loop that is currently executed.
+    std::function< void( const int ) > loopBody_;
+
+    //! Number of iterations of the loop that is currently executed.
+    int numberOfIterations_;
+
+    //! Index of the next iteration of the current loop that is to be executed.
+    std::atomic< int > nextIndex_;
+
+    //! Number of loops that has been started (used by the workers to detect a new loop).
+    unsigned int loopCounter_;
+
+    //! Number of worker threads that have not yet finished the current loop.
+    unsigned int numberOfBusyWorkers_;
+
+    //! Boolean denoting whether the worker threads are to be stopped.
+    bool isStopRequested_;
+
+    //! First exception thrown by an iteration of the current loop (if any).
+    std::exception_ptr firstException_;
+
+    //! Mutex protecting the loop settings and worker status.
+    std::mutex mutex_;
+
+    //! Mutex protecting the first exception.
+    std::mutex exceptionMutex_;
+
+    //! Condition variable used to notify the workers of a new loop (or of a stop request).
+    std::condition_variable startCondition_;
+
+    //! Condition variable used to notify the calling thread of a finished worker.
+    std::condition_variable finishCondition_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELLOOP_H
@@ -0,0 +1,278 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+
+#if( USE_ALLOCATION_COUNTING )
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
+
+#include "Tudat/Basics/performanceProfiler.h"
+
+#if( USE_ALLOCATION_COUNTING )
+
+namespace
+{
+
+//! Number of calls to global operator new since the start of the program.
+std::atomic< unsigned long long > globalNumberOfAllocations( 0 );
+
+}
+
+//! Replacement of global operator new, counting the number of allocations.
+void* operator new( std::size_t size )
+{
+    globalNumberOfAllocations.fetch_add( 1, std::memory_order_relaxed );
+    if( size == 0 )
+    {
+        size = 1;
+    }
+
+    void* allocatedMemory;
+    while( ( allocatedMemory = std::malloc( size ) ) == nullptr )
+    {
+        std::new_handler newHandler = std::get_new_handler( );
+        if( newHandler == nullptr )
+        {
+            throw std::bad_alloc( );
+        }
+        newHandler( );
+    }
+    return allocatedMemory;
+}
+
+//! Replacement of global operator new[], counting the number of allocations.
+void* operator new[ ]( std::size_t size )
+{
+    return operator new( size );
+}
+
+//! Replacement of global operator delete, consistent with replaced operator new.
+void operator delete( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+//! Replacement of global operator delete[], consistent with replaced operator new[].
+void operator delete[ ]( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+//! Replacement of global sized operator delete, consistent with replaced operator new.
+void operator delete( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+//! Replacement of global sized operator delete[], consistent with replaced operator new[].
+void operator delete[ ]( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+#endif
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve a string describing a type of profiled component.
+std::string getProfiledComponentTypeName( const ProfiledComponentType componentType )
+{
+    std::string componentTypeName;
+    switch( componentType )
+    {
+    case state_derivative_profiled_component:
+        componentTypeName = "State derivative";
+        break;
+    case environment_update_profiled_component:
+        componentTypeName = "Environment update";
+        break;
+    case acceleration_model_profiled_component:
+        componentTypeName = "Acceleration model";
+        break;
+    case dependent_variable_profiled_component:
+        componentTypeName = "Dependent variables";
+        break;
+    case integrator_overhead_profiled_component:
+        componentTypeName = "Integrator overhead";
+        break;
+    case custom_profiled_component:
+        componentTypeName = "Custom";
+        break;
+    default:
+        throw std::runtime_error( "Error, profiled component type " + std::to_string( componentType ) +
+                                  " not recognized when retrieving name." );
+    }
+    return componentTypeName;
+}
+
+//! Function to check whether allocations are counted by the profiler.
+bool areAllocationsCounted( )
+{
+#if( USE_ALLOCATION_COUNTING )
+    return true;
+#else
+    return false;
+#endif
+}
+
+//! Function to retrieve the number of dynamic memory allocations since the start of the program.
+unsigned long long getNumberOfAllocations( )
+{
+#if( USE_ALLOCATION_COUNTING )
+    return globalNumberOfAllocations.load( std::memory_order_relaxed );
+#else
+    return 0;
+#endif
+}
+
+//! Function to register a component for profiling.
+unsigned int PerformanceProfiler::addComponent(
+        const ProfiledComponentType componentType, const std::string& componentName )
+{
+    std::pair< ProfiledComponentType, std::string > componentId = std::make_pair( componentType, componentName );
+    std::map< std::pair< ProfiledComponentType, std::string >, unsigned int >::const_iterator componentIterator =
+            componentIndices_.find( componentId );
+    if( componentIterator != componentIndices_.end( ) )
+    {
+        return componentIterator->second;
+    }
+
+    ProfiledComponentSummary newComponent;
+    newComponent.componentType = componentType;
+    newComponent.componentName = componentName;
+    newComponent.numberOfCalls = 0;
+    newComponent.totalTime = 0.0;
+    newComponent.numberOfAllocations = 0;
+    components_.push_back( newComponent );
+
+    componentIndices_[ componentId ] = components_.size( ) - 1;
+    return components_.size( ) - 1;
+}
+
+//! Function to retrieve the profiling results of all components.
+std::vector< ProfiledComponentSummary > PerformanceProfiler::getSummary( ) const
+{
+    std::vector< ProfiledComponentSummary > summary = components_;
+    std::stable_sort( summary.begin( ), summary.end( ),
+                      [ ]( const ProfiledComponentSummary& first, const ProfiledComponentSummary& second )
+    {
+        if( first.componentType != second.componentType )
+        {
+            return first.componentType < second.componentType;
+        }
+        return first.totalTime > second.totalTime;
+    } );
+    return summary;
+}
+
+//! Function to retrieve the total time spent in all components of a given type.
+double PerformanceProfiler::getTotalTime( const ProfiledComponentType componentType ) const
+{
+    double totalTime = 0.0;
+    for( unsigned int i = 0; i < components_.size( ); i++ )
+    {
+        if( components_.at( i ).componentType == componentType )
+        {
+            totalTime += components_.at( i ).totalTime;
+        }
+    }
+    return totalTime;
+}
+
+//! Function to retrieve the total number of allocations made in all components of a given type.
+unsigned long long PerformanceProfiler::getTotalNumberOfAllocations( const ProfiledComponentType componentType ) const
+{
+    unsigned long long totalNumberOfAllocations = 0;
+    for( unsigned int i = 0; i < components_.size( ); i++ )
+    {
+        if( components_.at( i ).componentType == componentType )
+        {
+            totalNumberOfAllocations += components_.at( i ).numberOfAllocations;
+        }
+    }
+    return totalNumberOfAllocations;
+}
+
+//! Function to print the profiling results of all components, as a table.
+void PerformanceProfiler::printSummary( std::ostream& outputStream, const double referenceTime ) const
+{
+    double totalTime = referenceTime;
+    if( !( totalTime > 0.0 ) )
+    {
+        totalTime = getTotalTime( state_derivative_profiled_component ) +
+                getTotalTime( dependent_variable_profiled_component ) +
+                getTotalTime( integrator_overhead_profiled_component );
+    }
+
+    std::vector< ProfiledComponentSummary > summary = getSummary( );
+
+    std::ios::fmtflags originalFlags = outputStream.flags( );
+    std::streamsize originalPrecision = outputStream.precision( );
+
+    outputStream << "Performance profile (total time: " << totalTime << " s";
+    if( !areAllocationsCounted( ) )
+    {
+        outputStream << ", allocations not counted";
+    }
+    outputStream << ")" << std::endl;
+    outputStream << std::left << std::setw( 22 ) << "Type" << std::setw( 50 ) << "Component"
+                 << std::right << std::setw( 12 ) << "Calls" << std::setw( 14 ) << "Time [s]"
+                 << std::setw( 10 ) << "Time [%]" << std::setw( 14 ) << "Time/call [s]";
+    if( areAllocationsCounted( ) )
+    {
+        outputStream << std::setw( 14 ) << "Allocations";
+    }
+    outputStream << std::endl;
+
+    for( unsigned int i = 0; i < summary.size( ); i++ )
+    {
+        const ProfiledComponentSummary& component = summary.at( i );
+        outputStream << std::left << std::setw( 22 ) << getProfiledComponentTypeName( component.componentType )
+                     << std::setw( 50 ) << component.componentName << std::right
+                     << std::setw( 12 ) << component.numberOfCalls
+                     << std::setw( 14 ) << std::scientific << std::setprecision( 4 ) << component.totalTime
+                     << std::setw( 10 ) << std::fixed << std::setprecision( 2 )
+                     << ( totalTime > 0.0 ? 100.0 * component.totalTime / totalTime : 0.0 )
+                     << std::setw( 14 ) << std::scientific << std::setprecision( 4 )
+                     << ( component.numberOfCalls > 0 ? component.totalTime / component.numberOfCalls : 0.0 );
+        if( areAllocationsCounted( ) )
+        {
+            outputStream << std::setw( 14 ) << component.numberOfAllocations;
+        }
+        outputStream << std::endl;
+    }
+
+    outputStream.flags( originalFlags );
+    outputStream.precision( originalPrecision );
+}
+
+//! Function to reset the measurements of all components (registered components are retained).
+void PerformanceProfiler::resetMeasurements( )
+{
+    for( unsigned int i = 0; i < components_.size( ); i++ )
+    {
+        components_[ i ].numberOfCalls = 0;
+        components_[ i ].totalTime = 0.0;
+        components_[ i ].numberOfAllocations = 0;
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
@@ -0,0 +1,239 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PERFORMANCEPROFILER_H
+#define TUDAT_PERFORMANCEPROFILER_H
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Enum listing the types of components of a propagation that may be profiled.
+enum ProfiledComponentType
+{
+    state_derivative_profiled_component = 0,
+    environment_update_profiled_component = 1,
+    acceleration_model_profiled_component = 2,
+    dependent_variable_profiled_component = 3,
+    integrator_overhead_profiled_component = 4,
+    custom_profiled_component = 5
+};
+
+//! Function to retrieve a string describing a type of profiled component.
+/*!
+ *  Function to retrieve a string describing a type of profiled component.
+ *  \param componentType Type of profiled component.
+ *  \return String describing the type of profiled component.
+ */
+std::string getProfiledComponentTypeName( const ProfiledComponentType componentType );
+
+//! Function to check whether allocations are counted by the profiler.
+/*!
+ *  Function to check whether allocations are counted by the profiler. Counting allocations requires the global
+ *  operator new to be replaced, which is only done if Tudat is compiled with USE_ALLOCATION_COUNTING.
+ *  \return True if allocations are counted, false otherwise.
+ */
+bool areAllocationsCounted( );
+
+//! Function to retrieve the number of dynamic memory allocations since the start of the program.
+/*!
+ *  Function to retrieve the number of dynamic memory allocations (calls to global operator new) since the start of
+ *  the program, summed over all threads.
+ *  \return Number of dynamic memory allocations since the start of the program (always 0 if Tudat is not compiled
+ *  with USE_ALLOCATION_COUNTING).
+ */
+unsigned long long getNumberOfAllocations( );
+
+//! Summary of the profiling results of a single component.
+struct ProfiledComponentSummary
+{
+    //! Type of the component.
+    ProfiledComponentType componentType;
+
+    //! Name of the component.
+    std::string componentName;
+
+    //! Number of times the component was evaluated.
+    unsigned long long numberOfCalls;
+
+    //! Total wall-clock time spent in the component (in seconds).
+    double totalTime;
+
+    //! Number of dynamic memory allocations made while evaluating the component.
+    unsigned long long numberOfAllocations;
+};
+
+//! Class to measure the time spent in (and allocations made by) individual components of a computation.
+/*!
+ *  Class to measure the wall-clock time spent in, and number of dynamic memory allocations made by, individual
+ *  components of a computation (e.g. each acceleration model and environment update during a numerical propagation).
+ *  Components are registered once, with a type and a name, after which measurements are added for the index returned by
+ *  addComponent (typically by using a ScopedProfilerTimer). Components may be nested (e.g. an acceleration model inside
+ *  the state derivative evaluation), in which case the time of the inner component is also contained in the time of
+ *  the outer component. The object is not thread-safe.
+ */
+class PerformanceProfiler
+{
+public:
+
+    //! Constructor.
+    PerformanceProfiler( ){ }
+
+    //! Function to register a component for profiling.
+    /*!
+     *  Function to register a component for profiling. If a component with the same type and name was already
+     *  registered, its index is returned, so that its measurements are accumulated.
+     *  \param componentType Type of the component.
+     *  \param componentName Name of the component.
+     *  \return Index of the component, to be used when adding measurements.
+     */
+    unsigned int addComponent( const ProfiledComponentType componentType, const std::string& componentName );
+
+    //! Function to add a measurement for a component.
+    /*!
+     *  Function to add a measurement for a component, i.e. a single evaluation of the component.
+     *  \param componentIndex Index of the component, as returned by addComponent.
+     *  \param elapsedTime Wall-clock time spent in the component (in seconds).
+     *  \param numberOfAllocations Number of dynamic memory allocations made while evaluating the component.
+     */
+    void addMeasurement( const unsigned int componentIndex, const double elapsedTime,
+                         const unsigned long long numberOfAllocations = 0 )
+    {
+        ProfiledComponentSummary& component = components_[ componentIndex ];
+        component.numberOfCalls++;
+        component.totalTime += elapsedTime;
+        component.numberOfAllocations += numberOfAllocations;
+    }
+
+    //! Function to retrieve the profiling results of a single component.
+    /*!
+     *  Function to retrieve the profiling results of a single component.
+     *  \param componentIndex Index of the component, as returned by addComponent.
+     *  \return Profiling results of the component.
+     */
+    const ProfiledComponentSummary& getComponentSummary( const unsigned int componentIndex ) const
+    {
+        return components_.at( componentIndex );
+    }
+
+    //! Function to retrieve the profiling results of all components.
+    /*!
+     *  Function to retrieve the profiling results of all components, sorted by type and, per type, by decreasing total
+     *  time.
+     *  \return Profiling results of all components.
+     */
+    std::vector< ProfiledComponentSummary > getSummary( ) const;
+
+    //! Function to retrieve the total time spent in all components of a given type.
+    /*!
+     *  Function to retrieve the total time spent in all components of a given type.
+     *  \param componentType Type of the components.
+     *  \return Total time spent in all components of a given type (in seconds).
+     */
+    double getTotalTime( const ProfiledComponentType componentType ) const;
+
+    //! Function to retrieve the total number of allocations made in all components of a given type.
+    /*!
+     *  Function to retrieve the total number of allocations made in all components of a given type.
+     *  \param componentType Type of the components.
+     *  \return Total number of allocations made in all components of a given type.
+     */
+    unsigned long long getTotalNumberOfAllocations( const ProfiledComponentType componentType ) const;
+
+    //! Function to print the profiling results of all components, as a table.
+    /*!
+     *  Function to print the profiling results of all components, as a table, in the order given by getSummary.
+     *  \param outputStream Stream to which the table is written.
+     *  \param referenceTime Time with respect to which the fraction of time spent in each component is given
+     *  (in seconds). If not positive, the total time spent in the state derivative, dependent variable and integrator
+     *  overhead components is used.
+     */
+    void printSummary( std::ostream& outputStream = std::cout, const double referenceTime = 0.0 ) const;
+
+    //! Function to reset the measurements of all components (registered components are retained).
+    void resetMeasurements( );
+
+private:
+
+    //! Profiling results of all registered components.
+    std::vector< ProfiledComponentSummary > components_;
+
+    //! Index of each registered component, with type and name as key.
+    std::map< std::pair< ProfiledComponentType, std::string >, unsigned int > componentIndices_;
+};
+
+//! Class that adds a measurement for a profiled component, covering its own lifetime.
+/*!
+ *  Class that adds a measurement for a profiled component, covering its own lifetime: the time and number of
+ *  allocations are recorded upon construction, and the difference is added to the profiler upon destruction. If no
+ *  profiler is provided (nullptr), the object does nothing.
+ */
+class ScopedProfilerTimer
+{
+public:
+
+    //! Constructor, starts the measurement.
+    /*!
+     *  Constructor, starts the measurement.
+     *  \param profiler Profiler to which the measurement is added (nullptr if no measurement is to be made).
+     *  \param componentIndex Index of the component in the profiler.
+     */
+    ScopedProfilerTimer( PerformanceProfiler* profiler, const unsigned int componentIndex ):
+        profiler_( profiler ), componentIndex_( componentIndex )
+    {
+        if( profiler_ != nullptr )
+        {
+            startNumberOfAllocations_ = getNumberOfAllocations( );
+            startTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Destructor, adds the measurement to the profiler.
+    ~ScopedProfilerTimer( )
+    {
+        if( profiler_ != nullptr )
+        {
+            const double elapsedTime = std::chrono::duration< double >(
+                        std::chrono::steady_clock::now( ) - startTime_ ).count( );
+            profiler_->addMeasurement( componentIndex_, elapsedTime,
+                                       getNumberOfAllocations( ) - startNumberOfAllocations_ );
+        }
+    }
+
+private:
+
+    //! Profiler to which the measurement is added.
+    PerformanceProfiler* profiler_;
+
+    //! Index of the component in the profiler.
+    unsigned int componentIndex_;
+
+    //! Time at which the measurement was started.
+    std::chrono::steady_clock::time_point startTime_;
+
+    //! Number of allocations at the start of the measurement.
+    unsigned long long startNumberOfAllocations_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PERFORMANCEPROFILER_H
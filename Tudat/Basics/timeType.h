@@ -13,6 +13,10 @@
 
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include <Eigen/Core>
 
@@ -21,24 +25,36 @@
 namespace tudat
 {
 
+//! Number of seconds in a single full period of the Time class (one hour).
 static const long double TIME_NORMALIZATION_TERM = 3600.0L;
 
+//! Number of ticks (internal time units of the Time class) per second.
+static const double TIME_TICKS_PER_SECOND = 1048576.0;
+
+//! Number of ticks (internal time units of the Time class) per full period (one hour).
+static const long long TIME_TICKS_PER_FULL_PERIOD = 3774873600LL;
+
 //! Class for defining time with a resolution that is sub-fs for very long periods of time.
 /*!
  *  Class for defining time with a resolution that is sub-fs for very long periods of time. Using double or long double
  *  precision as a representation of time, the issue of reduced quality will occur that over long time-period. For instance,
  *  over a period of 10^8 seconds (about 3 years), double and long double representations have resolution of about 10^-8 and
- *  10^-11 s respectively, which is insufficient for various applications. This type uses an int to represent the number of
- *  hours since an epoch, and long double to represent the number of seconds into the present hour. This provides a
- *  resulution of < 1 femtosecond, over a range of 2147483647 hours (about 300,000 years), which is more than sufficient for
- *  practical applications.
+ *  10^-11 s respectively, which is insufficient for various applications. This type uses a 64-bit integer to represent
+ *  the number of 'ticks' of 2^-20 s (about 1 microsecond) since an epoch, and a double to represent the fraction of the
+ *  current tick. This provides a resolution of about 10^-22 s, over a range of about +/- 270,000 years (limited to
+ *  +/- 9 10^18 ticks), which is more than sufficient for practical applications. Results outside this range, or
+ *  infinite values, result in an exception; a NaN time is represented by a NaN fraction of a tick. Since a tick is a power of two of seconds, a double or long double number of
+ *  seconds is split exactly into ticks and a fraction of a tick, and adding a time interval only requires a single
+ *  floating-point and a single integer addition. No long double arithmetic is used in the arithmetic operators, as it is
+ *  slow on most platforms (x87 on x86-64, software emulation on others). The seconds since epoch can be retrieved in
+ *  terms of full hours since epoch, and seconds into the current hour.
  */
 class Time
 {
 public:
 
     //! Constructor, initialize time to 0
-    Time( ):fullPeriods_( 0 ), secondsIntoFullPeriod_( 0.0L ){ }
+    Time( ):numberOfTicks_( 0 ), fractionOfTick_( 0.0 ){ }
 
     //! Constructor, sets current hour and time into current hour directly
     /*!
@@ -49,9 +65,9 @@ public:
      * is in this range.
      */
     Time( const int fullPeriods, const long double secondsIntoFullPeriod ):
-        fullPeriods_( fullPeriods ), secondsIntoFullPeriod_( secondsIntoFullPeriod )
+        numberOfTicks_( static_cast< long long >( fullPeriods ) * TIME_TICKS_PER_FULL_PERIOD ), fractionOfTick_( 0.0 )
     {
-        normalizeMembers( );
+        addSeconds( secondsIntoFullPeriod );
     }
 
     //! Constructor, sets number of seconds since epoch (with long double representation as input)
@@ -60,9 +76,9 @@ public:
      * \param numberOfSeconds Number of seconds since epoch.
      */
     Time( const long double numberOfSeconds ):
-        fullPeriods_( 0 ), secondsIntoFullPeriod_( numberOfSeconds )
+        numberOfTicks_( 0 ), fractionOfTick_( 0.0 )
     {
-        normalizeMembers( );
+        addSeconds( numberOfSeconds );
     }
 
     //! Constructor, sets number of seconds since epoch (with double representation as input)
@@ -71,9 +87,9 @@ public:
      * \param secondsIntoFullPeriod Number of seconds since epoch.
      */
     Time( const double secondsIntoFullPeriod ):
-        fullPeriods_( 0 ), secondsIntoFullPeriod_( static_cast< long double >( secondsIntoFullPeriod ) )
+        numberOfTicks_( 0 ), fractionOfTick_( 0.0 )
     {
-        normalizeMembers( );
+        addSeconds( secondsIntoFullPeriod );
     }
 
     //! Constructor, sets number of seconds since epoch (with int representation as input)
@@ -82,21 +98,18 @@ public:
      * \param secondsIntoFullPeriod Number of seconds since epoch.
      */
     Time( const int secondsIntoFullPeriod ):
-        fullPeriods_( 0 ), secondsIntoFullPeriod_( static_cast< long double >( secondsIntoFullPeriod ) )
-    {
-        normalizeMembers( );
-    }
+        numberOfTicks_( static_cast< long long >( secondsIntoFullPeriod ) *
+                        static_cast< long long >( TIME_TICKS_PER_SECOND ) ), fractionOfTick_( 0.0 )
+    { }
 
     //! Copy constructor
     /*!
-     * Copy constructor
+     * Copy constructor (the copied object is always normalized, so no renormalization is needed).
      * \param otherTime Time that is to be copied.
      */
     Time( const Time& otherTime ):
-        fullPeriods_( otherTime.fullPeriods_ ), secondsIntoFullPeriod_( otherTime.secondsIntoFullPeriod_ )
-    {
-        normalizeMembers( );
-    }
+        numberOfTicks_( otherTime.numberOfTicks_ ), fractionOfTick_( otherTime.fractionOfTick_ )
+    { }
 
     //! Definition of = operator for Time type
     /*!
@@ -106,17 +119,9 @@ public:
      */
     Time& operator=( const Time& timeToCopy )
     {
-        if( this == &timeToCopy )
-        {
-            return *this;
-        }
-        else
-        {
-            secondsIntoFullPeriod_ = timeToCopy.secondsIntoFullPeriod_;
-            fullPeriods_ = timeToCopy.fullPeriods_;
-            normalizeMembers( );
-            return *this;
-        }
+        numberOfTicks_ = timeToCopy.numberOfTicks_;
+        fractionOfTick_ = timeToCopy.fractionOfTick_;
+        return *this;
     }
 
 
@@ -129,8 +134,9 @@ public:
      */
     friend Time operator+( const Time& timeToAdd1, const Time& timeToAdd2 )
     {
-        return Time( timeToAdd1.fullPeriods_ + timeToAdd2.fullPeriods_,
-                     timeToAdd1.secondsIntoFullPeriod_ + timeToAdd2.secondsIntoFullPeriod_ );
+        Time addedTime( timeToAdd1 );
+        addedTime += timeToAdd2;
+        return addedTime;
     }
 
     //! Addition operator for double variable with Time object.
@@ -142,7 +148,9 @@ public:
      */
     friend Time operator+( const double& timeToAdd1, const Time& timeToAdd2 )
     {
-        return Time( timeToAdd2.fullPeriods_, timeToAdd2.secondsIntoFullPeriod_ + static_cast< long double >( timeToAdd1 ) );
+        Time addedTime( timeToAdd2 );
+        addedTime += timeToAdd1;
+        return addedTime;
     }
 
     //! Addition operator for long double variable with Time object.
@@ -154,7 +162,9 @@ public:
      */
     friend Time operator+( const long double& timeToAdd1, const Time& timeToAdd2 )
     {
-        return Time( timeToAdd2.fullPeriods_, timeToAdd2.secondsIntoFullPeriod_ + timeToAdd1 );
+        Time addedTime( timeToAdd2 );
+        addedTime += timeToAdd1;
+        return addedTime;
     }
 
     //! Addition operator for Time object with double variable
@@ -192,9 +202,9 @@ public:
      */
     friend Time operator-( const Time& timeToSubtract1, const Time& timeToSubtract2 )
     {
-
-        return Time( timeToSubtract1.fullPeriods_ - timeToSubtract2.fullPeriods_,
-                     timeToSubtract1.secondsIntoFullPeriod_ - timeToSubtract2.secondsIntoFullPeriod_ );
+        Time subtractedTime( timeToSubtract1 );
+        subtractedTime -= timeToSubtract2;
+        return subtractedTime;
     }
 
     //! Subtraction operator for double from Time object
@@ -206,8 +216,9 @@ public:
      */
     friend Time operator-( const Time& timeToSubtract1, const double timeToSubtract2 )
     {
-        return Time( timeToSubtract1.fullPeriods_,
-                     timeToSubtract1.secondsIntoFullPeriod_ - static_cast< long double >( timeToSubtract2 ) );
+        Time subtractedTime( timeToSubtract1 );
+        subtractedTime -= timeToSubtract2;
+        return subtractedTime;
     }
 
     //! Subtraction operator for double from Time object
@@ -219,7 +230,9 @@ public:
      */
     friend Time operator-( const Time& timeToSubtract1, const long double timeToSubtract2 )
     {
-        return Time( timeToSubtract1.fullPeriods_, timeToSubtract1.secondsIntoFullPeriod_ - timeToSubtract2 );
+        Time subtractedTime( timeToSubtract1 );
+        subtractedTime -= timeToSubtract2;
+        return subtractedTime;
     }
 
     //! Subtraction operator for Time object from double
@@ -231,8 +244,9 @@ public:
      */
     friend Time operator-( const double timeToSubtract1, const Time& timeToSubtract2 )
     {
-        return Time( -timeToSubtract2.fullPeriods_,
-                     static_cast< long double >( timeToSubtract1 ) - timeToSubtract2.secondsIntoFullPeriod_ );
+        Time subtractedTime( timeToSubtract1 );
+        subtractedTime -= timeToSubtract2;
+        return subtractedTime;
     }
 
     //! Subtraction operator for Time object from long double
@@ -244,7 +258,9 @@ public:
      */
     friend Time operator-( const long double timeToSubtract1, const Time& timeToSubtract2 )
     {
-        return Time( -timeToSubtract2.fullPeriods_, timeToSubtract1 - timeToSubtract2.secondsIntoFullPeriod_ );
+        Time subtractedTime( timeToSubtract1 );
+        subtractedTime -= timeToSubtract2;
+        return subtractedTime;
     }
 
 
@@ -257,14 +273,9 @@ public:
      */
     friend Time operator*( const long double timeToMultiply1, const Time& timeToMultiply2 )
     {
-        long double newPeriods = timeToMultiply1 * static_cast< long double >( timeToMultiply2.fullPeriods_ );
-        long double roundedNewPeriods = static_cast< long double >( std::floor( newPeriods ) );
-
-        int newfullPeriods = static_cast< int >( std::round( roundedNewPeriods ) );
-        long double newSecondsIntoFullPeriod_ = timeToMultiply2.secondsIntoFullPeriod_ * timeToMultiply1;
-        newSecondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods ) * TIME_NORMALIZATION_TERM;
-
-        return Time( newfullPeriods, newSecondsIntoFullPeriod_ );
+        Time multipliedTime( timeToMultiply2 );
+        multipliedTime *= timeToMultiply1;
+        return multipliedTime;
     }
 
     //! Multiplication operator of a long double with a Time object (i.e. to rescale time)
@@ -288,16 +299,9 @@ public:
      */
     friend Time operator*( const double timeToMultiply1, const Time& timeToMultiply2 )
     {
-        long double newPeriods = static_cast< long double >( timeToMultiply1 ) *
-                static_cast< long double >( timeToMultiply2.fullPeriods_ );
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        int newfullPeriods = static_cast< int >( std::round( roundedNewPeriods ) );
-        long double newSecondsIntoFullPeriod_ = timeToMultiply2.secondsIntoFullPeriod_ *
-                static_cast< long double >( timeToMultiply1 );
-        newSecondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods ) * TIME_NORMALIZATION_TERM;
-
-        return Time( newfullPeriods, newSecondsIntoFullPeriod_ );
+        Time multipliedTime( timeToMultiply2 );
+        multipliedTime *= timeToMultiply1;
+        return multipliedTime;
     }
 
     //! Multiplication operator of a double with a Time object (i.e. to rescale time)
@@ -321,17 +325,9 @@ public:
      */
     friend const Time operator/( const Time& original, const double doubleToDivideBy )
     {
-        long double newPeriods =  static_cast< long double >( original.fullPeriods_ ) /
-                static_cast< long double >( doubleToDivideBy );
-
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        int newfullPeriods = static_cast< int >( std::round( roundedNewPeriods ) );
-        long double newSecondsIntoFullPeriod_ = original.secondsIntoFullPeriod_ /
-                static_cast< long double >( doubleToDivideBy );
-        newSecondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods ) * TIME_NORMALIZATION_TERM;
-
-        return Time( newfullPeriods, newSecondsIntoFullPeriod_ );
+        Time dividedTime( original );
+        dividedTime /= doubleToDivideBy;
+        return dividedTime;
     }
 
 
@@ -344,15 +340,9 @@ public:
      */
     friend const Time operator/( const Time& original, const long double doubleToDivideBy )
     {
-        long double newPeriods =  static_cast< long double >( original.fullPeriods_ ) / doubleToDivideBy;
-
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        int newfullPeriods = static_cast< int >( std::round( roundedNewPeriods ) );
-        long double newSecondsIntoFullPeriod_ = original.secondsIntoFullPeriod_ /  doubleToDivideBy;
-        newSecondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods ) * TIME_NORMALIZATION_TERM;
-
-        return Time( newfullPeriods, newSecondsIntoFullPeriod_ );
+        Time dividedTime( original );
+        dividedTime /= doubleToDivideBy;
+        return dividedTime;
     }
 
 
@@ -363,8 +353,8 @@ public:
      */
     void operator+=( const Time& timeToAdd )
     {
-        fullPeriods_ += timeToAdd.fullPeriods_;
-        secondsIntoFullPeriod_ += timeToAdd.secondsIntoFullPeriod_;
+        numberOfTicks_ += timeToAdd.numberOfTicks_;
+        fractionOfTick_ += timeToAdd.fractionOfTick_;
         normalizeMembers( );
     }
 
@@ -375,8 +365,7 @@ public:
      */
     void operator+=( const double timeToAdd )
     {
-        secondsIntoFullPeriod_ += static_cast< long double >( timeToAdd );
-        normalizeMembers( );
+        addSeconds( timeToAdd );
     }
 
     //! Add and assign operator for adding a double
@@ -386,8 +375,7 @@ public:
      */
     void operator+=( const long double timeToAdd )
     {
-        secondsIntoFullPeriod_ += timeToAdd;
-        normalizeMembers( );
+        addSeconds( timeToAdd );
     }
 
     //! Subtract and assign operator for adding a Time
@@ -397,8 +385,8 @@ public:
      */
     void operator-=( const Time& timeToSubtract )
     {
-        fullPeriods_ -= timeToSubtract.fullPeriods_;
-        secondsIntoFullPeriod_ -= timeToSubtract.secondsIntoFullPeriod_;
+        numberOfTicks_ -= timeToSubtract.numberOfTicks_;
+        fractionOfTick_ -= timeToSubtract.fractionOfTick_;
         normalizeMembers( );
     }
 
@@ -409,8 +397,7 @@ public:
      */
     void operator-=( const double timeToSubtract )
     {
-        secondsIntoFullPeriod_ -= static_cast< long double >( timeToSubtract );
-        normalizeMembers( );
+        addSeconds( -timeToSubtract );
     }
 
     //! Subtract and assign operator for adding a long double
@@ -420,8 +407,7 @@ public:
      */
     void operator-=( const long double timeToSubtract )
     {
-        secondsIntoFullPeriod_ -= timeToSubtract;
-        normalizeMembers( );
+        addSeconds( -timeToSubtract );
     }
 
     //! Multiply and assign operator for multiplying by double
@@ -431,14 +417,7 @@ public:
      */
     void operator*=( const double timeToMultiply )
     {
-        long double newPeriods = static_cast< long double >( timeToMultiply ) * static_cast< long double >( fullPeriods_ );
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        fullPeriods_ = static_cast< int >( std::round( roundedNewPeriods ) );
-        secondsIntoFullPeriod_ *= static_cast< long double >( timeToMultiply );
-        secondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods ) * TIME_NORMALIZATION_TERM;
-
-        normalizeMembers( );
+        multiplyByDoubleDouble( timeToMultiply, 0.0 );
     }
 
     //! Multiply and assign operator for multiplying by long double
@@ -448,14 +427,9 @@ public:
      */
     void operator*=( const long double timeToMultiply )
     {
-        long double newPeriods = timeToMultiply * static_cast< long double >( fullPeriods_ );
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        fullPeriods_ = static_cast< int >( std::round( roundedNewPeriods ) );
-        secondsIntoFullPeriod_ *= timeToMultiply;
-        secondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods ) * TIME_NORMALIZATION_TERM;
-
-        normalizeMembers( );
+        double timeToMultiplyHigh, timeToMultiplyLow;
+        splitLongDouble( timeToMultiply, timeToMultiplyHigh, timeToMultiplyLow );
+        multiplyByDoubleDouble( timeToMultiplyHigh, timeToMultiplyLow );
     }
 
     //! Divided and assign operator for dividing by double
@@ -465,14 +439,7 @@ public:
      */
     void operator/=( const double timeToDivide )
     {
-        long double newPeriods = static_cast< long double >( timeToDivide ) / static_cast< long double >( fullPeriods_ );
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        fullPeriods_ = static_cast< int >( std::round( roundedNewPeriods ) );
-        secondsIntoFullPeriod_ *= timeToDivide;
-        secondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods );
-
-        normalizeMembers( );
+        divideByDoubleDouble( timeToDivide, 0.0 );
     }
 
     //! Divided and assign operator for dividing by long double
@@ -482,14 +449,9 @@ public:
      */
     void operator/=( const long double timeToDivide )
     {
-        long double newPeriods = timeToDivide / static_cast< long double >( fullPeriods_ );
-        long double roundedNewPeriods = std::floor( newPeriods );
-
-        fullPeriods_ = static_cast< int >( std::round( roundedNewPeriods ) );
-        secondsIntoFullPeriod_ *= timeToDivide;
-        secondsIntoFullPeriod_ += ( newPeriods - roundedNewPeriods );
-
-        normalizeMembers( );
+        double timeToDivideHigh, timeToDivideLow;
+        splitLongDouble( timeToDivide, timeToDivideHigh, timeToDivideLow );
+        divideByDoubleDouble( timeToDivideHigh, timeToDivideLow );
     }
 
 
@@ -502,8 +464,8 @@ public:
      */
     friend bool operator==( const Time& timeToCompare1, const Time& timeToCompare2 )
     {
-        return ( ( timeToCompare1.getFullPeriods( ) == timeToCompare2.getFullPeriods( ) ) &&
-                 ( timeToCompare1.getSecondsIntoFullPeriod( ) == timeToCompare2.getSecondsIntoFullPeriod( ) ) );
+        return ( ( timeToCompare1.numberOfTicks_ == timeToCompare2.numberOfTicks_ ) &&
+                 ( timeToCompare1.fractionOfTick_ == timeToCompare2.fractionOfTick_ ) );
     }
 
     //! Inequality operator for two Time objects
@@ -644,19 +606,7 @@ public:
      */
     friend bool operator> ( const Time& timeToCompare1, const Time& timeToCompare2 )
     {
-        if( timeToCompare1.getFullPeriods( ) > timeToCompare2.getFullPeriods( ) )
-        {
-            return true;
-        }
-        else if( ( timeToCompare1.getFullPeriods( ) == timeToCompare2.getFullPeriods( ) ) &&
-                 ( timeToCompare1.getSecondsIntoFullPeriod( ) > timeToCompare2.getSecondsIntoFullPeriod( ) ) )
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        return timeToCompare2 < timeToCompare1;
     }
 
     //! Greater-than-or-equal-to operator for two Time objects
@@ -668,43 +618,22 @@ public:
      */
     friend bool operator>= ( const Time& timeToCompare1, const Time& timeToCompare2 )
     {
-        if( timeToCompare1.getFullPeriods( ) >= timeToCompare2.getFullPeriods( ) )
-        {
-            return true;
-        }
-        else if( ( timeToCompare1.getFullPeriods( ) == timeToCompare2.getFullPeriods( ) ) &&
-          ( timeToCompare1.getSecondsIntoFullPeriod( ) >= timeToCompare2.getSecondsIntoFullPeriod( ) ) )
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        return !( timeToCompare1 < timeToCompare2 );
     }
 
     //! Smaller-than operator for two Time objects
     /*!
-     * Smaller-than operator for two Time objects
+     * Smaller-than operator for two Time objects. Since the fraction of the current tick is normalized (between 0 and
+     * 1), the comparison is lexicographic.
      * \param timeToCompare1 First time to compare
      * \param timeToCompare2 Second time to compare
      * \return True if timeToCompare1 is smaller than timeToCompare2, false otherwise.
      */
     friend bool operator< ( const Time& timeToCompare1, const Time& timeToCompare2 )
     {
-        if( timeToCompare1.getFullPeriods( ) < timeToCompare2.getFullPeriods( ) )
-        {
-            return true;
-        }
-        else if( ( timeToCompare1.getFullPeriods( ) == timeToCompare2.getFullPeriods( ) ) &&
-                 ( timeToCompare1.getSecondsIntoFullPeriod( ) < timeToCompare2.getSecondsIntoFullPeriod( ) ) )
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        return ( timeToCompare1.numberOfTicks_ < timeToCompare2.numberOfTicks_ ) ||
+                ( ( timeToCompare1.numberOfTicks_ == timeToCompare2.numberOfTicks_ ) &&
+                  ( timeToCompare1.fractionOfTick_ < timeToCompare2.fractionOfTick_ ) );
     }
 
     //! Smaller-than-or-equal-to operator for two Time objects
@@ -716,19 +645,7 @@ public:
      */
     friend bool operator<= ( const Time& timeToCompare1, const Time& timeToCompare2 )
     {
-        if( timeToCompare1.getFullPeriods( ) < timeToCompare2.getFullPeriods( ) )
-        {
-            return true;
-        }
-        else if( ( timeToCompare1.getFullPeriods( ) == timeToCompare2.getFullPeriods( ) ) &&
-                 ( timeToCompare1.getSecondsIntoFullPeriod( ) <= timeToCompare2.getSecondsIntoFullPeriod( ) ) )
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+        return !( timeToCompare2 < timeToCompare1 );
     }
 
     //! Smaller-than operator for Time object with double
@@ -938,8 +855,19 @@ public:
     template< typename ScalarType >
     ScalarType getSeconds( ) const
     {
-        return static_cast< ScalarType >(
-                    static_cast< long double >( fullPeriods_ ) * TIME_NORMALIZATION_TERM + secondsIntoFullPeriod_ );
+        if( std::is_same< ScalarType, double >::value )
+        {
+            // Compute directly in double precision, without long double arithmetic (conversion of ticks is exact, and
+            // scaling by a power of two is exact).
+            return static_cast< ScalarType >(
+                        ( static_cast< double >( numberOfTicks_ ) + fractionOfTick_ ) / TIME_TICKS_PER_SECOND );
+        }
+        else
+        {
+            return static_cast< ScalarType >(
+                        ( static_cast< long double >( numberOfTicks_ ) + static_cast< long double >( fractionOfTick_ ) ) /
+                        static_cast< long double >( TIME_TICKS_PER_SECOND ) );
+        }
     }
 
     //! Function to get the total seconds since epoch, in int precision (cast of Time to int)
@@ -979,40 +907,210 @@ public:
      */
     int getFullPeriods( ) const
     {
-        return fullPeriods_;
+        return static_cast< int >( getFullPeriodTicks( ) / TIME_TICKS_PER_FULL_PERIOD );
     }
 
     //! Function to get the number of seconds into current hour
     /*!
-     * \brief Function to get the number of seconds into current hour
-     * \return
+     * \brief Function to get the number of seconds into current hour (rounded to long double precision)
+     * \return Number of seconds into current hour
      */
     long double getSecondsIntoFullPeriod( ) const
     {
-        return secondsIntoFullPeriod_;
+        return ( static_cast< long double >( numberOfTicks_ - getFullPeriodTicks( ) ) +
+                 static_cast< long double >( fractionOfTick_ ) ) / static_cast< long double >( TIME_TICKS_PER_SECOND );
+    }
+
+    //! Function to get the number of full ticks (internal time units of 2^-20 s) since epoch
+    /*!
+     * \brief Function to get the number of full ticks (internal time units of 2^-20 s) since epoch
+     * \return Number of full ticks since epoch
+     */
+    long long getNumberOfTicks( ) const
+    {
+        return numberOfTicks_;
+    }
+
+    //! Function to get the fraction of the current tick
+    /*!
+     * \brief Function to get the fraction of the current tick (internal time unit of 2^-20 s), between 0 and 1.
+     * \return Fraction of the current tick
+     */
+    double getFractionOfTick( ) const
+    {
+        return fractionOfTick_;
     }
 
 protected:
 
-    //! Function to renormalize the members of the Time object, so that secondsIntoFullPeriod_ is between 0 and 3600
-    void normalizeMembers( )
+    //! Function to compute the largest integer that is not larger than the input (std::floor, without library call)
+    /*!
+     *  Function to compute the largest integer that is not larger than the input, returned as integer. Unlike std::floor,
+     *  this function is inlined without requiring SSE4.1 support. An exception is thrown for non-finite input, or for
+     *  input that cannot be represented as a 64-bit integer number of ticks (a NaN time is to be handled by the caller).
+     *  \param value Value for which the floor is to be computed
+     *  \return Largest integer that is not larger than the input
+     */
+    template< typename ScalarType >
+    static long long floorToInteger( const ScalarType value )
+    {
+        if( !( std::fabs( value ) < static_cast< ScalarType >( 9.0E18 ) ) )
+        {
+            throw std::runtime_error( "Error in Time, number of ticks " +
+                                      std::to_string( static_cast< long double >( value ) ) +
+                                      " is not finite, or not within range of time representation." );
+        }
+        const long long truncatedValue = static_cast< long long >( value );
+        return ( static_cast< ScalarType >( truncatedValue ) > value ) ? truncatedValue - 1 : truncatedValue;
+    }
+
+    //! Function to get the number of ticks at the start of the current hour
+    long long getFullPeriodTicks( ) const
     {
-        if( secondsIntoFullPeriod_ < 0.0L || secondsIntoFullPeriod_ >= TIME_NORMALIZATION_TERM )
+        long long fullPeriods = numberOfTicks_ / TIME_TICKS_PER_FULL_PERIOD;
+        if( numberOfTicks_ - fullPeriods * TIME_TICKS_PER_FULL_PERIOD < 0 )
         {
-            basic_mathematics::computeModuloAndRemainder< long double >(
-                        secondsIntoFullPeriod_,TIME_NORMALIZATION_TERM, secondsIntoFullPeriod_, daysToAdd );
-            fullPeriods_ += daysToAdd;
+            fullPeriods--;
         }
+        return fullPeriods * TIME_TICKS_PER_FULL_PERIOD;
     }
 
-    //! Pre-declared variable used in often-called normalizeMembers function
-    int daysToAdd;
+    //! Function to add a number of seconds to the time.
+    /*!
+     *  Function to add a number of seconds to the time. The input is split into full ticks and a fraction of a tick,
+     *  which is exact since a tick is a power of two of seconds (except for the rounding of a negative fraction). As a
+     *  result, the only rounding error is that of the addition of the fractions of a tick.
+     *  \param secondsToAdd Number of seconds to add (double or long double)
+     */
+    template< typename ScalarType >
+    void addSeconds( const ScalarType secondsToAdd )
+    {
+        if( secondsToAdd != secondsToAdd )
+        {
+            setToNaN( );
+            return;
+        }
+
+        const ScalarType ticksToAdd = secondsToAdd * static_cast< ScalarType >( TIME_TICKS_PER_SECOND );
+        const long long fullTicksToAdd = floorToInteger( ticksToAdd );
+        numberOfTicks_ += fullTicksToAdd;
+        fractionOfTick_ += static_cast< double >( ticksToAdd - static_cast< ScalarType >( fullTicksToAdd ) );
+        normalizeMembers( );
+    }
+
+    //! Function to multiply the time by a factor (as double-double, i.e. unevaluated sum of two doubles).
+    /*!
+     *  Function to multiply the time by a factor (as double-double, i.e. unevaluated sum of two doubles). The number of
+     *  full ticks is split into a multiple of 2^26 and a remainder, which are both exactly representable as a double
+     *  over the full range of the number of ticks (unlike the full number of ticks, above 2^53). The products of both
+     *  parts with the high part of the factor are computed exactly, and split into integer and fractional parts.
+     *  \param factorHigh High part of the factor
+     *  \param factorLow Low part of the factor
+     */
+    void multiplyByDoubleDouble( const double factorHigh, const double factorLow )
+    {
+        static const long long splitTicks = 67108864LL; // 2^26
+
+        if( factorHigh != factorHigh || factorLow != factorLow )
+        {
+            setToNaN( );
+            return;
+        }
+
+        // Split full ticks into high and low parts, both exactly representable as double.
+        const long long lowTicks = numberOfTicks_ % splitTicks;
+        const double fullTicksHigh = static_cast< double >( numberOfTicks_ - lowTicks );
+        const double fullTicksLow = static_cast< double >( lowTicks );
+
+        // Compute products of full ticks and factor exactly, and split into integer and fractional parts.
+        double highTicksProduct, highTicksProductError;
+        twoProduct( fullTicksHigh, factorHigh, highTicksProduct, highTicksProductError );
+        const long long newHighFullTicks = floorToInteger( highTicksProduct );
+
+        double lowTicksProduct, lowTicksProductError;
+        twoProduct( fullTicksLow, factorHigh, lowTicksProduct, lowTicksProductError );
+        const long long newLowFullTicks = floorToInteger( lowTicksProduct );
+
+        // Add remaining terms to fraction of tick, and renormalize.
+        numberOfTicks_ = newHighFullTicks + newLowFullTicks;
+        fractionOfTick_ = ( ( highTicksProduct - static_cast< double >( newHighFullTicks ) ) +
+                            ( lowTicksProduct - static_cast< double >( newLowFullTicks ) ) +
+                            ( highTicksProductError + lowTicksProductError ) ) +
+                ( ( fullTicksHigh * factorLow + fullTicksLow * factorLow ) + fractionOfTick_ * factorHigh );
+        normalizeMembers( );
+    }
+
+    //! Function to divide the time by a value (as double-double, i.e. unevaluated sum of two doubles).
+    void divideByDoubleDouble( const double divisorHigh, const double divisorLow )
+    {
+        // Compute reciprocal of divisor as double-double, and multiply by it.
+        const double reciprocalHigh = 1.0 / divisorHigh;
+        double product, productError;
+        twoProduct( reciprocalHigh, divisorHigh, product, productError );
+        const double reciprocalLow =
+                ( ( ( 1.0 - product ) - productError ) - reciprocalHigh * divisorLow ) / divisorHigh;
+        multiplyByDoubleDouble( reciprocalHigh, reciprocalLow );
+    }
+
+    //! Function to compute the product of two doubles, and the (exact) rounding error of this product.
+    /*!
+     *  Function to compute the product of two doubles, and the (exact) rounding error of this product, using Dekker's
+     *  splitting (which, unlike std::fma, does not require hardware support to be fast).
+     */
+    static void twoProduct( const double firstValue, const double secondValue, double& product, double& error )
+    {
+        static const double splitFactor = 134217729.0; // 2^27 + 1
+
+        double temporary = splitFactor * firstValue;
+        const double firstValueHigh = temporary - ( temporary - firstValue );
+        const double firstValueLow = firstValue - firstValueHigh;
+
+        temporary = splitFactor * secondValue;
+        const double secondValueHigh = temporary - ( temporary - secondValue );
+        const double secondValueLow = secondValue - secondValueHigh;
+
+        product = firstValue * secondValue;
+        error = ( ( firstValueHigh * secondValueHigh - product ) + firstValueHigh * secondValueLow +
+                  firstValueLow * secondValueHigh ) + firstValueLow * secondValueLow;
+    }
+
+    //! Function to split a long double into an unevaluated sum of two doubles.
+    static void splitLongDouble( const long double value, double& valueHigh, double& valueLow )
+    {
+        valueHigh = static_cast< double >( value );
+        valueLow = static_cast< double >( value - static_cast< long double >( valueHigh ) );
+    }
+
+    //! Function to set the time to NaN (represented by a NaN fraction of a tick, which is retained by all operations)
+    void setToNaN( )
+    {
+        fractionOfTick_ = std::numeric_limits< double >::quiet_NaN( );
+    }
+
+    //! Function to renormalize the members of the Time object, so that the fraction of the current tick is between 0 and
+    //! 1 (a NaN fraction is left unchanged)
+    void normalizeMembers( )
+    {
+        if( fractionOfTick_ >= 1.0 || fractionOfTick_ < 0.0 )
+        {
+            const long long ticksToAdd = floorToInteger( fractionOfTick_ );
+            numberOfTicks_ += ticksToAdd;
+            fractionOfTick_ -= static_cast< double >( ticksToAdd );
+
+            // Correct for rounding of small negative fraction to 1.0
+            if( fractionOfTick_ >= 1.0 )
+            {
+                numberOfTicks_++;
+                fractionOfTick_ -= 1.0;
+            }
+        }
+    }
 
-    //! Number of full hours since epoch
-    int fullPeriods_;
+    //! Number of full ticks (internal time units of 2^-20 s) since epoch
+    long long numberOfTicks_;
 
-    //! Number of seconds into current hour
-    long double secondsIntoFullPeriod_;
+    //! Fraction of current tick (between 0 and 1)
+    double fractionOfTick_;
 
 };
 
@@ -0,0 +1,142 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Benchmark comparing the throughput (satellites propagated per second of wall-clock time) of the lock-step batch
+ *    Runge-Kutta integrator with that of the regular Runge-Kutta integrator, applied to each satellite separately.
+ *    Usage: benchmark_BatchCowellPropagation [numberOfSatellites] [propagationTime]
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Gravitation/centralJ2J3J4GravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/thirdBodyPerturbation.h"
+#include "Tudat/Astrodynamics/Propagators/batchCowellStateDerivative.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+using namespace tudat;
+
+static const double earthGravitationalParameter = 3.986004418E14;
+static const double earthEquatorialRadius = 6378137.0;
+static const double earthJ2 = 1.0826E-3;
+static const double earthJ3 = -2.532E-6;
+static const double earthJ4 = -1.6199E-6;
+static const double moonGravitationalParameter = 4.9028E12;
+
+//! Function to compute an (approximate) circular, inclined orbit of the Moon w.r.t. the Earth.
+Eigen::Vector3d getMoonPosition( const double time )
+{
+    const double moonOrbitRadius = 3.844E8;
+    const double moonMeanMotion = 2.0 * mathematical_constants::PI / ( 27.32 * 86400.0 );
+    const double moonInclination = 5.0 * mathematical_constants::PI / 180.0;
+    return ( Eigen::Vector3d( ) <<
+             moonOrbitRadius * std::cos( moonMeanMotion * time ),
+             moonOrbitRadius * std::sin( moonMeanMotion * time ) * std::cos( moonInclination ),
+             moonOrbitRadius * std::sin( moonMeanMotion * time ) * std::sin( moonInclination ) ).finished( );
+}
+
+//! Function to compute the state derivative of a single satellite, using the single-body acceleration functions.
+Eigen::VectorXd computeSingleSatelliteStateDerivative( const double time, const Eigen::VectorXd& state )
+{
+    Eigen::Vector3d position = state.segment( 0, 3 );
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) =
+            gravitation::computeGravitationalAcceleration( position, earthGravitationalParameter ) +
+            gravitation::computeGravitationalAccelerationDueToJ2(
+                position, earthGravitationalParameter, earthEquatorialRadius, earthJ2, Eigen::Vector3d::Zero( ) ) +
+            gravitation::computeGravitationalAccelerationDueToJ3(
+                position, earthGravitationalParameter, earthEquatorialRadius, earthJ3, Eigen::Vector3d::Zero( ) ) +
+            gravitation::computeGravitationalAccelerationDueToJ4(
+                position, earthGravitationalParameter, earthEquatorialRadius, earthJ4, Eigen::Vector3d::Zero( ) ) +
+            gravitation::computeThirdBodyPerturbingAcceleration(
+                moonGravitationalParameter, getMoonPosition( time ), position );
+    return stateDerivative;
+}
+
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat::numerical_integrators;
+
+    const int numberOfSatellites = ( argc > 1 ) ? std::atoi( argv[ 1 ] ) : 1000;
+    const double propagationTime = ( argc > 2 ) ? std::atof( argv[ 2 ] ) : 86400.0;
+    const double initialStepSize = 10.0;
+    const double tolerance = 1.0E-10;
+
+    // Create a set of LEO to MEO satellites with varying elements.
+    Eigen::ArrayXXd initialStates( numberOfSatellites, 6 );
+    for( int i = 0; i < numberOfSatellites; i++ )
+    {
+        Eigen::Vector6d keplerianElements;
+        keplerianElements << 7.0E6 + 2.0E7 * static_cast< double >( i ) / numberOfSatellites,
+                0.001 + 0.01 * ( i % 7 ), 0.01 * i, 0.5 * i, 1.0 + 0.3 * i, 0.7 * i;
+        initialStates.row( i ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    keplerianElements, earthGravitationalParameter ).transpose( ).array( );
+    }
+
+    RungeKuttaCoefficients coefficients =
+            RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg78 );
+
+    for( int testCase = 0; testCase < 2; testCase++ )
+    {
+        const bool useStepSizeControl = ( testCase == 0 );
+
+        // Propagate all satellites in lock-step.
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        propagators::BatchCowellStateDerivative batchStateDerivative(
+                    earthGravitationalParameter, earthEquatorialRadius, earthJ2, earthJ3, earthJ4,
+        { moonGravitationalParameter }, { &getMoonPosition } );
+        BatchRungeKuttaVariableStepSizeIntegrator batchIntegrator(
+                    coefficients, batchStateDerivative.getStateDerivativeFunction( ), 0.0, initialStates,
+                    initialStepSize, std::numeric_limits< double >::epsilon( ), 3600.0, tolerance, tolerance );
+        batchIntegrator.setStepSizeControl( useStepSizeControl );
+        batchIntegrator.integrateTo( propagationTime );
+        const double batchWallTime = std::chrono::duration< double >(
+                    std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        // Propagate each satellite separately.
+        startTime = std::chrono::steady_clock::now( );
+        for( int i = 0; i < numberOfSatellites; i++ )
+        {
+            RungeKuttaVariableStepSizeIntegrator< double, Eigen::VectorXd > singleSatelliteIntegrator(
+                        coefficients, &computeSingleSatelliteStateDerivative, 0.0,
+                        initialStates.row( i ).transpose( ).matrix( ),
+                        std::numeric_limits< double >::epsilon( ), 3600.0, tolerance, tolerance );
+            singleSatelliteIntegrator.setStepSizeControl( useStepSizeControl );
+
+            double stepSize = initialStepSize;
+            while( singleSatelliteIntegrator.getCurrentIndependentVariable( ) < propagationTime )
+            {
+                stepSize = std::min(
+                            stepSize, propagationTime - singleSatelliteIntegrator.getCurrentIndependentVariable( ) );
+                singleSatelliteIntegrator.performIntegrationStep( stepSize );
+                stepSize = singleSatelliteIntegrator.getNextStepSize( );
+            }
+        }
+        const double singleSatelliteWallTime = std::chrono::duration< double >(
+                    std::chrono::steady_clock::now( ) - startTime ).count( );
+
+        std::cout << ( useStepSizeControl ? "Variable step RKF7(8)" : "Fixed step RKF7(8)" ) << ", "
+                  << numberOfSatellites << " satellites, " << propagationTime << " s" << std::endl
+                  << "  batch:  " << batchWallTime << " s, "
+                  << numberOfSatellites / batchWallTime << " satellites/s, "
+                  << batchIntegrator.getNumberOfStateDerivativeFunctionCalls( ) << " batch function evaluations"
+                  << std::endl
+                  << "  single: " << singleSatelliteWallTime << " s, "
+                  << numberOfSatellites / singleSatelliteWallTime << " satellites/s" << std::endl
+                  << "  speed-up: " << singleSatelliteWallTime / batchWallTime << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
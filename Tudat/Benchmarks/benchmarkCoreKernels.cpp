@@ -0,0 +1,649 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Micro-benchmarks of the computational kernels that dominate typical propagation and estimation runs: spherical
+ *    harmonic gravity, Legendre polynomial cache updates, interpolation, orbital element conversions, analytical
+ *    orbit propagation, Lambert problems, light-time solutions, high-precision Time arithmetic and (interpolated)
+ *    NRLMSISE-00 densities. All inputs are generated with fixed random seeds, so that results are reproducible.
+ *    Usage: benchmark_CoreKernels [--filter=<text>] [--format=console|csv|json] [--output=<file>]
+ *                                 [--repetitions=<n>] [--min_time=<seconds>] [--list]
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/Propagators/batchAnalyticalOrbitPropagator.h"
+#include "Tudat/Basics/timeType.h"
+#include "Tudat/Benchmarks/benchmarkHarness.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+#include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#if( BUILD_WITH_ESTIMATION_TOOLS )
+#include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
+#endif
+#if( USE_NRLMSISE00 )
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#endif
+
+using namespace tudat;
+using namespace tudat::benchmarks;
+
+static const double earthGravitationalParameter = 3.986004418E14;
+static const double earthEquatorialRadius = 6378137.0;
+
+//! Number of distinct inputs over which each benchmark cycles (to prevent caches from short-circuiting computations).
+static const unsigned int numberOfInputs = 64;
+
+//! Function to generate a set of positions in low Earth orbit, using a fixed random seed.
+std::vector< Eigen::Vector3d > getTestPositions( )
+{
+    std::mt19937 randomGenerator( 42 );
+    std::uniform_real_distribution< double > unitDistribution( -1.0, 1.0 );
+    std::uniform_real_distribution< double > radiusDistribution( 6.7E6, 7.5E6 );
+
+    std::vector< Eigen::Vector3d > positions;
+    for( unsigned int i = 0; i < numberOfInputs; i++ )
+    {
+        Eigen::Vector3d direction;
+        do
+        {
+            direction << unitDistribution( randomGenerator ), unitDistribution( randomGenerator ),
+                    unitDistribution( randomGenerator );
+        }
+        while( direction.norm( ) < 0.1 || direction.norm( ) > 1.0 );
+        positions.push_back( radiusDistribution( randomGenerator ) * direction.normalized( ) );
+    }
+    return positions;
+}
+
+//! Function to generate geodesy-normalized spherical harmonic coefficients, using a fixed random seed.
+void getTestSphericalHarmonicCoefficients( const int maximumDegree,
+                                           Eigen::MatrixXd& cosineCoefficients,
+                                           Eigen::MatrixXd& sineCoefficients )
+{
+    std::mt19937 randomGenerator( 1000 + maximumDegree );
+    std::normal_distribution< double > coefficientDistribution( 0.0, 1.0 );
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        // Scale coefficients according to Kaula's rule.
+        const double coefficientMagnitude = 1.0E-5 / static_cast< double >( degree * degree );
+        for( int order = 0; order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = coefficientMagnitude * coefficientDistribution( randomGenerator );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = coefficientMagnitude * coefficientDistribution( randomGenerator );
+            }
+        }
+    }
+}
+
+//! Function to add the benchmark of the spherical harmonic acceleration at a given degree and order.
+void addSphericalHarmonicAccelerationBenchmark( BenchmarkRunner& runner, const int maximumDegree )
+{
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getTestSphericalHarmonicCoefficients( maximumDegree, cosineCoefficients, sineCoefficients );
+    std::vector< Eigen::Vector3d > positions = getTestPositions( );
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree, maximumDegree );
+
+    runner.addBenchmark(
+                "SphericalHarmonicAcceleration/" + std::to_string( maximumDegree ) + "x" +
+                std::to_string( maximumDegree ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm;
+        Eigen::Vector3d acceleration;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            acceleration = gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions.at( i % numberOfInputs ), earthGravitationalParameter, earthEquatorialRadius,
+                        cosineCoefficients, sineCoefficients, sphericalHarmonicsCache, accelerationPerTerm );
+            doNotOptimize( acceleration );
+        }
+    } );
+}
+
+//! Function to add the benchmark of the Legendre polynomial cache update at a given degree and order.
+void addLegendreCacheUpdateBenchmark( BenchmarkRunner& runner, const int maximumDegree )
+{
+    std::vector< Eigen::Vector3d > positions = getTestPositions( );
+    std::vector< double > polynomialParameters;
+    for( unsigned int i = 0; i < positions.size( ); i++ )
+    {
+        polynomialParameters.push_back( positions.at( i ).z( ) / positions.at( i ).norm( ) );
+    }
+    std::shared_ptr< basic_mathematics::LegendreCache > legendreCache =
+            std::make_shared< basic_mathematics::LegendreCache >( maximumDegree, maximumDegree, true );
+
+    runner.addBenchmark(
+                "LegendreCacheUpdate/" + std::to_string( maximumDegree ) + "x" + std::to_string( maximumDegree ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            legendreCache->update( polynomialParameters.at( i % numberOfInputs ) );
+            doNotOptimize( legendreCache->getLegendrePolynomial( maximumDegree, maximumDegree ) );
+        }
+    } );
+}
+
+//! Function to add the benchmarks of the Lagrange and cubic spline interpolators.
+void addInterpolatorBenchmarks( BenchmarkRunner& runner )
+{
+    const unsigned int numberOfNodes = 1000;
+    const double nodeSpacing = 60.0;
+    std::vector< double > independentVariables, dependentVariables;
+    for( unsigned int i = 0; i < numberOfNodes; i++ )
+    {
+        independentVariables.push_back( static_cast< double >( i ) * nodeSpacing );
+        dependentVariables.push_back( std::sin( 2.0 * mathematical_constants::PI * independentVariables.back( ) /
+                                                5400.0 ) );
+    }
+
+    // Evaluate at monotonically increasing times (as during a propagation), wrapping around at the end.
+    std::vector< double > evaluationTimes;
+    std::mt19937 randomGenerator( 7 );
+    std::uniform_real_distribution< double > stepDistribution( 0.0, 2.0 * nodeSpacing );
+    double currentTime = 10.0 * nodeSpacing;
+    while( currentTime < static_cast< double >( numberOfNodes - 10 ) * nodeSpacing )
+    {
+        evaluationTimes.push_back( currentTime );
+        currentTime += stepDistribution( randomGenerator );
+    }
+
+    std::vector< int > numbersOfStages = { 4, 8 };
+    for( unsigned int i = 0; i < numbersOfStages.size( ); i++ )
+    {
+        std::shared_ptr< interpolators::LagrangeInterpolatorDouble > lagrangeInterpolator =
+                std::make_shared< interpolators::LagrangeInterpolatorDouble >(
+                    independentVariables, dependentVariables, numbersOfStages.at( i ) );
+        runner.addBenchmark(
+                    "LagrangeInterpolation/" + std::to_string( numbersOfStages.at( i ) ),
+                    [ = ]( const unsigned long long numberOfIterations )
+        {
+            double interpolatedValue;
+            for( unsigned long long j = 0; j < numberOfIterations; j++ )
+            {
+                interpolatedValue = lagrangeInterpolator->interpolate(
+                            evaluationTimes.at( j % evaluationTimes.size( ) ) );
+                doNotOptimize( interpolatedValue );
+            }
+        } );
+    }
+
+    std::shared_ptr< interpolators::CubicSplineInterpolatorDouble > cubicSplineInterpolator =
+            std::make_shared< interpolators::CubicSplineInterpolatorDouble >(
+                independentVariables, dependentVariables );
+    runner.addBenchmark(
+                "CubicSplineInterpolation",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        double interpolatedValue;
+        for( unsigned long long j = 0; j < numberOfIterations; j++ )
+        {
+            interpolatedValue = cubicSplineInterpolator->interpolate(
+                        evaluationTimes.at( j % evaluationTimes.size( ) ) );
+            doNotOptimize( interpolatedValue );
+        }
+    } );
+}
+
+//! Function to add the benchmarks of the conversions between Keplerian and Cartesian elements.
+void addElementConversionBenchmarks( BenchmarkRunner& runner )
+{
+    std::mt19937 randomGenerator( 3 );
+    std::uniform_real_distribution< double > semiMajorAxisDistribution( 6.8E6, 4.2E7 );
+    std::uniform_real_distribution< double > eccentricityDistribution( 0.0, 0.7 );
+    std::uniform_real_distribution< double > inclinationDistribution( 0.0, mathematical_constants::PI );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * mathematical_constants::PI );
+
+    std::vector< Eigen::Vector6d > keplerianStates, cartesianStates;
+    for( unsigned int i = 0; i < numberOfInputs; i++ )
+    {
+        Eigen::Vector6d keplerianState;
+        keplerianState << semiMajorAxisDistribution( randomGenerator ), eccentricityDistribution( randomGenerator ),
+                inclinationDistribution( randomGenerator ), angleDistribution( randomGenerator ),
+                angleDistribution( randomGenerator ), angleDistribution( randomGenerator );
+        keplerianStates.push_back( keplerianState );
+        cartesianStates.push_back( orbital_element_conversions::convertKeplerianToCartesianElements(
+                                       keplerianState, earthGravitationalParameter ) );
+    }
+
+    runner.addBenchmark(
+                "KeplerianToCartesian",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Vector6d convertedState;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            convertedState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                        keplerianStates.at( i % numberOfInputs ), earthGravitationalParameter );
+            doNotOptimize( convertedState );
+        }
+    } );
+
+    runner.addBenchmark(
+                "CartesianToKeplerian",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Vector6d convertedState;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            convertedState = orbital_element_conversions::convertCartesianToKeplerianElements(
+                        cartesianStates.at( i % numberOfInputs ), earthGravitationalParameter );
+            doNotOptimize( convertedState );
+        }
+    } );
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStateArray( 6, numberOfInputs );
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStateArray( 6, numberOfInputs );
+    for( unsigned int i = 0; i < numberOfInputs; i++ )
+    {
+        keplerianStateArray.col( i ) = keplerianStates.at( i );
+        cartesianStateArray.col( i ) = cartesianStates.at( i );
+    }
+
+    runner.addBenchmark(
+                "KeplerianToCartesian/Batch" + std::to_string( numberOfInputs ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > convertedStates( 6, numberOfInputs );
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            orbital_element_conversions::convertKeplerianToCartesianStates(
+                        keplerianStateArray, earthGravitationalParameter, convertedStates, 1 );
+            doNotOptimize( convertedStates );
+        }
+    } );
+
+    runner.addBenchmark(
+                "CartesianToKeplerian/Batch" + std::to_string( numberOfInputs ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > convertedStates( 6, numberOfInputs );
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            orbital_element_conversions::convertCartesianToKeplerianStates(
+                        cartesianStateArray, earthGravitationalParameter, convertedStates, 1 );
+            doNotOptimize( convertedStates );
+        }
+    } );
+}
+
+//! Function to add the benchmarks of the solution of Kepler's equation, for single and batched mean anomalies.
+void addKeplerEquationBenchmarks( BenchmarkRunner& runner )
+{
+    std::mt19937 randomGenerator( 4 );
+    std::uniform_real_distribution< double > eccentricityDistribution( 0.0, 0.95 );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * mathematical_constants::PI );
+
+    Eigen::ArrayXd eccentricities( numberOfInputs ), meanAnomalies( numberOfInputs );
+    for( unsigned int i = 0; i < numberOfInputs; i++ )
+    {
+        eccentricities( i ) = eccentricityDistribution( randomGenerator );
+        meanAnomalies( i ) = angleDistribution( randomGenerator );
+    }
+
+    runner.addBenchmark(
+                "KeplerEquation/RootFinder",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        double eccentricAnomaly;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            eccentricAnomaly = orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
+                        eccentricities( i % numberOfInputs ), meanAnomalies( i % numberOfInputs ), false,
+                        meanAnomalies( i % numberOfInputs ) );
+            doNotOptimize( eccentricAnomaly );
+        }
+    } );
+
+    runner.addBenchmark(
+                "KeplerEquation/Single",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        double eccentricAnomaly;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            eccentricAnomaly = orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
+                        eccentricities( i % numberOfInputs ), meanAnomalies( i % numberOfInputs ) );
+            doNotOptimize( eccentricAnomaly );
+        }
+    } );
+
+    runner.addBenchmark(
+                "KeplerEquation/Batch" + std::to_string( numberOfInputs ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::ArrayXd eccentricAnomalies( numberOfInputs );
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            orbital_element_conversions::convertMeanAnomaliesToEccentricAnomalies(
+                        eccentricities, meanAnomalies, eccentricAnomalies );
+            doNotOptimize( eccentricAnomalies );
+        }
+    } );
+}
+
+//! Function to add the benchmarks of the analytical propagation of orbits, for single and batched orbits.
+void addAnalyticalPropagationBenchmarks( BenchmarkRunner& runner )
+{
+    std::mt19937 randomGenerator( 5 );
+    std::uniform_real_distribution< double > semiMajorAxisDistribution( 6.8E6, 4.2E7 );
+    std::uniform_real_distribution< double > eccentricityDistribution( 0.0, 0.7 );
+    std::uniform_real_distribution< double > inclinationDistribution( 0.0, mathematical_constants::PI );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * mathematical_constants::PI );
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianStates( 6, numberOfInputs );
+    for( unsigned int i = 0; i < numberOfInputs; i++ )
+    {
+        keplerianStates.col( i ) << semiMajorAxisDistribution( randomGenerator ),
+                eccentricityDistribution( randomGenerator ), inclinationDistribution( randomGenerator ),
+                angleDistribution( randomGenerator ), angleDistribution( randomGenerator ),
+                angleDistribution( randomGenerator );
+    }
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    orbital_element_conversions::convertKeplerianToCartesianStates(
+                keplerianStates, earthGravitationalParameter, cartesianStates, 1 );
+
+    runner.addBenchmark(
+                "AnalyticalPropagation/KeplerOrbit",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Vector6d propagatedState;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            propagatedState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                        orbital_element_conversions::propagateKeplerOrbit< double >(
+                            keplerianStates.col( i % numberOfInputs ), 3600.0, earthGravitationalParameter ),
+                        earthGravitationalParameter );
+            doNotOptimize( propagatedState );
+        }
+    } );
+
+    std::shared_ptr< propagators::BatchAnalyticalOrbitPropagator > batchPropagator =
+            std::make_shared< propagators::BatchAnalyticalOrbitPropagator >(
+                cartesianStates, 0.0, earthGravitationalParameter, 6378137.0, 1.0826E-3, 1 );
+    runner.addBenchmark(
+                "AnalyticalPropagation/BatchJ2" + std::to_string( numberOfInputs ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Matrix< double, 6, Eigen::Dynamic > propagatedStates( 6, numberOfInputs );
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            batchPropagator->computeCartesianStates( 3600.0, propagatedStates, 1 );
+            doNotOptimize( propagatedStates );
+        }
+    } );
+}
+
+//! Function to add the benchmarks of single and batch solutions of Lambert problems.
+void addLambertBenchmarks( BenchmarkRunner& runner )
+{
+    // Heliocentric transfers between random positions at 0.7-1.6 AU, with times of flight of 100-400 days.
+    const double sunGravitationalParameter = 1.32712440018E20;
+    const double astronomicalUnit = 1.495978707E11;
+    const int numberOfProblems = 1024;
+    std::mt19937 randomGenerator( 7 );
+    std::uniform_real_distribution< double > angleDistribution( 0.0, 2.0 * mathematical_constants::PI );
+    std::uniform_real_distribution< double > radiusDistribution( 0.7 * astronomicalUnit, 1.6 * astronomicalUnit );
+    std::uniform_real_distribution< double > timeOfFlightDistribution( 100.0 * 86400.0, 400.0 * 86400.0 );
+
+    Eigen::Matrix3Xd positionsAtDeparture( 3, numberOfProblems ), positionsAtArrival( 3, numberOfProblems );
+    Eigen::VectorXd timesOfFlight( numberOfProblems );
+    for( int i = 0; i < numberOfProblems; i++ )
+    {
+        const double departureAngle = angleDistribution( randomGenerator );
+        const double arrivalAngle = angleDistribution( randomGenerator );
+        positionsAtDeparture.col( i ) = radiusDistribution( randomGenerator ) *
+                Eigen::Vector3d( std::cos( departureAngle ), std::sin( departureAngle ), 0.01 );
+        positionsAtArrival.col( i ) = radiusDistribution( randomGenerator ) *
+                Eigen::Vector3d( std::cos( arrivalAngle ), std::sin( arrivalAngle ), -0.02 );
+        timesOfFlight( i ) = timeOfFlightDistribution( randomGenerator );
+    }
+
+    runner.addBenchmark(
+                "Lambert/IzzoSingle",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            const int problemIndex = static_cast< int >( i % numberOfProblems );
+            mission_segments::solveLambertProblemIzzo(
+                        positionsAtDeparture.col( problemIndex ), positionsAtArrival.col( problemIndex ),
+                        timesOfFlight( problemIndex ), sunGravitationalParameter,
+                        velocityAtDeparture, velocityAtArrival );
+            doNotOptimize( velocityAtDeparture );
+        }
+    } );
+
+    // One iteration corresponds to one Lambert problem, as for the single solution.
+    std::vector< int > numbersOfThreads = { 1 };
+    if( utilities::getDefaultNumberOfThreads( ) > 1 )
+    {
+        numbersOfThreads.push_back( utilities::getDefaultNumberOfThreads( ) );
+    }
+    for( unsigned int i = 0; i < numbersOfThreads.size( ); i++ )
+    {
+        const int numberOfThreads = numbersOfThreads.at( i );
+        runner.addBenchmark(
+                    "Lambert/IzzoBatch/Threads" + std::to_string( numberOfThreads ),
+                    [ = ]( const unsigned long long numberOfIterations )
+        {
+            Eigen::Matrix3Xd velocitiesAtDeparture, velocitiesAtArrival;
+            for( unsigned long long i = 0; i < numberOfIterations; i += numberOfProblems )
+            {
+                mission_segments::solveLambertProblemsIzzo(
+                            positionsAtDeparture, positionsAtArrival, timesOfFlight, sunGravitationalParameter,
+                            velocitiesAtDeparture, velocitiesAtArrival, false, 1e-9, 50, numberOfThreads );
+                doNotOptimize( velocitiesAtDeparture );
+            }
+        } );
+    }
+}
+
+//! Function to add the benchmarks of the arithmetic of the high-precision Time type.
+void addTimeArithmeticBenchmarks( BenchmarkRunner& runner )
+{
+    // Step through a propagation-like sequence of times, about 30 years after the reference epoch.
+    runner.addBenchmark(
+                "TimeArithmetic/AddAndCompare",
+                [ ]( const unsigned long long numberOfIterations )
+    {
+        Time currentTime( 30 * 8766, 1234.5L );
+        const Time finalTime = currentTime + 1.0E9;
+        const double timeStep = 0.6180339887;
+        unsigned long long numberOfSmallerTimes = 0;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            currentTime += timeStep;
+            if( currentTime < finalTime )
+            {
+                numberOfSmallerTimes++;
+            }
+        }
+        doNotOptimize( currentTime );
+        doNotOptimize( numberOfSmallerTimes );
+    } );
+
+    runner.addBenchmark(
+                "TimeArithmetic/DifferenceToDouble",
+                [ ]( const unsigned long long numberOfIterations )
+    {
+        Time currentTime( 30 * 8766, 1234.5L );
+        const Time referenceTime( 30 * 8766 - 5, 17.25L );
+        double timeDifference = 0.0;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            currentTime += 0.5;
+            timeDifference += static_cast< double >( currentTime - referenceTime );
+        }
+        doNotOptimize( timeDifference );
+    } );
+}
+
+#if( BUILD_WITH_ESTIMATION_TOOLS )
+//! Function to add the benchmark of the light-time solution between a ground station and a satellite.
+void addLightTimeBenchmark( BenchmarkRunner& runner )
+{
+    // Ground station on the rotating Earth, satellite in an eccentric Keplerian orbit.
+    std::function< Eigen::Vector6d( const double ) > groundStationStateFunction = [ ]( const double time )
+    {
+        const double earthRotationRate = 7.2921150E-5;
+        Eigen::Vector6d state;
+        state << earthEquatorialRadius * std::cos( earthRotationRate * time ),
+                earthEquatorialRadius * std::sin( earthRotationRate * time ), 0.0,
+                -earthEquatorialRadius * earthRotationRate * std::sin( earthRotationRate * time ),
+                earthEquatorialRadius * earthRotationRate * std::cos( earthRotationRate * time ), 0.0;
+        return state;
+    };
+    std::function< Eigen::Vector6d( const double ) > satelliteStateFunction = [ ]( const double time )
+    {
+        Eigen::Vector6d initialKeplerianState;
+        initialKeplerianState << 2.4E7, 0.7, 0.1, 1.0, 2.0, 0.0;
+        return orbital_element_conversions::convertKeplerianToCartesianElements(
+                    orbital_element_conversions::propagateKeplerOrbit(
+                        initialKeplerianState, time, earthGravitationalParameter ), earthGravitationalParameter );
+    };
+
+    std::shared_ptr< observation_models::LightTimeCalculator< double, double > > lightTimeCalculator =
+            std::make_shared< observation_models::LightTimeCalculator< double, double > >(
+                satelliteStateFunction, groundStationStateFunction );
+
+    runner.addBenchmark(
+                "LightTimeSolution",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        double lightTime;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            lightTime = lightTimeCalculator->calculateLightTime( 60.0 * static_cast< double >( i % 1440 ) );
+            doNotOptimize( lightTime );
+        }
+    } );
+}
+#endif
+
+#if( USE_NRLMSISE00 )
+//! Function to add the benchmarks of direct and interpolated NRLMSISE00 density evaluations along a LEO orbit.
+void addNRLMSISE00Benchmarks( BenchmarkRunner& runner )
+{
+    std::function< aerodynamics::NRLMSISE00Input( double, double, double, double ) > inputFunction =
+            std::bind( &aerodynamics::nrlmsiseInputFunction, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, std::placeholders::_4,
+                       input_output::solar_activity::readSolarActivityData(
+                           input_output::getSpaceWeatherDataPath( ) + "sw19571001.txt" ), false, TUDAT_NAN );
+
+    // Sequence of (altitude, longitude, latitude, time) along a near-circular 51.6 degree inclination orbit, for one
+    // day, sampled at 2.5 s (representative of the evaluations by a fixed-step RK4 integrator with 10 s step size).
+    const double initialTime = basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                basic_astrodynamics::convertCalendarDateToJulianDay< double >( 2012, 3, 15, 0, 0, 0.0 ),
+                basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    const double inclination = 51.6 * mathematical_constants::PI / 180.0;
+    std::vector< std::vector< double > > evaluationPoints;
+    for( double timeSinceStart = 0.0; timeSinceStart < 86400.0; timeSinceStart += 2.5 )
+    {
+        const double argumentOfLatitude = 2.0 * mathematical_constants::PI * timeSinceStart / 5550.0;
+        const double latitude = std::asin( std::sin( inclination ) * std::sin( argumentOfLatitude ) );
+        const double longitude = std::remainder(
+                    std::atan2( std::cos( inclination ) * std::sin( argumentOfLatitude ),
+                                std::cos( argumentOfLatitude ) ) - 7.2921150E-5 * timeSinceStart,
+                    2.0 * mathematical_constants::PI );
+        const double altitude = 400.0E3 + 10.0E3 * std::sin( 1.1 * argumentOfLatitude );
+        evaluationPoints.push_back( { altitude, longitude, latitude, initialTime + timeSinceStart } );
+    }
+
+    // Interpolated model retains its grid between repetitions, so that the steady-state cost is measured.
+    std::shared_ptr< aerodynamics::NRLMSISE00Atmosphere > directModel =
+            std::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
+    std::shared_ptr< aerodynamics::NRLMSISE00Atmosphere > interpolatedModel =
+            std::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
+    interpolatedModel->setInterpolationSettings( std::make_shared< aerodynamics::NRLMSISE00InterpolationSettings >( ) );
+
+    const std::vector< std::string > names = { "NRLMSISE00DensityDirect", "NRLMSISE00DensityInterpolated" };
+    const std::vector< std::shared_ptr< aerodynamics::NRLMSISE00Atmosphere > > models =
+    { directModel, interpolatedModel };
+    for( unsigned int j = 0; j < models.size( ); j++ )
+    {
+        std::shared_ptr< aerodynamics::NRLMSISE00Atmosphere > model = models.at( j );
+        runner.addBenchmark(
+                    names.at( j ),
+                    [ = ]( const unsigned long long numberOfIterations )
+        {
+            double density;
+            for( unsigned long long i = 0; i < numberOfIterations; i++ )
+            {
+                const std::vector< double >& point = evaluationPoints[ i % evaluationPoints.size( ) ];
+                density = model->getDensity( point[ 0 ], point[ 1 ], point[ 2 ], point[ 3 ] );
+                doNotOptimize( density );
+            }
+        } );
+    }
+}
+#endif
+
+int main( int argc, char* argv[ ] )
+{
+    try
+    {
+        BenchmarkRunner runner( "CoreKernels", argc, argv );
+
+        std::vector< int > maximumDegrees = { 4, 16, 64, 128 };
+        for( unsigned int i = 0; i < maximumDegrees.size( ); i++ )
+        {
+            addSphericalHarmonicAccelerationBenchmark( runner, maximumDegrees.at( i ) );
+        }
+        for( unsigned int i = 0; i < maximumDegrees.size( ); i++ )
+        {
+            addLegendreCacheUpdateBenchmark( runner, maximumDegrees.at( i ) );
+        }
+        addInterpolatorBenchmarks( runner );
+        addElementConversionBenchmarks( runner );
+        addKeplerEquationBenchmarks( runner );
+        addAnalyticalPropagationBenchmarks( runner );
+        addLambertBenchmarks( runner );
+        addTimeArithmeticBenchmarks( runner );
+#if( BUILD_WITH_ESTIMATION_TOOLS )
+        addLightTimeBenchmark( runner );
+#endif
+#if( USE_NRLMSISE00 )
+        addNRLMSISE00Benchmarks( runner );
+#endif
+
+        return runner.run( );
+    }
+    catch( std::exception& caughtException )
+    {
+        std::cerr << caughtException.what( ) << std::endl;
+        return EXIT_FAILURE;
+    }
+}
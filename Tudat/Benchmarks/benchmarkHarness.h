@@ -0,0 +1,394 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BENCHMARKHARNESS_H
+#define TUDAT_BENCHMARKHARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function to prevent the compiler from optimizing away the computation of a value.
+/*!
+ *  Function to prevent the compiler from optimizing away the computation of a value that is not otherwise used in a
+ *  benchmark.
+ *  \param value Value of which the computation is to be retained.
+ */
+template< typename ValueType >
+inline void doNotOptimize( const ValueType& value )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    asm volatile( "" : : "r"( &value ) : "memory" );
+#else
+    static volatile const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+//! Results of a single benchmark.
+struct BenchmarkResult
+{
+    //! Name of the benchmark.
+    std::string name;
+
+    //! Number of iterations in each repetition of the benchmark.
+    unsigned long long numberOfIterations;
+
+    //! Wall-clock time per iteration (in seconds), for each repetition of the benchmark.
+    std::vector< double > timesPerIteration;
+
+    //! Minimum of timesPerIteration.
+    double minimumTime;
+
+    //! Median of timesPerIteration.
+    double medianTime;
+
+    //! Mean of timesPerIteration.
+    double meanTime;
+
+    //! Sample standard deviation of timesPerIteration.
+    double standardDeviation;
+};
+
+//! Class to register and run a set of benchmarks, and report the results.
+/*!
+ *  Class to register and run a set of benchmarks, and report the results to console or in a machine-readable format
+ *  (CSV or JSON), so that results of different versions may be compared. Each benchmark is a function that executes a
+ *  given number of iterations of the benchmarked computation. The number of iterations is first calibrated such that a
+ *  single repetition takes at least a minimum time, after which a fixed number of repetitions is timed. All inputs of
+ *  the benchmarks should be deterministic (e.g. fixed random seeds), for results to be reproducible.
+ *  Command line options (all optional):
+ *  --filter=<text>       Only run benchmarks of which the name contains the given text.
+ *  --format=<format>     Output format: console (default), csv or json.
+ *  --output=<file>       File to which results are written (default: standard output).
+ *  --repetitions=<n>     Number of timed repetitions of each benchmark (default 5).
+ *  --min_time=<seconds>  Minimum duration of a single repetition (default 0.1).
+ *  --list                Only list the names of the registered benchmarks.
+ */
+class BenchmarkRunner
+{
+public:
+
+    //! Typedef for the function executing a given number of iterations of a benchmark.
+    typedef std::function< void( const unsigned long long ) > BenchmarkFunction;
+
+    //! Constructor, parses the command line options.
+    /*!
+     *  Constructor, parses the command line options.
+     *  \param suiteName Name of the suite of benchmarks.
+     *  \param argc Number of command line arguments.
+     *  \param argv Command line arguments.
+     */
+    BenchmarkRunner( const std::string& suiteName, int argc, char* argv[ ] ):
+        suiteName_( suiteName ), outputFormat_( "console" ), numberOfRepetitions_( 5 ), minimumTime_( 0.1 ),
+        listOnly_( false )
+    {
+        for( int i = 1; i < argc; i++ )
+        {
+            const std::string argument( argv[ i ] );
+            if( argument.compare( 0, 9, "--filter=" ) == 0 )
+            {
+                filter_ = argument.substr( 9 );
+            }
+            else if( argument.compare( 0, 9, "--format=" ) == 0 )
+            {
+                outputFormat_ = argument.substr( 9 );
+                if( outputFormat_ != "console" && outputFormat_ != "csv" && outputFormat_ != "json" )
+                {
+                    throw std::runtime_error( "Error in benchmark, output format " + outputFormat_ + " not recognized." );
+                }
+            }
+            else if( argument.compare( 0, 9, "--output=" ) == 0 )
+            {
+                outputFile_ = argument.substr( 9 );
+            }
+            else if( argument.compare( 0, 14, "--repetitions=" ) == 0 )
+            {
+                numberOfRepetitions_ = std::max( 1, std::atoi( argument.substr( 14 ).c_str( ) ) );
+            }
+            else if( argument.compare( 0, 11, "--min_time=" ) == 0 )
+            {
+                minimumTime_ = std::atof( argument.substr( 11 ).c_str( ) );
+            }
+            else if( argument == "--list" )
+            {
+                listOnly_ = true;
+            }
+            else
+            {
+                throw std::runtime_error( "Error in benchmark, command line argument " + argument + " not recognized." );
+            }
+        }
+    }
+
+    //! Function to register a benchmark.
+    /*!
+     *  Function to register a benchmark.
+     *  \param name Name of the benchmark (should be unique, and remain unchanged between versions).
+     *  \param benchmarkFunction Function that executes a given number of iterations of the benchmark.
+     */
+    void addBenchmark( const std::string& name, const BenchmarkFunction& benchmarkFunction )
+    {
+        benchmarkNames_.push_back( name );
+        benchmarkFunctions_.push_back( benchmarkFunction );
+    }
+
+    //! Function to run all (selected) benchmarks and write the results.
+    /*!
+     *  Function to run all benchmarks selected by the filter, and write the results in the requested format.
+     *  \return Exit code of the benchmark program.
+     */
+    int run( )
+    {
+        if( listOnly_ )
+        {
+            for( unsigned int i = 0; i < benchmarkNames_.size( ); i++ )
+            {
+                std::cout << benchmarkNames_.at( i ) << std::endl;
+            }
+            return EXIT_SUCCESS;
+        }
+
+        std::vector< BenchmarkResult > results;
+        for( unsigned int i = 0; i < benchmarkNames_.size( ); i++ )
+        {
+            if( benchmarkNames_.at( i ).find( filter_ ) != std::string::npos )
+            {
+                results.push_back( runBenchmark( benchmarkNames_.at( i ), benchmarkFunctions_.at( i ) ) );
+                if( outputFormat_ != "console" || !outputFile_.empty( ) )
+                {
+                    std::cerr << "Finished " << benchmarkNames_.at( i ) << std::endl;
+                }
+            }
+        }
+
+        if( outputFile_.empty( ) )
+        {
+            writeResults( results, std::cout );
+        }
+        else
+        {
+            std::ofstream outputStream( outputFile_.c_str( ) );
+            if( !outputStream.is_open( ) )
+            {
+                throw std::runtime_error( "Error in benchmark, could not open output file " + outputFile_ );
+            }
+            writeResults( results, outputStream );
+        }
+        return EXIT_SUCCESS;
+    }
+
+private:
+
+    //! Function to time a given number of iterations of a benchmark.
+    double timeIterations( const BenchmarkFunction& benchmarkFunction, const unsigned long long numberOfIterations )
+    {
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now( );
+        benchmarkFunction( numberOfIterations );
+        return std::chrono::duration< double >( std::chrono::steady_clock::now( ) - startTime ).count( );
+    }
+
+    //! Function to calibrate the number of iterations and run the repetitions of a single benchmark.
+    BenchmarkResult runBenchmark( const std::string& name, const BenchmarkFunction& benchmarkFunction )
+    {
+        // Warm up, and increase number of iterations until a single repetition takes at least the minimum time.
+        unsigned long long numberOfIterations = 1;
+        double elapsedTime = timeIterations( benchmarkFunction, numberOfIterations );
+        while( elapsedTime < minimumTime_ )
+        {
+            double increaseFactor = ( elapsedTime > 0.0 ) ? ( 1.2 * minimumTime_ / elapsedTime ) : 10.0;
+            increaseFactor = std::min( std::max( increaseFactor, 1.5 ), 10.0 );
+            numberOfIterations = static_cast< unsigned long long >(
+                        std::ceil( static_cast< double >( numberOfIterations ) * increaseFactor ) );
+            elapsedTime = timeIterations( benchmarkFunction, numberOfIterations );
+        }
+
+        BenchmarkResult result;
+        result.name = name;
+        result.numberOfIterations = numberOfIterations;
+        for( int i = 0; i < numberOfRepetitions_; i++ )
+        {
+            result.timesPerIteration.push_back( timeIterations( benchmarkFunction, numberOfIterations ) /
+                                                static_cast< double >( numberOfIterations ) );
+        }
+
+        // Compute statistics of repetitions.
+        std::vector< double > sortedTimes = result.timesPerIteration;
+        std::sort( sortedTimes.begin( ), sortedTimes.end( ) );
+        result.minimumTime = sortedTimes.front( );
+        result.medianTime = ( sortedTimes.size( ) % 2 == 1 ) ? sortedTimes.at( sortedTimes.size( ) / 2 ) :
+                                                               0.5 * ( sortedTimes.at( sortedTimes.size( ) / 2 - 1 ) +
+                                                                       sortedTimes.at( sortedTimes.size( ) / 2 ) );
+        result.meanTime = 0.0;
+        for( unsigned int i = 0; i < sortedTimes.size( ); i++ )
+        {
+            result.meanTime += sortedTimes.at( i );
+        }
+        result.meanTime /= static_cast< double >( sortedTimes.size( ) );
+        result.standardDeviation = 0.0;
+        if( sortedTimes.size( ) > 1 )
+        {
+            for( unsigned int i = 0; i < sortedTimes.size( ); i++ )
+            {
+                result.standardDeviation += ( sortedTimes.at( i ) - result.meanTime ) *
+                        ( sortedTimes.at( i ) - result.meanTime );
+            }
+            result.standardDeviation = std::sqrt(
+                        result.standardDeviation / static_cast< double >( sortedTimes.size( ) - 1 ) );
+        }
+        return result;
+    }
+
+    //! Function to retrieve the current date and time, in ISO 8601 format (UTC).
+    std::string getCurrentDateTime( )
+    {
+        std::time_t currentTime = std::time( nullptr );
+        char dateTimeString[ 32 ];
+        std::strftime( dateTimeString, sizeof( dateTimeString ), "%Y-%m-%dT%H:%M:%SZ", std::gmtime( &currentTime ) );
+        return std::string( dateTimeString );
+    }
+
+    //! Function to retrieve a description of the compiler and build type.
+    std::string getBuildDescription( )
+    {
+        std::ostringstream buildDescription;
+#if defined( __clang__ )
+        buildDescription << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined( __GNUC__ )
+        buildDescription << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined( _MSC_VER )
+        buildDescription << "msvc " << _MSC_VER;
+#else
+        buildDescription << "unknown compiler";
+#endif
+#if defined( NDEBUG )
+        buildDescription << ", assertions disabled";
+#else
+        buildDescription << ", assertions enabled";
+#endif
+        return buildDescription.str( );
+    }
+
+    //! Function to write the results of all benchmarks in the requested format.
+    void writeResults( const std::vector< BenchmarkResult >& results, std::ostream& outputStream )
+    {
+        if( outputFormat_ == "json" )
+        {
+            outputStream << "{" << std::endl
+                         << "  \"context\": {" << std::endl
+                         << "    \"suite\": \"" << suiteName_ << "\"," << std::endl
+                         << "    \"date\": \"" << getCurrentDateTime( ) << "\"," << std::endl
+                         << "    \"build\": \"" << getBuildDescription( ) << "\"," << std::endl
+                         << "    \"repetitions\": " << numberOfRepetitions_ << "," << std::endl
+                         << "    \"time_unit\": \"s\"" << std::endl
+                         << "  }," << std::endl
+                         << "  \"benchmarks\": [" << std::endl;
+            outputStream << std::setprecision( 9 );
+            for( unsigned int i = 0; i < results.size( ); i++ )
+            {
+                const BenchmarkResult& result = results.at( i );
+                outputStream << "    {" << std::endl
+                             << "      \"name\": \"" << result.name << "\"," << std::endl
+                             << "      \"iterations\": " << result.numberOfIterations << "," << std::endl
+                             << "      \"min_time\": " << result.minimumTime << "," << std::endl
+                             << "      \"median_time\": " << result.medianTime << "," << std::endl
+                             << "      \"mean_time\": " << result.meanTime << "," << std::endl
+                             << "      \"stddev_time\": " << result.standardDeviation << "," << std::endl
+                             << "      \"repetition_times\": [";
+                for( unsigned int j = 0; j < result.timesPerIteration.size( ); j++ )
+                {
+                    outputStream << ( j == 0 ? "" : ", " ) << result.timesPerIteration.at( j );
+                }
+                outputStream << "]" << std::endl
+                             << "    }" << ( i + 1 < results.size( ) ? "," : "" ) << std::endl;
+            }
+            outputStream << "  ]" << std::endl << "}" << std::endl;
+        }
+        else if( outputFormat_ == "csv" )
+        {
+            outputStream << "name,iterations,min_time,median_time,mean_time,stddev_time" << std::endl;
+            outputStream << std::setprecision( 9 );
+            for( unsigned int i = 0; i < results.size( ); i++ )
+            {
+                const BenchmarkResult& result = results.at( i );
+                outputStream << result.name << "," << result.numberOfIterations << "," << result.minimumTime << ","
+                             << result.medianTime << "," << result.meanTime << "," << result.standardDeviation
+                             << std::endl;
+            }
+        }
+        else
+        {
+            outputStream << suiteName_ << " (" << getBuildDescription( ) << ", " << numberOfRepetitions_
+                         << " repetitions)" << std::endl;
+            outputStream << std::left << std::setw( 50 ) << "Benchmark" << std::right << std::setw( 14 ) << "Iterations"
+                         << std::setw( 16 ) << "Median [s]" << std::setw( 16 ) << "Min [s]"
+                         << std::setw( 12 ) << "Stddev [%]" << std::endl;
+            for( unsigned int i = 0; i < results.size( ); i++ )
+            {
+                const BenchmarkResult& result = results.at( i );
+                outputStream << std::left << std::setw( 50 ) << result.name << std::right
+                             << std::setw( 14 ) << result.numberOfIterations
+                             << std::setw( 16 ) << std::scientific << std::setprecision( 4 ) << result.medianTime
+                             << std::setw( 16 ) << result.minimumTime
+                             << std::setw( 12 ) << std::fixed << std::setprecision( 2 )
+                             << 100.0 * result.standardDeviation / result.meanTime << std::endl;
+            }
+        }
+    }
+
+    //! Name of the suite of benchmarks.
+    std::string suiteName_;
+
+    //! Names of the registered benchmarks.
+    std::vector< std::string > benchmarkNames_;
+
+    //! Functions executing the registered benchmarks.
+    std::vector< BenchmarkFunction > benchmarkFunctions_;
+
+    //! Text that the names of the benchmarks that are run must contain.
+    std::string filter_;
+
+    //! Output format (console, csv or json).
+    std::string outputFormat_;
+
+    //! File to which the results are written (empty for standard output).
+    std::string outputFile_;
+
+    //! Number of timed repetitions of each benchmark.
+    int numberOfRepetitions_;
+
+    //! Minimum duration of a single repetition (in seconds).
+    double minimumTime_;
+
+    //! Boolean denoting whether only the names of the benchmarks are to be listed.
+    bool listOnly_;
+};
+
+} // namespace benchmarks
+
+} // namespace tudat
+
+#endif // TUDAT_BENCHMARKHARNESS_H
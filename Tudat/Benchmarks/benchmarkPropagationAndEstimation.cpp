@@ -0,0 +1,256 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Macro-benchmarks of complete propagation and estimation runs for a single satellite in low Earth orbit: numerical
+ *    propagation with an RKF7(8) integrator, propagation of the variational equations and a single iteration of an
+ *    orbit determination from simulated position observations. The environment is defined without external data
+ *    (no Spice kernels), and all inputs are fixed, so that results are reproducible.
+ *    Usage: benchmark_PropagationAndEstimation [--filter=<text>] [--format=console|csv|json] [--output=<file>]
+ *                                              [--repetitions=<n>] [--min_time=<seconds>] [--list]
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/Benchmarks/benchmarkHarness.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/EstimationSetup/variationalEquationsSolver.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+using namespace tudat;
+using namespace tudat::benchmarks;
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::observation_models;
+
+static const double earthGravitationalParameter = 3.986004418E14;
+static const double earthEquatorialRadius = 6378137.0;
+static const int earthGravityFieldDegree = 16;
+static const double propagationDuration = 86400.0;
+
+//! Function to create the environment: a spherical harmonic Earth with a simple rotation model, and a satellite.
+NamedBodyMap createBenchmarkBodies( )
+{
+    // Generate geodesy-normalized coefficients according to Kaula's rule, with a fixed seed.
+    std::mt19937 randomGenerator( 2018 );
+    std::normal_distribution< double > coefficientDistribution( 0.0, 1.0 );
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero(
+                earthGravityFieldDegree + 1, earthGravityFieldDegree + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero(
+                earthGravityFieldDegree + 1, earthGravityFieldDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.841651E-4;
+    for( int degree = 2; degree <= earthGravityFieldDegree; degree++ )
+    {
+        const double coefficientMagnitude = 1.0E-5 / static_cast< double >( degree * degree );
+        for( int order = ( degree == 2 ? 1 : 0 ); order <= degree; order++ )
+        {
+            cosineCoefficients( degree, order ) = coefficientMagnitude * coefficientDistribution( randomGenerator );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = coefficientMagnitude * coefficientDistribution( randomGenerator );
+            }
+        }
+    }
+
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = std::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( std::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( std::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                                  earthGravitationalParameter, earthEquatorialRadius,
+                                                  cosineCoefficients, sineCoefficients, "IAU_Earth" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( std::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                    Eigen::Quaterniond::Identity( ), 7.2921150E-5, 0.0,
+                                                    "ECLIPJ2000", "IAU_Earth" ) );
+
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+    return bodyMap;
+}
+
+//! Function to create the settings for the propagation of the satellite.
+std::shared_ptr< TranslationalStatePropagatorSettings< double > > createBenchmarkPropagatorSettings(
+        const NamedBodyMap& bodyMap )
+{
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< SphericalHarmonicAccelerationSettings >(
+                    earthGravityFieldDegree, earthGravityFieldDegree ) );
+    std::map< std::string, std::string > centralBodies;
+    centralBodies[ "Vehicle" ] = "Earth";
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, centralBodies );
+
+    Eigen::Vector6d initialKeplerianState;
+    initialKeplerianState << 7.0E6, 0.01, 1.7, 0.5, 1.0, 0.0;
+    Eigen::VectorXd initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerianState, earthGravitationalParameter );
+
+    return std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                std::vector< std::string >{ "Earth" }, accelerationModelMap, std::vector< std::string >{ "Vehicle" },
+                initialState, propagationDuration, cowell );
+}
+
+//! Function to create the RKF7(8) integrator settings.
+std::shared_ptr< IntegratorSettings< double > > createBenchmarkIntegratorSettings( )
+{
+    return std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 3600.0, 1.0E-12, 1.0E-12 );
+}
+
+//! Function to add the benchmark of the numerical propagation of the satellite.
+void addPropagationBenchmark( BenchmarkRunner& runner )
+{
+    NamedBodyMap bodyMap = createBenchmarkBodies( );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createBenchmarkPropagatorSettings( bodyMap );
+    std::shared_ptr< SingleArcDynamicsSimulator< double, double > > dynamicsSimulator =
+            std::make_shared< SingleArcDynamicsSimulator< double, double > >(
+                bodyMap, createBenchmarkIntegratorSettings( ), propagatorSettings, false );
+
+    runner.addBenchmark(
+                "Rkf78Propagation/SphericalHarmonics" + std::to_string( earthGravityFieldDegree ) + "/1day",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            dynamicsSimulator->integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+            doNotOptimize( dynamicsSimulator->getEquationsOfMotionNumericalSolution( ).rbegin( )->second );
+        }
+    } );
+}
+
+//! Function to create the parameters to estimate (initial state and gravitational parameter of the Earth).
+std::shared_ptr< EstimatableParameterSet< double > > createBenchmarkParameters(
+        const NamedBodyMap& bodyMap,
+        const std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings )
+{
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterSettings;
+    parameterSettings.push_back( std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                     "Vehicle", propagatorSettings->getInitialStates( ), "Earth", "ECLIPJ2000" ) );
+    parameterSettings.push_back( std::make_shared< EstimatableParameterSettings >(
+                                     "Earth", gravitational_parameter ) );
+    return createParametersToEstimate< double >( parameterSettings, bodyMap );
+}
+
+//! Function to add the benchmark of the numerical propagation of the dynamics and variational equations.
+void addVariationalPropagationBenchmark( BenchmarkRunner& runner )
+{
+    NamedBodyMap bodyMap = createBenchmarkBodies( );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createBenchmarkPropagatorSettings( bodyMap );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createBenchmarkParameters( bodyMap, propagatorSettings );
+    std::shared_ptr< SingleArcVariationalEquationsSolver< double, double > > variationalEquationsSolver =
+            std::make_shared< SingleArcVariationalEquationsSolver< double, double > >(
+                bodyMap, createBenchmarkIntegratorSettings( ), propagatorSettings, parametersToEstimate, true,
+                std::shared_ptr< IntegratorSettings< double > >( ), true, false );
+    Eigen::VectorXd initialState = parametersToEstimate->getFullParameterValues< double >( );
+
+    runner.addBenchmark(
+                "VariationalPropagation/SphericalHarmonics" + std::to_string( earthGravityFieldDegree ) + "/1day",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            variationalEquationsSolver->integrateVariationalAndDynamicalEquations( initialState, true );
+            doNotOptimize( variationalEquationsSolver->getNumericalVariationalEquationsSolution( ) );
+        }
+    } );
+}
+
+//! Function to add the benchmark of a single iteration of an orbit determination from position observations.
+void addEstimationIterationBenchmark( BenchmarkRunner& runner )
+{
+    NamedBodyMap bodyMap = createBenchmarkBodies( );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createBenchmarkPropagatorSettings( bodyMap );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createBenchmarkParameters( bodyMap, propagatorSettings );
+
+    LinkEnds linkEnds;
+    linkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+    ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, std::make_shared< ObservationSettings >(
+                                                       position_observable ) ) );
+
+    std::shared_ptr< OrbitDeterminationManager< double, double > > orbitDeterminationManager =
+            std::make_shared< OrbitDeterminationManager< double, double > >(
+                bodyMap, parametersToEstimate, observationSettingsMap, createBenchmarkIntegratorSettings( ),
+                propagatorSettings );
+    Eigen::VectorXd truthParameters = parametersToEstimate->getFullParameterValues< double >( );
+
+    // Simulate observations every 5 minutes, from the nominal parameters.
+    std::vector< double > observationTimes;
+    for( double observationTime = 600.0; observationTime < propagationDuration - 600.0; observationTime += 300.0 )
+    {
+        observationTimes.push_back( observationTime );
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    measurementSimulationInput[ position_observable ][ linkEnds ] = std::make_pair( observationTimes, observed_body );
+    std::shared_ptr< PodInput< double, double > > podInput = std::make_shared< PodInput< double, double > >(
+                simulateObservations< double, double >(
+                    measurementSimulationInput, orbitDeterminationManager->getObservationSimulators( ) ),
+                truthParameters.rows( ) );
+    podInput->defineEstimationSettings( true, true, true, false, false, false );
+
+    Eigen::VectorXd perturbedParameters = truthParameters;
+    perturbedParameters.segment( 0, 3 ) += Eigen::Vector3d::Constant( 10.0 );
+    perturbedParameters.segment( 3, 3 ) += Eigen::Vector3d::Constant( 1.0E-2 );
+
+    runner.addBenchmark(
+                "EstimationIteration/SphericalHarmonics" + std::to_string( earthGravityFieldDegree ) + "/1day",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            parametersToEstimate->resetParameterValues( perturbedParameters );
+            std::shared_ptr< PodOutput< double, double > > podOutput = orbitDeterminationManager->estimateParameters(
+                        podInput, std::make_shared< EstimationConvergenceChecker >( 1 ) );
+            doNotOptimize( podOutput->parameterEstimate_ );
+        }
+    } );
+}
+
+int main( int argc, char* argv[ ] )
+{
+    try
+    {
+        BenchmarkRunner runner( "PropagationAndEstimation", argc, argv );
+
+        addPropagationBenchmark( runner );
+        addVariationalPropagationBenchmark( runner );
+        addEstimationIterationBenchmark( runner );
+
+        return runner.run( );
+    }
+    catch( std::exception& caughtException )
+    {
+        std::cerr << caughtException.what( ) << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,352 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Benchmarks of the readers of large text data files: the spherical harmonic gravity field files shipped in
+ *    External/GravityModels (read as gravity field and as matrix), and a synthetic TLE catalogue. The memory-mapped,
+ *    multi-threaded readers are compared to copies of the previous (stream-based, single-threaded) readers.
+ *    Usage: benchmark_TextFileParsing [--filter=<text>] [--format=console|csv|json] [--output=<file>]
+ *                                     [--repetitions=<n>] [--min_time=<seconds>] [--list]
+ *
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Basics/parallelLoop.h"
+#include "Tudat/Benchmarks/benchmarkHarness.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/matrixTextFileReader.h"
+#include "Tudat/InputOutput/streamFilters.h"
+#include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
+
+using namespace tudat;
+using namespace tudat::benchmarks;
+
+//! Previous (stream-based) implementation of input_output::readMatrixFromFile, used as reference.
+Eigen::MatrixXd readMatrixFromFileWithStreams(
+        const std::string& relativePath, const std::string& separators, const std::string& skipLinesCharacter,
+        const int numberOfHeaderLines )
+{
+    std::fstream file( relativePath.c_str( ), std::ios::in );
+    if ( file.fail( ) )
+    {
+        throw std::runtime_error( "Data file could not be opened:" + relativePath );
+    }
+
+    std::stringstream filteredStream( std::ios::in | std::ios::out );
+    {
+        boost::iostreams::filtering_ostream filterProcessor;
+        for ( unsigned int i = 0; i < skipLinesCharacter.size( ); i++ )
+        {
+            filterProcessor.push( input_output::stream_filters::RemoveComment( skipLinesCharacter[ i ], true ) );
+        }
+        filterProcessor.push( filteredStream );
+        boost::iostreams::copy( file, filterProcessor );
+    }
+    filteredStream.seekg( 0, std::ios::beg );
+
+    std::vector< std::string > lines;
+    int numberOfLinesParsed = 0;
+    while ( !filteredStream.eof( ) )
+    {
+        std::string line;
+        getline( filteredStream, line );
+        if ( numberOfLinesParsed >= numberOfHeaderLines && !line.empty( ) )
+        {
+            boost::trim_all( line );
+            lines.push_back( line );
+        }
+        numberOfLinesParsed++;
+    }
+    if ( lines.empty( ) )
+    {
+        return Eigen::MatrixXd( );
+    }
+
+    const std::string realSeparators = std::string( separators ) + " ";
+    std::vector< std::string > lineSplit;
+    boost::algorithm::split( lineSplit, lines[ 0 ], boost::is_any_of( realSeparators ),
+                             boost::algorithm::token_compress_on );
+    const unsigned int numberOfColumns = lineSplit.size( );
+
+    Eigen::MatrixXd dataMatrix( lines.size( ), numberOfColumns );
+    for ( int rowIndex = 0; rowIndex < dataMatrix.rows( ); rowIndex++ )
+    {
+        lineSplit.clear( );
+        boost::algorithm::split( lineSplit, lines[ rowIndex ], boost::is_any_of( realSeparators ),
+                                 boost::algorithm::token_compress_on );
+        if ( lineSplit.size( ) != numberOfColumns )
+        {
+            throw std::runtime_error( "Number of colums in row " + std::to_string( rowIndex ) + " is " +
+                                      std::to_string( lineSplit.size( ) ) + "; should be " +
+                                      std::to_string( numberOfColumns ) );
+        }
+        for ( int columnIndex = 0; columnIndex < dataMatrix.cols( ); columnIndex++ )
+        {
+            boost::trim( lineSplit.at( columnIndex ) );
+            dataMatrix( rowIndex, columnIndex ) = boost::lexical_cast< double >( lineSplit.at( columnIndex ) );
+        }
+    }
+
+    return dataMatrix;
+}
+
+//! Previous (stream-based) implementation of simulation_setup::readGravityFieldFile, used as reference.
+std::pair< double, double > readGravityFieldFileWithStreams(
+        const std::string& fileName, const int maximumDegree, const int maximumOrder,
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    std::fstream stream( fileName.c_str( ), std::ios::in );
+    if( stream.fail( ) )
+    {
+        throw std::runtime_error( "Pds gravity field data file could not be opened: " + fileName );
+    }
+
+    std::vector< std::string > vectorOfIndividualStrings;
+    vectorOfIndividualStrings.resize( 4 );
+    std::string line;
+
+    double gravitationalParameter = TUDAT_NAN;
+    double referenceRadius = TUDAT_NAN;
+    if( ( gravitationalParameterIndex >= 0 ) && ( referenceRadiusIndex >= 0 ) )
+    {
+        std::getline( stream, line );
+        boost::algorithm::trim( line );
+        boost::algorithm::split( vectorOfIndividualStrings, line, boost::algorithm::is_any_of( "\t, " ),
+                                 boost::algorithm::token_compress_on );
+        gravitationalParameter = std::stod( vectorOfIndividualStrings[ gravitationalParameterIndex ] );
+        referenceRadius = std::stod( vectorOfIndividualStrings[ referenceRadiusIndex ] );
+    }
+
+    int currentDegree = 0, currentOrder = 0;
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    while ( !stream.fail( ) && !stream.eof( ) && ( currentDegree <= maximumDegree || currentOrder <= maximumOrder ) )
+    {
+        std::getline( stream, line );
+        boost::algorithm::trim( line );
+        boost::algorithm::split( vectorOfIndividualStrings, line, boost::algorithm::is_any_of( ", " ),
+                                 boost::algorithm::token_compress_on );
+        if( vectorOfIndividualStrings.size( ) != 0 )
+        {
+            if( vectorOfIndividualStrings.size( ) < 4 )
+            {
+                throw std::runtime_error( "Error when reading pds gravity field file, number of fields is " +
+                                          std::to_string( vectorOfIndividualStrings.size( ) ) );
+            }
+            currentDegree = std::stoi( vectorOfIndividualStrings[ 0 ] );
+            currentOrder = std::stoi( vectorOfIndividualStrings[ 1 ] );
+            if( currentDegree <= maximumDegree && currentOrder <= maximumOrder )
+            {
+                cosineCoefficients( currentDegree, currentOrder ) = std::stod( vectorOfIndividualStrings[ 2 ] );
+                sineCoefficients( currentDegree, currentOrder ) = std::stod( vectorOfIndividualStrings[ 3 ] );
+            }
+        }
+    }
+
+    cosineCoefficients( 0, 0 ) = 1.0;
+    coefficients = std::make_pair( cosineCoefficients, sineCoefficients );
+
+    return std::make_pair( gravitationalParameter, referenceRadius );
+}
+
+//! Function to retrieve the numbers of threads with which the current readers are benchmarked (single and default).
+std::vector< int > getNumbersOfThreads( )
+{
+    std::vector< int > numbersOfThreads = { 1 };
+    if( utilities::getDefaultNumberOfThreads( ) > 1 )
+    {
+        numbersOfThreads.push_back( utilities::getDefaultNumberOfThreads( ) );
+    }
+    return numbersOfThreads;
+}
+
+//! Function to add the benchmarks of reading a gravity field file, with the previous and the current reader.
+/*!
+ * Function to add the benchmarks of reading a gravity field file, with the previous and the current reader (single-
+ * and multi-threaded). The file is read up to one degree below its maximum degree, since the previous reader does not
+ * support reading up to the trailing empty line of the file.
+ * \param runner Benchmark runner to which the benchmarks are added.
+ * \param sphericalHarmonicsModel Gravity field model of which the file is read.
+ * \param modelName Name of the gravity field model.
+ * \param maximumDegree Maximum degree (and order) to which the file is read.
+ * \param gravitationalParameterIndex Index of gravitational parameter in file header.
+ * \param referenceRadiusIndex Index of reference radius in file header.
+ */
+void addGravityFieldFileBenchmarks(
+        BenchmarkRunner& runner, const simulation_setup::SphericalHarmonicsModel sphericalHarmonicsModel,
+        const std::string& modelName, const int maximumDegree,
+        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+{
+    const std::string filePath = simulation_setup::getPathForSphericalHarmonicsModel( sphericalHarmonicsModel );
+
+    runner.addBenchmark(
+                "GravityFieldFile/" + modelName + "/Streams",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            readGravityFieldFileWithStreams( filePath, maximumDegree, maximumDegree, coefficients,
+                                             gravitationalParameterIndex, referenceRadiusIndex );
+            doNotOptimize( coefficients.first( maximumDegree, 0 ) );
+        }
+    } );
+
+    const std::vector< int > numbersOfThreads = getNumbersOfThreads( );
+    for( unsigned int j = 0; j < numbersOfThreads.size( ); j++ )
+    {
+        const int numberOfThreads = numbersOfThreads.at( j );
+        runner.addBenchmark(
+                    "GravityFieldFile/" + modelName + "/Mapped/Threads" + std::to_string( numberOfThreads ),
+                    [ = ]( const unsigned long long numberOfIterations )
+        {
+            std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+            for( unsigned long long i = 0; i < numberOfIterations; i++ )
+            {
+                simulation_setup::readGravityFieldFile( filePath, maximumDegree, maximumDegree, coefficients,
+                                                        gravitationalParameterIndex, referenceRadiusIndex,
+                                                        numberOfThreads );
+                doNotOptimize( coefficients.first( maximumDegree, 0 ) );
+            }
+        } );
+    }
+}
+
+//! Function to add the benchmarks of reading a gravity field file (without its header) as a matrix, with the previous
+//! and the current reader (single- and multi-threaded).
+void addMatrixFileBenchmarks( BenchmarkRunner& runner )
+{
+    const std::string filePath = simulation_setup::getPathForSphericalHarmonicsModel( simulation_setup::ggm02c );
+
+    runner.addBenchmark(
+                "MatrixFile/ggm02c/Streams",
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            Eigen::MatrixXd dataMatrix = readMatrixFromFileWithStreams( filePath, "\t ;,", "%", 1 );
+            doNotOptimize( dataMatrix( 0, 0 ) );
+        }
+    } );
+
+    const std::vector< int > numbersOfThreads = getNumbersOfThreads( );
+    for( unsigned int j = 0; j < numbersOfThreads.size( ); j++ )
+    {
+        const int numberOfThreads = numbersOfThreads.at( j );
+        runner.addBenchmark(
+                    "MatrixFile/ggm02c/Mapped/Threads" + std::to_string( numberOfThreads ),
+                    [ = ]( const unsigned long long numberOfIterations )
+        {
+            for( unsigned long long i = 0; i < numberOfIterations; i++ )
+            {
+                Eigen::MatrixXd dataMatrix = input_output::readMatrixFromFile(
+                            filePath, "\t ;,", "%", 1, numberOfThreads );
+                doNotOptimize( dataMatrix( 0, 0 ) );
+            }
+        } );
+    }
+}
+
+//! Function to add the benchmark of reading a (synthetic) TLE catalogue.
+/*!
+ * Function to add the benchmark of reading a synthetic TLE catalogue, created by replicating the objects in the TLE
+ * file of the unit tests.
+ * \param runner Benchmark runner to which the benchmark is added.
+ * \param numberOfObjects Number of objects in the catalogue.
+ */
+void addTwoLineElementsFileBenchmark( BenchmarkRunner& runner, const int numberOfObjects )
+{
+    const std::string sourceFilePath = input_output::getTudatRootPath( ) +
+            "InputOutput/UnitTests/testTwoLineElementsTextFile3Line.txt";
+    std::ifstream sourceFile( sourceFilePath.c_str( ) );
+    std::vector< std::string > sourceLines;
+    std::string line;
+    while( std::getline( sourceFile, line ) )
+    {
+        sourceLines.push_back( line );
+    }
+    if( sourceLines.size( ) < 3 )
+    {
+        throw std::runtime_error( "Error, could not read TLE file " + sourceFilePath );
+    }
+
+    // Write catalogue to temporary file (without trailing newline, as for the source file).
+    const boost::filesystem::path catalogueDirectory = boost::filesystem::temp_directory_path( );
+    const std::string catalogueFileName =
+            boost::filesystem::unique_path( "tudatTleCatalogue%%%%%%%%.txt" ).string( );
+    {
+        std::ofstream catalogueFile( ( catalogueDirectory / catalogueFileName ).string( ).c_str( ) );
+        const int numberOfSourceObjects = static_cast< int >( sourceLines.size( ) ) / 3;
+        for( int i = 0; i < numberOfObjects; i++ )
+        {
+            const int sourceObject = i % numberOfSourceObjects;
+            catalogueFile << ( i > 0 ? "\n" : "" ) << sourceLines.at( 3 * sourceObject ) << "\n"
+                          << sourceLines.at( 3 * sourceObject + 1 ) << "\n" << sourceLines.at( 3 * sourceObject + 2 );
+        }
+    }
+
+    runner.addBenchmark(
+                "TwoLineElementsFile/Objects" + std::to_string( numberOfObjects ),
+                [ = ]( const unsigned long long numberOfIterations )
+    {
+        for( unsigned long long i = 0; i < numberOfIterations; i++ )
+        {
+            input_output::TwoLineElementsTextFileReader twoLineElementsTextFileReader;
+            twoLineElementsTextFileReader.setLineNumberTypeForTwoLineElementInputData(
+                        input_output::TwoLineElementsTextFileReader::threeLineType );
+            twoLineElementsTextFileReader.setAbsoluteDirectoryPath( catalogueDirectory.string( ) + "/" );
+            twoLineElementsTextFileReader.setFileName( catalogueFileName );
+            twoLineElementsTextFileReader.openFile( );
+            twoLineElementsTextFileReader.readAndStoreData( );
+            twoLineElementsTextFileReader.closeFile( );
+            twoLineElementsTextFileReader.setCurrentYear( 2011 );
+            twoLineElementsTextFileReader.storeTwoLineElementData( );
+            doNotOptimize( twoLineElementsTextFileReader.getNumberOfObjects( ) );
+        }
+    } );
+}
+
+int main( int argc, char* argv[ ] )
+{
+    try
+    {
+        BenchmarkRunner runner( "TextFileParsing", argc, argv );
+
+        addGravityFieldFileBenchmarks( runner, simulation_setup::egm96, "egm96", 359, 0, 1 );
+        addGravityFieldFileBenchmarks( runner, simulation_setup::ggm02c, "ggm02c", 199, 0, 1 );
+        addGravityFieldFileBenchmarks( runner, simulation_setup::ggm02s, "ggm02s", 159, 0, 1 );
+        addGravityFieldFileBenchmarks( runner, simulation_setup::jgmro120d, "jgmro120d", 119, 0, 1 );
+        addGravityFieldFileBenchmarks( runner, simulation_setup::glgm3150, "glgm3150", 149, 0, 1 );
+        addGravityFieldFileBenchmarks( runner, simulation_setup::lpe200, "lpe200", 199, 0, 1 );
+        addMatrixFileBenchmarks( runner );
+        addTwoLineElementsFileBenchmark( runner, 20000 );
+
+        return runner.run( );
+    }
+    catch( std::exception& caughtException )
+    {
+        std::cerr << caughtException.what( ) << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,188 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/numericTextFileParser.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace input_output;
+
+//! Function to create a range of characters from a string.
+TextRange getTextRange( const std::string& text )
+{
+    return TextRange( text.data( ), text.data( ) + text.size( ) );
+}
+
+BOOST_AUTO_TEST_SUITE( test_numeric_text_file_parser )
+
+//! Test whether numbers are converted identically to std::strtod.
+BOOST_AUTO_TEST_CASE( testNumberConversion )
+{
+    // Test fixed set of numbers, including numbers outside of the range of the exact conversion.
+    std::vector< std::string > numberStrings =
+    {
+        "0", "-0", "1", "-1.5", "+2.25", ".5", "5.", "0.1", "1.0E-22", "1.0E22", "1.0E23", "-0.484165371736E-03",
+        "398600.44150E+09", "0.4282837581575610E+14", "9007199254740993", "123456789012345678901234567890",
+        "0.000000000000000000000000000000001", "1.7976931348623157E308", "4.9E-324", "2.2250738585072014E-308",
+        "1e400", "1e-400", "10.84016246831189", "  34.2587", "1.5x", "1e", "1e+", "inf", "-nan"
+    };
+
+    // Add random numbers with 1 to 20 significant digits and a range of exponents.
+    std::mt19937 randomGenerator( 42 );
+    std::uniform_int_distribution< int > digitDistribution( 0, 9 );
+    std::uniform_int_distribution< int > numberOfDigitsDistribution( 1, 20 );
+    std::uniform_int_distribution< int > exponentDistribution( -40, 40 );
+    for( unsigned int i = 0; i < 10000; i++ )
+    {
+        std::string numberString = ( i % 2 == 0 ) ? "-" : "";
+        const int numberOfDigits = numberOfDigitsDistribution( randomGenerator );
+        const int decimalPointPosition = numberOfDigitsDistribution( randomGenerator ) % ( numberOfDigits + 1 );
+        for( int j = 0; j < numberOfDigits; j++ )
+        {
+            if( j == decimalPointPosition )
+            {
+                numberString += ".";
+            }
+            numberString += std::to_string( digitDistribution( randomGenerator ) );
+        }
+        numberString += "E" + std::to_string( exponentDistribution( randomGenerator ) );
+        numberStrings.push_back( numberString );
+    }
+
+    for( unsigned int i = 0; i < numberStrings.size( ); i++ )
+    {
+        const std::string& numberString = numberStrings.at( i );
+        char* expectedEnd;
+        const double expectedValue = std::strtod( numberString.c_str( ), &expectedEnd );
+
+        double computedValue = -1.0;
+        const char* computedEnd = parseLeadingDouble(
+                    numberString.data( ), numberString.data( ) + numberString.size( ), computedValue );
+
+        BOOST_CHECK_EQUAL( computedEnd - numberString.data( ), expectedEnd - numberString.c_str( ) );
+        if( expectedValue == expectedValue )
+        {
+            BOOST_CHECK_EQUAL( computedValue, expectedValue );
+            BOOST_CHECK_EQUAL( std::signbit( computedValue ), std::signbit( expectedValue ) );
+        }
+        else
+        {
+            BOOST_CHECK( computedValue != computedValue );
+        }
+    }
+
+    // Test conversion of a complete range.
+    BOOST_CHECK_EQUAL( parseDouble( getTextRange( " 6378136.30\t" ) ), 6378136.30 );
+    BOOST_CHECK_EQUAL( parseInteger( getTextRange( " -42 " ) ), -42 );
+    BOOST_CHECK_THROW( parseDouble( getTextRange( "1.5x" ) ), std::runtime_error );
+    BOOST_CHECK_THROW( parseDouble( getTextRange( "  " ) ), std::runtime_error );
+    BOOST_CHECK_THROW( parseInteger( getTextRange( "1.5" ) ), std::runtime_error );
+}
+
+//! Test splitting of text into lines and tokens.
+BOOST_AUTO_TEST_CASE( testSplitting )
+{
+    // Lines are split as for repeated calls to std::getline.
+    std::vector< TextRange > lines;
+    const std::string text = "1 2\r\n\n3,4\n";
+    splitIntoLines( getTextRange( text ), lines );
+    BOOST_CHECK_EQUAL( lines.size( ), 4 );
+    BOOST_CHECK_EQUAL( lines.at( 0 ).toString( ), "1 2\r" );
+    BOOST_CHECK( lines.at( 1 ).empty( ) );
+    BOOST_CHECK_EQUAL( lines.at( 2 ).toString( ), "3,4" );
+    BOOST_CHECK( lines.at( 3 ).empty( ) );
+
+    // Consecutive separators are treated as a single separator.
+    std::vector< TextRange > tokens;
+    const std::string line = "1,, 2\t3 ";
+    splitIntoTokens( getTextRange( line ), ", \t", tokens );
+    BOOST_CHECK_EQUAL( tokens.size( ), 4 );
+    BOOST_CHECK_EQUAL( tokens.at( 0 ).toString( ), "1" );
+    BOOST_CHECK_EQUAL( tokens.at( 1 ).toString( ), "2" );
+    BOOST_CHECK_EQUAL( tokens.at( 2 ).toString( ), "3" );
+    BOOST_CHECK( tokens.at( 3 ).empty( ) );
+
+    BOOST_CHECK_EQUAL( trimWhitespace( getTextRange( " \t a b \r" ) ).toString( ), "a b" );
+}
+
+//! Test parsing of lines into a matrix, using different numbers of threads.
+BOOST_AUTO_TEST_CASE( testParallelParsing )
+{
+    // Create text with more lines than a single block.
+    std::string text;
+    const int numberOfRows = 5000;
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        text += std::to_string( i ) + " " + std::to_string( 0.001 * i ) + ", -" + std::to_string( i ) + "E-3\n";
+    }
+
+    std::vector< TextRange > lines;
+    splitIntoLines( getTextRange( text ), lines );
+    lines.pop_back( );
+
+    for( int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads++ )
+    {
+        const Eigen::MatrixXd dataMatrix = parseNumericTextLines< double >( lines, ", ", numberOfThreads );
+        BOOST_CHECK_EQUAL( dataMatrix.rows( ), numberOfRows );
+        BOOST_CHECK_EQUAL( dataMatrix.cols( ), 3 );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            BOOST_CHECK_EQUAL( dataMatrix( i, 0 ), static_cast< double >( i ) );
+            BOOST_CHECK_EQUAL( dataMatrix( i, 1 ), std::strtod( std::to_string( 0.001 * i ).c_str( ), nullptr ) );
+            BOOST_CHECK_EQUAL( dataMatrix( i, 2 ), -static_cast< double >( i ) / 1000.0 );
+        }
+
+        const Eigen::MatrixXi integerMatrix = parseNumericTextLines< int >(
+                    std::vector< TextRange >( lines.begin( ), lines.begin( ) + 3 ), " ,.E-", numberOfThreads );
+        BOOST_CHECK_EQUAL( integerMatrix( 2, 0 ), 2 );
+    }
+
+    // Check that an error is thrown if a row has a different number of columns, or an invalid number.
+    std::vector< TextRange > invalidLines = lines;
+    const std::string invalidRow = "1 2";
+    invalidLines.at( 4000 ) = getTextRange( invalidRow );
+    BOOST_CHECK_THROW( parseNumericTextLines< double >( invalidLines, ", ", 4 ), std::runtime_error );
+
+    const std::string invalidNumber = "1 2 x";
+    invalidLines.at( 4000 ) = getTextRange( invalidNumber );
+    BOOST_CHECK_THROW( parseNumericTextLines< double >( invalidLines, ", ", 4 ), std::runtime_error );
+}
+
+//! Test reading a file into memory.
+BOOST_AUTO_TEST_CASE( testMappedTextFile )
+{
+    const MappedTextFile mappedFile( input_output::getTudatRootPath( ) + "InputOutput/UnitTests/testMatrix.txt" );
+    std::vector< TextRange > lines;
+    splitIntoLines( mappedFile.getContents( ), lines );
+    BOOST_CHECK( lines.size( ) > 1 );
+
+    BOOST_CHECK_THROW( MappedTextFile( input_output::getTudatRootPath( ) + "InputOutput/UnitTests/noSuchFile.txt" ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -36,7 +36,13 @@
 #include <string>
 #include <vector>
 
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/twoLineElementCatalogue.h"
 #include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
 
 namespace tudat
@@ -183,6 +189,117 @@ BOOST_AUTO_TEST_CASE( testTwoLineElementsTextFileReaderForThreeLine )
     BOOST_CHECK_EQUAL( twoLineElementDataAfterIntegrityCheck.at( 2 ).revolutionNumber, 57038 );
 }
 
+//! Test compact TLE catalogue.
+BOOST_AUTO_TEST_CASE( testTwoLineElementCatalogue )
+{
+    using namespace input_output;
+    using namespace orbital_element_conversions;
+
+    // Read catalogue file, removing corrupted TLEs.
+    const TwoLineElementCataloguePointer catalogue = readTwoLineElementCatalogue(
+                getTudatRootPath( ) + "InputOutput/UnitTests/testTwoLineElementsTextFile3Line.txt", 2011 );
+    BOOST_CHECK_EQUAL( catalogue->getNumberOfObjects( ), 3 );
+    BOOST_CHECK_EQUAL( catalogue->getObjectIdentificationNumbers( ).at( 0 ), 5 );
+
+    // Read same file with TLE reader, and duplicate the entries, with a later epoch for the first duplicates.
+    TwoLineElementsTextFileReader twoLineElementsTextFileReader;
+    twoLineElementsTextFileReader.setLineNumberTypeForTwoLineElementInputData(
+                TwoLineElementsTextFileReader::threeLineType );
+    twoLineElementsTextFileReader.setRelativeDirectoryPath( "InputOutput/UnitTests/" );
+    twoLineElementsTextFileReader.setFileName( "testTwoLineElementsTextFile3Line.txt" );
+    twoLineElementsTextFileReader.openFile( );
+    twoLineElementsTextFileReader.readAndStoreData( );
+    twoLineElementsTextFileReader.closeFile( );
+    twoLineElementsTextFileReader.setCurrentYear( 2011 );
+    twoLineElementsTextFileReader.storeTwoLineElementData( );
+    twoLineElementsTextFileReader.checkTwoLineElementsFileIntegrity( );
+
+    std::vector< TwoLineElementData > twoLineElementData = twoLineElementsTextFileReader.getTwoLineElementData( );
+    const unsigned int numberOfUniqueObjects = twoLineElementData.size( );
+    for ( unsigned int i = 0; i < numberOfUniqueObjects; i++ )
+    {
+        twoLineElementData.push_back( twoLineElementData.at( i ) );
+        twoLineElementData.back( ).epochDay += ( i == 0 ) ? 1.0 : -1.0;
+    }
+
+    for ( int numberOfThreads = 1; numberOfThreads <= 2; numberOfThreads++ )
+    {
+        TwoLineElementCatalogue duplicatedCatalogue( twoLineElementData, numberOfThreads );
+        BOOST_CHECK_EQUAL( duplicatedCatalogue.getNumberOfObjects( ), 2 * numberOfUniqueObjects );
+
+        // Check that catalogue entries and Cartesian states correspond to the TLE data.
+        const Eigen::Matrix< double, Eigen::Dynamic, 6 > cartesianStates =
+                duplicatedCatalogue.getCartesianStates( numberOfThreads );
+        for ( unsigned int i = 0; i < numberOfUniqueObjects; i++ )
+        {
+            const TwoLineElementData& twoLineElementDatum = twoLineElementData.at( i );
+            BOOST_CHECK_EQUAL( duplicatedCatalogue.getObjectIdentificationNumbers( ).at( i ),
+                               twoLineElementDatum.objectIdentificationNumber );
+            BOOST_CHECK_EQUAL( duplicatedCatalogue.getBStarDragTerms( )( i ), twoLineElementDatum.bStar );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        duplicatedCatalogue.getMeanMotions( )( i ) * physical_constants::JULIAN_DAY
+                        / ( 2.0 * mathematical_constants::PI ),
+                        twoLineElementDatum.meanMotionInRevolutionsPerDay, 1.0E-14 );
+
+            Eigen::Vector6d keplerianElements;
+            keplerianElements << twoLineElementDatum.TLEKeplerianElements( semiMajorAxisIndex ),
+                    twoLineElementDatum.TLEKeplerianElements( eccentricityIndex ),
+                    unit_conversions::convertDegreesToRadians(
+                        twoLineElementDatum.TLEKeplerianElements( inclinationIndex ) ),
+                    unit_conversions::convertDegreesToRadians(
+                        twoLineElementDatum.TLEKeplerianElements( argumentOfPeriapsisIndex ) ),
+                    unit_conversions::convertDegreesToRadians(
+                        twoLineElementDatum.TLEKeplerianElements( longitudeOfAscendingNodeIndex ) ),
+                    convertEccentricAnomalyToTrueAnomaly(
+                        convertMeanAnomalyToEccentricAnomaly(
+                            twoLineElementDatum.TLEKeplerianElements( eccentricityIndex ),
+                            unit_conversions::convertDegreesToRadians( twoLineElementDatum.meanAnomaly ) ),
+                        twoLineElementDatum.TLEKeplerianElements( eccentricityIndex ) );
+            const Eigen::Vector6d expectedCartesianState = convertKeplerianToCartesianElements(
+                        keplerianElements, TWO_LINE_ELEMENTS_EARTH_GRAVITATIONAL_PARAMETER );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        Eigen::Vector6d( cartesianStates.row( i ).transpose( ) ), expectedCartesianState, 1.0E-15 );
+        }
+
+        // Check epoch of first object (2011, day 10.22613693).
+        BOOST_CHECK_CLOSE_FRACTION( duplicatedCatalogue.getEpochs( )( 0 ),
+                                    ( 4017.5 + 9.22613693 ) * physical_constants::JULIAN_DAY, 1.0E-14 );
+
+        // Propagate states over one orbital period of each object, and check that the states are unchanged.
+        for ( unsigned int i = 0; i < numberOfUniqueObjects; i++ )
+        {
+            const double orbitalPeriod = 2.0 * mathematical_constants::PI / duplicatedCatalogue.getMeanMotions( )( i );
+            const Eigen::Matrix< double, Eigen::Dynamic, 6 > propagatedStates =
+                    duplicatedCatalogue.getCartesianStatesAtEpoch(
+                        duplicatedCatalogue.getEpochs( )( i ) + orbitalPeriod, numberOfThreads );
+            BOOST_CHECK_SMALL( ( propagatedStates.block( i, 0, 1, 3 ) - cartesianStates.block( i, 0, 1, 3 ) ).norm( ),
+                               1.0E-3 );
+            BOOST_CHECK_SMALL( ( propagatedStates.block( i, 3, 1, 3 ) - cartesianStates.block( i, 3, 1, 3 ) ).norm( ),
+                               1.0E-6 );
+        }
+
+        // Check that older entries of each object are found as duplicates, and removed.
+        const std::vector< unsigned int > duplicateIndices = duplicatedCatalogue.findDuplicateObjects( );
+        BOOST_CHECK_EQUAL( duplicateIndices.size( ), numberOfUniqueObjects );
+        BOOST_CHECK_EQUAL( duplicateIndices.at( 0 ), 0 );
+        for ( unsigned int i = 1; i < numberOfUniqueObjects; i++ )
+        {
+            BOOST_CHECK_EQUAL( duplicateIndices.at( i ), numberOfUniqueObjects + i );
+        }
+
+        BOOST_CHECK_EQUAL( duplicatedCatalogue.removeDuplicateObjects( ), numberOfUniqueObjects );
+        BOOST_CHECK_EQUAL( duplicatedCatalogue.getNumberOfObjects( ), numberOfUniqueObjects );
+        BOOST_CHECK( duplicatedCatalogue.findDuplicateObjects( ).empty( ) );
+        BOOST_CHECK_EQUAL( duplicatedCatalogue.getObjectIdentificationNumbers( ).at( 0 ),
+                           twoLineElementData.at( 1 ).objectIdentificationNumber );
+        BOOST_CHECK_EQUAL( duplicatedCatalogue.getObjectIdentificationNumbers( ).back( ),
+                           twoLineElementData.at( 0 ).objectIdentificationNumber );
+        BOOST_CHECK_CLOSE_FRACTION( duplicatedCatalogue.getEpochs( )( numberOfUniqueObjects - 1 ),
+                                    ( 4017.5 + 10.22613693 ) * physical_constants::JULIAN_DAY, 1.0E-14 );
+        BOOST_CHECK_EQUAL( duplicatedCatalogue.getKeplerianElements( ).rows( ), numberOfUniqueObjects );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }   // namespace unit_tests
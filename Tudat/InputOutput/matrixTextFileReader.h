@@ -31,6 +31,8 @@
 #include <boost/iostreams/filtering_stream.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include "Tudat/Basics/parallelLoop.h"
+#include "Tudat/InputOutput/numericTextFileParser.h"
 #include "Tudat/InputOutput/streamFilters.h"
 
 namespace tudat
@@ -42,11 +44,13 @@ namespace input_output
 /*!
  * Read a textfile whith separated (space, tab, comma etc...) numbers. The class returns these
  * numbers as a matrixXd. The first line with numbers is used to define the number of columns.
+ * The file is memory-mapped, and its lines are parsed concurrently in blocks (see parseNumericTextLines).
  * \param relativePath Relative path to file.
  * \param separators Separators used, every character in the string will be used as separators.
  *         (multiple seperators possible).
  * \param skipLinesCharacter Skip lines starting with this character.
  * \param numberOfHeaderLines Number of header lines, i.e., number of lines to be skipped at the beginning of the file.
+ * \param numberOfThreads Maximum number of threads used for parsing.
  * \return The data matrix.
  */
 template< typename ScalarType = double >
@@ -54,100 +58,49 @@ Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > readMatrixFromFile(
         const std::string& relativePath,
         const std::string& separators = "\t ;,",
         const std::string& skipLinesCharacter = "%",
-        const int numberOfHeaderLines = 0 )
+        const int numberOfHeaderLines = 0,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) )
 {
-    // Open input and output.
-    std::fstream file( relativePath.c_str( ), std::ios::in );
-    if ( file.fail( ) )
-    {
-        throw std::runtime_error( "Data file could not be opened:" + relativePath );
-    }
-
-    std::stringstream filteredStream( std::ios::in | std::ios::out );
-    {
-        // Filter the file stream. This needs to be in its own scope, because filtering_stream::
-        // flush( ) does not work if the underlying end point is a stringstream, so the flush has
-        // to be forced by letting the filtering_stream go out of scope.
-        boost::iostreams::filtering_ostream filterProcessor;
-        for ( unsigned int i = 0; i < skipLinesCharacter.size( ); i++ )
-        {
-            // Remove all comments from the stream.
-            filterProcessor.push( input_output::stream_filters::RemoveComment(
-                                      skipLinesCharacter[ i ], true ) );
-        }
-
-        // Add the output to the filter chain.
-        filterProcessor.push( filteredStream );
-
-        // Copy the input to the filter.
-        boost::iostreams::copy( file, filterProcessor );
-    }
-
-    // Seek stream back to start.
-    filteredStream.seekg( 0, std::ios::beg );
-
-    // Read the filtered stream into lines.
-    std::vector< std::string > lines_;
+    // Map file into memory and split it into lines.
+    const MappedTextFile file( relativePath );
+    std::vector< TextRange > lines;
+    splitIntoLines( file.getContents( ), lines );
+
+    // Remove comments (omitting lines that start with a comment), header lines and empty lines.
+    std::vector< TextRange > dataLines;
+    dataLines.reserve( lines.size( ) );
     int numberOfLinesParsed = 0;
-    while ( !filteredStream.eof( ) )
+    for ( unsigned int i = 0; i < lines.size( ); i++ )
     {
-        std::string line_;
-        getline( filteredStream, line_ );
-        if ( numberOfLinesParsed >= numberOfHeaderLines )
+        TextRange line = lines[ i ];
+        bool isLineOmitted = false;
+        for ( unsigned int j = 0; j < skipLinesCharacter.size( ); j++ )
         {
-            if ( !line_.empty( ) )
+            const char* commentBegin = std::find( line.begin, line.end, skipLinesCharacter[ j ] );
+            if ( commentBegin == line.begin && !line.empty( ) )
             {
-                boost::trim_all( line_ );
-                lines_.push_back( line_ );
+                isLineOmitted = true;
+                break;
             }
+            line.end = commentBegin;
         }
-        numberOfLinesParsed++;
-    }
 
-    // If there are no lines, return an empty matrix.
-    if ( lines_.empty( ) )
-    {
-        return Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >( );
-    }
-
-    const std::string realSeparators = std::string( separators ) + " ";
-
-    // Determine the number of columns from.
-    std::vector< std::string > lineSplit_;
-    boost::algorithm::split( lineSplit_, lines_[ 0 ], boost::is_any_of( realSeparators ),
-            boost::algorithm::token_compress_on );
-    const unsigned int numberOfColumns = lineSplit_.size( );
-
-    // Initialize the matrix with sizes obtained from the number of lines and the entries in the
-    // first line.
-    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > dataMatrix_( lines_.size( ), numberOfColumns );
-    for ( int rowIndex = 0; rowIndex < dataMatrix_.rows( ); rowIndex++ )
-    {
-        lineSplit_.clear( );
-
-        // Read current line and split into separate entries.
-        boost::algorithm::split( lineSplit_, lines_[ rowIndex ],
-                                 boost::is_any_of( realSeparators ),
-                                 boost::algorithm::token_compress_on );
-
-        // Check if number of column entries in line matches the number of columns in the matrix.
-        // If not, throw a runtime error.
-        if ( lineSplit_.size( ) != numberOfColumns )
-        {
-            throw std::runtime_error( "Number of colums in row " + std::to_string( rowIndex )
-                   + " is " + std::to_string( lineSplit_.size( ) ) + "; should be " + std::to_string( numberOfColumns ) );
-        }
-
-        // Put single line entries into matrix as doubles.
-        for ( int columnIndex = 0; columnIndex < dataMatrix_.cols( ); columnIndex++ )
+        if ( !isLineOmitted )
         {
-            boost::trim( lineSplit_.at( columnIndex ) );
-            dataMatrix_( rowIndex, columnIndex ) =
-                    boost::lexical_cast< ScalarType >( lineSplit_.at( columnIndex ) );
+            if ( numberOfLinesParsed >= numberOfHeaderLines )
+            {
+                line = trimWhitespace( line );
+                if ( !line.empty( ) )
+                {
+                    dataLines.push_back( line );
+                }
+            }
+            numberOfLinesParsed++;
         }
     }
 
-    return dataMatrix_;
+    // Parse lines into matrix.
+    return parseNumericTextLines< ScalarType >( dataLines, separators + " ", numberOfThreads );
 }
 
 } // namespace input_output
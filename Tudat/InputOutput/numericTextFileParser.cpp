@@ -0,0 +1,345 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Clinger, W.D. How to read floating point numbers accurately, ACM SIGPLAN Notices 25(6), 1990.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#if defined( __unix__ ) || defined( __unix ) || ( defined( __APPLE__ ) && defined( __MACH__ ) )
+#define TUDAT_USE_MEMORY_MAPPED_FILES 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define TUDAT_USE_MEMORY_MAPPED_FILES 0
+#endif
+
+#include "Tudat/InputOutput/numericTextFileParser.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Powers of ten that are exactly representable as a double.
+static const double exactPowersOfTen[ 23 ] =
+{
+    1.0E0, 1.0E1, 1.0E2, 1.0E3, 1.0E4, 1.0E5, 1.0E6, 1.0E7, 1.0E8, 1.0E9, 1.0E10, 1.0E11,
+    1.0E12, 1.0E13, 1.0E14, 1.0E15, 1.0E16, 1.0E17, 1.0E18, 1.0E19, 1.0E20, 1.0E21, 1.0E22
+};
+
+//! Largest integer up to which all integers are exactly representable as a double (2^53).
+static const unsigned long long maximumExactMantissa = 9007199254740992ULL;
+
+//! Function to check whether a character is a decimal digit.
+static inline bool isDigitCharacter( const char character )
+{
+    return static_cast< unsigned int >( character - '0' ) < 10;
+}
+
+//! Constructor, maps (or reads) the file.
+MappedTextFile::MappedTextFile( const std::string& filePath ):
+    data_( nullptr ), size_( 0 ), isMemoryMapped_( false )
+{
+#if TUDAT_USE_MEMORY_MAPPED_FILES
+    const int fileDescriptor = open( filePath.c_str( ), O_RDONLY );
+    if ( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Data file could not be opened: " + filePath );
+    }
+
+    struct stat fileStatus;
+    if ( fstat( fileDescriptor, &fileStatus ) == 0 && S_ISREG( fileStatus.st_mode ) && fileStatus.st_size > 0 )
+    {
+        void* mappedData = mmap( nullptr, static_cast< std::size_t >( fileStatus.st_size ), PROT_READ, MAP_PRIVATE,
+                                 fileDescriptor, 0 );
+        if ( mappedData != MAP_FAILED )
+        {
+            data_ = static_cast< const char* >( mappedData );
+            size_ = static_cast< std::size_t >( fileStatus.st_size );
+            isMemoryMapped_ = true;
+        }
+    }
+    close( fileDescriptor );
+#endif
+
+    // Read file into memory if it could not be mapped.
+    if ( !isMemoryMapped_ )
+    {
+        std::ifstream fileStream( filePath.c_str( ), std::ios::binary );
+        if ( !fileStream.good( ) )
+        {
+            throw std::runtime_error( "Data file could not be opened: " + filePath );
+        }
+        buffer_.assign( std::istreambuf_iterator< char >( fileStream ), std::istreambuf_iterator< char >( ) );
+        data_ = buffer_.data( );
+        size_ = buffer_.size( );
+    }
+}
+
+//! Destructor, unmaps the file.
+MappedTextFile::~MappedTextFile( )
+{
+#if TUDAT_USE_MEMORY_MAPPED_FILES
+    if ( isMemoryMapped_ )
+    {
+        munmap( const_cast< char* >( data_ ), size_ );
+    }
+#endif
+}
+
+//! Function to remove leading and trailing whitespace from a range of characters.
+TextRange trimWhitespace( const TextRange& text )
+{
+    const char* begin = text.begin;
+    const char* end = text.end;
+    while ( begin != end && isWhitespaceCharacter( *begin ) )
+    {
+        begin++;
+    }
+    while ( end != begin && isWhitespaceCharacter( *( end - 1 ) ) )
+    {
+        end--;
+    }
+    return TextRange( begin, end );
+}
+
+//! Function to split a range of characters into lines.
+void splitIntoLines( const TextRange& text, std::vector< TextRange >& lines )
+{
+    lines.clear( );
+    const char* lineBegin = text.begin;
+    while ( true )
+    {
+        const char* lineEnd = static_cast< const char* >(
+                    std::memchr( lineBegin, '\n', static_cast< std::size_t >( text.end - lineBegin ) ) );
+        if ( lineEnd == nullptr )
+        {
+            lines.push_back( TextRange( lineBegin, text.end ) );
+            break;
+        }
+        lines.push_back( TextRange( lineBegin, lineEnd ) );
+        lineBegin = lineEnd + 1;
+    }
+}
+
+//! Function to split a line into tokens.
+void splitIntoTokens( const TextRange& line, const std::string& separators, std::vector< TextRange >& tokens )
+{
+    // Create lookup table of separator characters.
+    bool isSeparator[ 256 ] = { false };
+    for ( unsigned int i = 0; i < separators.size( ); i++ )
+    {
+        isSeparator[ static_cast< unsigned char >( separators[ i ] ) ] = true;
+    }
+
+    tokens.clear( );
+    const char* tokenBegin = line.begin;
+    for ( const char* current = line.begin; current != line.end; current++ )
+    {
+        if ( isSeparator[ static_cast< unsigned char >( *current ) ] )
+        {
+            tokens.push_back( TextRange( tokenBegin, current ) );
+
+            // Treat consecutive separators as a single separator.
+            while ( current + 1 != line.end && isSeparator[ static_cast< unsigned char >( *( current + 1 ) ) ] )
+            {
+                current++;
+            }
+            tokenBegin = current + 1;
+        }
+    }
+    tokens.push_back( TextRange( tokenBegin, line.end ) );
+}
+
+//! Function to convert the number at the start of a range of characters to a double.
+const char* parseLeadingDouble( const char* begin, const char* end, double& value )
+{
+    const char* current = begin;
+    while ( current != end && isWhitespaceCharacter( *current ) )
+    {
+        current++;
+    }
+    const char* numberBegin = current;
+
+    bool isNegative = false;
+    if ( current != end && ( *current == '+' || *current == '-' ) )
+    {
+        isNegative = ( *current == '-' );
+        current++;
+    }
+
+    // Accumulate significant digits in an integer, keeping track of the decimal exponent. Digits that no longer fit
+    // are only recorded as being non-zero, in which case the exact conversion is left to std::strtod.
+    unsigned long long mantissa = 0;
+    int decimalExponent = 0;
+    bool hasDigits = false;
+    bool isTruncated = false;
+    while ( current != end && isDigitCharacter( *current ) )
+    {
+        hasDigits = true;
+        if ( mantissa < 100000000000000000ULL )
+        {
+            mantissa = 10 * mantissa + static_cast< unsigned int >( *current - '0' );
+        }
+        else
+        {
+            decimalExponent++;
+            isTruncated = isTruncated || ( *current != '0' );
+        }
+        current++;
+    }
+    if ( current != end && *current == '.' )
+    {
+        current++;
+        while ( current != end && isDigitCharacter( *current ) )
+        {
+            hasDigits = true;
+            if ( mantissa < 100000000000000000ULL )
+            {
+                mantissa = 10 * mantissa + static_cast< unsigned int >( *current - '0' );
+                decimalExponent--;
+            }
+            else
+            {
+                isTruncated = isTruncated || ( *current != '0' );
+            }
+            current++;
+        }
+    }
+
+    if ( !hasDigits )
+    {
+        // Leave special values (inf, nan) and invalid input to std::strtod.
+        const std::string numberString( numberBegin, std::min< std::size_t >( end - numberBegin, 64 ) );
+        char* conversionEnd;
+        const double convertedValue = std::strtod( numberString.c_str( ), &conversionEnd );
+        if ( conversionEnd == numberString.c_str( ) )
+        {
+            return begin;
+        }
+        value = convertedValue;
+        return numberBegin + ( conversionEnd - numberString.c_str( ) );
+    }
+
+    // Parse exponent (only if it contains at least one digit, as for std::strtod).
+    if ( current != end && ( *current == 'e' || *current == 'E' ) )
+    {
+        const char* exponentCurrent = current + 1;
+        bool isExponentNegative = false;
+        if ( exponentCurrent != end && ( *exponentCurrent == '+' || *exponentCurrent == '-' ) )
+        {
+            isExponentNegative = ( *exponentCurrent == '-' );
+            exponentCurrent++;
+        }
+        if ( exponentCurrent != end && isDigitCharacter( *exponentCurrent ) )
+        {
+            int exponent = 0;
+            while ( exponentCurrent != end && isDigitCharacter( *exponentCurrent ) )
+            {
+                if ( exponent < 100000 )
+                {
+                    exponent = 10 * exponent + ( *exponentCurrent - '0' );
+                }
+                exponentCurrent++;
+            }
+            decimalExponent += isExponentNegative ? -exponent : exponent;
+            current = exponentCurrent;
+        }
+    }
+
+    // Convert exactly, if both the mantissa and the power of ten are exactly representable (Clinger, 1990).
+    if ( mantissa == 0 && !isTruncated )
+    {
+        value = isNegative ? -0.0 : 0.0;
+    }
+    else if ( !isTruncated && mantissa <= maximumExactMantissa && decimalExponent >= -22 && decimalExponent <= 22 )
+    {
+        const double convertedValue = ( decimalExponent < 0 ) ?
+                    static_cast< double >( mantissa ) / exactPowersOfTen[ -decimalExponent ] :
+                    static_cast< double >( mantissa ) * exactPowersOfTen[ decimalExponent ];
+        value = isNegative ? -convertedValue : convertedValue;
+    }
+    else
+    {
+        const std::string numberString( numberBegin, current );
+        value = std::strtod( numberString.c_str( ), nullptr );
+    }
+    return current;
+}
+
+//! Function to convert the integer at the start of a range of characters.
+const char* parseLeadingInteger( const char* begin, const char* end, long long& value )
+{
+    const char* current = begin;
+    while ( current != end && isWhitespaceCharacter( *current ) )
+    {
+        current++;
+    }
+
+    bool isNegative = false;
+    if ( current != end && ( *current == '+' || *current == '-' ) )
+    {
+        isNegative = ( *current == '-' );
+        current++;
+    }
+
+    if ( current == end || !isDigitCharacter( *current ) )
+    {
+        return begin;
+    }
+
+    unsigned long long absoluteValue = 0;
+    while ( current != end && isDigitCharacter( *current ) )
+    {
+        absoluteValue = 10 * absoluteValue + static_cast< unsigned int >( *current - '0' );
+        if ( absoluteValue > 9223372036854775807ULL )
+        {
+            throw std::runtime_error( "Error, integer out of range: " + std::string( begin, end ) );
+        }
+        current++;
+    }
+    value = isNegative ? -static_cast< long long >( absoluteValue ) : static_cast< long long >( absoluteValue );
+    return current;
+}
+
+//! Function to convert a range of characters, which must contain a single number, to a double.
+double parseDouble( const TextRange& text )
+{
+    const TextRange trimmedText = trimWhitespace( text );
+    double value = 0.0;
+    if ( trimmedText.empty( ) ||
+         parseLeadingDouble( trimmedText.begin, trimmedText.end, value ) != trimmedText.end )
+    {
+        throw std::runtime_error( "Error, could not convert \"" + trimmedText.toString( ) + "\" to a number." );
+    }
+    return value;
+}
+
+//! Function to convert a range of characters, which must contain a single integer, to an integer.
+long long parseInteger( const TextRange& text )
+{
+    const TextRange trimmedText = trimWhitespace( text );
+    long long value = 0;
+    if ( trimmedText.empty( ) ||
+         parseLeadingInteger( trimmedText.begin, trimmedText.end, value ) != trimmedText.end )
+    {
+        throw std::runtime_error( "Error, could not convert \"" + trimmedText.toString( ) + "\" to an integer." );
+    }
+    return value;
+}
+
+} // namespace input_output
+} // namespace tudat
@@ -0,0 +1,289 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The functions in this file operate on ranges of characters in a (memory-mapped) file, without copying lines or
+ *      fields into strings. Numbers are converted with a fast path that is exact (i.e., identical to std::strtod)
+ *      if their significant digits form an integer of at most 2^53 and their decimal exponent is at most 22 in
+ *      magnitude (which covers typical data files); other numbers are converted with std::strtod.
+ *
+ */
+
+#ifndef TUDAT_NUMERIC_TEXT_FILE_PARSER_H
+#define TUDAT_NUMERIC_TEXT_FILE_PARSER_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <Eigen/Core>
+
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Basics/parallelLoop.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Range of characters in a text buffer, from begin (inclusive) to end (exclusive).
+struct TextRange
+{
+    //! Default constructor, creating an empty range.
+    TextRange( ): begin( nullptr ), end( nullptr ) { }
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param rangeBegin Pointer to first character of range.
+     * \param rangeEnd Pointer to one past the last character of range.
+     */
+    TextRange( const char* rangeBegin, const char* rangeEnd ): begin( rangeBegin ), end( rangeEnd ) { }
+
+    //! Function to check whether the range is empty.
+    bool empty( ) const { return begin == end; }
+
+    //! Function to retrieve the number of characters in the range.
+    std::size_t size( ) const { return static_cast< std::size_t >( end - begin ); }
+
+    //! Function to copy the characters in the range to a string.
+    std::string toString( ) const { return std::string( begin, end ); }
+
+    //! Pointer to first character of range.
+    const char* begin;
+
+    //! Pointer to one past the last character of range.
+    const char* end;
+};
+
+//! Read-only contents of a text file, memory-mapped where supported by the operating system.
+/*!
+ * Read-only contents of a text file. On POSIX systems, the file is memory-mapped, so that its contents are not copied
+ * before parsing. On other systems (or if mapping fails), the file is read into memory in a single operation.
+ */
+class MappedTextFile
+{
+public:
+
+    //! Constructor, maps (or reads) the file.
+    /*!
+     * Constructor, maps (or reads) the file.
+     * \param filePath Path to the file.
+     * \throws std::runtime_error If the file could not be opened.
+     */
+    explicit MappedTextFile( const std::string& filePath );
+
+    //! Destructor, unmaps the file.
+    ~MappedTextFile( );
+
+    //! Function to retrieve the full contents of the file.
+    TextRange getContents( ) const
+    {
+        return TextRange( data_, data_ + size_ );
+    }
+
+    //! Function to retrieve whether the file is memory-mapped (rather than read into memory).
+    bool isMemoryMapped( ) const
+    {
+        return isMemoryMapped_;
+    }
+
+private:
+
+    //! Copying is not allowed, since the object owns the mapping.
+    MappedTextFile( const MappedTextFile& );
+
+    //! Assignment is not allowed, since the object owns the mapping.
+    MappedTextFile& operator=( const MappedTextFile& );
+
+    //! Pointer to the contents of the file.
+    const char* data_;
+
+    //! Size of the file, in bytes.
+    std::size_t size_;
+
+    //! Boolean denoting whether the file is memory-mapped.
+    bool isMemoryMapped_;
+
+    //! Contents of the file, if it is not memory-mapped.
+    std::vector< char > buffer_;
+};
+
+//! Function to check whether a character is whitespace (space, tab, newline, carriage return, vertical tab, form feed).
+inline bool isWhitespaceCharacter( const char character )
+{
+    return character == ' ' || ( character >= '\t' && character <= '\r' );
+}
+
+//! Function to remove leading and trailing whitespace from a range of characters.
+/*!
+ * Function to remove leading and trailing whitespace from a range of characters.
+ * \param text Range of characters.
+ * \return Range without leading and trailing whitespace.
+ */
+TextRange trimWhitespace( const TextRange& text );
+
+//! Function to split a range of characters into lines.
+/*!
+ * Function to split a range of characters into lines, at each newline character. As for repeated calls to
+ * std::getline, the number of lines is one more than the number of newline characters (so the last line is empty if
+ * the text ends with a newline), and carriage return characters are not removed.
+ * \param text Range of characters.
+ * \param lines Ranges of the lines (returned by reference).
+ */
+void splitIntoLines( const TextRange& text, std::vector< TextRange >& lines );
+
+//! Function to split a line into tokens.
+/*!
+ * Function to split a line into tokens, separated by any of the separator characters. Consecutive separators are
+ * treated as a single separator (as with boost::algorithm::token_compress_on), so that a leading or trailing separator
+ * results in a single empty token.
+ * \param line Range of characters of the line.
+ * \param separators Characters that separate the tokens.
+ * \param tokens Ranges of the tokens (returned by reference).
+ */
+void splitIntoTokens( const TextRange& line, const std::string& separators, std::vector< TextRange >& tokens );
+
+//! Function to convert the number at the start of a range of characters to a double.
+/*!
+ * Function to convert the number at the start of a range of characters to a double, with the same semantics as
+ * std::strtod: leading whitespace is skipped, and conversion stops at the first character that is not part of the
+ * number.
+ * \param begin Pointer to first character of range.
+ * \param end Pointer to one past the last character of range.
+ * \param value Converted value (returned by reference, unchanged if no conversion could be performed).
+ * \return Pointer to the first character after the number, or begin if no conversion could be performed.
+ */
+const char* parseLeadingDouble( const char* begin, const char* end, double& value );
+
+//! Function to convert the integer at the start of a range of characters.
+/*!
+ * Function to convert the (decimal) integer at the start of a range of characters, with the same semantics as
+ * std::strtoll: leading whitespace is skipped, and conversion stops at the first character that is not a digit.
+ * \param begin Pointer to first character of range.
+ * \param end Pointer to one past the last character of range.
+ * \param value Converted value (returned by reference, unchanged if no conversion could be performed).
+ * \return Pointer to the first character after the integer, or begin if no conversion could be performed.
+ * \throws std::runtime_error If the integer is out of range.
+ */
+const char* parseLeadingInteger( const char* begin, const char* end, long long& value );
+
+//! Function to convert a range of characters, which must contain a single number, to a double.
+/*!
+ * Function to convert a range of characters, which must contain a single number (possibly surrounded by whitespace),
+ * to a double.
+ * \param text Range of characters.
+ * \return Converted value.
+ * \throws std::runtime_error If the range does not contain a single number.
+ */
+double parseDouble( const TextRange& text );
+
+//! Function to convert a range of characters, which must contain a single integer, to an integer.
+/*!
+ * Function to convert a range of characters, which must contain a single integer (possibly surrounded by whitespace),
+ * to an integer.
+ * \param text Range of characters.
+ * \return Converted value.
+ * \throws std::runtime_error If the range does not contain a single integer.
+ */
+long long parseInteger( const TextRange& text );
+
+//! Function to convert a range of characters, which must contain a single number, to a number of a given type.
+/*!
+ * Function to convert a range of characters, which must contain a single number (possibly surrounded by whitespace),
+ * to a number of a given type. Doubles are converted with parseDouble, other types with boost::lexical_cast.
+ * \param text Range of characters.
+ * \return Converted value.
+ * \throws std::runtime_error If the range does not contain a single number.
+ */
+template< typename ScalarType >
+ScalarType parseNumber( const TextRange& text )
+{
+    const TextRange trimmedText = trimWhitespace( text );
+    try
+    {
+        return boost::lexical_cast< ScalarType >( trimmedText.begin, trimmedText.size( ) );
+    }
+    catch( boost::bad_lexical_cast& )
+    {
+        throw std::runtime_error( "Error, could not convert \"" + trimmedText.toString( ) + "\" to a number." );
+    }
+}
+
+//! Function to convert a range of characters, which must contain a single number, to a double.
+template< >
+inline double parseNumber< double >( const TextRange& text )
+{
+    return parseDouble( text );
+}
+
+//! Function to parse lines of separated numbers into a matrix, distributing blocks of lines over multiple threads.
+/*!
+ * Function to parse lines of separated numbers into a matrix, distributing blocks of lines over multiple threads. The
+ * number of columns is defined by the first line.
+ * \param lines Ranges of the lines to parse, one per row of the matrix.
+ * \param separators Characters that separate the numbers on a line (see splitIntoTokens).
+ * \param numberOfThreads Maximum number of threads used for parsing.
+ * \return Matrix of parsed numbers.
+ * \throws std::runtime_error If a line has a different number of entries than the first line, or if an entry is not a
+ * number.
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > parseNumericTextLines(
+        const std::vector< TextRange >& lines,
+        const std::string& separators,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) )
+{
+    if ( lines.empty( ) )
+    {
+        return Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >( );
+    }
+
+    // Determine the number of columns from the first line.
+    std::vector< TextRange > tokens;
+    splitIntoTokens( lines.at( 0 ), separators, tokens );
+    const int numberOfColumns = static_cast< int >( tokens.size( ) );
+    const int numberOfRows = static_cast< int >( lines.size( ) );
+
+    // Parse blocks of lines concurrently; each block writes only to its own rows of the matrix.
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > dataMatrix( numberOfRows, numberOfColumns );
+    const int numberOfLinesPerBlock = 1024;
+    const int numberOfBlocks = ( numberOfRows + numberOfLinesPerBlock - 1 ) / numberOfLinesPerBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        std::vector< TextRange > lineTokens;
+        const int lastRow = std::min( ( blockIndex + 1 ) * numberOfLinesPerBlock, numberOfRows );
+        for ( int rowIndex = blockIndex * numberOfLinesPerBlock; rowIndex < lastRow; rowIndex++ )
+        {
+            splitIntoTokens( lines[ rowIndex ], separators, lineTokens );
+
+            // Check if number of column entries in line matches the number of columns in the matrix.
+            if ( static_cast< int >( lineTokens.size( ) ) != numberOfColumns )
+            {
+                throw std::runtime_error( "Number of colums in row " + std::to_string( rowIndex )
+                                          + " is " + std::to_string( lineTokens.size( ) ) + "; should be "
+                                          + std::to_string( numberOfColumns ) );
+            }
+
+            for ( int columnIndex = 0; columnIndex < numberOfColumns; columnIndex++ )
+            {
+                dataMatrix( rowIndex, columnIndex ) = parseNumber< ScalarType >( lineTokens[ columnIndex ] );
+            }
+        }
+    }, numberOfThreads );
+
+    return dataMatrix;
+}
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_NUMERIC_TEXT_FILE_PARSER_H
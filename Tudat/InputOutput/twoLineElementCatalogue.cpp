@@ -0,0 +1,270 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/batchOrbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/InputOutput/twoLineElementCatalogue.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Number of objects per block of objects that is processed by a single thread.
+static const int numberOfObjectsPerBlock = 256;
+
+//! Function to compute the true anomaly from the mean anomaly, for an elliptical orbit.
+static double convertEllipticalMeanToTrueAnomaly( const double eccentricity, const double meanAnomaly )
+{
+    return orbital_element_conversions::convertEccentricAnomalyToTrueAnomaly(
+                orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly( eccentricity, meanAnomaly ),
+                eccentricity );
+}
+
+//! Constructor from TLE data objects.
+TwoLineElementCatalogue::TwoLineElementCatalogue( const std::vector< TwoLineElementData >& twoLineElementData,
+                                                  const int numberOfThreads )
+{
+    using namespace orbital_element_conversions;
+
+    const int numberOfObjects = static_cast< int >( twoLineElementData.size( ) );
+    objectIdentificationNumbers_.resize( numberOfObjects );
+    objectNames_.resize( numberOfObjects );
+    epochs_.resize( numberOfObjects );
+    meanMotions_.resize( numberOfObjects );
+    meanAnomalies_.resize( numberOfObjects );
+    bStarDragTerms_.resize( numberOfObjects );
+    keplerianElements_.resize( numberOfObjects, 6 );
+
+    // Julian days (since J2000) at the start of the epoch years are computed only once per year.
+    std::map< unsigned int, double > julianDaysSinceJ2000AtStartOfYear;
+    for ( int i = 0; i < numberOfObjects; i++ )
+    {
+        const unsigned int epochYear = twoLineElementData[ i ].fourDigitEpochYear;
+        if ( julianDaysSinceJ2000AtStartOfYear.count( epochYear ) == 0 )
+        {
+            julianDaysSinceJ2000AtStartOfYear[ epochYear ] =
+                    basic_astrodynamics::convertCalendarDateToJulianDay< double >( epochYear, 1, 1, 0, 0, 0.0 )
+                    - basic_astrodynamics::JULIAN_DAY_ON_J2000;
+        }
+    }
+
+    // Convert blocks of objects concurrently; each block writes only to its own entries of the arrays.
+    const int numberOfBlocks = ( numberOfObjects + numberOfObjectsPerBlock - 1 ) / numberOfObjectsPerBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int lastObject = std::min( ( blockIndex + 1 ) * numberOfObjectsPerBlock, numberOfObjects );
+        for ( int i = blockIndex * numberOfObjectsPerBlock; i < lastObject; i++ )
+        {
+            const TwoLineElementData& twoLineElementDatum = twoLineElementData[ i ];
+            objectIdentificationNumbers_[ i ] = twoLineElementDatum.objectIdentificationNumber;
+            objectNames_[ i ] = twoLineElementDatum.objectNameString;
+
+            // Epoch day 1.0 corresponds to the start of January 1st.
+            epochs_( i ) = ( julianDaysSinceJ2000AtStartOfYear.at( twoLineElementDatum.fourDigitEpochYear )
+                             + ( twoLineElementDatum.epochDay - 1.0 ) ) * physical_constants::JULIAN_DAY;
+            meanMotions_( i ) = twoLineElementDatum.meanMotionInRevolutionsPerDay * 2.0 * mathematical_constants::PI
+                    / physical_constants::JULIAN_DAY;
+            meanAnomalies_( i ) = unit_conversions::convertDegreesToRadians( twoLineElementDatum.meanAnomaly );
+            bStarDragTerms_( i ) = twoLineElementDatum.bStar;
+
+            keplerianElements_( i, semiMajorAxisIndex ) =
+                    twoLineElementDatum.TLEKeplerianElements( semiMajorAxisIndex );
+            keplerianElements_( i, eccentricityIndex ) =
+                    twoLineElementDatum.TLEKeplerianElements( eccentricityIndex );
+            keplerianElements_( i, inclinationIndex ) = unit_conversions::convertDegreesToRadians(
+                        twoLineElementDatum.TLEKeplerianElements( inclinationIndex ) );
+            keplerianElements_( i, argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians(
+                        twoLineElementDatum.TLEKeplerianElements( argumentOfPeriapsisIndex ) );
+            keplerianElements_( i, longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians(
+                        twoLineElementDatum.TLEKeplerianElements( longitudeOfAscendingNodeIndex ) );
+            keplerianElements_( i, trueAnomalyIndex ) = convertEllipticalMeanToTrueAnomaly(
+                        keplerianElements_( i, eccentricityIndex ), meanAnomalies_( i ) );
+        }
+    }, numberOfThreads );
+}
+
+//! Function to find duplicate entries of objects.
+std::vector< unsigned int > TwoLineElementCatalogue::findDuplicateObjects( ) const
+{
+    // Sort entries by identification number, epoch and position in catalogue, so that the entries of each object are
+    // adjacent, with the most recent entry last.
+    std::vector< unsigned int > sortedIndices( getNumberOfObjects( ) );
+    std::iota( sortedIndices.begin( ), sortedIndices.end( ), 0 );
+    std::sort( sortedIndices.begin( ), sortedIndices.end( ),
+               [ & ]( const unsigned int firstIndex, const unsigned int secondIndex )
+    {
+        if ( objectIdentificationNumbers_[ firstIndex ] != objectIdentificationNumbers_[ secondIndex ] )
+        {
+            return objectIdentificationNumbers_[ firstIndex ] < objectIdentificationNumbers_[ secondIndex ];
+        }
+        else if ( epochs_( firstIndex ) != epochs_( secondIndex ) )
+        {
+            return epochs_( firstIndex ) < epochs_( secondIndex );
+        }
+        return firstIndex < secondIndex;
+    } );
+
+    // Each entry that is followed by an entry of the same object is a duplicate.
+    std::vector< unsigned int > duplicateIndices;
+    for ( unsigned int i = 1; i < sortedIndices.size( ); i++ )
+    {
+        if ( objectIdentificationNumbers_[ sortedIndices[ i - 1 ] ] ==
+             objectIdentificationNumbers_[ sortedIndices[ i ] ] )
+        {
+            duplicateIndices.push_back( sortedIndices[ i - 1 ] );
+        }
+    }
+    std::sort( duplicateIndices.begin( ), duplicateIndices.end( ) );
+    return duplicateIndices;
+}
+
+//! Function to remove objects from the catalogue.
+void TwoLineElementCatalogue::removeObjects( const std::vector< unsigned int >& objectIndices )
+{
+    const unsigned int numberOfObjects = getNumberOfObjects( );
+    std::vector< bool > isObjectRemoved( numberOfObjects, false );
+    for ( unsigned int i = 0; i < objectIndices.size( ); i++ )
+    {
+        if ( objectIndices[ i ] >= numberOfObjects )
+        {
+            throw std::runtime_error( "Error when removing object " + std::to_string( objectIndices[ i ] ) +
+                                      " from TLE catalogue, catalogue contains only " +
+                                      std::to_string( numberOfObjects ) + " objects." );
+        }
+        isObjectRemoved[ objectIndices[ i ] ] = true;
+    }
+
+    // Move each retained object forward at most once.
+    unsigned int numberOfRetainedObjects = 0;
+    for ( unsigned int i = 0; i < numberOfObjects; i++ )
+    {
+        if ( !isObjectRemoved[ i ] )
+        {
+            if ( numberOfRetainedObjects != i )
+            {
+                objectIdentificationNumbers_[ numberOfRetainedObjects ] = objectIdentificationNumbers_[ i ];
+                objectNames_[ numberOfRetainedObjects ] = std::move( objectNames_[ i ] );
+                epochs_( numberOfRetainedObjects ) = epochs_( i );
+                meanMotions_( numberOfRetainedObjects ) = meanMotions_( i );
+                meanAnomalies_( numberOfRetainedObjects ) = meanAnomalies_( i );
+                bStarDragTerms_( numberOfRetainedObjects ) = bStarDragTerms_( i );
+                keplerianElements_.row( numberOfRetainedObjects ) = keplerianElements_.row( i );
+            }
+            numberOfRetainedObjects++;
+        }
+    }
+
+    objectIdentificationNumbers_.resize( numberOfRetainedObjects );
+    objectNames_.resize( numberOfRetainedObjects );
+    epochs_.conservativeResize( numberOfRetainedObjects );
+    meanMotions_.conservativeResize( numberOfRetainedObjects );
+    meanAnomalies_.conservativeResize( numberOfRetainedObjects );
+    bStarDragTerms_.conservativeResize( numberOfRetainedObjects );
+    keplerianElements_.conservativeResize( numberOfRetainedObjects, Eigen::NoChange );
+}
+
+//! Function to remove duplicate entries of objects from the catalogue.
+unsigned int TwoLineElementCatalogue::removeDuplicateObjects( )
+{
+    const std::vector< unsigned int > duplicateIndices = findDuplicateObjects( );
+    removeObjects( duplicateIndices );
+    return duplicateIndices.size( );
+}
+
+//! Function to compute Keplerian states of all objects at a given epoch.
+Eigen::Matrix< double, Eigen::Dynamic, 6 > TwoLineElementCatalogue::getKeplerianStatesAtEpoch(
+        const double epoch, const int numberOfThreads ) const
+{
+    using namespace orbital_element_conversions;
+
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > keplerianStates = keplerianElements_;
+
+    const int numberOfObjects = static_cast< int >( getNumberOfObjects( ) );
+    const int numberOfBlocks = ( numberOfObjects + numberOfObjectsPerBlock - 1 ) / numberOfObjectsPerBlock;
+    utilities::executeParallelLoop( numberOfBlocks, [ & ]( const int blockIndex )
+    {
+        const int lastObject = std::min( ( blockIndex + 1 ) * numberOfObjectsPerBlock, numberOfObjects );
+        for ( int i = blockIndex * numberOfObjectsPerBlock; i < lastObject; i++ )
+        {
+            keplerianStates( i, trueAnomalyIndex ) = convertEllipticalMeanToTrueAnomaly(
+                        keplerianStates( i, eccentricityIndex ),
+                        meanAnomalies_( i ) + meanMotions_( i ) * ( epoch - epochs_( i ) ) );
+        }
+    }, numberOfThreads );
+
+    return keplerianStates;
+}
+
+//! Function to compute Cartesian states of all objects at a given epoch.
+Eigen::Matrix< double, Eigen::Dynamic, 6 > TwoLineElementCatalogue::getCartesianStatesAtEpoch(
+        const double epoch, const int numberOfThreads ) const
+{
+    return convertKeplerianToCartesianStates( getKeplerianStatesAtEpoch( epoch, numberOfThreads ), numberOfThreads );
+}
+
+//! Function to compute Cartesian states of all objects at the epochs of their TLEs.
+Eigen::Matrix< double, Eigen::Dynamic, 6 > TwoLineElementCatalogue::getCartesianStates(
+        const int numberOfThreads ) const
+{
+    return convertKeplerianToCartesianStates( keplerianElements_, numberOfThreads );
+}
+
+//! Function to compute Cartesian states from Keplerian states.
+Eigen::Matrix< double, Eigen::Dynamic, 6 > TwoLineElementCatalogue::convertKeplerianToCartesianStates(
+        const Eigen::Matrix< double, Eigen::Dynamic, 6 >& keplerianStates, const int numberOfThreads ) const
+{
+    // Convert states as contiguous columns (one per object).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > cartesianStates;
+    orbital_element_conversions::convertKeplerianToCartesianStates(
+                keplerianStates.transpose( ), TWO_LINE_ELEMENTS_EARTH_GRAVITATIONAL_PARAMETER, cartesianStates,
+                numberOfThreads );
+    return cartesianStates.transpose( );
+}
+
+//! Function to read a TLE catalogue file into a compact catalogue.
+TwoLineElementCataloguePointer readTwoLineElementCatalogue(
+        const std::string& absoluteFilePath, const unsigned int currentYear,
+        const TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType,
+        const int numberOfThreads )
+{
+    TwoLineElementsTextFileReader twoLineElementsTextFileReader;
+    twoLineElementsTextFileReader.setCurrentYear( currentYear );
+    twoLineElementsTextFileReader.setLineNumberTypeForTwoLineElementInputData( lineNumberType );
+
+    // Split file path into directory (including separator) and file name.
+    const std::size_t fileNamePosition = absoluteFilePath.find_last_of( "/\\" ) + 1;
+    twoLineElementsTextFileReader.setAbsoluteDirectoryPath( absoluteFilePath.substr( 0, fileNamePosition ) );
+    twoLineElementsTextFileReader.setFileName( absoluteFilePath.substr( fileNamePosition ) );
+    twoLineElementsTextFileReader.openFile( );
+    twoLineElementsTextFileReader.readAndStoreData( );
+    twoLineElementsTextFileReader.closeFile( );
+    twoLineElementsTextFileReader.storeTwoLineElementData( );
+    twoLineElementsTextFileReader.checkTwoLineElementsFileIntegrity( );
+
+    TwoLineElementCataloguePointer catalogue = std::make_shared< TwoLineElementCatalogue >(
+                twoLineElementsTextFileReader.getTwoLineElementData( ), numberOfThreads );
+    catalogue->removeDuplicateObjects( );
+    return catalogue;
+}
+
+} // namespace input_output
+} // namespace tudat
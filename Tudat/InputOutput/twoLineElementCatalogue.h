@@ -0,0 +1,223 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      The states computed from the catalogue are osculating two-body (Kepler) states, obtained by interpreting the
+ *      mean TLE elements as Keplerian elements, and propagating the mean anomaly with the mean motion. They are not
+ *      equivalent to SGP4 states, but are suitable for fast, approximate operations on full catalogues, such as
+ *      conjunction pre-screening.
+ *
+ */
+
+#ifndef TUDAT_TWO_LINE_ELEMENT_CATALOGUE_H
+#define TUDAT_TWO_LINE_ELEMENT_CATALOGUE_H
+
+#include <string>
+#include <vector>
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelLoop.h"
+#include "Tudat/InputOutput/twoLineElementData.h"
+#include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Gravitational parameter of the Earth used for TLEs (WGS-72) [m^3/s^2].
+const static double TWO_LINE_ELEMENTS_EARTH_GRAVITATIONAL_PARAMETER = 398600.8e9;
+
+//! Compact catalogue of TLE data of multiple objects.
+/*!
+ * Compact catalogue of TLE data of multiple objects, stored as a structure of arrays (one array per variable, with one
+ * entry per object) instead of a vector of TwoLineElementData objects. Only the variables required to compute the
+ * (approximate) states of the objects are stored, in SI units and radians. Duplicate entries of an object are found by
+ * sorting, and the states of all objects are computed concurrently.
+ */
+class TwoLineElementCatalogue
+{
+public:
+
+    //! Constructor from TLE data objects.
+    /*!
+     * Constructor from TLE data objects, as retrieved from a TwoLineElementsTextFileReader.
+     * \param twoLineElementData TLE data objects.
+     * \param numberOfThreads Maximum number of threads used for the conversion of the TLE data.
+     */
+    TwoLineElementCatalogue( const std::vector< TwoLineElementData >& twoLineElementData,
+                             const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+    //! Get number of objects in catalogue.
+    /*!
+     * \return Number of objects in catalogue.
+     */
+    unsigned int getNumberOfObjects( ) const { return objectIdentificationNumbers_.size( ); }
+
+    //! Get object identification numbers.
+    /*!
+     * \return Object identification numbers (one per object).
+     */
+    const std::vector< unsigned int >& getObjectIdentificationNumbers( ) const { return objectIdentificationNumbers_; }
+
+    //! Get object names.
+    /*!
+     * \return Object names (one per object; empty for two-line TLE data).
+     */
+    const std::vector< std::string >& getObjectNames( ) const { return objectNames_; }
+
+    //! Get epochs of TLEs.
+    /*!
+     * \return Epochs of TLEs, in seconds since J2000 (one per object).
+     */
+    const Eigen::VectorXd& getEpochs( ) const { return epochs_; }
+
+    //! Get mean motions.
+    /*!
+     * \return Mean motions [rad/s] (one per object).
+     */
+    const Eigen::VectorXd& getMeanMotions( ) const { return meanMotions_; }
+
+    //! Get mean anomalies at epochs of TLEs.
+    /*!
+     * \return Mean anomalies at epochs of TLEs [rad] (one per object).
+     */
+    const Eigen::VectorXd& getMeanAnomalies( ) const { return meanAnomalies_; }
+
+    //! Get B* drag terms.
+    /*!
+     * \return B* drag terms [1/earth radii] (one per object).
+     */
+    const Eigen::VectorXd& getBStarDragTerms( ) const { return bStarDragTerms_; }
+
+    //! Get Keplerian elements at epochs of TLEs.
+    /*!
+     * Get Keplerian elements at epochs of TLEs, with one row per object. Columns are ordered as defined by
+     * orbital_element_conversions::KeplerianElementIndices, with angles in radians.
+     * \return Keplerian elements at epochs of TLEs.
+     */
+    const Eigen::Matrix< double, Eigen::Dynamic, 6 >& getKeplerianElements( ) const { return keplerianElements_; }
+
+    //! Function to find duplicate entries of objects.
+    /*!
+     * Function to find duplicate entries of objects, i.e., entries with the same object identification number as an
+     * entry with a later epoch (or the same epoch, but later in the catalogue). The most recent entry of each object
+     * is not a duplicate.
+     * \return Indices of duplicate entries, in increasing order.
+     */
+    std::vector< unsigned int > findDuplicateObjects( ) const;
+
+    //! Function to remove objects from the catalogue.
+    /*!
+     * Function to remove objects from the catalogue, preserving the order of the remaining objects.
+     * \param objectIndices Indices of objects to remove (need not be sorted, may contain duplicate indices).
+     */
+    void removeObjects( const std::vector< unsigned int >& objectIndices );
+
+    //! Function to remove duplicate entries of objects from the catalogue.
+    /*!
+     * Function to remove duplicate entries of objects from the catalogue (see findDuplicateObjects), keeping only the
+     * most recent entry of each object.
+     * \return Number of removed entries.
+     */
+    unsigned int removeDuplicateObjects( );
+
+    //! Function to compute Keplerian states of all objects at a given epoch.
+    /*!
+     * Function to compute Keplerian states of all objects at a given epoch, by propagating the mean anomalies of the
+     * TLEs with the mean motions (two-body propagation).
+     * \param epoch Epoch at which states are to be computed, in seconds since J2000.
+     * \param numberOfThreads Maximum number of threads used for the computation.
+     * \return Keplerian states at given epoch, one row per object.
+     */
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > getKeplerianStatesAtEpoch(
+            const double epoch, const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+    //! Function to compute Cartesian states of all objects at a given epoch.
+    /*!
+     * Function to compute Cartesian states of all objects at a given epoch (see getKeplerianStatesAtEpoch), in the
+     * frame in which the TLEs are defined.
+     * \param epoch Epoch at which states are to be computed, in seconds since J2000.
+     * \param numberOfThreads Maximum number of threads used for the computation.
+     * \return Cartesian states at given epoch, one row per object.
+     */
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > getCartesianStatesAtEpoch(
+            const double epoch, const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+    //! Function to compute Cartesian states of all objects at the epochs of their TLEs.
+    /*!
+     * Function to compute Cartesian states of all objects at the epochs of their TLEs, in the frame in which the TLEs
+     * are defined.
+     * \param numberOfThreads Maximum number of threads used for the computation.
+     * \return Cartesian states at epochs of TLEs, one row per object.
+     */
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > getCartesianStates(
+            const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ) const;
+
+private:
+
+    //! Function to compute Cartesian states from Keplerian states.
+    /*!
+     * Function to compute Cartesian states from Keplerian states, for all objects concurrently.
+     * \param keplerianStates Keplerian states, one row per object.
+     * \param numberOfThreads Maximum number of threads used for the computation.
+     * \return Cartesian states, one row per object.
+     */
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > convertKeplerianToCartesianStates(
+            const Eigen::Matrix< double, Eigen::Dynamic, 6 >& keplerianStates, const int numberOfThreads ) const;
+
+    //! Object identification numbers.
+    std::vector< unsigned int > objectIdentificationNumbers_;
+
+    //! Object names.
+    std::vector< std::string > objectNames_;
+
+    //! Epochs of TLEs, in seconds since J2000.
+    Eigen::VectorXd epochs_;
+
+    //! Mean motions [rad/s].
+    Eigen::VectorXd meanMotions_;
+
+    //! Mean anomalies at epochs of TLEs [rad].
+    Eigen::VectorXd meanAnomalies_;
+
+    //! B* drag terms [1/earth radii].
+    Eigen::VectorXd bStarDragTerms_;
+
+    //! Keplerian elements at epochs of TLEs, one row per object.
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > keplerianElements_;
+};
+
+//! Typedef for shared-pointer to TwoLineElementCatalogue object.
+typedef std::shared_ptr< TwoLineElementCatalogue > TwoLineElementCataloguePointer;
+
+//! Function to read a TLE catalogue file into a compact catalogue.
+/*!
+ * Function to read a TLE catalogue file into a compact catalogue, using a TwoLineElementsTextFileReader. Objects with
+ * corrupted TLE data (see TwoLineElementsTextFileReader::checkTwoLineElementsFileIntegrity) and duplicate entries of
+ * objects (see TwoLineElementCatalogue::findDuplicateObjects) are removed.
+ * \param absoluteFilePath Absolute path to the TLE catalogue file.
+ * \param currentYear Current year, used to compute the total number of revolutions of the objects.
+ * \param lineNumberType Line number type of the TLE data (two- or three-line).
+ * \param numberOfThreads Maximum number of threads used for the conversion of the TLE data.
+ * \return Catalogue of TLE data in file.
+ */
+TwoLineElementCataloguePointer readTwoLineElementCatalogue(
+        const std::string& absoluteFilePath, const unsigned int currentYear,
+        const TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData lineNumberType =
+        TwoLineElementsTextFileReader::threeLineType,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_TWO_LINE_ELEMENT_CATALOGUE_H
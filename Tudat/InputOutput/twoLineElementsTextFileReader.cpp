@@ -31,15 +31,19 @@
  *
  */ 
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
-#include <boost/algorithm/string/trim.hpp>
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/numericTextFileParser.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
@@ -54,6 +58,70 @@ namespace input_output
 // Using declarations.
 using mathematical_constants::PI;
 
+//! Function to retrieve a fixed-width field of a TLE line.
+/*!
+ * Function to retrieve a fixed-width field of a TLE line, which is truncated if the line is too short (as for
+ * std::string::substr).
+ * \param line TLE line.
+ * \param position Position of first character of field.
+ * \param length Width of field.
+ * \return Range of characters of field.
+ * \throws std::out_of_range If the field starts beyond the end of the line.
+ */
+static TextRange getTwoLineElementField( const std::string& line, const std::size_t position,
+                                         const std::size_t length )
+{
+    if ( position > line.size( ) )
+    {
+        throw std::out_of_range( "Error, TLE line is too short: " + line );
+    }
+    return TextRange( line.data( ) + position, line.data( ) + position + std::min( length, line.size( ) - position ) );
+}
+
+//! Function to convert a fixed-width field of a TLE line to a double.
+/*!
+ * Function to convert a fixed-width field of a TLE line to a double, with the same semantics as std::stod (i.e.,
+ * characters after the number are ignored).
+ * \param line TLE line.
+ * \param position Position of first character of field.
+ * \param length Width of field.
+ * \return Converted value.
+ * \throws std::invalid_argument If the field does not start with a number.
+ */
+static double parseTwoLineElementDoubleField( const std::string& line, const std::size_t position,
+                                              const std::size_t length )
+{
+    const TextRange field = getTwoLineElementField( line, position, length );
+    double value = 0.0;
+    if ( parseLeadingDouble( field.begin, field.end, value ) == field.begin )
+    {
+        throw std::invalid_argument( "Error, could not convert TLE field \"" + field.toString( ) + "\" to a number." );
+    }
+    return value;
+}
+
+//! Function to convert a fixed-width field of a TLE line to an integer.
+/*!
+ * Function to convert a fixed-width field of a TLE line to an integer, with the same semantics as std::stoi (i.e.,
+ * characters after the integer are ignored).
+ * \param line TLE line.
+ * \param position Position of first character of field.
+ * \param length Width of field.
+ * \return Converted value.
+ * \throws std::invalid_argument If the field does not start with an integer.
+ */
+static long long parseTwoLineElementIntegerField( const std::string& line, const std::size_t position,
+                                                  const std::size_t length )
+{
+    const TextRange field = getTwoLineElementField( line, position, length );
+    long long value = 0;
+    if ( parseLeadingInteger( field.begin, field.end, value ) == field.begin )
+    {
+        throw std::invalid_argument( "Error, could not convert TLE field \"" + field.toString( ) + "\" to an integer." );
+    }
+    return value;
+}
+
 //! Open data file.
 void TwoLineElementsTextFileReader::openFile( )
 {
@@ -99,18 +167,30 @@ void TwoLineElementsTextFileReader::readAndStoreData( )
     // Reset the datafile.
     containerOfDataFromFile_.clear( );
 
-    // Whilst the end of the data file has not been reached, continue reading
-    // from lines from data file.
-    while( !dataFile_.eof( ) )
+    // Check if the end of the data file has already been reached.
+    if ( dataFile_.eof( ) )
     {
-        // Get next line of data from data file and store in a string.
-        getline( dataFile_, stringOfData_ );
+        return;
+    }
+
+    // Read the remainder of the data file in a single operation, and split it into lines (as for repeated calls to
+    // getline( ) until the end of the file is reached).
+    const std::string remainingFileContents( ( std::istreambuf_iterator< char >( dataFile_ ) ),
+                                             std::istreambuf_iterator< char >( ) );
+    std::vector< TextRange > linesOfData;
+    splitIntoLines( TextRange( remainingFileContents.data( ),
+                               remainingFileContents.data( ) + remainingFileContents.size( ) ), linesOfData );
+
+    for ( unsigned int i = 0; i < linesOfData.size( ); i++ )
+    {
+        // Get next line of data.
+        const TextRange& lineOfData = linesOfData[ i ];
 
         // Check if line of data is header line.
         if ( lineCounter_ <= numberOfHeaderLines_ )
         {
             // Store header line data.
-            containerOfHeaderDataFromFile_[ lineCounter_ ] = stringOfData_;
+            containerOfHeaderDataFromFile_[ lineCounter_ ] = lineOfData.toString( );
         }
 
         // Else process non-header data line.
@@ -118,21 +198,30 @@ void TwoLineElementsTextFileReader::readAndStoreData( )
         {
             // Check if string doesn't start with set starting character, if string
             // is not empty, and if the skip keyword is not in the string.
-            if ( ( ( !startingCharacter_.empty( ) && stringOfData_.substr( 0, 1 )
+            if ( ( ( !startingCharacter_.empty( ) &&
+                     std::string( lineOfData.begin, std::min< std::size_t >( lineOfData.size( ), 1 ) )
                      .compare( startingCharacter_ ) != 0 )
-                   || ( !skipKeyword_.empty( ) && stringOfData_.find( skipKeyword_ )
-                        == std::string::npos )
+                   || ( !skipKeyword_.empty( ) &&
+                        std::search( lineOfData.begin, lineOfData.end, skipKeyword_.begin( ),
+                                     skipKeyword_.end( ) ) == lineOfData.end )
                    || ( startingCharacter_.empty( ) && skipKeyword_.empty( ) ) )
-                 && !stringOfData_.empty( ) )
+                 && !lineOfData.empty( ) )
             {
-                // Store string in container.
-                containerOfDataFromFile_[ lineCounter_ ] = stringOfData_;
+                // Store string in container (line numbers are increasing, so it is appended).
+                containerOfDataFromFile_.insert( containerOfDataFromFile_.end( ),
+                                                 std::make_pair( lineCounter_, lineOfData.toString( ) ) );
             }
         }
 
         // Increment line counter.
         lineCounter_++;
     }
+
+    // Keep last line of data, as read by getline( ).
+    stringOfData_ = linesOfData.back( ).toString( );
+
+    // Set end-of-file state of data file.
+    dataFile_.setstate( std::ios::eofbit );
 }
 
 //! Read and store data.
@@ -194,8 +283,6 @@ void TwoLineElementsTextFileReader::stripEndOfLineCharacters(
 //! Convert and store TLE data.
 void TwoLineElementsTextFileReader::storeTwoLineElementData( )
 {
-    using boost::algorithm::trim_copy;
-
     // Strip End-Of-Line characters from data container.
     stripEndOfLineCharacters( containerOfDataFromFile_ );
 
@@ -205,17 +292,26 @@ void TwoLineElementsTextFileReader::storeTwoLineElementData( )
     // Set TLE data vector size.
     twoLineElementData_.resize( numberOfObjects_ );
 
-    // Create vector of the three lines of a single object's TLE data as strings.
-    std::vector< std::string > twoLineElementString_( 3 );
-
-    // Create the object counter.
-    unsigned int objectNumberCounter_ = 0;
+    // For every 3 lines, read the data from 3 consecutive strings of TLE data and convert them to the TLE data
+    // variables. The objects are independent, and are converted concurrently.
+    const int numberOfDataBlocks = ( lineCounter_ > 1 ) ?
+                static_cast< int >( ( lineCounter_ - 2 ) / numberOfLinesPerTwoLineElementDatum_ + 1 ) : 0;
+    utilities::executeParallelLoop( numberOfDataBlocks, [ & ]( const int objectIndex )
+    {
+        storeTwoLineElementDatum(
+                    objectIndex, 1 + static_cast< unsigned int >( objectIndex ) * numberOfLinesPerTwoLineElementDatum_ );
+    } );
+}
 
+//! Convert and store TLE data of a single object.
+void TwoLineElementsTextFileReader::storeTwoLineElementDatum(
+        const unsigned int objectIndex, const unsigned int firstLineNumber )
+{
     // Declare Keplerian elements variables.
-    double inclination_;
-    double rightAscensionOfAscendingNode_;
-    double eccentricity_;
-    double argumentOfPerigee_;
+    double inclination_ = 0.0;
+    double rightAscensionOfAscendingNode_ = 0.0;
+    double eccentricity_ = 0.0;
+    double argumentOfPerigee_ = 0.0;
     double meanMotion_;
 
     // Declare approximate number of revolutions, remainder, and lost part.
@@ -226,317 +322,273 @@ void TwoLineElementsTextFileReader::storeTwoLineElementData( )
     // Reference: Table 2 in (Vallado, D.A., et al., 2006).
     const double earthWithWorldGeodeticSystem72GravitationalParameter = 398600.8e9;
 
-    // For every 3 lines, read the data from 3 consecutive strings of TLE data
-    // and convert them to the TLE data variables
-    for ( unsigned int i = 1; i < lineCounter_; i += numberOfLinesPerTwoLineElementDatum_ )
+    // General setup for variable storing.
+    //---------------------------------------------------------------------
+
+    // Create vector of the three lines of a single object's TLE data as strings, and fill it with the line strings
+    // from the data container.
+    std::vector< std::string > twoLineElementString_( 3 );
+    const unsigned int i = firstLineNumber;
+    if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
     {
-        // General setup for variable storing.
-        //---------------------------------------------------------------------
+        twoLineElementString_.at( 0 ) = containerOfDataFromFile_.at( i );
+        twoLineElementString_.at( 1 ) = containerOfDataFromFile_.at( i + 1 );
+        twoLineElementString_.at( 2 ) = containerOfDataFromFile_.at( i + 2 );
+    }
 
-        // Fill the vector with the line strings from the data container.
-        if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
-        {
-            twoLineElementString_.at( 0 ) = containerOfDataFromFile_.at( i );
-            twoLineElementString_.at( 1 ) = containerOfDataFromFile_.at( i + 1 );
-            twoLineElementString_.at( 2 ) = containerOfDataFromFile_.at( i + 2 );
-        }
+    else if ( numberOfLinesPerTwoLineElementDatum_ == 2 )
+    {
+        twoLineElementString_.at( 1 ) = containerOfDataFromFile_.at( i );
+        twoLineElementString_.at( 2 ) = containerOfDataFromFile_.at( i + 1 );
+    }
 
-        else if ( numberOfLinesPerTwoLineElementDatum_ == 2 )
-        {
-            twoLineElementString_.at( 1 ) = containerOfDataFromFile_.at( i );
-            twoLineElementString_.at( 2 ) = containerOfDataFromFile_.at( i + 1 );
-        }
+    TwoLineElementData& twoLineElementDatum = twoLineElementData_.at( objectIndex );
 
-        // Push the TLE strings to the TLE data container.
-        twoLineElementData_[ objectNumberCounter_ ].twoLineElementStrings = twoLineElementString_;
+    // Push the TLE strings to the TLE data container.
+    twoLineElementDatum.twoLineElementStrings = twoLineElementString_;
 
-        // Push the line numbers to the TLE data container.
-        twoLineElementData_[ objectNumberCounter_ ].lineNumbers.push_back( i );
-        twoLineElementData_[ objectNumberCounter_ ].lineNumbers.push_back( i + 1 );
-        if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
+    // Push the line numbers to the TLE data container.
+    twoLineElementDatum.lineNumbers.push_back( i );
+    twoLineElementDatum.lineNumbers.push_back( i + 1 );
+    if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
+    {
+        twoLineElementDatum.lineNumbers.push_back( i + 2 );
+    }
+
+    // Line-0 variable storing.
+    //---------------------------------------------------------------------
+    if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
+    {
+        // Read words that constitute name of object. Store name parts in objectName storage container.
+        const std::string& line0String = twoLineElementString_.at( 0 );
+        std::string::const_iterator namePartBegin = line0String.begin( );
+        while ( namePartBegin != line0String.end( ) )
         {
-            twoLineElementData_[ objectNumberCounter_ ].lineNumbers.push_back( i + 2 );
+            namePartBegin = std::find_if_not( namePartBegin, line0String.end( ), isWhitespaceCharacter );
+            const std::string::const_iterator namePartEnd =
+                    std::find_if( namePartBegin, line0String.end( ), isWhitespaceCharacter );
+            if ( namePartBegin != namePartEnd )
+            {
+                twoLineElementDatum.objectName.push_back( std::string( namePartBegin, namePartEnd ) );
+            }
+            namePartBegin = namePartEnd;
         }
 
-        // Initiate a stringstream for each line.
-        std::stringstream line0StringStream_( std::stringstream::in | std::stringstream::out );
-        std::stringstream line1StringStream_( std::stringstream::in | std::stringstream::out );
-        std::stringstream line2StringStream_( std::stringstream::in | std::stringstream::out );
+        // Insert the entire line-0 string in the object name string.
+        twoLineElementDatum.objectNameString = twoLineElementString_.at( 0 );
+    }
 
-        // Insert the strings into the stringstreams
-        if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
-        {
-            line0StringStream_ << twoLineElementString_.at( 0 );
-        }
-        line1StringStream_ << twoLineElementString_.at( 1 );
-        line2StringStream_ << twoLineElementString_.at( 2 );
+    // Line-1 variable storing.
+    //---------------------------------------------------------------------
+    // Fill all line-1 variables of the object structure with fixed-width fields of the line-1 string.
+    // See reference for which columns are assigned to which variable.
+    const std::string& line1String = twoLineElementString_.at( 1 );
 
-        // Line-0 variable storing.
-        //---------------------------------------------------------------------
-        if ( numberOfLinesPerTwoLineElementDatum_ == 3 )
-        {
-            // Declare string containing part of name of object.
-            std::string namePart_;
+    // Get line number integer of line-1 from string.
+    twoLineElementDatum.lineNumberLine1  = parseTwoLineElementIntegerField( line1String, 0, 1 );
 
-            // Loop through the stringstream and read words that constitute name of
-            // object. Store name parts in objectName storage container.
-            while ( line0StringStream_ >> namePart_ )
-            {
-                twoLineElementData_[ objectNumberCounter_ ].objectName.push_back( namePart_ );
-            }
+    // Get object indentification number integer of line-1 from string
+    twoLineElementDatum.objectIdentificationNumber = parseTwoLineElementIntegerField( line1String, 2, 5 );
 
-            // Insert the entire line-0 string in the object name string.
-            twoLineElementData_[ objectNumberCounter_ ].objectNameString
-                    = twoLineElementString_.at( 0 );
-        }
+    // Get classification character from string.
+    twoLineElementDatum.tleClassification = line1String[ 7 ];
 
-        // Line-1 variable storing.
-        //---------------------------------------------------------------------
-        // Fill all line-1 variables of the object structure with substrings
-        // of the line-1 string using the template function to transform the
-        // string to another type.
-        // See reference for which columns are assigned to which variable.
+    // Get launch year integer from string.
+    twoLineElementDatum.launchYear = parseTwoLineElementIntegerField( line1String, 9, 2 );
 
-        // Get line number integer of line-1 from string.
-        twoLineElementData_[ objectNumberCounter_ ].lineNumberLine1  =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 0, 1 ) ) );
+    // Calculate four-digit launch year from the above.
+    if ( twoLineElementDatum.launchYear > 56 )
+    {
+        twoLineElementDatum.fourDigitlaunchYear = twoLineElementDatum.launchYear + 1900;
+    }
+
+    else
+    {
+        twoLineElementDatum.fourDigitlaunchYear = twoLineElementDatum.launchYear + 2000;
+    }
 
-        // Get object indentification number integer of line-1 from string
-        twoLineElementData_[ objectNumberCounter_ ].objectIdentificationNumber =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 2, 5 ) ) );
+    // Get launch number integer from string.
+    twoLineElementDatum.launchNumber = parseTwoLineElementIntegerField( line1String, 11, 3 );
 
+    // Get launch part string from string.
+    twoLineElementDatum.launchPart = line1String.substr( 14, 3 );
 
-        // Get classification character from string.
-        twoLineElementData_[ objectNumberCounter_ ].tleClassification =
-                twoLineElementString_.at( 1 ) [ 7 ];
+    // Get epoch year integer from string.
+    twoLineElementDatum.epochYear = parseTwoLineElementIntegerField( line1String, 18, 2 );
 
-        // Get launch year integer from string.
-        twoLineElementData_[ objectNumberCounter_ ].launchYear =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 9, 2 ) ) );
+    // Calculate four-digit epoch year from the above.
+    if ( twoLineElementDatum.epochYear > 56 )
+    {
+        twoLineElementDatum.fourDigitEpochYear = twoLineElementDatum.epochYear + 1900;
+    }
 
-        // Calculate four-digit launch year from the above.
-        if ( twoLineElementData_[ objectNumberCounter_ ].launchYear > 56 )
+    else
+    {
+        twoLineElementDatum.fourDigitEpochYear = twoLineElementDatum.epochYear + 2000;
+    }
+
+    // Get epoch day double from string.
+    twoLineElementDatum.epochDay = parseTwoLineElementDoubleField( line1String, 20, 12 );
+
+    // Get "first-derivative of mean motion divided by two" double from string.
+    twoLineElementDatum.firstDerivativeOfMeanMotionDividedByTwo =
+            parseTwoLineElementDoubleField( line1String, 33, 10 );
+
+    // Get coefficient of scientific notation of "second-derivative of mean motion divided
+    // by six" double from string,
+    // Apply implied leading decimal point.
+    twoLineElementDatum.coefficientOfSecondDerivativeOfMeanMotionDividedBySix =
+            parseTwoLineElementDoubleField( line1String, 44, 6 ) / 100000.0;
+
+    // Get exponent of scientific notation of "second-derivative of mean motion divided
+    // by six" integer from string.
+    twoLineElementDatum.exponentOfSecondDerivativeOfMeanMotionDividedBySix =
+            parseTwoLineElementDoubleField( line1String, 50, 2 );
+
+    // Calculate "second-derivative of mean motion divided by six" double from the above two.
+    twoLineElementDatum.secondDerivativeOfMeanMotionDividedBySix =
+            twoLineElementDatum.coefficientOfSecondDerivativeOfMeanMotionDividedBySix
+            * pow( 10, twoLineElementDatum.exponentOfSecondDerivativeOfMeanMotionDividedBySix );
+
+    // Get coefficient of scientific notation of "B* divided by six" double
+    // from string; apply implied leading decimal point.
+    twoLineElementDatum.coefficientOfBStar = parseTwoLineElementDoubleField( line1String, 53, 6 ) / 100000.0;
+
+    // Get exponent of scientific notation of B* integer from string
+    twoLineElementDatum.exponentOfBStar = parseTwoLineElementIntegerField( line1String, 59, 2 );
+
+    // Calculate B* double from the above two.
+    twoLineElementDatum.bStar = twoLineElementDatum.coefficientOfBStar * pow( 10.0, twoLineElementDatum.exponentOfBStar );
+
+    // Get orbital model integer from string.
+    twoLineElementDatum.orbitalModel = parseTwoLineElementIntegerField( line1String, 62, 1 );
+
+    // Get TLE number integer from string.
+    twoLineElementDatum.tleNumber = parseTwoLineElementIntegerField( line1String, 64, 4 );
+
+    // Get modulo-10 checksum integer from string.
+    twoLineElementDatum.modulo10CheckSumLine1 = parseTwoLineElementIntegerField( line1String, 68, 1 );
+
+    // Line-2 variable storing.
+    //---------------------------------------------------------------------
+    // Fill all line-2 variables of the object structure partly with whitespace-separated values (extracted as
+    // from a stringstream) and partly with fixed-width fields of the line-2 string.
+    // See reference for which columns are assigned to which variable.
+    const std::string& line2String = twoLineElementString_.at( 2 );
+    const char* line2Position = line2String.data( );
+    const char* const line2End = line2String.data( ) + line2String.size( );
+    bool isLine2ExtractionFailed = false;
+
+    // Function to extract the next value from line 2; as for a stringstream, a failed extraction sets the value to
+    // zero, and leaves all subsequent values unchanged.
+    auto extractLine2Double = [ & ]( double& value )
+    {
+        if ( !isLine2ExtractionFailed )
         {
-            twoLineElementData_[ objectNumberCounter_ ].fourDigitlaunchYear =
-                    twoLineElementData_[ objectNumberCounter_ ].launchYear + 1900;
+            const char* valueEnd = parseLeadingDouble( line2Position, line2End, value );
+            if ( valueEnd == line2Position )
+            {
+                value = 0.0;
+                isLine2ExtractionFailed = true;
+            }
+            line2Position = valueEnd;
         }
-
-        else
+    };
+    auto extractLine2Integer = [ & ]( unsigned int& value )
+    {
+        if ( !isLine2ExtractionFailed )
         {
-            twoLineElementData_[ objectNumberCounter_ ].fourDigitlaunchYear =
-                    twoLineElementData_[ objectNumberCounter_ ].launchYear + 2000;
+            long long integerValue = 0;
+            const char* valueEnd = parseLeadingInteger( line2Position, line2End, integerValue );
+            if ( valueEnd == line2Position )
+            {
+                isLine2ExtractionFailed = true;
+            }
+            value = static_cast< unsigned int >( integerValue );
+            line2Position = valueEnd;
         }
+    };
 
-        // Get launch number integer from string.
-        twoLineElementData_[ objectNumberCounter_ ].launchNumber =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 11, 3 ) ) );
+    // Get line number integer of line-2.
+    extractLine2Integer( twoLineElementDatum.lineNumberLine2 );
 
-        // Get launch part string from string.
-        twoLineElementData_[ objectNumberCounter_ ].launchPart =
-                twoLineElementString_.at( 1 ).substr( 14, 3 );
+    // Get object identification number integer of line-2.
+    extractLine2Integer( twoLineElementDatum.objectIdentificationNumberLine2 );
 
-        // Get epoch year integer from string.
-        twoLineElementData_[ objectNumberCounter_ ].epochYear =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 18, 2 ) ) );
+    // Get inclination double.
+    extractLine2Double( inclination_ );
+    twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::inclinationIndex ) = inclination_;
 
-        // Calculate four-digit epoch year from the above.
-        if ( twoLineElementData_[ objectNumberCounter_ ].epochYear > 56 )
-        {
-            twoLineElementData_[ objectNumberCounter_ ].fourDigitEpochYear =
-                    twoLineElementData_[ objectNumberCounter_ ].epochYear + 1900;
-        }
+    // Get right ascension of ascending node double.
+    extractLine2Double( rightAscensionOfAscendingNode_ );
+    twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::longitudeOfAscendingNodeIndex )
+            = rightAscensionOfAscendingNode_;
 
-        else
-        {
-            twoLineElementData_[ objectNumberCounter_ ].fourDigitEpochYear =
-                    twoLineElementData_[ objectNumberCounter_ ].epochYear + 2000;
-        }
+    // Get eccetricity double.
+    extractLine2Double( eccentricity_ );
+    eccentricity_ /= 10000000;
+    twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::eccentricityIndex ) = eccentricity_;
 
-        // Get epoch day double from string.
-        twoLineElementData_[ objectNumberCounter_ ].epochDay =
-                std::stod(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 20, 12 ) ) );
-
-        // Get "first-derivative of mean motion divided by two" double from string.
-        twoLineElementData_[ objectNumberCounter_].firstDerivativeOfMeanMotionDividedByTwo =
-                std::stod(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 33, 10 ) ) );
-
-        // Get coefficient of scientific notation of "second-derivative of mean motion divided
-        // by six" double from string,
-        // Apply implied leading decimal point.
-        twoLineElementData_[ objectNumberCounter_ ]
-                .coefficientOfSecondDerivativeOfMeanMotionDividedBySix =
-                std::stod(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 44, 6 ) ) ) / 100000.0;
-
-        // Get exponent of scientific notation of "second-derivative of mean motion divided
-        // by six" integer from string.
-        twoLineElementData_[ objectNumberCounter_]
-                .exponentOfSecondDerivativeOfMeanMotionDividedBySix =
-                std::stod(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 50, 2 ) ) );
-
-        // Calculate "second-derivative of mean motion divided by six" double from the above two.
-        twoLineElementData_[ objectNumberCounter_ ].secondDerivativeOfMeanMotionDividedBySix =
-                twoLineElementData_[ objectNumberCounter_]
-                .coefficientOfSecondDerivativeOfMeanMotionDividedBySix
-                * pow( 10, twoLineElementData_[ objectNumberCounter_ ]
-                       .exponentOfSecondDerivativeOfMeanMotionDividedBySix );
-
-        // Get coefficient of scientific notation of "B* divided by six" double
-        // from string; apply implied leading decimal point.
-        twoLineElementData_[ objectNumberCounter_ ].coefficientOfBStar =
-                std::stod(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 53, 6 ) ) ) /
-                100000.0;
-
-        // Get exponent of scientific notation of B* integer from string
-        twoLineElementData_[ objectNumberCounter_ ].exponentOfBStar =
-                std::stoi(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 59, 2 ) ) );
-
-        // Calculate B* double from the above two.
-        twoLineElementData_[ objectNumberCounter_ ].bStar =
-                twoLineElementData_[ objectNumberCounter_ ].coefficientOfBStar
-                * pow( 10.0, twoLineElementData_[ objectNumberCounter_ ].exponentOfBStar );
-
-        // Get orbital model integer from string.
-        twoLineElementData_[ objectNumberCounter_ ].orbitalModel =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 62, 1 ) ) );
-
-        // Get TLE number integer from string.
-        twoLineElementData_[ objectNumberCounter_ ].tleNumber =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 64, 4 ) ) );
-
-        // Get modulo-10 checksum integer from string.
-        twoLineElementData_[ objectNumberCounter_ ].modulo10CheckSumLine1 =
-                std::stoul(
-                    trim_copy( twoLineElementString_.at( 1 ).substr( 68, 1 ) ) );
-
-        // Line-2 variable storing.
-        //---------------------------------------------------------------------
-        // Fill all line-2 variables of the object structure partly with the
-        // stringstream and partly with with substrings of the line-2 string
-        // using the template function to transform the string to another type.
-        // See reference for which columns are assigned to which variable.
-
-        // Get line number integer of line-2 from stringstream.
-        line2StringStream_ >> twoLineElementData_[ objectNumberCounter_ ].lineNumberLine2;
-
-        // Get object identification number integer of line-2 from stringstream.
-        line2StringStream_ >> twoLineElementData_[ objectNumberCounter_ ]
-                              .objectIdentificationNumberLine2;
-
-        // Get inclination double from stringstream.
-        line2StringStream_ >> inclination_;
-        twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::inclinationIndex ) = inclination_;
-
-        // Get right ascension of ascending node double from stringstream.
-        line2StringStream_ >> rightAscensionOfAscendingNode_;
-        twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::longitudeOfAscendingNodeIndex )
-                = rightAscensionOfAscendingNode_;
-
-        // Get eccetricity double from stringstream.
-        line2StringStream_ >> eccentricity_;
-        eccentricity_ /= 10000000;
-        twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::eccentricityIndex ) = eccentricity_;
-
-        // Get argument of perigee double from stringstream
-        line2StringStream_ >> argumentOfPerigee_;
-        twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::argumentOfPeriapsisIndex ) = argumentOfPerigee_;
-
-        // Get mean anomaly double from stringstream.
-        line2StringStream_ >> twoLineElementData_[ objectNumberCounter_ ].meanAnomaly;
-
-        // Get mean motion double from line-2 string.
-        twoLineElementData_[ objectNumberCounter_ ].meanMotionInRevolutionsPerDay =
-                std::stod(
-                    trim_copy( twoLineElementString_[ 2 ].substr( 52, 11 ) ) );
-
-        // Get revolution number integer from line-2 string.
-        twoLineElementData_[ objectNumberCounter_ ].revolutionNumber =
-                std::stoi(
-                    trim_copy( twoLineElementString_[ 2 ].substr( 63, 5 ) ) );
-
-        // Get modulo-10 checksum integer of line-2 from line-2 string.
-        twoLineElementData_[ objectNumberCounter_ ].modulo10CheckSumLine2 =
-                std::stoul(
-                    trim_copy( twoLineElementString_[ 2 ].substr( 68, 1 ) ) );
-
-        // Calculate the approximate total number of revolutions, as the counter resets to 0 after
-        // passing by 99999, insert the current year in the following equation.
-        approximateNumberOfRevolutions_ = twoLineElementData_[ objectNumberCounter_ ]
-                .meanMotionInRevolutionsPerDay
-                * ( currentYear_
-                    - twoLineElementData_[ objectNumberCounter_ ].fourDigitlaunchYear )
-                * physical_constants::JULIAN_YEAR_IN_DAYS;
-        approximateNumberOfRevolutionsRemainder_ = approximateNumberOfRevolutions_ % 100000;
-        lostNumberOfRevolutions_ = approximateNumberOfRevolutions_
-                - approximateNumberOfRevolutionsRemainder_;
-
-        // Check if the counter has been reset after passing 99999.
-        if ( ( twoLineElementData_[ objectNumberCounter_ ].revolutionNumber -
-               approximateNumberOfRevolutionsRemainder_ ) <=
-             ( approximateNumberOfRevolutionsRemainder_ + 100000 -
-               twoLineElementData_[ objectNumberCounter_ ].revolutionNumber ) )
-        {
-            twoLineElementData_[ objectNumberCounter_ ].totalRevolutionNumber =
-                    lostNumberOfRevolutions_ + twoLineElementData_[ objectNumberCounter_ ]
-                    .revolutionNumber;
-        }
+    // Get argument of perigee double.
+    extractLine2Double( argumentOfPerigee_ );
+    twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::argumentOfPeriapsisIndex ) =
+            argumentOfPerigee_;
 
-        else
-        {
-            twoLineElementData_[ objectNumberCounter_ ].totalRevolutionNumber =
-                    lostNumberOfRevolutions_ - 100000
-                    + twoLineElementData_[ objectNumberCounter_ ].revolutionNumber;
-        }
+    // Get mean anomaly double.
+    extractLine2Double( twoLineElementDatum.meanAnomaly );
 
-        // Check if total number of revolutions is negative.
-        if ( twoLineElementData_[ objectNumberCounter_ ].totalRevolutionNumber < 0 )
-        {
-            twoLineElementData_[ objectNumberCounter_ ].totalRevolutionNumber =
-                    twoLineElementData_[ objectNumberCounter_ ].revolutionNumber;
-        }
+    // Get mean motion double from line-2 string.
+    twoLineElementDatum.meanMotionInRevolutionsPerDay = parseTwoLineElementDoubleField( line2String, 52, 11 );
+
+    // Get revolution number integer from line-2 string.
+    twoLineElementDatum.revolutionNumber = parseTwoLineElementIntegerField( line2String, 63, 5 );
+
+    // Get modulo-10 checksum integer of line-2 from line-2 string.
+    twoLineElementDatum.modulo10CheckSumLine2 = parseTwoLineElementIntegerField( line2String, 68, 1 );
+
+    // Calculate the approximate total number of revolutions, as the counter resets to 0 after
+    // passing by 99999, insert the current year in the following equation.
+    approximateNumberOfRevolutions_ = twoLineElementDatum.meanMotionInRevolutionsPerDay
+            * ( currentYear_ - twoLineElementDatum.fourDigitlaunchYear )
+            * physical_constants::JULIAN_YEAR_IN_DAYS;
+    approximateNumberOfRevolutionsRemainder_ = approximateNumberOfRevolutions_ % 100000;
+    lostNumberOfRevolutions_ = approximateNumberOfRevolutions_
+            - approximateNumberOfRevolutionsRemainder_;
 
-        // Semi-major axis of the object is calculated from the other TLE variables.
-        meanMotion_ = twoLineElementData_[ objectNumberCounter_ ].meanMotionInRevolutionsPerDay
-                * 2.0 * PI / physical_constants::JULIAN_DAY;
-        twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::semiMajorAxisIndex )
-                = orbital_element_conversions::
-                convertEllipticalMeanMotionToSemiMajorAxis(
-                    meanMotion_, earthWithWorldGeodeticSystem72GravitationalParameter );
-
-        // Perigee of the object is calculated from the other TLE variables.
-        twoLineElementData_[ objectNumberCounter_ ].perigee =
-                twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::semiMajorAxisIndex )
-                * ( 1.0 - twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                        orbital_element_conversions::eccentricityIndex ) );
-
-        // Apogee of the object is calculated from the other TLE variables.
-        twoLineElementData_[ objectNumberCounter_ ].apogee =
-                twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                    orbital_element_conversions::semiMajorAxisIndex )
-                * ( 1.0 + twoLineElementData_[ objectNumberCounter_ ].TLEKeplerianElements(
-                        orbital_element_conversions::eccentricityIndex ) );
-
-        // Increment object number counter by one.
-        objectNumberCounter_++;
+    // Check if the counter has been reset after passing 99999.
+    if ( ( twoLineElementDatum.revolutionNumber - approximateNumberOfRevolutionsRemainder_ ) <=
+         ( approximateNumberOfRevolutionsRemainder_ + 100000 - twoLineElementDatum.revolutionNumber ) )
+    {
+        twoLineElementDatum.totalRevolutionNumber = lostNumberOfRevolutions_ + twoLineElementDatum.revolutionNumber;
     }
+
+    else
+    {
+        twoLineElementDatum.totalRevolutionNumber =
+                lostNumberOfRevolutions_ - 100000 + twoLineElementDatum.revolutionNumber;
+    }
+
+    // Check if total number of revolutions is negative.
+    if ( twoLineElementDatum.totalRevolutionNumber < 0 )
+    {
+        twoLineElementDatum.totalRevolutionNumber = twoLineElementDatum.revolutionNumber;
+    }
+
+    // Semi-major axis of the object is calculated from the other TLE variables.
+    meanMotion_ = twoLineElementDatum.meanMotionInRevolutionsPerDay * 2.0 * PI / physical_constants::JULIAN_DAY;
+    twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex )
+            = orbital_element_conversions::convertEllipticalMeanMotionToSemiMajorAxis(
+                meanMotion_, earthWithWorldGeodeticSystem72GravitationalParameter );
+
+    // Perigee of the object is calculated from the other TLE variables.
+    twoLineElementDatum.perigee =
+            twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex )
+            * ( 1.0 - twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::eccentricityIndex ) );
+
+    // Apogee of the object is calculated from the other TLE variables.
+    twoLineElementDatum.apogee =
+            twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::semiMajorAxisIndex )
+            * ( 1.0 + twoLineElementDatum.TLEKeplerianElements( orbital_element_conversions::eccentricityIndex ) );
 }
 
 //! Checks the integrity of the TLE input file.
@@ -705,13 +757,26 @@ std::multimap< int, std::string > TwoLineElementsTextFileReader::checkTwoLineEle
         }
     }
 
-    // Erase all the corrupted TLEs from the TLE data vector.
-
-    for ( unsigned int q = 0; q < corruptedTwoLineElementDataPositions_.size( ); q++ )
+    // Erase all the corrupted TLEs from the TLE data vector, moving each remaining TLE forward at most once (the
+    // corrupted positions are in increasing order).
+    if ( !corruptedTwoLineElementDataPositions_.empty( ) )
     {
-        twoLineElementData_.erase( twoLineElementData_.begin( ) + (
-                                   corruptedTwoLineElementDataPositions_.at( q ) - q ) );
-        numberOfObjects_--;
+        unsigned int numberOfRetainedObjects = corruptedTwoLineElementDataPositions_.at( 0 );
+        unsigned int nextCorruptedIndex = 0;
+        for ( unsigned int i = numberOfRetainedObjects; i < numberOfObjects_; i++ )
+        {
+            if ( nextCorruptedIndex < corruptedTwoLineElementDataPositions_.size( ) &&
+                 static_cast< unsigned int >( corruptedTwoLineElementDataPositions_.at( nextCorruptedIndex ) ) == i )
+            {
+                nextCorruptedIndex++;
+            }
+            else
+            {
+                twoLineElementData_[ numberOfRetainedObjects++ ] = std::move( twoLineElementData_[ i ] );
+            }
+        }
+        twoLineElementData_.resize( numberOfRetainedObjects );
+        numberOfObjects_ = numberOfRetainedObjects;
     }
 
     // Return the amount of corrupted TLEs
@@ -217,7 +217,7 @@ public:
      * data retrieved from the catalog file and stored in objects.
      * \return TLE data stored in TwoLineElementData objects.
      */
-    std::vector< TwoLineElementData > getTwoLineElementData( ) { return twoLineElementData_; }
+    const std::vector< TwoLineElementData >& getTwoLineElementData( ) const { return twoLineElementData_; }
 
     //! Get number of objects.
     /*!
@@ -229,7 +229,8 @@ public:
     /*!
      * Converts strings read by TextFileReader to the variables contained in
      * their TLE format and stores their data according to their variable-type
-     * in the variables contained in this class.
+     * in the variables contained in this class. The data of different objects are converted
+     * concurrently.
      */
     void storeTwoLineElementData( );
 
@@ -306,6 +307,16 @@ protected:
 
 private:
 
+    //! Convert and store TLE data of a single object.
+    /*!
+     * Converts the strings of the TLE data of a single object to the variables contained in their TLE format, and
+     * stores them in the corresponding TwoLineElementData object. Called concurrently for different objects by
+     * storeTwoLineElementData( ).
+     * \param objectIndex Index of the object in the vector of TwoLineElementData objects.
+     * \param firstLineNumber Line number of the first line of the TLE data of the object.
+     */
+    void storeTwoLineElementDatum( const unsigned int objectIndex, const unsigned int firstLineNumber );
+
     //! Current year.
     unsigned int currentYear_;
 
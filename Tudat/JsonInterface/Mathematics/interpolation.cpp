@@ -120,6 +120,8 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ModelInterpolat
     jsonObject[ K::finalTime ] = modelInterpolationSettings->finalTime_;
     jsonObject[ K::timeStep ] = modelInterpolationSettings->timeStep_;
     jsonObject[ K::interpolator ] = modelInterpolationSettings->interpolatorSettings_;
+    jsonObject[ K::numberOfThreads ] = modelInterpolationSettings->numberOfThreads_;
+    jsonObject[ K::estimateInterpolationError ] = modelInterpolationSettings->estimateInterpolationError_;
 }
 
 //! Create a shared pointer to a `ModelInterpolationSettings` object from a `json` object.
@@ -133,7 +135,9 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< ModelInterpol
                 getValue( jsonObject, K::initialTime, defaults.initialTime_ ),
                 getValue( jsonObject, K::finalTime, defaults.finalTime_ ),
                 getValue( jsonObject, K::timeStep, defaults.timeStep_ ),
-                getValue( jsonObject, K::interpolator, defaults.interpolatorSettings_ ) );
+                getValue( jsonObject, K::interpolator, defaults.interpolatorSettings_ ),
+                getValue( jsonObject, K::numberOfThreads, defaults.numberOfThreads_ ),
+                getValue( jsonObject, K::estimateInterpolationError, defaults.estimateInterpolationError_ ) );
 }
 
 } // namespace simulation_setup
@@ -9,6 +9,12 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+
 #include "Tudat/JsonInterface/Propagation/export.h"
 
 namespace tudat
@@ -17,6 +23,57 @@ namespace tudat
 namespace json_interface
 {
 
+//! Identifier at start of columnar results file.
+static const char COLUMNAR_RESULTS_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'O', 'L' };
+
+//! Version of columnar results file format.
+static const boost::int32_t COLUMNAR_RESULTS_FILE_VERSION = 1;
+
+//! Function to determine whether the host stores numbers in little-endian byte order.
+static bool isHostLittleEndian( )
+{
+    const boost::uint16_t testValue = 1;
+    char firstByte;
+    std::memcpy( &firstByte, &testValue, 1 );
+    return firstByte == 1;
+}
+
+//! Function to write an array of values to a stream in little-endian byte order.
+template< typename ValueType >
+static void writeLittleEndian( std::ostream& outputStream, const ValueType* values, const std::size_t numberOfValues )
+{
+    if ( isHostLittleEndian( ) )
+    {
+        outputStream.write( reinterpret_cast< const char* >( values ), numberOfValues * sizeof( ValueType ) );
+    }
+    else
+    {
+        std::vector< char > swappedBytes( numberOfValues * sizeof( ValueType ) );
+        const char* originalBytes = reinterpret_cast< const char* >( values );
+        for ( std::size_t i = 0; i < numberOfValues; i++ )
+        {
+            std::reverse_copy( originalBytes + i * sizeof( ValueType ), originalBytes + ( i + 1 ) * sizeof( ValueType ),
+                               swappedBytes.begin( ) + i * sizeof( ValueType ) );
+        }
+        outputStream.write( swappedBytes.data( ), swappedBytes.size( ) );
+    }
+}
+
+//! Function to read an array of values, stored in little-endian byte order, from a stream.
+template< typename ValueType >
+static void readLittleEndian( std::istream& inputStream, ValueType* values, const std::size_t numberOfValues )
+{
+    inputStream.read( reinterpret_cast< char* >( values ), numberOfValues * sizeof( ValueType ) );
+    if ( !isHostLittleEndian( ) )
+    {
+        char* bytes = reinterpret_cast< char* >( values );
+        for ( std::size_t i = 0; i < numberOfValues; i++ )
+        {
+            std::reverse( bytes + i * sizeof( ValueType ), bytes + ( i + 1 ) * sizeof( ValueType ) );
+        }
+    }
+}
+
 //! Create a `json` object from a shared pointer to a `ExportSettings` object.
 void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ExportSettings >& exportSettings )
 {
@@ -34,6 +91,14 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ExportSettings
     jsonObject[ K::onlyFinalStep ] = exportSettings->onlyFinalStep_;
     jsonObject[ K::numericalPrecision ] = exportSettings->numericalPrecision_;
     jsonObject[ K::printVariableIndicesToTerminal ] = exportSettings->printVariableIndicesToTerminal_;
+    if ( exportSettings->format_ != text_export_format )
+    {
+        jsonObject[ K::format ] = exportSettings->format_;
+    }
+    if ( exportSettings->format_ == columnar_export_format )
+    {
+        jsonObject[ K::chunkSize ] = exportSettings->chunkSize_;
+    }
 }
 
 //! Create a shared pointer to a `ExportSettings` object from a `json` object.
@@ -51,7 +116,296 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< ExportSetting
     updateFromJSONIfDefined( exportSettings->onlyFinalStep_, jsonObject, K::onlyFinalStep );
     updateFromJSONIfDefined( exportSettings->numericalPrecision_, jsonObject, K::numericalPrecision );
     updateFromJSONIfDefined( exportSettings->printVariableIndicesToTerminal_, jsonObject, K::printVariableIndicesToTerminal );
+    updateFromJSONIfDefined( exportSettings->format_, jsonObject, K::format );
+    updateFromJSONIfDefined( exportSettings->chunkSize_, jsonObject, K::chunkSize );
+
+    if ( exportSettings->chunkSize_ == 0 )
+    {
+        throw std::runtime_error( "Error, chunk size of columnar export format must be positive." );
+    }
+}
+
+//! Constructor, opens the output file.
+BinaryResultsWriter::BinaryResultsWriter( const boost::filesystem::path& outputFile,
+                                          const std::vector< std::string >& columnNames ):
+    outputFile_( outputFile ), columnNames_( columnNames ), numberOfRows_( 0 )
+{
+    if ( !outputFile_.parent_path( ).empty( ) )
+    {
+        boost::filesystem::create_directories( outputFile_.parent_path( ) );
+    }
+    outputStream_.open( outputFile_.string( ).c_str( ), std::ios::binary );
+    if ( !outputStream_.good( ) )
+    {
+        throw std::runtime_error( "Error when opening binary results file " + outputFile_.string( ) );
+    }
+}
+
+//! Function to check that a row has the size of the results table.
+void BinaryResultsWriter::checkRowSize( const Eigen::VectorXd& row )
+{
+    if ( row.rows( ) != static_cast< int >( columnNames_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when writing row to binary results file " + outputFile_.string( ) +
+                                  ", row has " + boost::lexical_cast< std::string >( row.rows( ) ) +
+                                  " entries, but table has " +
+                                  boost::lexical_cast< std::string >( columnNames_.size( ) ) + " columns." );
+    }
+    if ( !outputStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing row to binary results file " + outputFile_.string( ) +
+                                  ", file was already closed." );
+    }
+}
+
+//! Destructor, closes the file if this was not done already.
+RawBinaryResultsWriter::~RawBinaryResultsWriter( )
+{
+    if ( outputStream_.is_open( ) )
+    {
+        try
+        {
+            close( );
+        }
+        catch( std::exception& caughtException )
+        {
+            std::cerr << caughtException.what( ) << std::endl;
+        }
+    }
+}
+
+//! Function to write a single row of the results table.
+void RawBinaryResultsWriter::writeRow( const Eigen::VectorXd& row )
+{
+    checkRowSize( row );
+    writeLittleEndian( outputStream_, row.data( ), row.rows( ) );
+    numberOfRows_++;
+}
+
+//! Function to close the output file, and write the sidecar file.
+void RawBinaryResultsWriter::close( )
+{
+    outputStream_.close( );
+    if ( outputStream_.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing binary results file " + outputFile_.string( ) );
+    }
+
+    nlohmann::json sidecarJsonObject;
+    sidecarJsonObject[ "format" ] = exportFileFormats.at( raw_binary_export_format );
+    sidecarJsonObject[ "dataType" ] = "float64";
+    sidecarJsonObject[ "byteOrder" ] = "littleEndian";
+    sidecarJsonObject[ "layout" ] = "rowMajor";
+    sidecarJsonObject[ "numberOfRows" ] = numberOfRows_;
+    sidecarJsonObject[ "numberOfColumns" ] = columnNames_.size( );
+    sidecarJsonObject[ "columns" ] = columnNames_;
+    if ( !header_.empty( ) )
+    {
+        sidecarJsonObject[ "header" ] = header_;
+    }
+
+    std::ofstream sidecarStream( getSidecarFile( outputFile_ ).string( ).c_str( ) );
+    sidecarStream << sidecarJsonObject.dump( 2 ) << std::endl;
+    if ( !sidecarStream.good( ) )
+    {
+        throw std::runtime_error( "Error when writing sidecar file of binary results file " + outputFile_.string( ) );
+    }
+}
+
+//! Constructor, opens the output file and writes the file header.
+ColumnarResultsWriter::ColumnarResultsWriter( const boost::filesystem::path& outputFile,
+                                              const std::vector< std::string >& columnNames,
+                                              const unsigned int chunkSize ):
+    BinaryResultsWriter( outputFile, columnNames ),
+    chunkBuffer_( Eigen::MatrixXd( std::max( chunkSize, 1U ), columnNames.size( ) ) ), numberOfRowsInChunk_( 0 )
+{
+    const boost::int32_t numberOfColumns = columnNames_.size( );
+    outputStream_.write( COLUMNAR_RESULTS_FILE_IDENTIFIER, 8 );
+    writeLittleEndian( outputStream_, &COLUMNAR_RESULTS_FILE_VERSION, 1 );
+    writeLittleEndian( outputStream_, &numberOfColumns, 1 );
+    for ( const std::string& columnName : columnNames_ )
+    {
+        const boost::int32_t nameLength = columnName.size( );
+        writeLittleEndian( outputStream_, &nameLength, 1 );
+        outputStream_.write( columnName.c_str( ), nameLength );
+    }
+}
+
+//! Destructor, closes the file if this was not done already.
+ColumnarResultsWriter::~ColumnarResultsWriter( )
+{
+    if ( outputStream_.is_open( ) )
+    {
+        try
+        {
+            close( );
+        }
+        catch( std::exception& caughtException )
+        {
+            std::cerr << caughtException.what( ) << std::endl;
+        }
+    }
+}
+
+//! Function to write a single row of the results table.
+void ColumnarResultsWriter::writeRow( const Eigen::VectorXd& row )
+{
+    checkRowSize( row );
+    chunkBuffer_.row( numberOfRowsInChunk_++ ) = row.transpose( );
+    numberOfRows_++;
+    if ( numberOfRowsInChunk_ == chunkBuffer_.rows( ) )
+    {
+        writeChunk( );
+    }
+}
+
+//! Function to write the last (partial) chunk and close the output file.
+void ColumnarResultsWriter::close( )
+{
+    if ( numberOfRowsInChunk_ > 0 )
+    {
+        writeChunk( );
+    }
+    outputStream_.close( );
+    if ( outputStream_.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing columnar results file " + outputFile_.string( ) );
+    }
+}
+
+//! Function to write the buffered rows as a chunk.
+void ColumnarResultsWriter::writeChunk( )
+{
+    const boost::int64_t numberOfRowsToWrite = numberOfRowsInChunk_;
+    writeLittleEndian( outputStream_, &numberOfRowsToWrite, 1 );
+    for ( int i = 0; i < chunkBuffer_.cols( ); i++ )
+    {
+        writeLittleEndian( outputStream_, chunkBuffer_.col( i ).data( ), numberOfRowsInChunk_ );
+    }
+    numberOfRowsInChunk_ = 0;
+}
+
+//! Function to create a binary results writer according to the format in the export settings.
+std::shared_ptr< BinaryResultsWriter > createBinaryResultsWriter(
+        const std::shared_ptr< ExportSettings > exportSettings, const std::vector< std::string >& columnNames )
+{
+    switch ( exportSettings->format_ )
+    {
+    case raw_binary_export_format:
+        return std::make_shared< RawBinaryResultsWriter >(
+                    exportSettings->outputFile_, columnNames, exportSettings->header_ );
+    case columnar_export_format:
+        return std::make_shared< ColumnarResultsWriter >(
+                    exportSettings->outputFile_, columnNames, exportSettings->chunkSize_ );
+    default:
+        throw std::runtime_error( "Error, export format " +
+                                  boost::lexical_cast< std::string >( exportSettings->format_ ) +
+                                  " is not a binary format." );
+    }
+}
+
+//! Function to read a results table written by a RawBinaryResultsWriter.
+Eigen::MatrixXd readRawBinaryResultsFile( const boost::filesystem::path& inputFile,
+                                          std::vector< std::string >& columnNames )
+{
+    std::ifstream sidecarStream( RawBinaryResultsWriter::getSidecarFile( inputFile ).string( ).c_str( ) );
+    if ( !sidecarStream.good( ) )
+    {
+        throw std::runtime_error( "Error when opening sidecar file of binary results file " + inputFile.string( ) );
+    }
+    const nlohmann::json sidecarJsonObject = nlohmann::json::parse( sidecarStream );
+    columnNames = sidecarJsonObject.at( "columns" ).get< std::vector< std::string > >( );
+    const long long numberOfRows = sidecarJsonObject.at( "numberOfRows" ).get< long long >( );
+
+    std::ifstream inputStream( inputFile.string( ).c_str( ), std::ios::binary );
+    typedef Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > RowMajorMatrix;
+    RowMajorMatrix results( numberOfRows, columnNames.size( ) );
+    readLittleEndian( inputStream, results.data( ), results.size( ) );
+    if ( !inputStream.good( ) )
+    {
+        throw std::runtime_error( "Error when reading binary results file " + inputFile.string( ) );
+    }
+    return results;
+}
+
+//! Function to read a results table written by a ColumnarResultsWriter.
+Eigen::MatrixXd readColumnarResultsFile( const boost::filesystem::path& inputFile,
+                                         std::vector< std::string >& columnNames )
+{
+    std::ifstream inputStream( inputFile.string( ).c_str( ), std::ios::binary );
+    if ( !inputStream.good( ) )
+    {
+        throw std::runtime_error( "Error when opening columnar results file " + inputFile.string( ) );
+    }
+
+    // Read and check file header.
+    char fileIdentifier[ 8 ];
+    boost::int32_t fileVersion, numberOfColumns;
+    inputStream.read( fileIdentifier, 8 );
+    readLittleEndian( inputStream, &fileVersion, 1 );
+    readLittleEndian( inputStream, &numberOfColumns, 1 );
+    if ( !inputStream.good( ) || std::memcmp( fileIdentifier, COLUMNAR_RESULTS_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error, file " + inputFile.string( ) + " is not a columnar results file" );
+    }
+    else if ( fileVersion != COLUMNAR_RESULTS_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error, columnar results file version " +
+                                  boost::lexical_cast< std::string >( fileVersion ) + " not supported" );
+    }
 
+    columnNames.resize( numberOfColumns );
+    for ( int i = 0; i < numberOfColumns; i++ )
+    {
+        boost::int32_t nameLength;
+        readLittleEndian( inputStream, &nameLength, 1 );
+        columnNames[ i ].resize( nameLength );
+        inputStream.read( &columnNames[ i ][ 0 ], nameLength );
+    }
+
+    // Read chunks.
+    std::vector< Eigen::MatrixXd > chunks;
+    long long numberOfRows = 0;
+    boost::int64_t numberOfRowsInChunk;
+    while ( inputStream.peek( ) != std::char_traits< char >::eof( ) )
+    {
+        readLittleEndian( inputStream, &numberOfRowsInChunk, 1 );
+        Eigen::MatrixXd chunk( numberOfRowsInChunk, numberOfColumns );
+        readLittleEndian( inputStream, chunk.data( ), chunk.size( ) );
+        if ( !inputStream.good( ) )
+        {
+            throw std::runtime_error( "Error when reading chunk from columnar results file " + inputFile.string( ) );
+        }
+        numberOfRows += numberOfRowsInChunk;
+        chunks.push_back( chunk );
+    }
+
+    Eigen::MatrixXd results( numberOfRows, numberOfColumns );
+    long long currentRow = 0;
+    for ( const Eigen::MatrixXd& chunk : chunks )
+    {
+        results.block( currentRow, 0, chunk.rows( ), numberOfColumns ) = chunk;
+        currentRow += chunk.rows( );
+    }
+    return results;
+}
+
+//! Function to get the names of the columns in which a variable is exported.
+std::vector< std::string > getExportColumnNames( const std::string& variableId, const unsigned int variableSize )
+{
+    std::vector< std::string > columnNames;
+    if ( variableSize == 1 )
+    {
+        columnNames.push_back( variableId );
+    }
+    else
+    {
+        for ( unsigned int i = 0; i < variableSize; i++ )
+        {
+            columnNames.push_back( variableId + " [" + std::to_string( i ) + "]" );
+        }
+    }
+    return columnNames;
 }
 
 } // namespace simulation_setup
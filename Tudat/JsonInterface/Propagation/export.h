@@ -24,6 +24,37 @@ namespace tudat
 namespace json_interface
 {
 
+//! Formats of the files to which results can be exported.
+enum ExportFileFormat
+{
+    text_export_format,
+    raw_binary_export_format,
+    columnar_export_format
+};
+
+//! Map of `ExportFileFormat` string representations.
+static std::map< ExportFileFormat, std::string > exportFileFormats =
+{
+    { text_export_format, "text" },
+    { raw_binary_export_format, "rawBinary" },
+    { columnar_export_format, "columnar" }
+};
+
+//! `ExportFileFormat`s not supported by `json_interface`.
+static std::vector< ExportFileFormat > unsupportedExportFileFormats = { };
+
+//! Convert `ExportFileFormat` to `json`.
+inline void to_json( nlohmann::json& jsonObject, const ExportFileFormat& exportFileFormat )
+{
+    jsonObject = json_interface::stringFromEnum( exportFileFormat, exportFileFormats );
+}
+
+//! Convert `json` to `ExportFileFormat`.
+inline void from_json( const nlohmann::json& jsonObject, ExportFileFormat& exportFileFormat )
+{
+    exportFileFormat = json_interface::enumFromString( jsonObject, exportFileFormats );
+}
+
 class ExportSettings
 {
 public:
@@ -67,8 +98,192 @@ public:
     //! Whether to show, in the terminal, the indices in the output vector where variables are saved
     bool printVariableIndicesToTerminal_ = false;
 
+    //! Format of the output file.
+    //! For binary formats, the header and numerical precision are not used (values are stored as 64-bit doubles).
+    ExportFileFormat format_ = text_export_format;
+
+    //! Number of rows per chunk for the columnar format.
+    unsigned int chunkSize_ = 4096;
+
+};
+
+//! Base class for writing a results table to a binary file, one row at a time.
+/*!
+ *  Base class for writing a results table to a binary file, one row at a time, such that the results do not have to be
+ *  collected in memory before being written. All numbers are written in little-endian byte order.
+ */
+class BinaryResultsWriter
+{
+public:
+    //! Constructor, opens the output file.
+    /*!
+     *  Constructor, opens the output file.
+     *  \param outputFile Path of the output file.
+     *  \param columnNames Names of the columns of the results table.
+     */
+    BinaryResultsWriter( const boost::filesystem::path& outputFile, const std::vector< std::string >& columnNames );
+
+    //! Destructor.
+    virtual ~BinaryResultsWriter( ) { }
+
+    //! Function to write a single row of the results table.
+    /*!
+     *  Function to write a single row of the results table.
+     *  \param row Values of the row, the size of which must be equal to the number of columns.
+     */
+    virtual void writeRow( const Eigen::VectorXd& row ) = 0;
+
+    //! Function to write any buffered data and close the output file.
+    virtual void close( ) = 0;
+
+    //! Function to retrieve the number of rows written so far.
+    long long getNumberOfRows( )
+    {
+        return numberOfRows_;
+    }
+
+protected:
+
+    //! Function to check that a row has the size of the results table.
+    void checkRowSize( const Eigen::VectorXd& row );
+
+    //! Path of the output file.
+    boost::filesystem::path outputFile_;
+
+    //! Names of the columns of the results table.
+    std::vector< std::string > columnNames_;
+
+    //! Stream to the output file.
+    std::ofstream outputStream_;
+
+    //! Number of rows written so far.
+    long long numberOfRows_;
+};
+
+//! Class for writing a results table to a raw binary file, with a JSON sidecar file describing its contents.
+/*!
+ *  Class for writing a results table to a raw binary file, which contains the values of the table as a row-major array
+ *  of little-endian 64-bit doubles, without any header. When closing the writer, the file `<outputFile>.json` is
+ *  written, containing the format, data type, byte order, layout, number of rows and columns, column names and header.
+ */
+class RawBinaryResultsWriter: public BinaryResultsWriter
+{
+public:
+    //! Constructor.
+    /*!
+     *  Constructor, opens the output file.
+     *  \param outputFile Path of the output file.
+     *  \param columnNames Names of the columns of the results table.
+     *  \param header Header to be included in the sidecar file (not written if empty).
+     */
+    RawBinaryResultsWriter( const boost::filesystem::path& outputFile, const std::vector< std::string >& columnNames,
+                            const std::string& header = "" ):
+        BinaryResultsWriter( outputFile, columnNames ), header_( header ) { }
+
+    //! Destructor, closes the file if this was not done already.
+    ~RawBinaryResultsWriter( );
+
+    //! Function to write a single row of the results table.
+    void writeRow( const Eigen::VectorXd& row );
+
+    //! Function to close the output file, and write the sidecar file.
+    void close( );
+
+    //! Function to retrieve the path of the sidecar file of a raw binary results file.
+    static boost::filesystem::path getSidecarFile( const boost::filesystem::path& outputFile )
+    {
+        return outputFile.string( ) + ".json";
+    }
+
+private:
+
+    //! Header to be included in the sidecar file.
+    std::string header_;
+};
+
+//! Class for writing a results table to a chunked columnar binary file.
+/*!
+ *  Class for writing a results table to a chunked columnar binary file. The file starts with the identifier
+ *  "TUDATCOL", the (32-bit integer) format version and number of columns, and the length and characters of each
+ *  column name. Then, chunks of (at most) chunkSize rows follow, each consisting of its (64-bit integer) number of
+ *  rows followed by the values of each column (64-bit doubles), one column after the other. All numbers are stored
+ *  little-endian. Rows are buffered until a chunk is full, such that a single column of a large table can be read
+ *  without reading the other columns.
+ */
+class ColumnarResultsWriter: public BinaryResultsWriter
+{
+public:
+    //! Constructor.
+    /*!
+     *  Constructor, opens the output file and writes the file header.
+     *  \param outputFile Path of the output file.
+     *  \param columnNames Names of the columns of the results table.
+     *  \param chunkSize Maximum number of rows per chunk.
+     */
+    ColumnarResultsWriter( const boost::filesystem::path& outputFile, const std::vector< std::string >& columnNames,
+                           const unsigned int chunkSize = 4096 );
+
+    //! Destructor, closes the file if this was not done already.
+    ~ColumnarResultsWriter( );
+
+    //! Function to write a single row of the results table.
+    void writeRow( const Eigen::VectorXd& row );
+
+    //! Function to write the last (partial) chunk and close the output file.
+    void close( );
+
+private:
+
+    //! Function to write the buffered rows as a chunk.
+    void writeChunk( );
+
+    //! Buffer of rows of current chunk (column-major, such that each column is contiguous).
+    Eigen::MatrixXd chunkBuffer_;
+
+    //! Number of rows in current chunk.
+    int numberOfRowsInChunk_;
 };
 
+//! Function to create a binary results writer according to the format in the export settings.
+/*!
+ *  Function to create a binary results writer according to the format in the export settings.
+ *  \param exportSettings Export settings, the format of which must be a binary format.
+ *  \param columnNames Names of the columns of the results table.
+ *  \return Binary results writer.
+ */
+std::shared_ptr< BinaryResultsWriter > createBinaryResultsWriter(
+        const std::shared_ptr< ExportSettings > exportSettings, const std::vector< std::string >& columnNames );
+
+//! Function to read a results table written by a RawBinaryResultsWriter.
+/*!
+ *  Function to read a results table written by a RawBinaryResultsWriter, using the contents of its sidecar file.
+ *  \param inputFile Path of the raw binary file.
+ *  \param columnNames Names of the columns of the results table (returned by reference).
+ *  \return Results table.
+ */
+Eigen::MatrixXd readRawBinaryResultsFile( const boost::filesystem::path& inputFile,
+                                          std::vector< std::string >& columnNames );
+
+//! Function to read a results table written by a ColumnarResultsWriter.
+/*!
+ *  Function to read a results table written by a ColumnarResultsWriter.
+ *  \param inputFile Path of the columnar file.
+ *  \param columnNames Names of the columns of the results table (returned by reference).
+ *  \return Results table.
+ */
+Eigen::MatrixXd readColumnarResultsFile( const boost::filesystem::path& inputFile,
+                                         std::vector< std::string >& columnNames );
+
+//! Function to get the names of the columns in which a variable is exported.
+/*!
+ *  Function to get the names of the columns in which a variable is exported.
+ *  \param variableId Identifier of the variable.
+ *  \param variableSize Number of columns of the variable.
+ *  \return Names of the columns: the identifier for single-column variables, or the identifier followed by the
+ *  index in square brackets otherwise.
+ */
+std::vector< std::string > getExportColumnNames( const std::string& variableId, const unsigned int variableSize );
+
 //! Create a `json` object from a shared pointer to a `ExportSettings` object.
 void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ExportSettings >& saveSettings );
 
@@ -106,6 +321,11 @@ void exportResultsOfDynamicsSimulator(
         std::vector< std::shared_ptr< VariableSettings > > variables;
         std::vector< unsigned int > variableSizes;
         std::vector< unsigned int > variableIndices;
+        std::vector< std::string > columnNames;
+        if ( exportSettings->epochsInFirstColumn_ )
+        {
+            columnNames.push_back( "epoch" );
+        }
 
         // Determine number of columns (not including first column = epoch).
         unsigned int cols = 0;
@@ -201,6 +421,10 @@ void exportResultsOfDynamicsSimulator(
                 variableSizes.push_back( variableSize );
                 variableIndices.push_back( variableIndex );
 
+                const std::vector< std::string > variableColumnNames =
+                        getExportColumnNames( getVariableId( variable ), variableSize );
+                columnNames.insert( columnNames.end( ), variableColumnNames.begin( ), variableColumnNames.end( ) );
+
                 if( exportSettings->printVariableIndicesToTerminal_ )
                 {
                     std::cout<<cols<<", "<<getVariableId( variable )<<std::endl;
@@ -215,6 +439,15 @@ void exportResultsOfDynamicsSimulator(
             std::cout<<std::endl;
         }
 
+        // For binary formats, write each row directly instead of collecting all results.
+        std::shared_ptr< BinaryResultsWriter > binaryResultsWriter;
+        if ( exportSettings->format_ != text_export_format )
+        {
+            binaryResultsWriter = createBinaryResultsWriter( exportSettings, columnNames );
+        }
+        Eigen::VectorXd binaryRow( columnNames.size( ) );
+        const unsigned int firstVariableColumn = exportSettings->epochsInFirstColumn_ ? 1 : 0;
+
         // Concatenate requested results
         std::map< TimeType, Eigen::VectorXd > results;
         for ( auto it = statesHistory.begin( ); it != statesHistory.end( ); ++it )
@@ -276,10 +509,27 @@ void exportResultsOfDynamicsSimulator(
 
                 currentIndex += variableSize;
             }
-            results[ epoch ] = result;
+
+            if ( binaryResultsWriter != nullptr )
+            {
+                if ( exportSettings->epochsInFirstColumn_ )
+                {
+                    binaryRow( 0 ) = static_cast< double >( epoch );
+                }
+                binaryRow.segment( firstVariableColumn, cols ) = result;
+                binaryResultsWriter->writeRow( binaryRow );
+            }
+            else
+            {
+                results[ epoch ] = result;
+            }
         }
 
-        if ( exportSettings->epochsInFirstColumn_ )
+        if ( binaryResultsWriter != nullptr )
+        {
+            binaryResultsWriter->close( );
+        }
+        else if ( exportSettings->epochsInFirstColumn_ )
         {
             // Write results map to file.
             writeDataMapToTextFile( results,
@@ -305,6 +555,66 @@ void exportResultsOfDynamicsSimulator(
     }
 }
 
+//! Export a history of matrices to a binary file, according to the format specified in \p exportSettings.
+/*!
+ * Export a history of matrices to a binary file, according to the format specified in \p exportSettings. Each row of the
+ * exported table contains (optionally) the epoch followed by the entries of the matrix at that epoch, row after row.
+ * \param matrixHistory History of matrices to export.
+ * \param variableId Identifier of the exported variable, used to generate the column names.
+ * \param exportSettings Export settings, the format of which must be a binary format.
+ */
+template< typename TimeType = double >
+void exportMatrixHistoryToBinaryFile(
+        const std::map< TimeType, Eigen::MatrixXd >& matrixHistory,
+        const std::string& variableId,
+        const std::shared_ptr< ExportSettings > exportSettings )
+{
+    if ( matrixHistory.empty( ) )
+    {
+        return;
+    }
+    const int rows = matrixHistory.begin( )->second.rows( );
+    const int cols = matrixHistory.begin( )->second.cols( );
+
+    std::vector< std::string > columnNames;
+    if ( exportSettings->epochsInFirstColumn_ )
+    {
+        columnNames.push_back( "epoch" );
+    }
+    for ( int i = 0; i < rows; i++ )
+    {
+        for ( int j = 0; j < cols; j++ )
+        {
+            columnNames.push_back( variableId + " [" + std::to_string( i ) + "," + std::to_string( j ) + "]" );
+        }
+    }
+
+    const int firstMatrixColumn = exportSettings->epochsInFirstColumn_ ? 1 : 0;
+    std::shared_ptr< BinaryResultsWriter > binaryResultsWriter =
+            createBinaryResultsWriter( exportSettings, columnNames );
+    Eigen::VectorXd row( columnNames.size( ) );
+    for ( auto it = matrixHistory.begin( ); it != matrixHistory.end( ); ++it )
+    {
+        if ( ( exportSettings->onlyInitialStep_ || exportSettings->onlyFinalStep_ ) &&
+             !( exportSettings->onlyInitialStep_ && it == matrixHistory.begin( ) ) &&
+             !( exportSettings->onlyFinalStep_ && it == --matrixHistory.end( ) ) )
+        {
+            continue;
+        }
+
+        if ( exportSettings->epochsInFirstColumn_ )
+        {
+            row( 0 ) = static_cast< double >( it->first );
+        }
+        for ( int i = 0; i < rows; i++ )
+        {
+            row.segment( firstMatrixColumn + i * cols, cols ) = it->second.row( i ).transpose( );
+        }
+        binaryResultsWriter->writeRow( row );
+    }
+    binaryResultsWriter->close( );
+}
+
 template< typename StateScalarType = double, typename TimeType = double >
 void exportResultsOfVariationalEquations(
         const std::shared_ptr< propagators::SingleArcVariationalEquationsSolver< StateScalarType, TimeType > > variationalEquationsSolver,
@@ -317,6 +627,16 @@ void exportResultsOfVariationalEquations(
     {
         for ( std::shared_ptr< VariableSettings > variable : exportSettings->variables_ )
         {
+            if ( exportSettings->format_ != text_export_format &&
+                 ( variable->variableType_ == stateTransitionMatrix || variable->variableType_ == sensitivityMatrix ) )
+            {
+                exportMatrixHistoryToBinaryFile(
+                            variationalEquationsSolver->getNumericalVariationalEquationsSolution( ).at(
+                                variable->variableType_ == stateTransitionMatrix ? 0 : 1 ),
+                            getVariableId( variable ), exportSettings );
+                continue;
+            }
+
             switch ( variable->variableType_ )
             {
             case stateTransitionMatrix:
@@ -467,6 +467,8 @@ const std::string Keys::Interpolation::ModelInterpolation::initialTime = "initia
 const std::string Keys::Interpolation::ModelInterpolation::finalTime = "finalTime";
 const std::string Keys::Interpolation::ModelInterpolation::timeStep = "timeStep";
 const std::string Keys::Interpolation::ModelInterpolation::interpolator = "interpolator";
+const std::string Keys::Interpolation::ModelInterpolation::numberOfThreads = "numberOfThreads";
+const std::string Keys::Interpolation::ModelInterpolation::estimateInterpolationError = "estimateInterpolationError";
 
 
 //  Export
@@ -479,6 +481,8 @@ const std::string Keys::Export::onlyInitialStep = "onlyInitialStep";
 const std::string Keys::Export::onlyFinalStep = "onlyFinalStep";
 const std::string Keys::Export::numericalPrecision = "numericalPrecision";
 const std::string Keys::Export::printVariableIndicesToTerminal = "printVariableIndicesToTerminal";
+const std::string Keys::Export::format = "format";
+const std::string Keys::Export::chunkSize = "chunkSize";
 
 //  Options
 const std::string Keys::options = "options";
@@ -504,6 +504,8 @@ struct Keys
             static const std::string finalTime;
             static const std::string timeStep;
             static const std::string interpolator;
+            static const std::string numberOfThreads;
+            static const std::string estimateInterpolationError;
         };
     };
 
@@ -518,6 +520,8 @@ struct Keys
         static const std::string onlyFinalStep;
         static const std::string numericalPrecision;
         static const std::string printVariableIndicesToTerminal;
+        static const std::string format;
+        static const std::string chunkSize;
     };
 
     static const std::string options;
@@ -115,8 +115,9 @@ ExceptionResponseType getResponseToEvent( const nlohmann::json& jsonObject, cons
 // ACCESS HISTORY
 
 //! Global variable containing all the key paths that were accessed since clearAccessHistory() was called for the
-//! last time (or since this variable was initialized).
-extern std::set< KeyPath > accessedKeyPaths;
+//! last time (or since this variable was initialized). Each thread has its own access history, so that settings can be
+//! parsed concurrently on different threads.
+extern thread_local std::set< KeyPath > accessedKeyPaths;
 
 //! Clear the global variable accessedKeyPaths.
 /*!
@@ -0,0 +1,173 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#include "Tudat/JsonInterface/UnitTests/unitTestSupport.h"
+#include "Tudat/JsonInterface/jsonInterface.h"
+#include "Tudat/JsonInterface/jsonBatchInterface.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+#define INPUT( filename ) \
+    ( json_interface::inputDirectory( ) / boost::filesystem::path( __FILE__ ).stem( ) / filename ).string( )
+
+BOOST_AUTO_TEST_SUITE( test_json_batchSimulation )
+
+BOOST_AUTO_TEST_CASE( test_json_batchSimulation_main )
+{
+    using namespace json_interface;
+
+    // Read base configuration.
+    const nlohmann::json baseJsonObject = getDeserializedJSON( getPathForJSONFile( INPUT( "main" ) ) );
+
+    // Define variations.
+    std::vector< nlohmann::json > patches;
+
+    // Unmodified base configuration.
+    patches.push_back( nlohmann::json::object( ) );
+
+    // Modified initial state, defined using key paths (environment can be reused).
+    nlohmann::json eccentricityPatch;
+    eccentricityPatch[ "bodies.asterix.initialState.eccentricity" ] = 0.2;
+    patches.push_back( eccentricityPatch );
+
+    // Modified step size, defined using a JSON Patch (environment can be reused).
+    patches.push_back( nlohmann::json::parse(
+                           "[ { \"op\": \"replace\", \"path\": \"/integrator/stepSize\", \"value\": 20 } ]" ) );
+
+    // Modified gravitational parameter of the Earth (environment has to be recreated).
+    nlohmann::json gravitationalParameterPatch;
+    gravitationalParameterPatch[ "bodies.Earth.gravityField.gravitationalParameter" ] = 4.0E14;
+    patches.push_back( gravitationalParameterPatch );
+
+    // Invalid integrator type (setup fails, batch continues).
+    nlohmann::json invalidPatch;
+    invalidPatch[ "integrator.type" ] = "unknownIntegrator";
+    patches.push_back( invalidPatch );
+
+    // Modified initial state for modified environment (environment can be reused).
+    nlohmann::json combinedPatch = gravitationalParameterPatch;
+    combinedPatch[ "bodies.asterix.initialState.eccentricity" ] = 0.3;
+    patches.push_back( combinedPatch );
+
+    // Run batch using a single thread, such that the variations are run in order by a single simulation manager.
+    const std::string singleThreadOutputFile =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "batchSimulation-%%%%-%%%%.bin" ) ).string( );
+    JsonBatchSimulationManager< > singleThreadBatchSimulation( baseJsonObject, patches, 1 );
+    singleThreadBatchSimulation.runSimulations( singleThreadOutputFile );
+    BOOST_CHECK_EQUAL( singleThreadBatchSimulation.getNumberOfEnvironmentCreations( ), 2 );
+    BOOST_CHECK_EQUAL( singleThreadBatchSimulation.getNumberOfFailedVariations( ), 1 );
+
+    // Check that environment is not reused if the settings of the acceleration models (which modify the bodies) differ.
+    {
+        nlohmann::json accelerationPatch;
+        accelerationPatch[ "propagators" ] = baseJsonObject.at( "propagators" );
+        accelerationPatch[ "propagators" ][ 0 ][ "accelerations" ][ "asterix" ][ "Earth" ][ 0 ][ "type" ] =
+                "sphericalHarmonicGravity";
+        BOOST_CHECK( getEnvironmentSettings( getPatchedJsonObject( baseJsonObject, accelerationPatch ) ) !=
+                     getEnvironmentSettings( baseJsonObject ) );
+
+        nlohmann::json initialStatePatch;
+        initialStatePatch[ "propagators" ] = baseJsonObject.at( "propagators" );
+        initialStatePatch[ "propagators" ][ 0 ][ "initialStates" ] = { 7.5E6, 0.0, 0.0, 0.0, 7.5E3, 0.0 };
+        BOOST_CHECK( getEnvironmentSettings( getPatchedJsonObject( baseJsonObject, initialStatePatch ) ) ==
+                     getEnvironmentSettings( baseJsonObject ) );
+    }
+
+    // Check that environment is reused after a variation of which the setup failed.
+    {
+        JsonVariationSimulationManager< > variationSimulation(
+                    getPatchedJsonObject( baseJsonObject, patches.at( 3 ) ) );
+        variationSimulation.updateSettings( );
+        BOOST_CHECK( !variationSimulation.isEnvironmentReused( ) );
+
+        variationSimulation.resetJsonObject( getPatchedJsonObject( baseJsonObject, patches.at( 4 ) ) );
+        BOOST_CHECK_THROW( variationSimulation.updateSettings( ), std::exception );
+
+        variationSimulation.resetJsonObject( getPatchedJsonObject( baseJsonObject, patches.at( 5 ) ) );
+        variationSimulation.updateSettings( );
+        BOOST_CHECK( variationSimulation.isEnvironmentReused( ) );
+    }
+
+    const std::map< int, BatchSimulationResult > batchResults = readBatchSimulationResults( singleThreadOutputFile );
+    BOOST_CHECK_EQUAL( batchResults.size( ), patches.size( ) );
+
+    // Compare to results of individual simulations.
+    const std::vector< unsigned int > indices = { 0, 3 };
+    const std::vector< unsigned int > sizes = { 3, 3 };
+    for( unsigned int i = 0; i < patches.size( ); i++ )
+    {
+        const BatchSimulationResult& batchResult = batchResults.at( i );
+        if( i == 4 )
+        {
+            BOOST_CHECK_EQUAL( batchResult.status, batch_simulation_setup_failed );
+            BOOST_CHECK( !batchResult.errorMessage.empty( ) );
+            BOOST_CHECK( batchResult.stateHistory.empty( ) );
+            continue;
+        }
+
+        BOOST_CHECK_EQUAL( batchResult.status, batch_simulation_successful );
+
+        JsonSimulationManager< > jsonSimulation( getPatchedJsonObject( baseJsonObject, patches.at( i ) ) );
+        jsonSimulation.updateSettings( );
+        jsonSimulation.runPropagation( );
+        const std::map< double, Eigen::VectorXd > stateHistory =
+                jsonSimulation.getDynamicsSimulator( )->getEquationsOfMotionNumericalSolution( );
+        const std::map< double, Eigen::VectorXd > dependentVariableHistory =
+                jsonSimulation.getDynamicsSimulator( )->getDependentVariableHistory( );
+
+        BOOST_CHECK_EQUAL( batchResult.stateHistory.size( ), stateHistory.size( ) );
+        BOOST_CHECK_EQUAL( batchResult.dependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+        BOOST_CHECK( !batchResult.dependentVariableHistory.empty( ) );
+        BOOST_CHECK_CLOSE_INTEGRATION_RESULTS( batchResult.stateHistory, stateHistory, indices, sizes, 1.0E-15 );
+        BOOST_CHECK_CLOSE_INTEGRATION_RESULTS( batchResult.dependentVariableHistory, dependentVariableHistory,
+                                               { 0 }, { 1 }, 1.0E-15 );
+    }
+
+    // Run batch using multiple threads, and compare to single-thread results.
+    const std::string multipleThreadsOutputFile =
+            ( boost::filesystem::temp_directory_path( ) /
+              boost::filesystem::unique_path( "batchSimulation-%%%%-%%%%.bin" ) ).string( );
+    JsonBatchSimulationManager< > multipleThreadsBatchSimulation( baseJsonObject, patches, 3 );
+    multipleThreadsBatchSimulation.runSimulations( multipleThreadsOutputFile );
+    BOOST_CHECK_LE( multipleThreadsBatchSimulation.getNumberOfEnvironmentCreations( ), 5 );
+    BOOST_CHECK_EQUAL( multipleThreadsBatchSimulation.getNumberOfFailedVariations( ), 1 );
+
+    const std::map< int, BatchSimulationResult > multipleThreadsBatchResults =
+            readBatchSimulationResults( multipleThreadsOutputFile );
+    BOOST_CHECK_EQUAL( multipleThreadsBatchResults.size( ), patches.size( ) );
+    for( unsigned int i = 0; i < patches.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( multipleThreadsBatchResults.at( i ).status, batchResults.at( i ).status );
+        BOOST_CHECK_EQUAL( multipleThreadsBatchResults.at( i ).stateHistory.size( ),
+                           batchResults.at( i ).stateHistory.size( ) );
+        if( !batchResults.at( i ).stateHistory.empty( ) )
+        {
+            BOOST_CHECK_CLOSE_INTEGRATION_RESULTS( multipleThreadsBatchResults.at( i ).stateHistory,
+                                                   batchResults.at( i ).stateHistory, indices, sizes, 1.0E-15 );
+        }
+    }
+
+    boost::filesystem::remove( singleThreadOutputFile );
+    boost::filesystem::remove( multipleThreadsOutputFile );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -77,6 +77,84 @@ BOOST_AUTO_TEST_CASE( test_json_export_partial_result )
     BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
 }
 
+// Test 3: columnar result
+BOOST_AUTO_TEST_CASE( test_json_export_columnar_result )
+{
+    using namespace tudat::propagators;
+    using namespace tudat::json_interface;
+
+    // Create ExportSettings from JSON file
+    const std::shared_ptr< ExportSettings > fromFileSettings =
+            parseJSONFile< std::shared_ptr< ExportSettings > >( INPUT( "columnarResult" ) );
+
+    // Create ExportSettings manually
+    const std::string outputFile = "columnar.bin";
+    const std::vector< std::shared_ptr< VariableSettings > > variables =
+    {
+        std::make_shared< VariableSettings >( stateVariable )
+    };
+    std::shared_ptr< ExportSettings > manualSettings =
+            std::make_shared< ExportSettings >( outputFile, variables );
+    manualSettings->format_ = columnar_export_format;
+    manualSettings->chunkSize_ = 100;
+
+    // Compare
+    BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
+}
+
+// Test 4: writing and reading binary files
+BOOST_AUTO_TEST_CASE( test_json_export_binary_files )
+{
+    using namespace tudat::json_interface;
+
+    const std::vector< std::string > columnNames = { "epoch", "position [0]", "position [1]", "position [2]" };
+    const Eigen::MatrixXd results = Eigen::MatrixXd::Random( 250, columnNames.size( ) );
+
+    const boost::filesystem::path rawOutputFile =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "export-%%%%-%%%%.bin" );
+    const boost::filesystem::path columnarOutputFile =
+            boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( "export-%%%%-%%%%.col" );
+
+    // Write results row by row (number of rows is not a multiple of the chunk size)
+    {
+        RawBinaryResultsWriter rawWriter( rawOutputFile, columnNames, "Foo" );
+        ColumnarResultsWriter columnarWriter( columnarOutputFile, columnNames, 64 );
+        for ( int i = 0; i < results.rows( ); i++ )
+        {
+            rawWriter.writeRow( results.row( i ).transpose( ) );
+            columnarWriter.writeRow( results.row( i ).transpose( ) );
+        }
+        rawWriter.close( );
+        BOOST_CHECK_EQUAL( rawWriter.getNumberOfRows( ), results.rows( ) );
+        BOOST_CHECK_THROW( rawWriter.writeRow( results.row( 0 ).transpose( ) ), std::runtime_error );
+        BOOST_CHECK_THROW( columnarWriter.writeRow( Eigen::VectorXd::Zero( 2 ) ), std::runtime_error );
+
+        // Columnar writer is closed by its destructor
+    }
+
+    // Check sidecar file
+    const nlohmann::json sidecar = readJSON( RawBinaryResultsWriter::getSidecarFile( rawOutputFile ) );
+    BOOST_CHECK_EQUAL( sidecar.at( "format" ).get< std::string >( ), "rawBinary" );
+    BOOST_CHECK_EQUAL( sidecar.at( "numberOfRows" ).get< int >( ), results.rows( ) );
+    BOOST_CHECK_EQUAL( sidecar.at( "header" ).get< std::string >( ), "Foo" );
+
+    // Read results back and compare
+    std::vector< std::string > rawColumnNames, columnarColumnNames;
+    const Eigen::MatrixXd rawResults = readRawBinaryResultsFile( rawOutputFile, rawColumnNames );
+    const Eigen::MatrixXd columnarResults = readColumnarResultsFile( columnarOutputFile, columnarColumnNames );
+
+    BOOST_CHECK( rawColumnNames == columnNames );
+    BOOST_CHECK( columnarColumnNames == columnNames );
+    BOOST_CHECK_EQUAL( rawResults.rows( ), results.rows( ) );
+    BOOST_CHECK_EQUAL( columnarResults.rows( ), results.rows( ) );
+    BOOST_CHECK_EQUAL( ( rawResults - results ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( columnarResults - results ).cwiseAbs( ).maxCoeff( ), 0.0 );
+
+    boost::filesystem::remove( rawOutputFile );
+    boost::filesystem::remove( RawBinaryResultsWriter::getSidecarFile( rawOutputFile ) );
+    boost::filesystem::remove( columnarOutputFile );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
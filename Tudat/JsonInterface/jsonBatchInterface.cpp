@@ -0,0 +1,288 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/JsonInterface/jsonBatchInterface.h"
+#include "Tudat/JsonInterface/Environment/atmosphere.h"
+
+namespace tudat
+{
+
+namespace json_interface
+{
+
+//! Identifier at start of binary batch simulation results file.
+static const char BATCH_SIMULATION_RESULTS_FILE_IDENTIFIER[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'B', 'S', 'R' };
+
+//! Version of binary batch simulation results file format.
+static const boost::int32_t BATCH_SIMULATION_RESULTS_FILE_VERSION = 1;
+
+//! Apply a patch to a `json` object.
+nlohmann::json getPatchedJsonObject( const nlohmann::json& baseJsonObject, const nlohmann::json& patch )
+{
+    if( patch.is_array( ) )
+    {
+        return baseJsonObject.patch( patch );
+    }
+    else if( patch.is_object( ) )
+    {
+        nlohmann::json patchedJsonObject = baseJsonObject;
+        for( nlohmann::json::const_iterator patchIterator = patch.begin( ); patchIterator != patch.end( );
+             patchIterator++ )
+        {
+            nlohmann::json* currentJsonObject = &patchedJsonObject;
+            for( const std::string& key : KeyPath( patchIterator.key( ) ) )
+            {
+                currentJsonObject = &valueAt( *currentJsonObject, key, true );
+            }
+            *currentJsonObject = patchIterator.value( );
+        }
+        return patchedJsonObject;
+    }
+    else
+    {
+        throw std::runtime_error( "Error when applying patch to JSON object, patch must be an array (JSON Patch) or an "
+                                  "object (key paths and values)." );
+    }
+}
+
+//! Get the settings of a `json` object that determine the environment (loaded Spice kernels and created bodies).
+nlohmann::json getEnvironmentSettings( const nlohmann::json& jsonObject )
+{
+    nlohmann::json environmentSettings = jsonObject;
+    if( !environmentSettings.is_object( ) )
+    {
+        return environmentSettings;
+    }
+
+    // Remove integrator, termination, export and application settings, which do not modify the bodies, retaining the
+    // initial time of the integrator (which determines the interpolation interval of the ephemerides).
+    const KeyPath initialTimeKeyPath = Keys::integrator / Keys::Integrator::initialTime;
+    const nlohmann::json integratorInitialTime = isDefined( jsonObject, initialTimeKeyPath ) ?
+                valueAt( jsonObject, initialTimeKeyPath ) : nlohmann::json( );
+    environmentSettings.erase( Keys::integrator );
+    environmentSettings.erase( Keys::termination );
+    environmentSettings.erase( Keys::xport );
+    environmentSettings.erase( Keys::options );
+    environmentSettings[ Keys::integrator ] = integratorInitialTime;
+
+    // Remove initial states of the bodies, which are only used to define the propagator settings.
+    if( environmentSettings.count( Keys::bodies ) > 0 && environmentSettings[ Keys::bodies ].is_object( ) )
+    {
+        nlohmann::json& bodySettings = environmentSettings[ Keys::bodies ];
+        for( nlohmann::json::iterator bodyIterator = bodySettings.begin( ); bodyIterator != bodySettings.end( );
+             bodyIterator++ )
+        {
+            if( bodyIterator.value( ).is_object( ) )
+            {
+                bodyIterator.value( ).erase( Keys::Body::initialState );
+                bodyIterator.value( ).erase( Keys::Body::initialStateOrigin );
+            }
+        }
+    }
+
+    // Remove initial states of the propagators, retaining the settings of the state derivative models (accelerations,
+    // torques, mass-rate models), the creation of which modifies the bodies (e.g. their aerodynamic angle functions).
+    if( environmentSettings.count( Keys::propagators ) > 0 && environmentSettings[ Keys::propagators ].is_array( ) )
+    {
+        nlohmann::json& propagatorSettings = environmentSettings[ Keys::propagators ];
+        for( unsigned int i = 0; i < propagatorSettings.size( ); i++ )
+        {
+            if( propagatorSettings[ i ].is_object( ) )
+            {
+                propagatorSettings[ i ].erase( Keys::Propagator::initialStates );
+            }
+        }
+    }
+
+    return environmentSettings;
+}
+
+//! Get whether a `json` object uses models that can not be used concurrently from multiple threads.
+bool isNonReentrantModelUsed( const nlohmann::json& jsonObject )
+{
+    // Spice library.
+    if( isDefined( jsonObject, Keys::spice ) )
+    {
+        return true;
+    }
+
+    // NRLMSISE00 atmosphere model, which stores its input and output in global variables.
+    if( jsonObject.is_object( ) && jsonObject.count( Keys::bodies ) > 0 && jsonObject.at( Keys::bodies ).is_object( ) )
+    {
+        const nlohmann::json& bodySettings = jsonObject.at( Keys::bodies );
+        for( nlohmann::json::const_iterator bodyIterator = bodySettings.begin( ); bodyIterator != bodySettings.end( );
+             bodyIterator++ )
+        {
+            if( isDefined( bodyIterator.value( ), Keys::Body::atmosphere / Keys::Body::Atmosphere::type ) &&
+                    valueAt( bodyIterator.value( ), Keys::Body::atmosphere / Keys::Body::Atmosphere::type ) ==
+                    simulation_setup::atmosphereTypes.at( simulation_setup::nrlmsise00 ) )
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//! Constructor, opens the file and writes the file header.
+BatchSimulationResultsWriter::BatchSimulationResultsWriter( const std::string& fileName, const int numberOfVariations )
+{
+    outputFile_.open( fileName.c_str( ), std::ios::binary );
+    if( !outputFile_.good( ) )
+    {
+        throw std::runtime_error( "Error when opening batch simulation results file " + fileName );
+    }
+
+    const boost::int32_t numberOfVariationsToWrite = numberOfVariations;
+    outputFile_.write( BATCH_SIMULATION_RESULTS_FILE_IDENTIFIER, 8 );
+    outputFile_.write( reinterpret_cast< const char* >( &BATCH_SIMULATION_RESULTS_FILE_VERSION ),
+                       sizeof( BATCH_SIMULATION_RESULTS_FILE_VERSION ) );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfVariationsToWrite ),
+                       sizeof( numberOfVariationsToWrite ) );
+    outputFile_.flush( );
+}
+
+//! Function to write the results of a single variation.
+void BatchSimulationResultsWriter::writeResult(
+        const int variationIndex, const BatchSimulationStatus status, const std::string& errorMessage,
+        const std::map< double, Eigen::VectorXd >& stateHistory,
+        const std::map< double, Eigen::VectorXd >& dependentVariableHistory )
+{
+    // Determine sizes of record
+    const boost::int32_t stateSize = stateHistory.empty( ) ? 0 : stateHistory.begin( )->second.rows( );
+    const boost::int32_t dependentVariableSize =
+            dependentVariableHistory.empty( ) ? 0 : dependentVariableHistory.begin( )->second.rows( );
+    const boost::int64_t numberOfEpochs = stateHistory.size( );
+    const int rowSize = 1 + stateSize + dependentVariableSize;
+
+    // Fill data of record (before acquiring lock), with NaN for missing dependent variables.
+    std::vector< double > recordData( numberOfEpochs * rowSize, TUDAT_NAN );
+    int currentIndex = 0;
+    for( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = stateHistory.begin( );
+         stateIterator != stateHistory.end( ); stateIterator++ )
+    {
+        recordData[ currentIndex ] = stateIterator->first;
+        Eigen::Map< Eigen::VectorXd >( recordData.data( ) + currentIndex + 1, stateSize ) = stateIterator->second;
+
+        std::map< double, Eigen::VectorXd >::const_iterator variableIterator =
+                dependentVariableHistory.find( stateIterator->first );
+        if( variableIterator != dependentVariableHistory.end( ) )
+        {
+            Eigen::Map< Eigen::VectorXd >( recordData.data( ) + currentIndex + 1 + stateSize, dependentVariableSize ) =
+                    variableIterator->second;
+        }
+        currentIndex += rowSize;
+    }
+
+    const boost::int32_t indexToWrite = variationIndex;
+    const boost::int32_t statusToWrite = status;
+    const boost::int32_t messageLength = errorMessage.size( );
+
+    std::lock_guard< std::mutex > outputLock( outputMutex_ );
+    outputFile_.write( reinterpret_cast< const char* >( &indexToWrite ), sizeof( indexToWrite ) );
+    outputFile_.write( reinterpret_cast< const char* >( &statusToWrite ), sizeof( statusToWrite ) );
+    outputFile_.write( reinterpret_cast< const char* >( &messageLength ), sizeof( messageLength ) );
+    outputFile_.write( errorMessage.c_str( ), messageLength );
+    outputFile_.write( reinterpret_cast< const char* >( &numberOfEpochs ), sizeof( numberOfEpochs ) );
+    outputFile_.write( reinterpret_cast< const char* >( &stateSize ), sizeof( stateSize ) );
+    outputFile_.write( reinterpret_cast< const char* >( &dependentVariableSize ), sizeof( dependentVariableSize ) );
+    outputFile_.write( reinterpret_cast< const char* >( recordData.data( ) ), recordData.size( ) * sizeof( double ) );
+    outputFile_.flush( );
+
+    if( !outputFile_.good( ) )
+    {
+        throw std::runtime_error( "Error when writing results of variation " +
+                                  boost::lexical_cast< std::string >( variationIndex ) +
+                                  " to batch simulation results file." );
+    }
+}
+
+//! Function to read the results of a batch of JSON-based simulations from a binary file.
+std::map< int, BatchSimulationResult > readBatchSimulationResults( const std::string& fileName )
+{
+    std::ifstream inputFile( fileName.c_str( ), std::ios::binary );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when opening batch simulation results file " + fileName );
+    }
+
+    // Read and check file header.
+    char fileIdentifier[ 8 ];
+    boost::int32_t fileVersion, numberOfVariations;
+    inputFile.read( fileIdentifier, 8 );
+    inputFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfVariations ), sizeof( numberOfVariations ) );
+    if( !inputFile.good( ) ||
+            std::memcmp( fileIdentifier, BATCH_SIMULATION_RESULTS_FILE_IDENTIFIER, 8 ) != 0 )
+    {
+        throw std::runtime_error( "Error, file " + fileName + " is not a batch simulation results file" );
+    }
+    else if( fileVersion != BATCH_SIMULATION_RESULTS_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error, batch simulation results file version " +
+                                  boost::lexical_cast< std::string >( fileVersion ) + " not supported" );
+    }
+
+    // Read records of all variations.
+    std::map< int, BatchSimulationResult > batchResults;
+    boost::int32_t variationIndex;
+    while( inputFile.read( reinterpret_cast< char* >( &variationIndex ), sizeof( variationIndex ) ) )
+    {
+        boost::int32_t status, messageLength, stateSize, dependentVariableSize;
+        boost::int64_t numberOfEpochs;
+
+        BatchSimulationResult& currentResult = batchResults[ variationIndex ];
+        inputFile.read( reinterpret_cast< char* >( &status ), sizeof( status ) );
+        inputFile.read( reinterpret_cast< char* >( &messageLength ), sizeof( messageLength ) );
+        currentResult.status = static_cast< BatchSimulationStatus >( status );
+        currentResult.errorMessage.resize( messageLength );
+        inputFile.read( &currentResult.errorMessage[ 0 ], messageLength );
+        inputFile.read( reinterpret_cast< char* >( &numberOfEpochs ), sizeof( numberOfEpochs ) );
+        inputFile.read( reinterpret_cast< char* >( &stateSize ), sizeof( stateSize ) );
+        inputFile.read( reinterpret_cast< char* >( &dependentVariableSize ), sizeof( dependentVariableSize ) );
+
+        const int rowSize = 1 + stateSize + dependentVariableSize;
+        std::vector< double > recordData( numberOfEpochs * rowSize );
+        inputFile.read( reinterpret_cast< char* >( recordData.data( ) ), recordData.size( ) * sizeof( double ) );
+        if( !inputFile.good( ) )
+        {
+            throw std::runtime_error( "Error when reading results of variation " +
+                                      boost::lexical_cast< std::string >( variationIndex ) +
+                                      " from batch simulation results file " + fileName );
+        }
+
+        for( int i = 0; i < numberOfEpochs; i++ )
+        {
+            const double* rowData = recordData.data( ) + i * rowSize;
+            currentResult.stateHistory[ rowData[ 0 ] ] =
+                    Eigen::Map< const Eigen::VectorXd >( rowData + 1, stateSize );
+            if( dependentVariableSize > 0 )
+            {
+                currentResult.dependentVariableHistory[ rowData[ 0 ] ] =
+                        Eigen::Map< const Eigen::VectorXd >( rowData + 1 + stateSize, dependentVariableSize );
+            }
+        }
+    }
+
+    return batchResults;
+}
+
+template class JsonVariationSimulationManager< double, double >;
+template class JsonBatchSimulationManager< double, double >;
+
+} // namespace json_interface
+
+} // namespace tudat
@@ -0,0 +1,472 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_JSONBATCHINTERFACE_H
+#define TUDAT_JSONBATCHINTERFACE_H
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <set>
+
+#include "Tudat/Basics/parallelLoop.h"
+#include "Tudat/JsonInterface/jsonInterface.h"
+
+namespace tudat
+{
+
+namespace json_interface
+{
+
+//! Apply a patch to a `json` object.
+/*!
+ * Apply a patch to a `json` object. The patch can be either a JSON Patch (RFC 6902), i.e. an array of operations
+ * such as `{ "op": "replace", "path": "/integrator/stepSize", "value": 20 }`, or an object in which each key is a key
+ * path (e.g. "integrator.stepSize" or "bodies.Earth.gravityField.gravitationalParameter") and each value is the new
+ * value at that key path (keys that do not exist are created).
+ * \param baseJsonObject The `json` object to be patched.
+ * \param patch The patch to apply.
+ * \return The patched `json` object.
+ * \throws std::runtime_error If \p patch is not an array or an object.
+ */
+nlohmann::json getPatchedJsonObject( const nlohmann::json& baseJsonObject, const nlohmann::json& patch );
+
+//! Get the settings of a `json` object that determine the environment (loaded Spice kernels and created bodies).
+/*!
+ * Get the settings of a `json` object that determine the environment (loaded Spice kernels and created bodies), i.e.
+ * all settings except for the initial states (of the bodies and propagators), the integrator settings (other than the
+ * initial time, which determines the interpolation interval of the ephemerides), and the termination, export and
+ * application settings. The settings of the state derivative models are included, since their creation modifies the
+ * bodies. If these settings are equal for two `json` objects, the environment created for one can be reused for the
+ * other.
+ * \param jsonObject The (unparsed) root `json` object of a simulation.
+ * \return `json` object containing the settings that determine the environment.
+ */
+nlohmann::json getEnvironmentSettings( const nlohmann::json& jsonObject );
+
+//! Get whether a `json` object uses models that can not be used concurrently from multiple threads.
+/*!
+ * Get whether a `json` object uses models that can not be used concurrently from multiple threads, i.e. whether Spice
+ * kernels are loaded or any of the bodies has an NRLMSISE00 atmosphere model.
+ * \param jsonObject The (unparsed) root `json` object of a simulation.
+ * \return Whether non-reentrant models are used.
+ */
+bool isNonReentrantModelUsed( const nlohmann::json& jsonObject );
+
+//! Status of a single variation of a batch of JSON-based simulations.
+enum BatchSimulationStatus
+{
+    batch_simulation_successful = 0,
+    batch_simulation_propagation_failed = 1,
+    batch_simulation_setup_failed = 2
+};
+
+//! Results of a single variation of a batch of JSON-based simulations, as read from a batch results file.
+struct BatchSimulationResult
+{
+    //! Status of the variation.
+    BatchSimulationStatus status;
+
+    //! Error message (empty if no exception was thrown).
+    std::string errorMessage;
+
+    //! History of the propagated (Cartesian) states.
+    std::map< double, Eigen::VectorXd > stateHistory;
+
+    //! History of the dependent variables (empty if no dependent variables were saved).
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+};
+
+//! Class for writing the results of a batch of JSON-based simulations to a single binary file.
+/*!
+ * Class for writing the results of a batch of JSON-based simulations to a single binary file. Results can be written
+ * concurrently from multiple threads, and are written in the order in which they are provided. The file starts with an
+ * 8-character identifier ("TUDATBSR"), followed by the (32-bit integer) file version and number of variations. For each
+ * variation, a record is written containing the variation index, status (see BatchSimulationStatus) and error message
+ * length (32-bit integers), the error message, the number of epochs (64-bit integer), the state and dependent variable
+ * sizes (32-bit integers), followed by one row of doubles per epoch, containing the epoch, the state and the dependent
+ * variables. All values are written in the native (little-endian on all supported platforms) byte order.
+ */
+class BatchSimulationResultsWriter
+{
+public:
+
+    //! Constructor, opens the file and writes the file header.
+    /*!
+     * Constructor, opens the file and writes the file header.
+     * \param fileName Name of the binary file to which the results are written.
+     * \param numberOfVariations Number of variations in the batch.
+     */
+    BatchSimulationResultsWriter( const std::string& fileName, const int numberOfVariations );
+
+    //! Function to write the results of a single variation.
+    /*!
+     * Function to write the results of a single variation (thread-safe).
+     * \param variationIndex Index of the variation.
+     * \param status Status of the variation.
+     * \param errorMessage Error message (empty if no exception was thrown).
+     * \param stateHistory History of the propagated states.
+     * \param dependentVariableHistory History of the dependent variables (at the same epochs as the states).
+     */
+    void writeResult( const int variationIndex, const BatchSimulationStatus status, const std::string& errorMessage,
+                      const std::map< double, Eigen::VectorXd >& stateHistory =
+            std::map< double, Eigen::VectorXd >( ),
+                      const std::map< double, Eigen::VectorXd >& dependentVariableHistory =
+            std::map< double, Eigen::VectorXd >( ) );
+
+private:
+
+    //! Output file stream.
+    std::ofstream outputFile_;
+
+    //! Mutex used to write results from multiple threads.
+    std::mutex outputMutex_;
+};
+
+//! Function to read the results of a batch of JSON-based simulations from a binary file.
+/*!
+ * Function to read the results of a batch of JSON-based simulations from a binary file, as written by
+ * BatchSimulationResultsWriter.
+ * \param fileName Name of the binary file.
+ * \return Results of the variations, with the variation index as key.
+ */
+std::map< int, BatchSimulationResult > readBatchSimulationResults( const std::string& fileName );
+
+//! Class for managing JSON-based simulations that reuses the environment of the previous simulation, if possible.
+/*!
+ * Class for managing JSON-based simulations that reuses the environment (loaded Spice kernels and created bodies) of
+ * the previous simulation when the settings are updated, if the settings that determine the environment (as obtained
+ * by getEnvironmentSettings) are unchanged. The keys that were accessed to create the environment are marked as
+ * accessed again when it is reused, such that unused keys can be checked for every simulation. Objects of this class
+ * are used to run the variations of a JsonBatchSimulationManager.
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class JsonVariationSimulationManager: public JsonSimulationManager< TimeType, StateScalarType >
+{
+public:
+
+    //! Constructor from JSON object.
+    /*!
+     * Constructor.
+     * \param jsonObject The root JSON object.
+     */
+    JsonVariationSimulationManager( const nlohmann::json& jsonObject ):
+        JsonSimulationManager< TimeType, StateScalarType >( jsonObject ), isEnvironmentReused_( false ) { }
+
+    virtual ~JsonVariationSimulationManager( ){ }
+
+    //! Update the settings, creating a new environment only if the settings that determine it have changed.
+    virtual void updateSettings( )
+    {
+        requestedEnvironmentSettings_ = getEnvironmentSettings( this->jsonObject_ );
+        isEnvironmentReused_ =
+                ( !this->bodyMap_.empty( ) && requestedEnvironmentSettings_ == environmentSettings_ );
+        JsonSimulationManager< TimeType, StateScalarType >::updateSettings( );
+    }
+
+    //! Get whether the environment of the previous simulation was reused in the last call to updateSettings.
+    bool isEnvironmentReused( ) const
+    {
+        return isEnvironmentReused_;
+    }
+
+protected:
+
+    //! Reset spiceSettings_ and load Spice kernels, unless the environment is reused.
+    virtual void resetSpice( )
+    {
+        if( !isEnvironmentReused_ )
+        {
+            // Environment is incomplete until the bodies have been created, so it is not reused if this fails.
+            environmentSettings_ = nlohmann::json( );
+            JsonSimulationManager< TimeType, StateScalarType >::resetSpice( );
+        }
+    }
+
+    //! Reset bodySettingsMap_ and bodyMap_, unless the environment is reused.
+    virtual void resetBodies( )
+    {
+        if( !isEnvironmentReused_ )
+        {
+            environmentSettings_ = nlohmann::json( );
+            JsonSimulationManager< TimeType, StateScalarType >::resetBodies( );
+            environmentSettings_ = requestedEnvironmentSettings_;
+            environmentKeyPaths_ = accessedKeyPaths;
+        }
+        else
+        {
+            accessedKeyPaths.insert( environmentKeyPaths_.begin( ), environmentKeyPaths_.end( ) );
+        }
+    }
+
+    //! Whether the environment of the previous simulation was reused in the last call to updateSettings.
+    bool isEnvironmentReused_;
+
+    //! Settings that determine the current environment (see getEnvironmentSettings), null if it is incomplete.
+    nlohmann::json environmentSettings_;
+
+    //! Settings that determine the environment of the settings passed in the last call to updateSettings.
+    nlohmann::json requestedEnvironmentSettings_;
+
+    //! Key paths that were accessed up to and including the creation of the current environment.
+    std::set< KeyPath > environmentKeyPaths_;
+
+};
+
+//! Class for managing batches of JSON-based simulations, defined by a base configuration and a list of patches.
+/*!
+ * Class for managing batches of JSON-based simulations, defined by a base configuration and a list of patches (see
+ * getPatchedJsonObject), each of which defines one variation of the base configuration. The variations are run on a
+ * number of threads, where each thread reuses the environment (loaded Spice kernels and created bodies) of its
+ * previous variation if the settings that determine the environment are unchanged. The results of all variations are
+ * written to a single binary file (see BatchSimulationResultsWriter), instead of the (text) export settings of the
+ * configurations. Note that the Spice library and the NRLMSISE00 atmosphere model are not thread-safe, so that the
+ * variations are run on a single thread if any of them uses these (see isNonReentrantModelUsed).
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+class JsonBatchSimulationManager
+{
+public:
+
+    //! Constructor from base JSON file.
+    /*!
+     * Constructor.
+     * \param baseInputFilePath Path to the root JSON input file of the base configuration. Can be absolute or relative
+     * (to the working directory). The working directory is changed to the directory of this file.
+     * \param patches List of patches, each of which defines one variation of the base configuration.
+     * \param numberOfThreads Maximum number of threads used to run the variations.
+     */
+    JsonBatchSimulationManager( const std::string& baseInputFilePath,
+                                const std::vector< nlohmann::json >& patches,
+                                const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ):
+        patches_( patches ), numberOfThreads_( numberOfThreads ), numberOfEnvironmentCreations_( 0 ),
+        numberOfFailedVariations_( 0 )
+    {
+        const boost::filesystem::path inputFilePath = getPathForJSONFile( baseInputFilePath );
+        boost::filesystem::current_path( inputFilePath.parent_path( ) );
+        baseJsonObject_ = getDeserializedJSON( inputFilePath );
+    }
+
+    //! Constructor from base JSON object.
+    /*!
+     * Constructor.
+     * \param baseJsonObject The root JSON object of the base configuration.
+     * \param patches List of patches, each of which defines one variation of the base configuration.
+     * \param numberOfThreads Maximum number of threads used to run the variations.
+     */
+    JsonBatchSimulationManager( const nlohmann::json& baseJsonObject,
+                                const std::vector< nlohmann::json >& patches,
+                                const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) ):
+        baseJsonObject_( baseJsonObject ), patches_( patches ), numberOfThreads_( numberOfThreads ),
+        numberOfEnvironmentCreations_( 0 ), numberOfFailedVariations_( 0 ) { }
+
+    //! Run all variations, and write the results to a single binary file.
+    /*!
+     * Run all variations, and write the results to a single binary file (see BatchSimulationResultsWriter). A variation
+     * for which an exception is thrown does not interrupt the batch: its status (setup or propagation failure,
+     * depending on the stage at which the exception was thrown) and error message are written instead.
+     * \param outputFilePath Path of the binary file to which the results are written.
+     */
+    void runSimulations( const std::string& outputFilePath )
+    {
+        typedef JsonVariationSimulationManager< TimeType, StateScalarType > VariationManager;
+
+        const int numberOfVariations = static_cast< int >( patches_.size( ) );
+        BatchSimulationResultsWriter resultsWriter( outputFilePath, numberOfVariations );
+
+        // Simulation managers that are not in use, each retaining the environment of its last variation.
+        std::vector< std::shared_ptr< VariationManager > > idleSimulationManagers;
+        std::mutex simulationManagersMutex;
+
+        numberOfEnvironmentCreations_ = 0;
+        numberOfFailedVariations_ = 0;
+        utilities::executeParallelLoop(
+                    numberOfVariations, [ & ]( const int variationIndex )
+        {
+            std::shared_ptr< VariationManager > simulationManager;
+            {
+                std::lock_guard< std::mutex > simulationManagersLock( simulationManagersMutex );
+                if( !idleSimulationManagers.empty( ) )
+                {
+                    simulationManager = idleSimulationManagers.back( );
+                    idleSimulationManagers.pop_back( );
+                }
+            }
+
+            // Set up simulation, checking for unused keys (also if the environment was reused).
+            bool isSetupSuccessful = false;
+            try
+            {
+                const nlohmann::json variationJsonObject =
+                        getPatchedJsonObject( baseJsonObject_, patches_.at( variationIndex ) );
+                if( simulationManager == nullptr )
+                {
+                    simulationManager = std::make_shared< VariationManager >( variationJsonObject );
+                }
+                else
+                {
+                    simulationManager->resetJsonObject( variationJsonObject );
+                }
+
+                simulationManager->updateSettings( );
+                if( !simulationManager->isEnvironmentReused( ) )
+                {
+                    numberOfEnvironmentCreations_++;
+                }
+                checkUnusedKeys( simulationManager->getJsonObject( ),
+                                 simulationManager->getApplicationOptions( )->unusedKey_ );
+                isSetupSuccessful = true;
+            }
+            catch( std::exception& caughtException )
+            {
+                numberOfFailedVariations_++;
+                resultsWriter.writeResult( variationIndex, batch_simulation_setup_failed, caughtException.what( ) );
+            }
+
+            // Run simulation.
+            if( isSetupSuccessful )
+            {
+                std::string errorMessage;
+                try
+                {
+                    simulationManager->runJsonSimulation( );
+                }
+                catch( std::exception& caughtException )
+                {
+                    errorMessage = caughtException.what( );
+                }
+
+                if( errorMessage.empty( ) )
+                {
+                    if( writeVariationResults( resultsWriter, variationIndex,
+                                               simulationManager->getDynamicsSimulator( ) ) !=
+                            batch_simulation_successful )
+                    {
+                        numberOfFailedVariations_++;
+                    }
+                }
+                else
+                {
+                    numberOfFailedVariations_++;
+                    resultsWriter.writeResult( variationIndex, batch_simulation_propagation_failed, errorMessage );
+                }
+            }
+
+            if( simulationManager != nullptr )
+            {
+                std::lock_guard< std::mutex > simulationManagersLock( simulationManagersMutex );
+                idleSimulationManagers.push_back( simulationManager );
+            }
+        }, areNonReentrantModelsUsed( ) ? 1 : numberOfThreads_ );
+    }
+
+    //! Get the base configuration.
+    nlohmann::json getBaseJsonObject( ) const
+    {
+        return baseJsonObject_;
+    }
+
+    //! Get the patches defining the variations.
+    std::vector< nlohmann::json > getPatches( ) const
+    {
+        return patches_;
+    }
+
+    //! Get the number of environments that were created in the last call to runSimulations.
+    int getNumberOfEnvironmentCreations( ) const
+    {
+        return numberOfEnvironmentCreations_;
+    }
+
+    //! Get the number of variations of which the setup or propagation failed in the last call to runSimulations.
+    int getNumberOfFailedVariations( ) const
+    {
+        return numberOfFailedVariations_;
+    }
+
+protected:
+
+    //! Get whether non-reentrant models are used by the base configuration or any of its variations.
+    bool areNonReentrantModelsUsed( ) const
+    {
+        if( isNonReentrantModelUsed( baseJsonObject_ ) )
+        {
+            return true;
+        }
+        for( unsigned int i = 0; i < patches_.size( ); i++ )
+        {
+            try
+            {
+                if( isNonReentrantModelUsed( getPatchedJsonObject( baseJsonObject_, patches_.at( i ) ) ) )
+                {
+                    return true;
+                }
+            }
+            catch( ... ) { }
+        }
+        return false;
+    }
+
+    //! Write the results of a single variation, converted to double precision, and return its status.
+    BatchSimulationStatus writeVariationResults(
+            BatchSimulationResultsWriter& resultsWriter, const int variationIndex,
+            const std::shared_ptr< propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > >&
+            dynamicsSimulator )
+    {
+        std::map< double, Eigen::VectorXd > stateHistory;
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& numericalSolution =
+                dynamicsSimulator->getEquationsOfMotionNumericalSolution( );
+        for( auto stateIterator = numericalSolution.begin( ); stateIterator != numericalSolution.end( );
+             stateIterator++ )
+        {
+            stateHistory[ static_cast< double >( stateIterator->first ) ] =
+                    stateIterator->second.template cast< double >( );
+        }
+
+        std::map< double, Eigen::VectorXd > dependentVariableHistory;
+        const std::map< TimeType, Eigen::VectorXd >& dependentVariableSolution =
+                dynamicsSimulator->getDependentVariableHistory( );
+        for( auto variableIterator = dependentVariableSolution.begin( );
+             variableIterator != dependentVariableSolution.end( ); variableIterator++ )
+        {
+            dependentVariableHistory[ static_cast< double >( variableIterator->first ) ] = variableIterator->second;
+        }
+
+        const BatchSimulationStatus status = dynamicsSimulator->integrationCompletedSuccessfully( ) ?
+                    batch_simulation_successful : batch_simulation_propagation_failed;
+        resultsWriter.writeResult( variationIndex, status, "", stateHistory, dependentVariableHistory );
+        return status;
+    }
+
+    //! Root JSON object of the base configuration.
+    nlohmann::json baseJsonObject_;
+
+    //! Patches, each of which defines one variation of the base configuration.
+    std::vector< nlohmann::json > patches_;
+
+    //! Maximum number of threads used to run the variations.
+    int numberOfThreads_;
+
+    //! Number of environments that were created in the last call to runSimulations.
+    std::atomic< int > numberOfEnvironmentCreations_;
+
+    //! Number of variations of which the setup or propagation failed in the last call to runSimulations.
+    std::atomic< int > numberOfFailedVariations_;
+
+};
+
+extern template class JsonVariationSimulationManager< double, double >;
+extern template class JsonBatchSimulationManager< double, double >;
+
+} // namespace json_interface
+
+} // namespace tudat
+
+#endif // TUDAT_JSONBATCHINTERFACE_H
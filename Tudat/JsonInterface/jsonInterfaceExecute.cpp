@@ -11,6 +11,7 @@
 #include <getopt.h>
 
 #include "Tudat/JsonInterface/jsonInterface.h"
+#include "Tudat/JsonInterface/jsonBatchInterface.h"
 
 void printHelp( )
 {
@@ -23,7 +24,12 @@ void printHelp( )
                  "If not provided, a main.json file will be looked for in the current directory.\n"
                  "\n"
                  "Options:\n"
-                 "-h, --help       Show help\n"
+                 "-h, --help                 Show help\n"
+                 "-v, --variations <file>    Run a batch of variations of the input file, defined by the patches "
+                 "in the JSON array contained in <file>\n"
+                 "-o, --output <file>        Binary file to which the results of a batch of variations are written "
+                 "(default: batchResults.bin)\n"
+                 "-t, --threads <number>     Maximum number of threads used to run a batch of variations\n"
               << std::endl;
     exit( EXIT_FAILURE );
 }
@@ -32,11 +38,16 @@ void printHelp( )
 int main( int argumentCount, char* arguments[ ] )
 {
     int currentOption;
-    int optionCount = 0;
-    const char* const shortOptions = "h";
+    std::string variationsPath;
+    std::string batchOutputPath = "batchResults.bin";
+    int numberOfThreads = tudat::utilities::getDefaultNumberOfThreads( );
+    const char* const shortOptions = "hv:o:t:";
     const option longOptions[ ] =
     {
         { "help", no_argument, nullptr, 'h' },
+        { "variations", required_argument, nullptr, 'v' },
+        { "output", required_argument, nullptr, 'o' },
+        { "threads", required_argument, nullptr, 't' },
         { nullptr, 0, nullptr, 0 }
     };
 
@@ -44,26 +55,60 @@ int main( int argumentCount, char* arguments[ ] )
     {
         switch ( currentOption )
         {
+        case 'v':
+            variationsPath = optarg;
+            break;
+        case 'o':
+            batchOutputPath = boost::filesystem::absolute( optarg ).string( );
+            break;
+        case 't':
+            numberOfThreads = std::max( std::atoi( optarg ), 1 );
+            break;
         case 'h':
         case '?':
         default:
             printHelp( );
         }
-        optionCount++;
     }
 
-    const int nonOptionArgumentCount = argumentCount - optionCount - 1;
+    const int nonOptionArgumentCount = argumentCount - optind;
     if ( nonOptionArgumentCount > 1 )
     {
         printHelp( );
     }
-    const std::string inputPath = nonOptionArgumentCount == 1 ? arguments[ argumentCount - 1 ] : "";
+    const std::string inputPath = nonOptionArgumentCount == 1 ? arguments[ optind ] : "";
 
     // FIXME: Get binary path (not working on Mac OS)
     // boost::filesystem::path full_path( boost::filesystem::initial_path< boost::filesystem::path >( ) );
     // full_path = boost::filesystem::system_complete( boost::filesystem::path( arguments[ 0 ] ) );
     // std::cout << full_path << std::endl;
 
+    // Run batch of variations, if requested.
+    if ( !variationsPath.empty( ) )
+    {
+        const nlohmann::json patches = tudat::json_interface::readJSON( variationsPath );
+        if ( !patches.is_array( ) )
+        {
+            std::cerr << "The variations file must contain an array of patches." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        tudat::json_interface::JsonBatchSimulationManager< > batchSimulationManager(
+                    inputPath, patches.get< std::vector< nlohmann::json > >( ), numberOfThreads );
+        batchSimulationManager.runSimulations( batchOutputPath );
+
+        // Report failure if the setup or propagation of any of the variations failed.
+        const int numberOfFailedVariations = batchSimulationManager.getNumberOfFailedVariations( );
+        if ( numberOfFailedVariations > 0 )
+        {
+            std::cerr << "FAILURE: " << numberOfFailedVariations << " of " << patches.size( )
+                      << " variations failed, see " << batchOutputPath << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
     tudat::json_interface::JsonSimulationManager< > jsonSimulationManager( inputPath );
     jsonSimulationManager.updateSettings( );
     jsonSimulationManager.runPropagation( );
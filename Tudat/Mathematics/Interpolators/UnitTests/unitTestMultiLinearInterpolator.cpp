@@ -23,6 +23,7 @@
 
 #include "Tudat/Mathematics/Interpolators/linearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearVectorInterpolator.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 namespace tudat
@@ -618,6 +619,95 @@ BOOST_AUTO_TEST_CASE( test2DimensionsUserExtrapolationCase )
     }
 }
 
+// Test 7: comparison of vector multi-linear interpolator with (component-wise) multi-linear interpolator, for odd and even
+// number of dependent variables, and for different boundary handling methods.
+BOOST_AUTO_TEST_CASE( testMultiLinearVectorInterpolator )
+{
+    using namespace interpolators;
+
+    // Create (non-equidistant) independent variables
+    std::vector< std::vector< double > > independentValues;
+    independentValues.resize( 3 );
+    for ( int i = 0; i < 7; i++ )
+    {
+        independentValues[ 0 ].push_back( -1.0 + 0.3 * static_cast< double >( i ) + 0.01 * static_cast< double >( i * i ) );
+    }
+    for ( int i = 0; i < 5; i++ )
+    {
+        independentValues[ 1 ].push_back( 10.0 * static_cast< double >( i ) );
+    }
+    for ( int i = 0; i < 4; i++ )
+    {
+        independentValues[ 2 ].push_back( std::exp( static_cast< double >( i ) ) );
+    }
+
+    // Create random dependent variables
+    boost::multi_array< Eigen::Vector3d, 3 > dependentValues3;
+    dependentValues3.resize( boost::extents[ 7 ][ 5 ][ 4 ] );
+    boost::multi_array< Eigen::Vector6d, 3 > dependentValues6;
+    dependentValues6.resize( boost::extents[ 7 ][ 5 ][ 4 ] );
+    for ( int i = 0; i < 7; i++ )
+    {
+        for ( int j = 0; j < 5; j++ )
+        {
+            for ( int k = 0; k < 4; k++ )
+            {
+                dependentValues3[ i ][ j ][ k ] = Eigen::Vector3d::Random( );
+                dependentValues6[ i ][ j ][ k ] = Eigen::Vector6d::Random( );
+            }
+        }
+    }
+
+    std::vector< std::vector< double > > targetValues =
+    { { -0.9, 3.0, 1.1 }, { 1.25, 39.9, 20.0 }, { -1.0, 0.0, 1.0 }, { 0.2, 25.0, 5.0 },
+      { -2.0, 15.0, 2.0 }, { 0.5, 45.0, 3.0 }, { 0.5, 15.0, 25.0 } };
+
+    // Test extrapolation (inside and outside of domain), and use of boundary values.
+    for ( unsigned int boundaryMethod = 0; boundaryMethod < 2; boundaryMethod++ )
+    {
+        BoundaryInterpolationType boundaryHandling = ( boundaryMethod == 0 ) ?
+                    extrapolate_at_boundary : use_boundary_value;
+        MultiLinearInterpolator< double, Eigen::Vector3d, 3 > referenceInterpolator3(
+                    independentValues, dependentValues3, huntingAlgorithm, boundaryHandling );
+        MultiLinearVectorInterpolator< 3, 3 > vectorInterpolator3(
+                    independentValues, dependentValues3, huntingAlgorithm, boundaryHandling );
+        MultiLinearInterpolator< double, Eigen::Vector6d, 3 > referenceInterpolator6(
+                    independentValues, dependentValues6, binarySearch, boundaryHandling );
+        MultiLinearVectorInterpolator< 3, 6 > vectorInterpolator6(
+                    independentValues, dependentValues6, binarySearch, boundaryHandling );
+
+        for ( unsigned int i = 0; i < targetValues.size( ); i++ )
+        {
+            Eigen::Vector3d expectedValue3 = referenceInterpolator3.interpolate( targetValues.at( i ) );
+            Eigen::Vector3d computedValue3 = vectorInterpolator3.interpolate( targetValues.at( i ) );
+            Eigen::Vector6d expectedValue6 = referenceInterpolator6.interpolate( targetValues.at( i ) );
+            Eigen::Vector6d computedValue6 = vectorInterpolator6.interpolate( targetValues.at( i ) );
+
+            for ( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( expectedValue3( j ) - computedValue3( j ) ), 1.0E-13 );
+            }
+            for ( int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( expectedValue6( j ) - computedValue6( j ) ), 1.0E-13 );
+            }
+        }
+    }
+
+    // Test use of default values
+    Eigen::Vector3d defaultValue = Eigen::Vector3d::Random( );
+    MultiLinearVectorInterpolator< 3, 3 > vectorInterpolator3(
+                independentValues, dependentValues3, huntingAlgorithm, use_default_value, defaultValue );
+    for ( unsigned int i = 4; i < targetValues.size( ); i++ )
+    {
+        Eigen::Vector3d computedValue3 = vectorInterpolator3.interpolate( targetValues.at( i ) );
+        for ( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( computedValue3( j ), defaultValue( j ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
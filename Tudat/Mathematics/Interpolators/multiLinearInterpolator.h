@@ -180,15 +180,19 @@ public:
                                       std::to_string( NumberOfDimensions ) );
         }
 
-        // Create local copy of current independent variables
-        std::vector< IndependentVariableType > localIndependentValuesToInterpolate = independentValuesToInterpolate;
+        // Create local copy of current independent variables (fixed-size, to prevent heap allocation)
+        boost::array< IndependentVariableType, NumberOfDimensions > localIndependentValuesToInterpolate;
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            localIndependentValuesToInterpolate[ i ] = independentValuesToInterpolate[ i ];
+        }
 
         // Check that independent variables are in range
         bool useValue = false;
         DependentVariableType currentDependentVariable;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
-            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate.at( i ), currentDependentVariable );
+            this->checkBoundaryCase( i, useValue, localIndependentValuesToInterpolate[ i ], currentDependentVariable );
             if ( useValue )
             {
                 return currentDependentVariable;
@@ -196,8 +200,7 @@ public:
         }
 
         // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
+        boost::array< int, NumberOfDimensions > nearestLowerIndices;
         for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
         {
             nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
@@ -285,9 +288,9 @@ private:
      */
     DependentVariableType performRecursiveInterpolationStep(
             const unsigned int currentDimension,
-            const std::vector< IndependentVariableType >& independentValuesToInterpolate,
+            const boost::array< IndependentVariableType, NumberOfDimensions >& independentValuesToInterpolate,
             boost::array< unsigned int, NumberOfDimensions > currentArrayIndices,
-            const std::vector< int >& nearestLowerIndices )
+            const boost::array< int, NumberOfDimensions >& nearestLowerIndices )
     {
         IndependentVariableType upperFraction, lowerFraction;
         DependentVariableType upperContribution, lowerContribution;
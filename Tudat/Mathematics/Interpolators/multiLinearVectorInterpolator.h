@@ -0,0 +1,272 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_MULTI_LINEAR_VECTOR_INTERPOLATOR_H
+#define TUDAT_MULTI_LINEAR_VECTOR_INTERPOLATOR_H
+
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+#include "Tudat/Mathematics/Interpolators/multiDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class for performing multi-linear interpolation of a fixed-size vector of dependent variables.
+/*!
+ *  Class for performing multi-linear interpolation of a fixed-size vector of dependent variables (e.g. a set of aerodynamic
+ *  coefficients, or density, pressure and temperature of an atmosphere), for which both the number of independent variables
+ *  and the number of dependent variables are known at compile time. As opposed to the MultiLinearInterpolator, which
+ *  evaluates the 2^N corners of the grid cell recursively, this class computes the 2^N corner weights once, and accumulates
+ *  all dependent variables in a single pass over the corners, without any heap allocation.
+ *
+ *  The dependent variables are stored in a single flat, aligned array (last independent variable running fastest), with all
+ *  entries at a single node stored contiguously. The number of entries per node is padded to a multiple of two, so that the
+ *  accumulation over the nodes is performed by aligned, vectorized (SIMD) Eigen operations, with the padding entries set to
+ *  zero.
+ *  \tparam NumberOfDimensions Number of independent variables.
+ *  \tparam NumberOfOutputs Number of dependent variables.
+ */
+template< unsigned int NumberOfDimensions, int NumberOfOutputs >
+class MultiLinearVectorInterpolator: public MultiDimensionalInterpolator<
+        double, Eigen::Matrix< double, NumberOfOutputs, 1 >, NumberOfDimensions >
+{
+public:
+
+    //! Typedef for vector of dependent variables.
+    typedef Eigen::Matrix< double, NumberOfOutputs, 1 > DependentVariableType;
+
+    //! Number of entries stored per node, padded to allow aligned, vectorized accumulation.
+    static const int PaddedNumberOfOutputs = 2 * ( ( NumberOfOutputs + 1 ) / 2 );
+
+    //! Typedef for (padded) vector of dependent variables at a single node.
+    typedef Eigen::Matrix< double, PaddedNumberOfOutputs, 1 > PaddedDependentVariableType;
+
+    //! Number of corners of the grid cell in which interpolation is performed.
+    static const unsigned int NumberOfCorners = 1 << NumberOfDimensions;
+
+    // Using statements to prevent having to put 'this' everywhere in the code.
+    using MultiDimensionalInterpolator< double, DependentVariableType, NumberOfDimensions >::dependentData_;
+    using MultiDimensionalInterpolator< double, DependentVariableType, NumberOfDimensions >::independentValues_;
+    using MultiDimensionalInterpolator< double, DependentVariableType, NumberOfDimensions >::lookUpSchemes_;
+
+    //! Default constructor taking independent and dependent variable data.
+    /*!
+     *  Default constructor taking independent and dependent variable data.
+     *  \param independentValues Vector of vectors containing data points of independent variables,
+     *      each must be sorted in ascending order.
+     *  \param dependentData Multi-dimensional array of dependent data at each point of
+     *      hyper-rectangular grid formed by independent variable points.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum. This algorithm is used
+     *      to find the nearest lower data point in the independent variables when requesting
+     *      interpolation.
+     *  \param boundaryHandling Vector of boundary handling methods, in case independent variable is outside the
+     *      specified range.
+     *  \param defaultExtrapolationValue Vector of pairs of default values to be used for extrapolation, in case
+     *      of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
+     */
+    MultiLinearVectorInterpolator(
+            const std::vector< std::vector< double > >& independentValues,
+            const boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) >& dependentData,
+            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
+            const std::vector< BoundaryInterpolationType >& boundaryHandling =
+            std::vector< BoundaryInterpolationType >( NumberOfDimensions, extrapolate_at_boundary ),
+            const std::vector< std::pair< DependentVariableType, DependentVariableType > >& defaultExtrapolationValue =
+            std::vector< std::pair< DependentVariableType, DependentVariableType > >(
+                NumberOfDimensions, std::make_pair( DependentVariableType::Zero( ), DependentVariableType::Zero( ) ) ) ) :
+        MultiDimensionalInterpolator< double, DependentVariableType, NumberOfDimensions >(
+            boundaryHandling, defaultExtrapolationValue )
+    {
+        // Check consistency of template arguments and input variables.
+        if ( independentValues.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error: dimension of independent value vector provided to multi-linear vector "
+                                      "interpolator incompatible with template parameter." );
+        }
+
+        // Check consistency of input data of dependent and independent data.
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            if ( independentValues[ i ].size( ) != dependentData.shape( )[ i ] )
+            {
+                throw std::runtime_error( "Error: number of data points in dimension " + std::to_string( i ) +
+                                          " of independent and dependent data incompatible." );
+            }
+            else if ( independentValues[ i ].size( ) < 2 )
+            {
+                throw std::runtime_error( "Error: multi-linear vector interpolator requires at least two data points in "
+                                          "dimension " + std::to_string( i ) );
+            }
+        }
+
+        // Save (in)dependent variables
+        independentValues_ = independentValues;
+        dependentData_.resize( reinterpret_cast< boost::array< size_t, NumberOfDimensions > const& >(
+                                   *dependentData.shape( ) ) );
+        dependentData_ = dependentData;
+
+        // Set strides (in number of nodes) of flat data array
+        nodeStrides_[ NumberOfDimensions - 1 ] = 1;
+        for ( int i = static_cast< int >( NumberOfDimensions ) - 2; i >= 0; i-- )
+        {
+            nodeStrides_[ i ] = nodeStrides_[ i + 1 ] * static_cast< int >( independentValues_[ i + 1 ].size( ) );
+        }
+
+        // Copy dependent variables to flat, padded array (dependentData_ has c storage order).
+        const unsigned int numberOfNodes = dependentData_.num_elements( );
+        flatDependentData_.resize( numberOfNodes * PaddedNumberOfOutputs );
+        for ( unsigned int i = 0; i < numberOfNodes; i++ )
+        {
+            PaddedDependentVariableType currentNodeData = PaddedDependentVariableType::Zero( );
+            currentNodeData.template head< NumberOfOutputs >( ) = *( dependentData_.data( ) + i );
+            Eigen::Map< PaddedDependentVariableType >( flatDependentData_.data( ) + i * PaddedNumberOfOutputs ) =
+                    currentNodeData;
+        }
+
+        // Create lookup scheme from independent variable data points.
+        this->makeLookupSchemes( selectedLookupScheme );
+    }
+
+    //! Constructor taking independent and dependent variable data, with single boundary handling method.
+    /*!
+     *  Constructor taking independent and dependent variable data. This constructor only requires one boundary
+     *  handling method, and assumes it for each dimension.
+     *  \param independentValues Vector of vectors containing data points of independent variables,
+     *      each must be sorted in ascending order.
+     *  \param dependentData Multi-dimensional array of dependent data at each point of
+     *      hyper-rectangular grid formed by independent variable points.
+     *  \param selectedLookupScheme Identifier of lookupscheme from enum.
+     *  \param boundaryHandling Boundary handling method, in case independent variable is outside the
+     *      specified range.
+     *  \param defaultExtrapolationValue Default value to be used for extrapolation, in case of use_default_value
+     *      or use_default_value_with_warning as methods for boundaryHandling.
+     */
+    MultiLinearVectorInterpolator(
+            const std::vector< std::vector< double > >& independentValues,
+            const boost::multi_array< DependentVariableType, static_cast< size_t >( NumberOfDimensions ) >& dependentData,
+            const AvailableLookupScheme selectedLookupScheme,
+            const BoundaryInterpolationType boundaryHandling,
+            const DependentVariableType& defaultExtrapolationValue = DependentVariableType::Zero( ) ) :
+        MultiLinearVectorInterpolator( independentValues, dependentData, selectedLookupScheme,
+                                       std::vector< BoundaryInterpolationType >( NumberOfDimensions, boundaryHandling ),
+                                       std::vector< std::pair< DependentVariableType, DependentVariableType > >(
+                                           NumberOfDimensions, std::make_pair( defaultExtrapolationValue,
+                                                                               defaultExtrapolationValue ) ) )
+    { }
+
+    //! Destructor.
+    ~MultiLinearVectorInterpolator( ){ }
+
+    //! Function to perform interpolation.
+    /*!
+     *  This function performs the multilinear interpolation, from a vector of independent variables.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which
+     *      the value of the dependent variables is to be determined.
+     *  \return Interpolated value of dependent variables.
+     */
+    DependentVariableType interpolate( const std::vector< double >& independentValuesToInterpolate )
+    {
+        // Check whether size of independent variable vector is correct
+        if ( independentValuesToInterpolate.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error( "Error in multi-linear vector interpolator. The number of independent variables "
+                                      "provided is incompatible with the previous definition. Provided: " +
+                                      std::to_string( independentValuesToInterpolate.size( ) ) + ". Needed: " +
+                                      std::to_string( NumberOfDimensions ) );
+        }
+
+        boost::array< double, NumberOfDimensions > localIndependentValuesToInterpolate;
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            localIndependentValuesToInterpolate[ i ] = independentValuesToInterpolate[ i ];
+        }
+        return interpolate( localIndependentValuesToInterpolate );
+    }
+
+    //! Function to perform interpolation, without any heap allocation.
+    /*!
+     *  This function performs the multilinear interpolation, from a fixed-size array of independent variables.
+     *  \param independentValuesToInterpolate Values of independent variables at which the value of the dependent variables
+     *      is to be determined.
+     *  \return Interpolated value of dependent variables.
+     */
+    DependentVariableType interpolate( boost::array< double, NumberOfDimensions > independentValuesToInterpolate )
+    {
+        // Check boundaries, and find grid cell and fractions in each dimension
+        bool useValue = false;
+        DependentVariableType boundaryValue;
+        boost::array< double, NumberOfDimensions > upperFractions;
+        int lowerNodeIndex = 0;
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            this->checkBoundaryCase( i, useValue, independentValuesToInterpolate[ i ], boundaryValue );
+            if ( useValue )
+            {
+                return boundaryValue;
+            }
+
+            int nearestLowerIndex = lookUpSchemes_[ i ]->findNearestLowerNeighbour( independentValuesToInterpolate[ i ] );
+            upperFractions[ i ] = ( independentValuesToInterpolate[ i ] - independentValues_[ i ][ nearestLowerIndex ] ) /
+                    ( independentValues_[ i ][ nearestLowerIndex + 1 ] - independentValues_[ i ][ nearestLowerIndex ] );
+            lowerNodeIndex += nearestLowerIndex * nodeStrides_[ i ];
+        }
+
+        // Compute weights and flat data offsets of all cell corners, by successively splitting each corner in two
+        boost::array< double, NumberOfCorners > cornerWeights;
+        boost::array< int, NumberOfCorners > cornerOffsets;
+        cornerWeights[ 0 ] = 1.0;
+        cornerOffsets[ 0 ] = lowerNodeIndex * PaddedNumberOfOutputs;
+        unsigned int numberOfCurrentCorners = 1;
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            for ( unsigned int j = 0; j < numberOfCurrentCorners; j++ )
+            {
+                cornerWeights[ j + numberOfCurrentCorners ] = cornerWeights[ j ] * upperFractions[ i ];
+                cornerOffsets[ j + numberOfCurrentCorners ] = cornerOffsets[ j ] + nodeStrides_[ i ] * PaddedNumberOfOutputs;
+                cornerWeights[ j ] *= ( 1.0 - upperFractions[ i ] );
+            }
+            numberOfCurrentCorners *= 2;
+        }
+
+        // Accumulate weighted dependent variables over all corners
+        PaddedDependentVariableType interpolatedValue = PaddedDependentVariableType::Zero( );
+        for ( unsigned int j = 0; j < NumberOfCorners; j++ )
+        {
+            interpolatedValue += cornerWeights[ j ] * Eigen::Map< const PaddedDependentVariableType, Eigen::Aligned16 >(
+                        flatDependentData_.data( ) + cornerOffsets[ j ] );
+        }
+
+        return interpolatedValue.template head< NumberOfOutputs >( );
+    }
+
+private:
+
+    //! Stride (in number of nodes) in flat data array, for an increment of the index in each dimension.
+    boost::array< int, NumberOfDimensions > nodeStrides_;
+
+    //! Flat, aligned array of dependent variables, with PaddedNumberOfOutputs entries per node.
+    std::vector< double, Eigen::aligned_allocator< double > > flatDependentData_;
+
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_MULTI_LINEAR_VECTOR_INTERPOLATOR_H
@@ -25,6 +25,7 @@
 
 #include <limits>
 #include <cmath>
+#include <functional>
 
 #include <Eigen/Core>
 
@@ -164,6 +165,70 @@ BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Compare78_VanDerPol
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test whether externally halving or doubling the step size reuses the (resampled) history
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_ResampledHistory )
+{
+    // Count the number of state derivative evaluations
+    int numberOfFunctionEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        numberOfFunctionEvaluations++;
+        return computeFehlbergLogirithmicTestODEStateDerivative( time, state );
+    };
+
+    // Initial conditions
+    double initialTime = 0.0;
+    Eigen::VectorXd initialState( 2 );
+    initialState << std::exp( 1.0 ), 1.0;
+
+    // Setup integrator with fixed step size and order
+    double stepSize = 1.0E-3;
+    AdamsBashforthMoultonIntegratorXd integrator_abam(
+                stateDerivativeFunction, initialTime, initialState,
+                std::numeric_limits< double >::epsilon( ), 1.0, 1.0E-12, 1.0E-12 );
+    integrator_abam.setFixedStepSize( true );
+    integrator_abam.setFixedOrder( true );
+
+    // Fill history
+    for( unsigned int i = 0; i < 30; i++ )
+    {
+        integrator_abam.performIntegrationStep( stepSize );
+    }
+
+    // Halve step size: history should be interpolated, so that only the predictor and new derivative are evaluated.
+    double currentTime = integrator_abam.getCurrentIndependentVariable( );
+    int numberOfPreviousFunctionEvaluations = numberOfFunctionEvaluations;
+    integrator_abam.performIntegrationStep( stepSize / 2.0 );
+    BOOST_CHECK_EQUAL( numberOfFunctionEvaluations - numberOfPreviousFunctionEvaluations, 2 );
+    BOOST_CHECK_CLOSE_FRACTION( integrator_abam.getCurrentIndependentVariable( ) - currentTime, stepSize / 2.0,
+                                std::numeric_limits< double >::epsilon( ) * 1.0E3 );
+    BOOST_CHECK_EQUAL( integrator_abam.getNextStepSize( ), stepSize / 2.0 );
+
+    for( unsigned int i = 0; i < 30; i++ )
+    {
+        integrator_abam.performIntegrationStep( stepSize / 2.0 );
+    }
+
+    // Double step size: history should be decimated, so that only the predictor and new derivative are evaluated.
+    currentTime = integrator_abam.getCurrentIndependentVariable( );
+    numberOfPreviousFunctionEvaluations = numberOfFunctionEvaluations;
+    integrator_abam.performIntegrationStep( stepSize );
+    BOOST_CHECK_EQUAL( numberOfFunctionEvaluations - numberOfPreviousFunctionEvaluations, 2 );
+    BOOST_CHECK_CLOSE_FRACTION( integrator_abam.getCurrentIndependentVariable( ) - currentTime, stepSize,
+                                std::numeric_limits< double >::epsilon( ) * 1.0E3 );
+
+    // Continue integration, and compare with analytical solution
+    for( unsigned int i = 0; i < 500; i++ )
+    {
+        integrator_abam.performIntegrationStep( stepSize );
+    }
+    Eigen::VectorXd analyticalState = computeAnalyticalStateFehlbergODE(
+                integrator_abam.getCurrentIndependentVariable( ), initialState );
+    BOOST_CHECK_SMALL( std::fabs( integrator_abam.getCurrentState( )( 0 ) - analyticalState( 0 ) ), 1E-11 );
+    BOOST_CHECK_SMALL( std::fabs( integrator_abam.getCurrentState( )( 1 ) - analyticalState( 1 ) ), 1E-11 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
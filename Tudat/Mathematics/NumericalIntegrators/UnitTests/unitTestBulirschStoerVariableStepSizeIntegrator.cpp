@@ -25,12 +25,15 @@
 
 #include <limits>
 #include <cmath>
+#include <functional>
+#include <stdexcept>
 
 #include <Eigen/Core>
 
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Mathematics/NumericalIntegrators/bulirschStoerVariableStepsizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 #include "Tudat/Mathematics/NumericalIntegrators/UnitTests/numericalIntegratorTestFunctions.h"
@@ -167,6 +170,97 @@ BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_Compare78_VanDerPol )
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test whether concurrent evaluation of the mid-point sequences gives results identical to serial evaluation
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_ParallelSequences )
+{
+    // Initial conditions
+    double initialTime = 0.0;
+    Eigen::VectorXd initialState( 2 );
+    initialState << std::exp( 1.0 ), 1.0;
+    double endTime = 2.0;
+
+    for( unsigned int sequenceType = 0; sequenceType < 2; sequenceType++ )
+    {
+        std::vector< unsigned int > sequence = getBulirschStoerStepSequence(
+                    sequenceType == 0 ? bulirsch_stoer_sequence : deufelhard_sequence, 6 );
+
+        // Integrate with serial evaluation of sequences
+        BulirschStoerVariableStepSizeIntegratorXd serialIntegrator(
+                    sequence, computeFehlbergLogirithmicTestODEStateDerivative, initialTime, initialState,
+                    std::numeric_limits< double >::epsilon( ), 1.0, 1.0E-12, 1.0E-12 );
+        Eigen::VectorXd serialSolution = serialIntegrator.integrateTo( endTime, 0.1 );
+
+        // Integrate with concurrent evaluation of sequences, using shared and separate state derivative functions
+        for( unsigned int testCase = 0; testCase < 2; testCase++ )
+        {
+            std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > >
+                    sequenceStateDerivativeFunctions;
+            if( testCase == 1 )
+            {
+                sequenceStateDerivativeFunctions.resize(
+                            sequence.size( ), &computeFehlbergLogirithmicTestODEStateDerivative );
+            }
+
+            BulirschStoerVariableStepSizeIntegratorXd parallelIntegrator(
+                        sequence, computeFehlbergLogirithmicTestODEStateDerivative, initialTime, initialState,
+                        std::numeric_limits< double >::epsilon( ), 1.0, 1.0E-12, 1.0E-12 );
+            parallelIntegrator.setParallelSequenceEvaluation( 4, sequenceStateDerivativeFunctions );
+            BOOST_CHECK_EQUAL( parallelIntegrator.getNumberOfThreads( ), 4 );
+            Eigen::VectorXd parallelSolution = parallelIntegrator.integrateTo( endTime, 0.1 );
+
+            BOOST_CHECK_EQUAL( parallelIntegrator.getCurrentIndependentVariable( ),
+                               serialIntegrator.getCurrentIndependentVariable( ) );
+            for( int i = 0; i < 2; i++ )
+            {
+                BOOST_CHECK_EQUAL( parallelSolution( i ), serialSolution( i ) );
+            }
+        }
+
+        // Check that inconsistent number of state derivative functions is rejected
+        BOOST_CHECK_THROW( serialIntegrator.setParallelSequenceEvaluation(
+                               4, { &computeFehlbergLogirithmicTestODEStateDerivative } ), std::runtime_error );
+    }
+}
+
+//! Test whether concurrent evaluation of the mid-point sequences is correctly set from the integrator settings
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_ParallelSequencesFromSettings )
+{
+    // Initial conditions
+    double initialTime = 0.0;
+    Eigen::VectorXd initialState( 2 );
+    initialState << std::exp( 1.0 ), 1.0;
+    double endTime = 2.0;
+
+    std::vector< Eigen::VectorXd > solutions;
+    for( int numberOfThreads = 1; numberOfThreads <= 16; numberOfThreads *= 4 )
+    {
+        // Create integrator from settings
+        std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                std::make_shared< BulirschStoerIntegratorSettings< > >(
+                    initialTime, 0.1, bulirsch_stoer_sequence, 6, std::numeric_limits< double >::epsilon( ), 1.0,
+                    1.0E-12, 1.0E-12, 1, false, 0.6, 4.0, 0.1, numberOfThreads );
+        std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+                createIntegrator< double, Eigen::VectorXd >(
+                    computeFehlbergLogirithmicTestODEStateDerivative, initialState, integratorSettings );
+
+        // Check number of threads (limited by length of sequence)
+        std::shared_ptr< BulirschStoerVariableStepSizeIntegratorXd > bulirschStoerIntegrator =
+                std::dynamic_pointer_cast< BulirschStoerVariableStepSizeIntegratorXd >( integrator );
+        BOOST_CHECK_EQUAL( bulirschStoerIntegrator->getNumberOfThreads( ), std::min( numberOfThreads, 6 ) );
+
+        solutions.push_back( integrator->integrateTo( endTime, 0.1 ) );
+    }
+
+    // Check that results are identical
+    for( unsigned int j = 1; j < solutions.size( ); j++ )
+    {
+        for( int i = 0; i < 2; i++ )
+        {
+            BOOST_CHECK_EQUAL( solutions.at( j )( i ), solutions.at( 0 )( i ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,104 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <stdexcept>
+
+#include <Eigen/Core>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/NumericalIntegrators/historyRingBuffer.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_history_ring_buffer )
+
+using namespace numerical_integrators;
+
+//! Test ordering of entries when adding and removing values at both ends of the history.
+BOOST_AUTO_TEST_CASE( testHistoryRingBufferOrdering )
+{
+    HistoryRingBuffer< int > history( 4 );
+    BOOST_CHECK( history.empty( ) );
+    BOOST_CHECK_EQUAL( history.capacity( ), 4 );
+
+    // Add values to front, until buffer wraps around (oldest value is overwritten).
+    for( int i = 0; i < 6; i++ )
+    {
+        history.pushFront( i );
+    }
+    BOOST_CHECK_EQUAL( history.size( ), 4 );
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( history.at( i ), 5 - static_cast< int >( i ) );
+    }
+    BOOST_CHECK_EQUAL( history.front( ), 5 );
+    BOOST_CHECK_EQUAL( history.back( ), 2 );
+
+    // Check bounds checking and full buffer.
+    BOOST_CHECK_THROW( history.at( 4 ), std::out_of_range );
+    BOOST_CHECK_THROW( history.pushBack( 10 ), std::runtime_error );
+
+    // Remove and add values at both ends.
+    history.popFront( );
+    history.pushBack( 1 );
+    history.popBack( );
+    history.popBack( );
+    BOOST_CHECK_EQUAL( history.size( ), 2 );
+    BOOST_CHECK_EQUAL( history.front( ), 4 );
+    BOOST_CHECK_EQUAL( history.back( ), 3 );
+
+    // Truncate and clear.
+    history.resize( 1 );
+    BOOST_CHECK_EQUAL( history.back( ), 4 );
+    BOOST_CHECK_THROW( history.resize( 5 ), std::runtime_error );
+    history.clear( );
+    BOOST_CHECK( history.empty( ) );
+    BOOST_CHECK_THROW( history.popFront( ), std::runtime_error );
+}
+
+//! Test whether storage of dynamically sized values is reused when the buffer wraps around.
+BOOST_AUTO_TEST_CASE( testHistoryRingBufferStorageReuse )
+{
+    HistoryRingBuffer< Eigen::VectorXd > history( 3 );
+    std::vector< const double* > slotData;
+    for( int i = 0; i < 3; i++ )
+    {
+        history.pushFront( Eigen::VectorXd::Constant( 6, static_cast< double >( i ) ) );
+    }
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        slotData.push_back( history[ i ].data( ) );
+    }
+
+    // Copy a value into the history: oldest slot is overwritten, without reallocation.
+    Eigen::VectorXd newValue = Eigen::VectorXd::Constant( 6, 3.0 );
+    history.pushFront( newValue );
+    BOOST_CHECK_EQUAL( history.front( ).data( ), slotData.at( 2 ) );
+    BOOST_CHECK_EQUAL( history.front( )( 0 ), 3.0 );
+    BOOST_CHECK_EQUAL( history.back( )( 0 ), 1.0 );
+
+    // Swap entries in place, without reallocation.
+    std::swap( history[ 0 ], history[ 2 ] );
+    BOOST_CHECK_EQUAL( history[ 0 ].data( ), slotData.at( 1 ) );
+    BOOST_CHECK_EQUAL( history[ 0 ]( 0 ), 1.0 );
+    BOOST_CHECK_EQUAL( history[ 2 ]( 0 ), 3.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
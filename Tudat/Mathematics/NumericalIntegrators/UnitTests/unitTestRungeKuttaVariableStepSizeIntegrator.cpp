@@ -28,15 +28,18 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKutta4Integrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/Mathematics/NumericalIntegrators/UnitTests/numericalIntegratorTestFunctions.h"
 
+#include <algorithm>
 #include <limits>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 namespace tudat
 {
@@ -313,6 +316,77 @@ BOOST_AUTO_TEST_CASE( testVariableStepIntegrateToFunction )
     BOOST_CHECK_CLOSE_FRACTION( fixedStepIntegratedValue.x( ), integratedValue.x( ), 1.0E-10 );
 }
 
+//! Test if steps end at the breakpoints that are set, for a state derivative with a discontinuous derivative.
+BOOST_AUTO_TEST_CASE( testVariableStepBreakpoints )
+{
+    using namespace numerical_integrators;
+
+    // Define state derivative with a discontinuous derivative, and count the number of evaluations.
+    const double discontinuityTime = 1.2345;
+    int numberOfStateDerivativeEvaluations = 0;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& )
+    {
+        numberOfStateDerivativeEvaluations++;
+        return ( Eigen::VectorXd( 1 ) << std::fabs( time - discontinuityTime ) ).finished( );
+    };
+
+    // Integrate without breakpoint, with breakpoint, and with breakpoint set through the integrator settings.
+    std::vector< int > numberOfEvaluations;
+    for( unsigned int testCase = 0; testCase < 3; testCase++ )
+    {
+        std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator;
+        if( testCase < 2 )
+        {
+            integrator = std::make_shared< RungeKuttaVariableStepSizeIntegratorXd >(
+                        RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKutta87DormandPrince ),
+                        stateDerivativeFunction, 0.0, ( Eigen::VectorXd( 1 ) << 0.0 ).finished( ),
+                        1.0E-12, 10.0, 1.0E-12, 1.0E-12 );
+            if( testCase == 1 )
+            {
+                integrator->setStepBreakpoints( std::vector< double >( { 10.0, discontinuityTime } ) );
+            }
+        }
+        else
+        {
+            std::shared_ptr< RungeKuttaVariableStepSizeSettings< > > integratorSettings =
+                    std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                        0.0, 0.1, RungeKuttaCoefficients::rungeKutta87DormandPrince, 1.0E-12, 10.0, 1.0E-12, 1.0E-12 );
+            integratorSettings->stepBreakpoints_ = std::vector< double >( { 10.0, discontinuityTime } );
+            integrator = createIntegrator< double, Eigen::VectorXd >(
+                        stateDerivativeFunction, ( Eigen::VectorXd( 1 ) << 0.0 ).finished( ), integratorSettings );
+        }
+
+        numberOfStateDerivativeEvaluations = 0;
+        std::vector< double > stepEndTimes;
+        double stepSize = 0.1;
+        while( integrator->getCurrentIndependentVariable( ) < 5.0 )
+        {
+            integrator->performIntegrationStep( stepSize );
+            stepSize = integrator->getNextStepSize( );
+            stepEndTimes.push_back( integrator->getCurrentIndependentVariable( ) );
+        }
+        numberOfEvaluations.push_back( numberOfStateDerivativeEvaluations );
+
+        // Check that a step ends at the breakpoint, and that the solution is exact in that case.
+        if( testCase > 0 )
+        {
+            BOOST_CHECK_EQUAL( std::count( stepEndTimes.begin( ), stepEndTimes.end( ), discontinuityTime ), 1 );
+            const double finalTime = integrator->getCurrentIndependentVariable( );
+            BOOST_CHECK_CLOSE_FRACTION(
+                        integrator->getCurrentState( )( 0 ),
+                        0.5 * ( discontinuityTime * discontinuityTime +
+                                ( finalTime - discontinuityTime ) * ( finalTime - discontinuityTime ) ),
+                        1.0E-13 );
+        }
+    }
+
+    // Check that far fewer state derivative evaluations are needed when using the breakpoint, as steps across the
+    // discontinuity are rejected repeatedly otherwise.
+    BOOST_CHECK_LT( 4 * numberOfEvaluations.at( 1 ), numberOfEvaluations.at( 0 ) );
+    BOOST_CHECK_EQUAL( numberOfEvaluations.at( 2 ), numberOfEvaluations.at( 1 ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -21,14 +21,15 @@
 #ifndef TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 #define TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 
-#include <deque>
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include <memory>
 
 #include <Eigen/Core>
 
+#include "Tudat/Mathematics/NumericalIntegrators/historyRingBuffer.h"
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
@@ -110,7 +111,11 @@ public:
           maximumStepSize_( std::fabs( static_cast< double >( maximumStepSize ) ) ),
           relativeErrorTolerance_( relativeErrorTolerance.array( ).abs( ) ),
           absoluteErrorTolerance_( absoluteErrorTolerance.array( ).abs( ) ),
-          bandwidth_( std::fabs( static_cast< double >( bandwidth ) ) )
+          bandwidth_( std::fabs( static_cast< double >( bandwidth ) ) ),
+          stateHistory_( maximumHistorySize ),
+          derivHistory_( maximumHistorySize ),
+          halvingStateWorkspace_( maximumHistorySize / 2 ),
+          halvingDerivativeWorkspace_( maximumHistorySize / 2 )
     {
         fixedStepSize_ = false;
         strictCompare_ = true;
@@ -121,9 +126,9 @@ public:
         stepSize_ = 1.;
         fixedSingleStep_ = fixedStepSize_;
         
-        // Start filling the state and state derivative history deques.
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_(
+        // Start filling the state and state derivative histories.
+        stateHistory_.pushFront( currentState_ );
+        derivHistory_.pushFront( this->stateDerivativeFunction_(
                                       currentIndependentVariable_, currentState_ ));
     }
 
@@ -218,20 +223,29 @@ public:
      */
     virtual StateType performIntegrationStep( const TimeStepType stepSize )
     {
-        // If stepSize is not same as old, clear the step-size dependent histories.
+        // If stepSize is not same as old, the step-size dependent histories must be modified.
         if ( stepSize != stepSize_ )
         {
-            // Pop all values from the history deque (the history is
-            // invalid as it is dependent on the stepSize), except for
-            // the current state and state derivative.
-            while ( stateHistory_.size( ) > 1 )
+            unsigned int possibleOrder = std::min( stateHistory_.size( ), derivHistory_.size( ) );
+
+            // Resample the history at the new step size if it is half or double the current step size, and
+            // sufficient history is available.
+            if ( stepSize == stepSize_ / 2.0 && possibleOrder >= minimumOrder_ && possibleOrder >= order_ )
             {
-                stateHistory_.pop_back( );
+                halveHistoryStepSize( possibleOrder );
+                return performIntegrationStep( );
             }
-            while ( derivHistory_.size( ) > 1 )
+            else if ( stepSize == stepSize_ * 2.0 && possibleOrder >= 2 * order_ )
             {
-                derivHistory_.pop_back( );
+                doubleHistoryStepSize( 0 );
+                return performIntegrationStep( );
             }
+
+            // Clear all values from the history (the history is
+            // invalid as it is dependent on the stepSize), except for
+            // the current state and state derivative.
+            stateHistory_.resize( 1 );
+            derivHistory_.resize( 1 );
             stepSize_ = stepSize;
             
             // Allow single step integrator to determine own stepsize
@@ -256,55 +270,45 @@ public:
 
         // Remove old elements so enough are left to calculate predicted and corrected.
         // max twice the order, to facilitatie a doubling, halving, and order change.
-        while ( stateHistory_.size( ) > order_ * 2 )
-        {
-            stateHistory_.pop_back( );
-        }
-        while ( derivHistory_.size( ) > order_ * 2 )
-        {
-            derivHistory_.pop_back( );
-        }
+        stateHistory_.resize( std::min( stateHistory_.size( ), order_ * 2 ) );
+        derivHistory_.resize( std::min( derivHistory_.size( ), order_ * 2 ) );
         unsigned int sizeStateHistory = stateHistory_.size( );
         unsigned int sizeDerivativeHistory = derivHistory_.size( );
         unsigned int possibleOrder = std::min( sizeStateHistory, sizeDerivativeHistory );
 
-        StateType correctedState;
-        StateType predictedState;
-
         // Check if enough history steps are available to perform AM
         // step if not use a single-step method.
         if ( possibleOrder < minimumOrder_ || possibleOrder < order_ )
         {
-            correctedState = performSingleStep( );
+            correctedState_ = performSingleStep( );
         }
         else
         {
-            StateType predictedState = performPredictorStep( order_, false );
+            performPredictorStep( order_, false, predictedState_ );
             predictedDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_ +
-                                                                   stepSize_, predictedState );
-            correctedState  = performCorrectorStep( predictedState, order_, false );
-            absoluteError_ = estimateAbsoluteError( predictedState, correctedState, order_ );
-            relativeError_ = estimateRelativeError( predictedState, correctedState, absoluteError_ );
+                                                                   stepSize_, predictedState_ );
+            performCorrectorStep( predictedState_, order_, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_, absoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, absoluteError_, relativeError_ );
         }
 
         // Change order to one that gives a higher predicted accuracy
         // Add tolenaces
-        StateType predictorAbsoluteError;
-        StateType predictorRelativeError;
         
         // If order is not fixed, order is not max yet and enough
         // history is available, then predict the error of an order
         // more.
         if ( !fixedOrder_ && order_ < maximumOrder_ && order_ < possibleOrder )
         {
-            predictedState = performPredictorStep( order_ + 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ + 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ + 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ + 1, false, predictedState_ );
+            performCorrectorStep( predictedState_, order_ + 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ + 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_,
+                                   predictorRelativeError_ );
 
             // If the predicted error is less than the current error,
             // increase the error.
-            if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
+            if ( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) )
             {
                 
                 order_++;
@@ -315,84 +319,33 @@ public:
         }
         else if ( !fixedOrder_ && order_ > minimumOrder_ && order_ - 1 <= possibleOrder )
         {
-            predictedState = performPredictorStep( order_ - 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ - 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ - 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ - 1, false, predictedState_ );
+            performCorrectorStep( predictedState_, order_ - 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ - 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_,
+                                   predictorRelativeError_ );
             // If it is less than the current order, lower the order.
-            if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
+            if ( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) )
             {
                 order_--;
             } else {
-                predictorAbsoluteError = absoluteError_;
-                predictorRelativeError = relativeError_;
+                predictorAbsoluteError_ = absoluteError_;
+                predictorRelativeError_ = relativeError_;
             }
         }
         else
         {
-            predictorAbsoluteError = absoluteError_;
-            predictorRelativeError = relativeError_;
+            predictorAbsoluteError_ = absoluteError_;
+            predictorRelativeError_ = relativeError_;
         }
 
         // If the error (after order change) is too big, stepsize
         // isn't fixed and will not become too small, then halve the
         // stepsize.
-        if ( errorTooLarge( predictorAbsoluteError, predictorRelativeError )
+        if ( errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ )
              && std::fabs( stepSize_ / 2.0 )> minimumStepSize_ && !fixedStepSize_ )
         {
-            // Set up new data for halving
-            std::deque< StateType > tempStateHistory;
-            std::deque< StateType > tempDerivativeHistory;
-            StateType midState = currentState_;
-            StateDerivativeType midDerivative = midState;
-            unsigned int interpolationStateIndex;
-            unsigned int interpolationDerivativeIndex;
-
-            // Only if there is enough historical data, is it possible to create the intermediate
-            // points. Redefine order based on available data, it could drop, but can't be lower
-            // that minimum order
-            unsigned int possibleHalvingOrder = std::min( 2 * possibleOrder - 1, maximumOrder_ );
-            order_ = std::min( possibleHalvingOrder, order_ );
-            
-            // FIXME: make this a setting?
-            // Reduce order. Too much backlog aversly affects the accuracy when halving.
-            if( order_ > minimumOrder_ )
-            {
-                order_ = minimumOrder_;
-            }
-            
-            for( unsigned int i = 0; i < possibleHalvingOrder ; i++ )
-            {
-                // If states are even, they already exist, no need to interpolate
-                if ( i % 2 == 0 )
-                {
-                    tempStateHistory.push_back( stateHistory_.at( i / 2 ));
-                    tempDerivativeHistory.push_back( derivHistory_.at( i / 2 ));
-                } else {
-                    // Reset midpoint state and deriv to zero
-                    midState = 0 * midState;
-                    midDerivative = midState;
-                    interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + ( i - 1 ) / 2;
-                    interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
-                    for( unsigned int j = 0; j < order_; j++ )
-                    {
-                        midState += interpolationCoefficients[ interpolationStateIndex ][ j ] *
-                                stateHistory_.at( j ) + interpolationCoefficients[ interpolationStateIndex ][ order_ + j ] *
-                                derivHistory_.at( j ) * stepSize_;
-                        midDerivative += interpolationCoefficients[ interpolationDerivativeIndex ][ j ] *
-                                stateHistory_.at( j ) / stepSize_
-                                + interpolationCoefficients[ interpolationDerivativeIndex ][ order_ + j ] *
-                                derivHistory_.at( j );
-                    }
-                    tempStateHistory.push_back( midState );
-                    tempDerivativeHistory.push_back( midDerivative );
-                }
-            }
-            
-            // Set the new history and stepsize
-            stateHistory_ = tempStateHistory;
-            derivHistory_ = tempDerivativeHistory;
-            stepSize_ = stepSize_ / 2.0;
+            halveHistoryStepSize( possibleOrder );
             
             // Temporarily turn halving off.
             fixedStepSize_ = true;
@@ -404,7 +357,7 @@ public:
         // If the error (after order change ) is too small, the
         // stepsize isn't fixed and the and will not become too big,
         // then double the stepsize.
-        if ( errorTooSmall( predictorAbsoluteError, predictorRelativeError )
+        if ( errorTooSmall( predictorAbsoluteError_, predictorRelativeError_ )
              && sizeDerivativeHistory >= 2 * order_
              && std::fabs( stepSize_ * 2.0 ) <= maximumStepSize_ && !fixedStepSize_ )
         {
@@ -418,44 +371,26 @@ public:
             // 2. The difference in the derivative of the predicted state (predictedDerivative_)
             //    at the normal stepsize (already computed) with the doubled stepsize (not computed)
             //    is neglibile. This assumption saves one function evaluation.
-            // It's possible to reuse previously defined variables here except for correctedState
+            // It's possible to reuse previously defined variables here except for correctedState_
             // which is still used below.
-            predictedState = performPredictorStep( order_ , true );
-            StateType doubleStepCorrectedState = performCorrectorStep( predictedState, order_, true );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, doubleStepCorrectedState, order_ );
-            predictorRelativeError = estimateRelativeError( predictedState, doubleStepCorrectedState,
-                                                            predictorAbsoluteError );
+            performPredictorStep( order_ , true, predictedState_ );
+            performCorrectorStep( predictedState_, order_, true, doubleStepCorrectedState_ );
+            estimateAbsoluteError( predictedState_, doubleStepCorrectedState_, order_, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, doubleStepCorrectedState_, predictorAbsoluteError_,
+                                   predictorRelativeError_ );
 
             // Only update the history if the error will not be too large
-            if ( !errorTooLarge( predictorAbsoluteError, predictorRelativeError ) )
+            if ( !errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ ) )
             {
-                // Note that the history should be at least 7 to allow successful
-                // continuation of the AM scheme.
-                std::deque< StateType > tempStateHistory;
-                std::deque< StateType > tempDerivativeHistory;
-                
-                // Use old history to fill new history, skipping every other entry starting at 1
-                for( unsigned int i = 1; i < sizeStateHistory; i += 2 )
-                {
-                    tempStateHistory.push_back( stateHistory_.at( i ));
-                }
-                for( unsigned int i = 1; i < sizeDerivativeHistory; i += 2 )
-                {
-                    tempDerivativeHistory.push_back( derivHistory_.at( i ));
-                }
-                
-                // Set the new history and stepsize
-                stateHistory_ = tempStateHistory;
-                derivHistory_ = tempDerivativeHistory;
-                stepSize_ = stepSize_ * 2.0;
+                doubleHistoryStepSize( 1 );
             }
         } // end if ( errorTooSmall( ...
 
         // Move computed state to history
         currentIndependentVariable_ += lastStepSize_;
-        currentState_ = correctedState;
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_(
+        currentState_ = correctedState_;
+        stateHistory_.pushFront( currentState_ );
+        derivHistory_.pushFront( this->stateDerivativeFunction_(
                                       currentIndependentVariable_, currentState_ ) );
         return currentState_;
     }
@@ -476,15 +411,15 @@ public:
         }
         currentIndependentVariable_ = lastIndependentVariable_;
         stepSize_ = lastStepSize_;
-        stateHistory_.push_back( lastState_ );
-        derivHistory_.push_back( lastDerivative_ );
-        stateHistory_.pop_front( );
-        derivHistory_.pop_front( );
-        derivHistory_.pop_front( );
+        stateHistory_.pushBack( lastState_ );
+        derivHistory_.pushBack( lastDerivative_ );
+        stateHistory_.popFront( );
+        derivHistory_.popFront( );
+        derivHistory_.popFront( );
         currentState_ = stateHistory_.front( );
         // Recalculate the derivative in order to make sure that all
         // update functions inside state derivative model get reactivated
-        derivHistory_.push_front( this->stateDerivativeFunction_(
+        derivHistory_.pushFront( this->stateDerivativeFunction_(
                                       currentIndependentVariable_, currentState_ ) );
         return true;
     }
@@ -757,6 +692,13 @@ protected:
      */
     //RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateType, TimeStepType > singleStepIntegrator_;
 
+    //! Capacity of the state and derivative histories.
+    /*!
+     * Capacity of the state and derivative histories: twice the maximum order for which coefficients are
+     * available (12), plus the entries added when taking a step and when rolling back.
+     */
+    static const unsigned int maximumHistorySize = 26;
+
     //! Truncation error coefficients.
     /*!
      * Coefficients for estimating the truncation error.
@@ -826,7 +768,7 @@ protected:
         }
         
         // Even if a different step size is suggested, let's stick with the old one, since the goal is to start
-        // filling up the deque at a constant stepsize interval
+        // filling up the history at a constant stepsize interval
         stepSize_ = lastStepSize_; // singleStepIntegrator_.getNextStepSize( );
 
         // Disregard the ABAM error control in the performIntegrationStep function when using single steps.
@@ -841,20 +783,19 @@ protected:
      * Using the order find predicted estimate using the Adams-Bashforth predictor
      * \param order Order of the integration.
      * \param doubleStep Boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return state after predictor step
+     * \param predictedState State after predictor step (returned by reference).
      */
-    StateType performPredictorStep( unsigned int order, bool doubleStep )
+    void performPredictorStep( unsigned int order, bool doubleStep, StateType& predictedState )
     {
         // Calculate predicted state
         unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType predictedState = stateHistory_.at( stepsToSkip );
+        predictedState = stateHistory_[ stepsToSkip ];
         for ( unsigned int i = 0; i < order; i++ )
         {
             predictedState += extrapolationCoefficients[ order * 2 - 2 ][ i ] * stepSize *
-                    derivHistory_.at( i * ( stepsToSkip + 1 ) + stepsToSkip );
+                    derivHistory_[ i * ( stepsToSkip + 1 ) + stepsToSkip ];
         }
-        return predictedState;
     }
 
     //! Perform correcter step.
@@ -863,20 +804,20 @@ protected:
      * \param predictedState by the predictor.
      * \param order of the integration.
      * \param doubleStep boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return  after corrector step
+     * \param correctedState State after corrector step (returned by reference).
      */
-    StateType performCorrectorStep( StateType predictedState, unsigned int order, bool doubleStep )
+    void performCorrectorStep( const StateType& predictedState, unsigned int order, bool doubleStep,
+                               StateType& correctedState )
     {
         unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
         TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType correctedState = stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
+        correctedState = stateHistory_[ stepsToSkip ] + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
                 stepSize * predictedDerivative_;
         for ( unsigned int i = 1; i < order; i++ )
         {
             correctedState += stepSize * extrapolationCoefficients[ order * 2 - 1 ][ i ] *
-                    derivHistory_.at( ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip );
+                    derivHistory_[ ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip ];
         }
-        return correctedState;
     }
 
     //! Estimate the absolute error
@@ -885,12 +826,13 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param order of the integration.
-     * \return absolute error vector.
+     * \param absoluteError absolute error vector (returned by reference).
      */
-    StateType estimateAbsoluteError( StateType predictedState, StateType correctedState, unsigned int order )
+    void estimateAbsoluteError( const StateType& predictedState, const StateType& correctedState,
+                                unsigned int order, StateType& absoluteError )
     {
         // Estimate the maximum truncation error
-        return truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
+        absoluteError = truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
     }
 
     //! Estimate the relative error
@@ -899,12 +841,13 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param absoluteError
-     * \return relative error vector.
+     * \param relativeError relative error vector (returned by reference).
      */
-    StateType estimateRelativeError( StateType predictedState, StateType correctedState, StateType absoluteError )
+    void estimateRelativeError( const StateType& predictedState, const StateType& correctedState,
+                                const StateType& absoluteError, StateType& relativeError )
     {
         // Estimate the maximum truncation error
-        return absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
+        relativeError = absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
     }
 
     //! Compare two errors
@@ -917,23 +860,23 @@ protected:
      * \param relativeError2 relative error two.
      * \return true if one is better than two, false otherwise.
      */
-    bool errorCompare( StateType absoluteError1, StateType relativeError1,
-                       StateType absoluteError2, StateType relativeError2 )
+    bool errorCompare( const StateType& absoluteError1, const StateType& relativeError1,
+                       const StateType& absoluteError2, const StateType& relativeError2 )
     {
-        // Find compound error
-        StateType c1 = absoluteError1.cwiseMin( relativeError1 );
-        StateType c2 = absoluteError2.cwiseMin( relativeError2 );
+        // Compare compound errors
         bool oneBetter = true;
         if( strictCompare_ )
         {
             // Needs to be better or equal for each component
-            for( int i = 0; i < c1.size( ); ++i )
+            for( int i = 0; i < absoluteError1.size( ); ++i )
             {
-                oneBetter = oneBetter && ( c1( i ) <= c2( i ) );
+                oneBetter = oneBetter && ( std::min( absoluteError1( i ), relativeError1( i ) ) <=
+                                           std::min( absoluteError2( i ), relativeError2( i ) ) );
             }
         } else {
             // Needs to be overal better
-            oneBetter = ( c1.norm( ) <= c2.norm( ) );
+            oneBetter = ( absoluteError1.cwiseMin( relativeError1 ).norm( ) <=
+                          absoluteError2.cwiseMin( relativeError2 ).norm( ) );
         }
         return oneBetter;
     }
@@ -946,7 +889,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too big, false if within limits
      */
-    bool errorTooLarge( StateType absoluteError, StateType relativeError )
+    bool errorTooLarge( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components needs to be below the upper limit (tol)
@@ -967,7 +910,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too small, false if within limits
      */
-    bool errorTooSmall( StateType absoluteError, StateType relativeError )
+    bool errorTooSmall( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components need to be above lower limit ( tol / bw )
@@ -980,6 +923,111 @@ protected:
         return belowLimit;
     }
 
+    //! Halve the step size, and resample the history at the new step size.
+    /*!
+     * Halves the step size, and resamples the state and derivative history at the new step size. The existing
+     * entries are kept (at the even indices), and the mid-points are interpolated using the precomputed
+     * interpolation coefficients. The history is rearranged in place, without allocating new storage.
+     * \param possibleOrder Maximum order that is possible with the current history.
+     */
+    void halveHistoryStepSize( const unsigned int possibleOrder )
+    {
+        unsigned int interpolationStateIndex;
+        unsigned int interpolationDerivativeIndex;
+
+        // Only if there is enough historical data, is it possible to create the intermediate
+        // points. Redefine order based on available data, it could drop, but can't be lower
+        // that minimum order
+        unsigned int possibleHalvingOrder = std::min( 2 * possibleOrder - 1, maximumOrder_ );
+        order_ = std::min( possibleHalvingOrder, order_ );
+
+        // FIXME: make this a setting?
+        // Reduce order. Too much backlog aversly affects the accuracy when halving.
+        if( order_ > minimumOrder_ )
+        {
+            order_ = minimumOrder_;
+        }
+
+        // Interpolate the mid-points from the current history.
+        for( unsigned int i = 1; i < possibleHalvingOrder; i += 2 )
+        {
+            StateType& midState = halvingStateWorkspace_[ ( i - 1 ) / 2 ];
+            StateDerivativeType& midDerivative = halvingDerivativeWorkspace_[ ( i - 1 ) / 2 ];
+
+            // Reset midpoint state and deriv to zero
+            midState.setZero( currentState_.rows( ), currentState_.cols( ) );
+            midDerivative.setZero( currentState_.rows( ), currentState_.cols( ) );
+            interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + ( i - 1 ) / 2;
+            interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
+            for( unsigned int j = 0; j < order_; j++ )
+            {
+                midState += interpolationCoefficients[ interpolationStateIndex ][ j ] *
+                        stateHistory_[ j ] + interpolationCoefficients[ interpolationStateIndex ][ order_ + j ] *
+                        derivHistory_[ j ] * stepSize_;
+                midDerivative += interpolationCoefficients[ interpolationDerivativeIndex ][ j ] *
+                        stateHistory_[ j ] / stepSize_
+                        + interpolationCoefficients[ interpolationDerivativeIndex ][ order_ + j ] *
+                        derivHistory_[ j ];
+            }
+        }
+
+        // Rearrange the history in place, starting from the oldest entry: entry i / 2 moves to (even) entry i, and
+        // the mid-points are swapped into the odd entries.
+        stateHistory_.resize( possibleHalvingOrder );
+        derivHistory_.resize( possibleHalvingOrder );
+        for( unsigned int i = possibleHalvingOrder - 1; i > 0; i-- )
+        {
+            if ( i % 2 == 0 )
+            {
+                std::swap( stateHistory_[ i ], stateHistory_[ i / 2 ] );
+                std::swap( derivHistory_[ i ], derivHistory_[ i / 2 ] );
+            }
+            else
+            {
+                std::swap( stateHistory_[ i ], halvingStateWorkspace_[ ( i - 1 ) / 2 ] );
+                std::swap( derivHistory_[ i ], halvingDerivativeWorkspace_[ ( i - 1 ) / 2 ] );
+            }
+        }
+
+        stepSize_ = stepSize_ / 2.0;
+    }
+
+    //! Double the step size, and resample the history at the new step size.
+    /*!
+     * Doubles the step size, and resamples the state and derivative history at the new step size, by keeping every
+     * other entry. The history is rearranged in place, without allocating new storage.
+     * \param firstEntry Index of the first entry of the current history that is kept: 1 if the state of the step that
+     *          is currently being taken (at the old step size) is still to be added to the history, 0 if the next step
+     *          is taken at the doubled step size.
+     */
+    void doubleHistoryStepSize( const unsigned int firstEntry )
+    {
+        // Note that the history should be at least 7 to allow successful
+        // continuation of the AM scheme.
+        unsigned int newStateHistorySize = ( stateHistory_.size( ) + 1 - firstEntry ) / 2;
+        unsigned int newDerivativeHistorySize = ( derivHistory_.size( ) + 1 - firstEntry ) / 2;
+
+        // Use old history to fill new history, skipping every other entry
+        for( unsigned int i = 0; i < newStateHistorySize; i++ )
+        {
+            if( 2 * i + firstEntry != i )
+            {
+                std::swap( stateHistory_[ i ], stateHistory_[ 2 * i + firstEntry ] );
+            }
+        }
+        for( unsigned int i = 0; i < newDerivativeHistorySize; i++ )
+        {
+            if( 2 * i + firstEntry != i )
+            {
+                std::swap( derivHistory_[ i ], derivHistory_[ 2 * i + firstEntry ] );
+            }
+        }
+        stateHistory_.resize( newStateHistorySize );
+        derivHistory_.resize( newDerivativeHistorySize );
+
+        stepSize_ = stepSize_ * 2.0;
+    }
+
 
     //! Last used step size.
     /*!
@@ -996,15 +1044,36 @@ protected:
 
     //! State history.
     /*!
-     * History of states, dynamic deque size depends on order.
+     * History of states (most recent first), fixed capacity, size depends on order.
      */
-    std::deque<StateType> stateHistory_;
+    HistoryRingBuffer< StateType > stateHistory_;
 
     //! Derivative history.
     /*!
-     * History of derivatives, dynamic deque size depends on order.
+     * History of derivatives (most recent first), fixed capacity, size depends on order.
      */
-    std::deque<StateType> derivHistory_;
+    HistoryRingBuffer< StateType > derivHistory_;
+
+    //! Workspace for the state mid-points that are interpolated when halving the step size.
+    std::vector< StateType > halvingStateWorkspace_;
+
+    //! Workspace for the derivative mid-points that are interpolated when halving the step size.
+    std::vector< StateType > halvingDerivativeWorkspace_;
+
+    //! Predicted state of the current step (workspace).
+    StateType predictedState_;
+
+    //! Corrected state of the current step (workspace).
+    StateType correctedState_;
+
+    //! Corrected state for a doubled step, used to estimate the error after doubling (workspace).
+    StateType doubleStepCorrectedState_;
+
+    //! Absolute truncation error at the order (and step size) that is selected for the next step (workspace).
+    StateType predictorAbsoluteError_;
+
+    //! Relative truncation error at the order (and step size) that is selected for the next step (workspace).
+    StateType predictorRelativeError_;
 
     //! Last state.
     /*!
@@ -0,0 +1,208 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Mathematics/NumericalIntegrators/batchRungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Constructor.
+BatchRungeKuttaVariableStepSizeIntegrator::BatchRungeKuttaVariableStepSizeIntegrator(
+        const RungeKuttaCoefficients& coefficients,
+        const BatchStateDerivativeFunction& stateDerivativeFunction,
+        const double intervalStart,
+        const Eigen::ArrayXXd& initialStates,
+        const double initialStepSize,
+        const double minimumStepSize,
+        const double maximumStepSize,
+        const double relativeErrorTolerance,
+        const double absoluteErrorTolerance,
+        const double safetyFactorForNextStepSize,
+        const double maximumFactorIncreaseForNextStepSize,
+        const double minimumFactorDecreaseForNextStepSize ):
+    coefficients_( coefficients ),
+    stateDerivativeFunction_( stateDerivativeFunction ),
+    currentStates_( initialStates ),
+    currentIndependentVariables_( Eigen::ArrayXd::Constant( initialStates.rows( ), intervalStart ) ),
+    stepSizes_( Eigen::ArrayXd::Constant( initialStates.rows( ), initialStepSize ) ),
+    integrationDirection_( ( initialStepSize < 0.0 ) ? -1.0 : 1.0 ),
+    minimumStepSize_( std::fabs( minimumStepSize ) ),
+    maximumStepSize_( std::fabs( maximumStepSize ) ),
+    relativeErrorTolerance_( std::fabs( relativeErrorTolerance ) ),
+    absoluteErrorTolerance_( std::fabs( absoluteErrorTolerance ) ),
+    safetyFactorForNextStepSize_( std::fabs( safetyFactorForNextStepSize ) ),
+    maximumFactorIncreaseForNextStepSize_( std::fabs( maximumFactorIncreaseForNextStepSize ) ),
+    minimumFactorDecreaseForNextStepSize_( std::fabs( minimumFactorDecreaseForNextStepSize ) ),
+    useStepSizeControl_( true ),
+    numberOfStateDerivativeFunctionCalls_( 0 ),
+    numberOfAcceptedSteps_( 0 )
+{
+    if( initialStepSize == 0.0 )
+    {
+        throw std::runtime_error( "Error in batch Runge-Kutta integrator, initial step size is zero" );
+    }
+
+    intervalEnd_ = integrationDirection_ * std::numeric_limits< double >::infinity( );
+
+    // Allocate workspace for all stages.
+    const int numberOfLanes = initialStates.rows( );
+    const int numberOfStages = coefficients_.cCoefficients.rows( );
+    stageStateDerivatives_.resize( numberOfStages );
+    for( int stage = 0; stage < numberOfStages; stage++ )
+    {
+        stageStateDerivatives_[ stage ].resize( numberOfLanes, initialStates.cols( ) );
+    }
+    intermediateStates_.resize( numberOfLanes, initialStates.cols( ) );
+    intermediateIndependentVariables_.resize( numberOfLanes );
+    lowerOrderIncrements_.resize( numberOfLanes, initialStates.cols( ) );
+    higherOrderIncrements_.resize( numberOfLanes, initialStates.cols( ) );
+    usedStepSizes_.resize( numberOfLanes );
+    isLaneActive_.resize( numberOfLanes );
+    isFinalStep_.resize( numberOfLanes );
+    isStepAccepted_.resize( numberOfLanes );
+}
+
+//! Perform a single (attempted) integration step for all lanes.
+int BatchRungeKuttaVariableStepSizeIntegrator::performIntegrationStep( )
+{
+    // Determine which lanes are to be integrated, and shorten the step of lanes that reach the end of the interval.
+    isLaneActive_ = ( integrationDirection_ * ( intervalEnd_ - currentIndependentVariables_ ) ) > 0.0;
+    isFinalStep_ = ( intervalEnd_ - currentIndependentVariables_ ).abs( ) <=
+            stepSizes_.abs( ) * ( 1.0 + std::numeric_limits< double >::epsilon( ) );
+    usedStepSizes_ = isLaneActive_.select(
+                isFinalStep_.select( intervalEnd_ - currentIndependentVariables_, stepSizes_ ), 0.0 );
+
+    if( !isLaneActive_.any( ) )
+    {
+        return 0;
+    }
+
+    // Compute the state derivatives per stage, for all lanes simultaneously.
+    lowerOrderIncrements_.setZero( );
+    higherOrderIncrements_.setZero( );
+    for( unsigned int stage = 0; stage < stageStateDerivatives_.size( ); stage++ )
+    {
+        intermediateStates_ = currentStates_;
+        for( unsigned int column = 0; column < stage; column++ )
+        {
+            if( coefficients_.aCoefficients( stage, column ) != 0.0 )
+            {
+                intermediateStates_ += stageStateDerivatives_[ column ].colwise( ) *
+                        ( coefficients_.aCoefficients( stage, column ) * usedStepSizes_ );
+            }
+        }
+        intermediateIndependentVariables_ = currentIndependentVariables_ +
+                coefficients_.cCoefficients( stage ) * usedStepSizes_;
+
+        stateDerivativeFunction_(
+                    intermediateIndependentVariables_, intermediateStates_, stageStateDerivatives_[ stage ] );
+        numberOfStateDerivativeFunctionCalls_++;
+
+        if( coefficients_.bCoefficients( 0, stage ) != 0.0 )
+        {
+            lowerOrderIncrements_ += coefficients_.bCoefficients( 0, stage ) * stageStateDerivatives_[ stage ];
+        }
+        if( coefficients_.bCoefficients( 1, stage ) != 0.0 )
+        {
+            higherOrderIncrements_ += coefficients_.bCoefficients( 1, stage ) * stageStateDerivatives_[ stage ];
+        }
+    }
+
+    // Compute higher order estimate, and determine which steps are accepted.
+    intermediateStates_ = currentStates_ + higherOrderIncrements_.colwise( ) * usedStepSizes_;
+    computeNewStepSizesAndValidateResults( );
+
+    // Set the new states of all lanes for which the step is accepted.
+    if( coefficients_.orderEstimateToIntegrate == RungeKuttaCoefficients::lower )
+    {
+        intermediateStates_ = currentStates_ + lowerOrderIncrements_.colwise( ) * usedStepSizes_;
+    }
+    currentStates_ = isStepAccepted_.replicate( 1, currentStates_.cols( ) ).select(
+                intermediateStates_, currentStates_ );
+    currentIndependentVariables_ = isStepAccepted_.select(
+                isFinalStep_.select( intervalEnd_, currentIndependentVariables_ + usedStepSizes_ ),
+                currentIndependentVariables_ );
+
+    const int numberOfAcceptedLaneSteps = isStepAccepted_.count( );
+    numberOfAcceptedSteps_ += numberOfAcceptedLaneSteps;
+    return numberOfAcceptedLaneSteps;
+}
+
+//! Perform an integration of all lanes to a specified independent variable value.
+const Eigen::ArrayXXd& BatchRungeKuttaVariableStepSizeIntegrator::integrateTo( const double intervalEnd )
+{
+    if( ( integrationDirection_ * ( intervalEnd - currentIndependentVariables_ ) < 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Error in batch Runge-Kutta integrator, end of interval is in wrong direction" );
+    }
+
+    intervalEnd_ = intervalEnd;
+    while( ( currentIndependentVariables_ != intervalEnd_ ).any( ) )
+    {
+        performIntegrationStep( );
+    }
+    intervalEnd_ = integrationDirection_ * std::numeric_limits< double >::infinity( );
+
+    return currentStates_;
+}
+
+//! Function to compute the new step size of each lane, and determine which lanes' steps are accepted.
+void BatchRungeKuttaVariableStepSizeIntegrator::computeNewStepSizesAndValidateResults( )
+{
+    if( !useStepSizeControl_ )
+    {
+        isStepAccepted_ = isLaneActive_;
+        return;
+    }
+
+    // Compute maximum relative truncation error per lane, with error estimated from difference between
+    // higher and lower order estimates.
+    const Eigen::ArrayXd maximumErrorInState =
+            ( ( ( higherOrderIncrements_ - lowerOrderIncrements_ ).colwise( ) * usedStepSizes_ ).abs( ) /
+              ( intermediateStates_.abs( ) * relativeErrorTolerance_ + absoluteErrorTolerance_ ) ).rowwise( ).maxCoeff( );
+
+    // Compute step size factors, limited to allowed range (Montenbruck and Gill, 2005).
+    const Eigen::ArrayXd stepSizeFactors = ( safetyFactorForNextStepSize_ * maximumErrorInState.pow(
+                                                 -1.0 / static_cast< double >( coefficients_.higherOrder ) ) ).
+            max( minimumFactorDecreaseForNextStepSize_ ).min( maximumFactorIncreaseForNextStepSize_ );
+
+    // Update step sizes of active lanes, limited to maximum step size.
+    stepSizes_ = isLaneActive_.select(
+                integrationDirection_ * ( usedStepSizes_ * stepSizeFactors ).abs( ).min( maximumStepSize_ ), stepSizes_ );
+
+    // Check if minimum step size is violated.
+    if( ( isLaneActive_ && ( stepSizes_.abs( ) < minimumStepSize_ ) ).any( ) )
+    {
+        int violatingLane;
+        ( isLaneActive_.cast< double >( ) * ( stepSizes_.abs( ) < minimumStepSize_ ).cast< double >( ) ).maxCoeff(
+                    &violatingLane );
+        throw std::runtime_error( "Error in batch Runge-Kutta integrator, minimum step size exceeded in lane " +
+                                  std::to_string( violatingLane ) + ", step size " +
+                                  std::to_string( stepSizes_( violatingLane ) ) );
+    }
+
+    isStepAccepted_ = isLaneActive_ && ( maximumErrorInState <= 1.0 );
+}
+
+} // namespace numerical_integrators
+
+} // namespace tudat
@@ -0,0 +1,227 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *
+ */
+
+#ifndef TUDAT_BATCH_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
+#define TUDAT_BATCH_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Class that implements a Runge-Kutta integrator for a batch of independent systems, integrated in lock-step.
+/*!
+ *  Class that implements a Runge-Kutta integrator for a batch of independent systems of ODEs, with identical dynamics
+ *  but different states (e.g. a constellation of satellites subject to the same force model). Each system (lane) is
+ *  stored as a single row of the state array, so that the state derivative function can evaluate the dynamics of all
+ *  lanes simultaneously, with each state element stored contiguously for all lanes (structure-of-arrays).
+ *  All lanes are advanced in lock-step, i.e. each call to performIntegrationStep evaluates all stages for all lanes,
+ *  but the step size is controlled per lane, in the same manner as in the RungeKuttaVariableStepSizeIntegrator. Lanes
+ *  for which a step is rejected, or which have reached the end of the integration interval, are masked: their state
+ *  derivative is evaluated with a step size of zero, and their state and independent variable are not modified.
+ *  Step size control may be switched off (see setStepSizeControl), in which case each lane uses a fixed step size.
+ */
+class BatchRungeKuttaVariableStepSizeIntegrator
+{
+public:
+
+    //! Typedef for the function computing the state derivatives for all lanes.
+    /*!
+     *  Typedef for the function computing the state derivatives for all lanes. First input is the current independent
+     *  variable of each lane, second input the current states (one row per lane), third input the state derivatives
+     *  that are to be computed (one row per lane, same size as states, returned by reference).
+     */
+    typedef std::function< void( const Eigen::ArrayXd&, const Eigen::ArrayXXd&, Eigen::ArrayXXd& ) >
+    BatchStateDerivativeFunction;
+
+    //! Constructor.
+    /*!
+     *  Constructor, taking coefficients, a state derivative function, initial conditions, step size settings and
+     *  error tolerances (identical for all lanes and state elements) as argument.
+     *  \param coefficients Coefficients to use with this integrator (must include an embedded lower-order scheme if
+     *  step size control is used).
+     *  \param stateDerivativeFunction Function computing the state derivatives for all lanes.
+     *  \param intervalStart The start of the integration interval (identical for all lanes).
+     *  \param initialStates The initial states, one row per lane.
+     *  \param initialStepSize Initial step size, identical for all lanes (sign determines direction of integration).
+     *  \param minimumStepSize The minimum step size to take. If a lane violates this constraint, an exception is thrown.
+     *  \param maximumStepSize The maximum step size to take.
+     *  \param relativeErrorTolerance The relative error tolerance, for each individual state element.
+     *  \param absoluteErrorTolerance The absolute error tolerance, for each individual state element.
+     *  \param safetyFactorForNextStepSize Safety factor used to scale prediction of next step size.
+     *  \param maximumFactorIncreaseForNextStepSize Maximum factor increase for next step size.
+     *  \param minimumFactorDecreaseForNextStepSize Maximum factor decrease for next step size.
+     */
+    BatchRungeKuttaVariableStepSizeIntegrator(
+            const RungeKuttaCoefficients& coefficients,
+            const BatchStateDerivativeFunction& stateDerivativeFunction,
+            const double intervalStart,
+            const Eigen::ArrayXXd& initialStates,
+            const double initialStepSize,
+            const double minimumStepSize,
+            const double maximumStepSize,
+            const double relativeErrorTolerance,
+            const double absoluteErrorTolerance,
+            const double safetyFactorForNextStepSize = 0.8,
+            const double maximumFactorIncreaseForNextStepSize = 4.0,
+            const double minimumFactorDecreaseForNextStepSize = 0.1 );
+
+    //! Perform a single (attempted) integration step for all lanes.
+    /*!
+     *  Perform a single attempted integration step for all lanes that have not yet reached the end of the integration
+     *  interval (if set by integrateTo, infinite otherwise), and compute the new step size per lane. The step is
+     *  accepted or rejected per lane, depending on the estimated local truncation error.
+     *  \return Number of lanes for which the step was accepted.
+     */
+    int performIntegrationStep( );
+
+    //! Perform an integration of all lanes to a specified independent variable value.
+    /*!
+     *  Perform an integration of all lanes to a specified independent variable value. Each lane takes steps with its
+     *  own step size, where the last step of each lane is shortened to end exactly at the end of the interval. Lanes
+     *  that have reached the end of the interval are masked until all lanes have reached it.
+     *  \param intervalEnd The value of the independent variable to which all lanes are to be integrated.
+     *  \return States of all lanes at the end of the interval, one row per lane.
+     */
+    const Eigen::ArrayXXd& integrateTo( const double intervalEnd );
+
+    //! Function to toggle the use of step-size control
+    /*!
+     *  Function to toggle the use of step-size control. If switched off, each lane uses its current step size (which
+     *  is only shortened to end exactly at the end of the integration interval), and all steps are accepted.
+     *  \param useStepSizeControl Boolean denoting whether step size control is to be used
+     */
+    void setStepSizeControl( const bool useStepSizeControl )
+    {
+        useStepSizeControl_ = useStepSizeControl;
+    }
+
+    //! Function to retrieve the current states of all lanes (one row per lane).
+    const Eigen::ArrayXXd& getCurrentStates( ) const { return currentStates_; }
+
+    //! Function to retrieve the current independent variable of all lanes.
+    const Eigen::ArrayXd& getCurrentIndependentVariables( ) const { return currentIndependentVariables_; }
+
+    //! Function to retrieve the step size to be used for the next step of each lane.
+    const Eigen::ArrayXd& getNextStepSizes( ) const { return stepSizes_; }
+
+    //! Function to retrieve the number of lanes that are integrated.
+    int getNumberOfLanes( ) const { return currentStates_.rows( ); }
+
+    //! Function to retrieve the number of calls to the state derivative function (each call evaluates all lanes).
+    int getNumberOfStateDerivativeFunctionCalls( ) const { return numberOfStateDerivativeFunctionCalls_; }
+
+    //! Function to retrieve the total number of accepted steps, summed over all lanes.
+    int getNumberOfAcceptedSteps( ) const { return numberOfAcceptedSteps_; }
+
+private:
+
+    //! Function to compute the new step size of each lane, and determine which lanes' steps are accepted.
+    /*!
+     *  Function to compute the new step size of each lane, and determine which lanes' steps are accepted, in the same
+     *  manner as RungeKuttaVariableStepSizeIntegrator::computeNewStepSize (Montenbruck and Gill, 2005). The higher
+     *  order estimate must be stored in intermediateStates_ when calling this function. Results are set in the
+     *  stepSizes_ and isStepAccepted_ members.
+     */
+    void computeNewStepSizesAndValidateResults( );
+
+    //! Coefficients for the integrator, as defined by the Butcher tableau.
+    RungeKuttaCoefficients coefficients_;
+
+    //! Function computing the state derivatives for all lanes.
+    BatchStateDerivativeFunction stateDerivativeFunction_;
+
+    //! Current states of all lanes (one row per lane).
+    Eigen::ArrayXXd currentStates_;
+
+    //! Current independent variables of all lanes.
+    Eigen::ArrayXd currentIndependentVariables_;
+
+    //! Step sizes to be used for the next step of each lane.
+    Eigen::ArrayXd stepSizes_;
+
+    //! End of the integration interval (infinite in direction of integration if not set).
+    double intervalEnd_;
+
+    //! Sign of the step size (direction of integration).
+    double integrationDirection_;
+
+    //! Minimum step size.
+    double minimumStepSize_;
+
+    //! Maximum step size.
+    double maximumStepSize_;
+
+    //! Relative error tolerance.
+    double relativeErrorTolerance_;
+
+    //! Absolute error tolerance.
+    double absoluteErrorTolerance_;
+
+    //! Safety factor used to scale prediction of next step size.
+    double safetyFactorForNextStepSize_;
+
+    //! Maximum factor by which the next step size can increase compared to the current value.
+    double maximumFactorIncreaseForNextStepSize_;
+
+    //! Minimum factor by which the next step size can decrease compared to the current value.
+    double minimumFactorDecreaseForNextStepSize_;
+
+    //! Boolean denoting whether step size control is used.
+    bool useStepSizeControl_;
+
+    //! State derivatives of all lanes, for each stage of the current step (pre-allocated workspace).
+    std::vector< Eigen::ArrayXXd > stageStateDerivatives_;
+
+    //! Intermediate states of all lanes, at which state derivatives are evaluated (pre-allocated workspace).
+    Eigen::ArrayXXd intermediateStates_;
+
+    //! Independent variables of all lanes, at which state derivatives are evaluated (pre-allocated workspace).
+    Eigen::ArrayXd intermediateIndependentVariables_;
+
+    //! Sums of weighted stage state derivatives for lower and higher order estimates (pre-allocated workspace).
+    Eigen::ArrayXXd lowerOrderIncrements_, higherOrderIncrements_;
+
+    //! Step sizes used in the current step, per lane (zero for masked lanes).
+    Eigen::ArrayXd usedStepSizes_;
+
+    //! Boolean per lane denoting whether the lane is integrated in the current step.
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isLaneActive_;
+
+    //! Boolean per lane denoting whether the current step ends at the end of the integration interval.
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isFinalStep_;
+
+    //! Boolean per lane denoting whether the step of the current lane was accepted.
+    Eigen::Array< bool, Eigen::Dynamic, 1 > isStepAccepted_;
+
+    //! Number of calls to the state derivative function.
+    int numberOfStateDerivativeFunctionCalls_;
+
+    //! Total number of accepted steps, summed over all lanes.
+    int numberOfAcceptedSteps_;
+};
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_BATCH_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
@@ -22,12 +22,18 @@
 #ifndef TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 #define TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <boost/assign/std/vector.hpp>
 
 #include <Eigen/Core>
 
+#include <Tudat/Basics/parallelLoop.h>
 #include <Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h>
 #include <Tudat/Mathematics/BasicMathematics/mathematicalConstants.h>
 
@@ -134,6 +140,10 @@ public:
         {
             integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
         }
+
+        stateAtFirstPoints_.resize( maximumStepIndex_ + 1 );
+        stateAtCenterPoints_.resize( maximumStepIndex_ + 1 );
+        stateAtLastPoints_.resize( maximumStepIndex_ + 1 );
     }
 
     //! Default constructor.
@@ -187,6 +197,10 @@ public:
         {
             integratedStates_[ i ].resize( maximumStepIndex_ + 1  );
         }
+
+        stateAtFirstPoints_.resize( maximumStepIndex_ + 1 );
+        stateAtCenterPoints_.resize( maximumStepIndex_ + 1 );
+        stateAtLastPoints_.resize( maximumStepIndex_ + 1 );
     }
 
     ~BulirschStoerVariableStepSizeIntegrator( ){ }
@@ -224,10 +238,6 @@ public:
      */
     virtual StateType performIntegrationStep( const TimeStepType stepSize )
     {
-        StateType stateAtFirstPoint_;
-        StateType stateAtCenterPoint_;
-        StateType stateAtLastPoint_;
-
         bool stepSuccessful = 0;
 
         // Compute sub steps to take.
@@ -237,35 +247,34 @@ public:
                         sequence_.at( p ) );
         }
 
-        double errorScaleTerm = TUDAT_NAN;
-        for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+        // Compute state derivative at start of step (identical for all sequences).
+        stateDerivativeAtStart_ = this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+
+        // Integrate each sequence with the modified mid-point method, concurrently if requested (longest sequences
+        // first, so that the shorter sequences fill up the remaining threads).
+        if( sequenceLoopExecutor_ != nullptr )
         {
-            // Compute Euler step and set as state at center point for use with mid-point method.
-            stateAtCenterPoint_ = currentState_ + subSteps_.at( i )
-                    * this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
-
-            // Apply modified mid-point rule.
-            stateAtFirstPoint_ = currentState_;
-            IndependentVariableType independentVariableAtFirstPoint_ = currentIndependentVariable_;
-            for ( unsigned int j = 0; j < sequence_.at( i ) - 1; j++ )
+            sequenceLoopExecutor_->executeLoop(
+                        maximumStepIndex_ + 1, [ & ]( const int i )
             {
-                stateAtLastPoint_ = executeMidPointMethod(
-                            stateAtFirstPoint_, stateAtCenterPoint_,
-                            independentVariableAtFirstPoint_, subSteps_.at( i ) );
-
-                if ( j < sequence_.at( i ) - 2 )
-                {
-                    stateAtFirstPoint_ = stateAtCenterPoint_;
-                    stateAtCenterPoint_ = stateAtLastPoint_;
-                    independentVariableAtFirstPoint_ += subSteps_.at( i );
-                }
+                const unsigned int sequenceIndex = sequenceEvaluationOrder_.at( i );
+                executeModifiedMidPointSequence(
+                            sequenceIndex, stepSize, sequenceStateDerivativeFunctions_.size( ) > 0 ?
+                                sequenceStateDerivativeFunctions_.at( sequenceIndex ) : this->stateDerivativeFunction_ );
+            } );
+        }
+        else
+        {
+            for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+            {
+                executeModifiedMidPointSequence( i, stepSize, this->stateDerivativeFunction_ );
             }
+        }
 
-            // Apply end-point correction.
-            integratedStates_[ i ][ 0 ]
-                    = 0.5 * ( stateAtLastPoint_ + stateAtCenterPoint_+ subSteps_.at( i ) * this->stateDerivativeFunction_(
-                                  currentIndependentVariable_ + stepSize, stateAtLastPoint_ ) );
-
+        // Perform Richardson extrapolation of results of all sequences.
+        double errorScaleTerm = TUDAT_NAN;
+        for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+        {
             for ( unsigned int k = 1; k < i + 1; k++ )
             {
                 integratedStates_[ i ][ k ] =
@@ -395,6 +404,65 @@ public:
         }
     }
 
+    //! Function to set the evaluation of the mid-point sequences on multiple threads.
+    /*!
+     * Function to set the evaluation of the modified mid-point sequences (one for each entry of the step sequence) on
+     * multiple threads. The sequences only depend on the state at the start of the step, so that they can be evaluated
+     * concurrently, before the Richardson extrapolation, with separate state workspaces per sequence. The results are
+     * identical to those of the serial evaluation. The state derivative function must then be safe to call
+     * concurrently, or a separate state derivative function (e.g. with its own environment and acceleration models)
+     * may be provided for each sequence. The sequences are distributed over a set of threads that is created here, and
+     * re-used for each step, with the longest sequences started first. Note that concurrent evaluation only reduces the
+     * wall-clock time when the state derivative is expensive to evaluate.
+     * \param numberOfThreads Maximum number of threads used to evaluate the sequences (serial evaluation if 1 or less).
+     * \param sequenceStateDerivativeFunctions State derivative function for each entry of the step sequence (if
+     *          empty, the state derivative function of the integrator is used for all sequences).
+     */
+    void setParallelSequenceEvaluation(
+            const int numberOfThreads,
+            const std::vector< StateDerivativeFunction >& sequenceStateDerivativeFunctions =
+            std::vector< StateDerivativeFunction >( ) )
+    {
+        if( sequenceStateDerivativeFunctions.size( ) > 0 &&
+                sequenceStateDerivativeFunctions.size( ) != sequence_.size( ) )
+        {
+            throw std::runtime_error( "Error in BS integrator, number of sequence state derivative functions (" +
+                                      std::to_string( sequenceStateDerivativeFunctions.size( ) ) +
+                                      ") is not equal to length of sequence (" +
+                                      std::to_string( sequence_.size( ) ) + ")" );
+        }
+        sequenceStateDerivativeFunctions_ = sequenceStateDerivativeFunctions;
+
+        // Create threads, or reset to serial evaluation.
+        int numberOfUsedThreads = std::min( numberOfThreads, static_cast< int >( sequence_.size( ) ) );
+        if( numberOfUsedThreads > 1 )
+        {
+            sequenceLoopExecutor_ = std::make_shared< utilities::ParallelLoopExecutor >( numberOfUsedThreads );
+        }
+        else
+        {
+            sequenceLoopExecutor_.reset( );
+        }
+
+        // Order sequences by decreasing number of sub-steps.
+        sequenceEvaluationOrder_.resize( sequence_.size( ) );
+        for( unsigned int i = 0; i < sequence_.size( ); i++ )
+        {
+            sequenceEvaluationOrder_[ i ] = i;
+        }
+        std::stable_sort( sequenceEvaluationOrder_.begin( ), sequenceEvaluationOrder_.end( ),
+                          [ & ]( const unsigned int first, const unsigned int second )
+        {
+            return sequence_.at( first ) > sequence_.at( second );
+        } );
+    }
+
+    //! Function to retrieve the maximum number of threads used to evaluate the mid-point sequences.
+    int getNumberOfThreads( ) const
+    {
+        return ( sequenceLoopExecutor_ != nullptr ) ? sequenceLoopExecutor_->getNumberOfThreads( ) : 1;
+    }
+
 private:
 
     //! Last used step size.
@@ -486,22 +554,48 @@ private:
      */
     bool isMinimumStepSizeViolated_;
 
-    //! Execute mid-point method.
+    //! Execute modified mid-point method for a single entry of the step sequence.
     /*!
-     * Executes mid-point method, given a known state and state derivative.
-     * \param stateAtFirstPoint State at first point.
-     * \param stateAtCenterPoint State at center point.
-     * \param independentVariableAtFirstPoint Independent variable at first point.
-     * \param subStepSize Sub step size between successive states used by mid-point method.
-     * \return Result of midpoint method
+     * Executes the modified mid-point method over the current step, with the number of sub-steps of a single entry of
+     * the step sequence, and stores the result (after end-point correction) as the first column of the extrapolation
+     * tableau. Only the workspaces associated with the sequence entry are modified, so that different entries can be
+     * evaluated concurrently. The state derivative at the start of the step must have been computed.
+     * \param sequenceIndex Index of the entry in the step sequence.
+     * \param stepSize Step size that is taken.
+     * \param stateDerivativeFunction State derivative function that is to be used.
      */
-    StateType executeMidPointMethod( StateType stateAtFirstPoint, StateType stateAtCenterPoint,
-                                     const IndependentVariableType independentVariableAtFirstPoint,
-                                     const IndependentVariableType subStepSize )
+    void executeModifiedMidPointSequence( const unsigned int sequenceIndex, const TimeStepType stepSize,
+                                          const StateDerivativeFunction& stateDerivativeFunction )
     {
-        return stateAtFirstPoint + 2.0 * subStepSize
-                * this->stateDerivativeFunction_( independentVariableAtFirstPoint + subStepSize,
-                                                  stateAtCenterPoint );
+        const double subStep = subSteps_.at( sequenceIndex );
+        StateType& stateAtFirstPoint = stateAtFirstPoints_[ sequenceIndex ];
+        StateType& stateAtCenterPoint = stateAtCenterPoints_[ sequenceIndex ];
+        StateType& stateAtLastPoint = stateAtLastPoints_[ sequenceIndex ];
+
+        // Compute Euler step and set as state at center point for use with mid-point method.
+        stateAtCenterPoint = currentState_ + subStep * stateDerivativeAtStart_;
+
+        // Apply modified mid-point rule.
+        stateAtFirstPoint = currentState_;
+        IndependentVariableType independentVariableAtFirstPoint = currentIndependentVariable_;
+        for ( unsigned int j = 0; j < sequence_.at( sequenceIndex ) - 1; j++ )
+        {
+            stateAtLastPoint = stateAtFirstPoint + 2.0 * subStep
+                    * stateDerivativeFunction( independentVariableAtFirstPoint + subStep, stateAtCenterPoint );
+
+            if ( j < sequence_.at( sequenceIndex ) - 2 )
+            {
+                // Shift states: first point becomes center point, center point becomes last point.
+                std::swap( stateAtFirstPoint, stateAtCenterPoint );
+                std::swap( stateAtCenterPoint, stateAtLastPoint );
+                independentVariableAtFirstPoint += subStep;
+            }
+        }
+
+        // Apply end-point correction.
+        integratedStates_[ sequenceIndex ][ 0 ]
+                = 0.5 * ( stateAtLastPoint + stateAtCenterPoint + subStep * stateDerivativeFunction(
+                              currentIndependentVariable_ + stepSize, stateAtLastPoint ) );
     }
 
     std::vector< std::vector< StateType > > integratedStates_;
@@ -510,6 +604,27 @@ private:
 
     std::vector< double > subSteps_;
 
+    //! State derivative at the start of the current step.
+    StateDerivativeType stateDerivativeAtStart_;
+
+    //! States at first point of current mid-point step, per entry of the step sequence (workspace).
+    std::vector< StateType > stateAtFirstPoints_;
+
+    //! States at center point of current mid-point step, per entry of the step sequence (workspace).
+    std::vector< StateType > stateAtCenterPoints_;
+
+    //! States at last point of current mid-point step, per entry of the step sequence (workspace).
+    std::vector< StateType > stateAtLastPoints_;
+
+    //! Object distributing the evaluation of the mid-point sequences over threads (nullptr if evaluated serially).
+    std::shared_ptr< utilities::ParallelLoopExecutor > sequenceLoopExecutor_;
+
+    //! Order in which the mid-point sequences are started when evaluated concurrently (longest sequence first).
+    std::vector< unsigned int > sequenceEvaluationOrder_;
+
+    //! State derivative functions used for each entry of the step sequence, if evaluated concurrently (may be empty).
+    std::vector< StateDerivativeFunction > sequenceStateDerivativeFunctions_;
+
 };
 
 extern template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -80,6 +80,17 @@ public:
      */
     virtual ~IntegratorSettings( ) { }
 
+    //! Function to create a copy of the settings.
+    /*!
+     *  Function to create a (deep) copy of the settings, retaining the derived type, such that the copy can be modified
+     *  (e.g. its initial time) without affecting the original settings.
+     *  \return Copy of the settings.
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< IntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of numerical integrator
     /*!
      *  Type of numerical integrator, from enum of available integrators.
@@ -174,6 +185,16 @@ public:
      */
     virtual ~RungeKuttaVariableStepSizeBaseSettings( ) { }
 
+    //! Function to create a copy of the settings.
+    /*!
+     *  Function to create a copy of the settings, retaining the derived type.
+     *  \return Copy of the settings.
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeBaseSettings< IndependentVariableType > >( *this );
+    }
+
     //! Boolean denoting whether integration error tolerances are defined as a scalar (or vector).
     bool areTolerancesDefinedAsScalar_;
 
@@ -198,6 +219,14 @@ public:
     //! Minimum decrease factor in time step in subsequent iterations.
     IndependentVariableType minimumFactorDecreaseForNextStepSize_;
 
+    //! Values of the independent variable at which steps are to end (empty by default).
+    /*!
+     *  Values of the independent variable at which steps are to end, e.g. at discontinuities in the state derivative
+     *  such as the occultation boundary times of electro_magnetism::OccultationEventTable::getOccultationBoundaryTimes
+     *  (see NumericalIntegrator::setStepBreakpoints).
+     */
+    std::vector< double > stepBreakpoints_;
+
 };
 
 //! Class to define settings of variable step RK numerical integrator with scalar tolerances.
@@ -310,6 +339,16 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsScalarTolerances( ) { }
 
+    //! Function to create a copy of the settings.
+    /*!
+     *  Function to create a copy of the settings, retaining the derived type.
+     *  \return Copy of the settings.
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     IndependentVariableType relativeErrorTolerance_;
 
@@ -376,6 +415,16 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsVectorTolerances( ) { }
 
+    //! Function to create a copy of the settings.
+    /*!
+     *  Function to create a copy of the settings, retaining the derived type.
+     *  \return Copy of the settings.
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     DependentVariableType relativeErrorTolerance_;
 
@@ -410,6 +459,10 @@ public:
      *  \param safetyFactorForNextStepSize Safety factor for step size control.
      *  \param maximumFactorIncreaseForNextStepSize Maximum increase factor in time step in subsequent iterations.
      *  \param minimumFactorDecreaseForNextStepSize Minimum decrease factor in time step in subsequent iterations.
+     *  \param numberOfThreads Maximum number of threads over which the mid-point sequences of each step are distributed
+     *      (see BulirschStoerVariableStepSizeIntegrator::setParallelSequenceEvaluation). Default 1 (serial evaluation).
+     *      A value larger than 1 may only be used if the state derivative function is thread-safe, which is not the case
+     *      for the propagation of dynamics with environment models.
      */
     BulirschStoerIntegratorSettings(
             const IndependentVariableType initialTime,
@@ -423,7 +476,8 @@ public:
             const bool assessPropagationTerminationConditionDuringIntegrationSubsteps = false,
             const IndependentVariableType safetyFactorForNextStepSize = 0.7,
             const IndependentVariableType maximumFactorIncreaseForNextStepSize = 10.0,
-            const IndependentVariableType minimumFactorDecreaseForNextStepSize = 0.1 ):
+            const IndependentVariableType minimumFactorDecreaseForNextStepSize = 0.1,
+            const int numberOfThreads = 1 ):
         IntegratorSettings< IndependentVariableType >(
             bulirschStoer, initialTime, initialTimeStep, saveFrequency,
             assessPropagationTerminationConditionDuringIntegrationSubsteps ),
@@ -432,7 +486,8 @@ public:
         relativeErrorTolerance_( relativeErrorTolerance ), absoluteErrorTolerance_( absoluteErrorTolerance ),
         safetyFactorForNextStepSize_( safetyFactorForNextStepSize ),
         maximumFactorIncreaseForNextStepSize_( maximumFactorIncreaseForNextStepSize ),
-        minimumFactorDecreaseForNextStepSize_( minimumFactorDecreaseForNextStepSize ){ }
+        minimumFactorDecreaseForNextStepSize_( minimumFactorDecreaseForNextStepSize ),
+        numberOfThreads_( numberOfThreads ){ }
 
     //! Destructor.
     /*!
@@ -440,6 +495,16 @@ public:
      */
     ~BulirschStoerIntegratorSettings( ){ }
 
+    //! Function to create a copy of the settings.
+    /*!
+     *  Function to create a copy of the settings, retaining the derived type.
+     *  \return Copy of the settings.
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of sequence that is to be used for Bulirsch-Stoer integrator
     ExtrapolationMethodStepSequences extrapolationSequence_;
 
@@ -470,6 +535,9 @@ public:
     //! Minimum decrease factor in time step in subsequent iterations.
     const IndependentVariableType minimumFactorDecreaseForNextStepSize_;
 
+    //! Maximum number of threads over which the mid-point sequences of each step are distributed.
+    int numberOfThreads_;
+
 };
 
 //! Class to define settings of variable step ABAM numerical integrator
@@ -528,6 +596,16 @@ public:
      */
     ~AdamsBashforthMoultonSettings( ){ }
 
+    //! Function to create a copy of the settings.
+    /*!
+     *  Function to create a copy of the settings, retaining the derived type.
+     *  \return Copy of the settings.
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< AdamsBashforthMoultonSettings< IndependentVariableType > >( *this );
+    }
+
     //! Minimum step size for integration.
     /*!
      *  Minimum step size for integration. Integration stops (exception thrown) if time step comes below this value.
@@ -681,6 +759,12 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                       static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
                       static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
         }
+
+        // Set values of independent variable at which steps are to end, if any.
+        if( !variableStepIntegratorSettings->stepBreakpoints_.empty( ) )
+        {
+            integrator->setStepBreakpoints( variableStepIntegratorSettings->stepBreakpoints_ );
+        }
         break;
     }
     case bulirschStoer:
@@ -699,7 +783,9 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         }
         else
         {
-            integrator = std::make_shared< BulirschStoerVariableStepSizeIntegrator
+            std::shared_ptr< BulirschStoerVariableStepSizeIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                    bulirschStoerIntegrator = std::make_shared< BulirschStoerVariableStepSizeIntegrator
                     < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
                     ( getBulirschStoerStepSequence( bulirschStoerIntegratorSettings->extrapolationSequence_,
                                                     bulirschStoerIntegratorSettings->maximumNumberOfSteps_ ),
@@ -711,6 +797,13 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                       static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->safetyFactorForNextStepSize_ ),
                       static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
                       static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+
+            // Set concurrent evaluation of mid-point sequences, if requested.
+            if( bulirschStoerIntegratorSettings->numberOfThreads_ > 1 )
+            {
+                bulirschStoerIntegrator->setParallelSequenceEvaluation( bulirschStoerIntegratorSettings->numberOfThreads_ );
+            }
+            integrator = bulirschStoerIntegrator;
         }
         break;
     }
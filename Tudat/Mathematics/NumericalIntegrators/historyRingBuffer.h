@@ -0,0 +1,187 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_HISTORY_RING_BUFFER_H
+#define TUDAT_HISTORY_RING_BUFFER_H
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Fixed-capacity history of values, ordered from most recent (index 0) to oldest.
+/*!
+ * Fixed-capacity history of values (e.g. states or state derivatives of a multi-step integrator), ordered from
+ * most recent (index 0) to oldest, stored in a ring buffer. All storage slots are allocated once, at construction, and
+ * new values are copy-assigned into existing slots, so that values with dynamic storage (e.g. Eigen::VectorXd) reuse
+ * their memory after the first pass through the buffer. When a value is added to the front of a full buffer, the
+ * oldest value is overwritten. Entries between the size and the capacity of the buffer may be accessed (and modified,
+ * e.g. by swapping values in place) after increasing the size with resize( ); their contents are then those of the
+ * last value that occupied the slot.
+ * \tparam ValueType Type of the values in the history.
+ */
+template< typename ValueType >
+class HistoryRingBuffer
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor, allocates all storage slots.
+     * \param capacity Maximum number of values in the history.
+     */
+    HistoryRingBuffer( const unsigned int capacity ):
+        buffer_( capacity ), head_( 0 ), size_( 0 )
+    {
+        if( capacity == 0 )
+        {
+            throw std::runtime_error( "Error when creating history ring buffer, capacity must be positive." );
+        }
+    }
+
+    //! Function to retrieve the number of values in the history.
+    unsigned int size( ) const { return size_; }
+
+    //! Function to retrieve the maximum number of values in the history.
+    unsigned int capacity( ) const { return buffer_.size( ); }
+
+    //! Function to check whether the history is empty.
+    bool empty( ) const { return size_ == 0; }
+
+    //! Function to retrieve a value from the history, without bounds checking (0 is most recent).
+    ValueType& operator[ ]( const unsigned int index )
+    {
+        return buffer_[ getBufferIndex( index ) ];
+    }
+
+    //! Function to retrieve a value from the history, without bounds checking (0 is most recent).
+    const ValueType& operator[ ]( const unsigned int index ) const
+    {
+        return buffer_[ getBufferIndex( index ) ];
+    }
+
+    //! Function to retrieve a value from the history, with bounds checking (0 is most recent).
+    const ValueType& at( const unsigned int index ) const
+    {
+        if( index >= size_ )
+        {
+            throw std::out_of_range( "Error when retrieving entry from history ring buffer, index out of range." );
+        }
+        return buffer_[ getBufferIndex( index ) ];
+    }
+
+    //! Function to retrieve the most recent value.
+    const ValueType& front( ) const { return at( 0 ); }
+
+    //! Function to retrieve the oldest value.
+    const ValueType& back( ) const { return at( size_ - 1 ); }
+
+    //! Function to add a value as most recent entry, overwriting the oldest value if the history is full.
+    void pushFront( const ValueType& value )
+    {
+        moveHeadBack( );
+        buffer_[ head_ ] = value;
+    }
+
+    //! Function to add a value as most recent entry, overwriting the oldest value if the history is full.
+    void pushFront( ValueType&& value )
+    {
+        moveHeadBack( );
+        buffer_[ head_ ] = std::move( value );
+    }
+
+    //! Function to add a value as oldest entry (history may not be full).
+    void pushBack( const ValueType& value )
+    {
+        if( size_ == buffer_.size( ) )
+        {
+            throw std::runtime_error( "Error when adding entry to back of history ring buffer, buffer is full." );
+        }
+        size_++;
+        buffer_[ getBufferIndex( size_ - 1 ) ] = value;
+    }
+
+    //! Function to remove the most recent value.
+    void popFront( )
+    {
+        if( size_ == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from history ring buffer, buffer is empty." );
+        }
+        head_ = getBufferIndex( 1 );
+        size_--;
+    }
+
+    //! Function to remove the oldest value.
+    void popBack( )
+    {
+        if( size_ == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from history ring buffer, buffer is empty." );
+        }
+        size_--;
+    }
+
+    //! Function to change the number of values in the history.
+    /*!
+     * Function to change the number of values in the history. When decreasing the size, the oldest values are
+     * removed. When increasing the size, the added (oldest) entries retain the contents of their storage slot, and
+     * should be set by the user.
+     * \param size New number of values in the history (may not exceed the capacity).
+     */
+    void resize( const unsigned int size )
+    {
+        if( size > buffer_.size( ) )
+        {
+            throw std::runtime_error( "Error when resizing history ring buffer, size exceeds capacity." );
+        }
+        size_ = size;
+    }
+
+    //! Function to remove all values from the history (storage is retained).
+    void clear( ) { size_ = 0; }
+
+private:
+
+    //! Function to compute the index in the storage buffer of a given entry of the history.
+    unsigned int getBufferIndex( const unsigned int index ) const
+    {
+        return ( head_ + index ) % buffer_.size( );
+    }
+
+    //! Function to move the head of the history one slot back, to make room for a new most recent value.
+    void moveHeadBack( )
+    {
+        head_ = ( head_ == 0 ) ? ( buffer_.size( ) - 1 ) : ( head_ - 1 );
+        if( size_ < buffer_.size( ) )
+        {
+            size_++;
+        }
+    }
+
+    //! Storage slots of the history.
+    std::vector< ValueType > buffer_;
+
+    //! Index in buffer_ of the most recent value.
+    unsigned int head_;
+
+    //! Number of values in the history.
+    unsigned int size_;
+};
+
+} // namespace numerical_integrators
+} // namespace tudat
+
+#endif // TUDAT_HISTORY_RING_BUFFER_H
@@ -17,6 +17,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <Eigen/Core>
 
@@ -197,6 +198,16 @@ public:
      */
     virtual void setStepSizeControl( const bool useStepSizeControl ) { }
 
+    //! Function to set the values of the independent variable at which steps are to end.
+    /*!
+     * Function to set the values of the independent variable at which steps are to end, e.g. at discontinuities in the
+     * state derivative, so that no step is taken across them. To be implemented in derived classes with variable step
+     * sizes, in which the step size proposed for the next step is reduced where needed to end exactly at the next
+     * breakpoint.
+     * \param stepBreakpoints Values of the independent variable at which steps are to end.
+     */
+    virtual void setStepBreakpoints( const std::vector< double >& stepBreakpoints ) { }
+
     //! Replace the state with a new value.
     /*!
      * Replace the state with a new value. This allows for discrete jumps in the state, often
@@ -16,6 +16,9 @@
 #ifndef TUDAT_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
 #define TUDAT_RUNGE_KUTTA_VARIABLE_STEP_SIZE_INTEGRATOR_H
 
+#include <algorithm>
+#include <cmath>
+
 #include <boost/bind.hpp>
 #include <functional>
 #include <memory>
@@ -341,6 +344,20 @@ public:
         useStepSizeControl_ = useStepSizeControl;
     }
 
+    //! Function to set the values of the independent variable at which steps are to end.
+    /*!
+     * Function to set the values of the independent variable at which steps are to end, e.g. at discontinuities in the
+     * state derivative. When step size control is used, the step size proposed for the next step (see
+     * getNextStepSize) is reduced where needed, such that the step ends exactly at the next breakpoint, instead of
+     * the step size control having to reduce the step size (with rejected steps) while crossing the discontinuity.
+     * \param stepBreakpoints Values of the independent variable at which steps are to end.
+     */
+    void setStepBreakpoints( const std::vector< double >& stepBreakpoints )
+    {
+        stepBreakpoints_ = stepBreakpoints;
+        std::sort( stepBreakpoints_.begin( ), stepBreakpoints_.end( ) );
+    }
+
 protected:
 
     //! Computes the next step size and validates the result.
@@ -383,6 +400,14 @@ protected:
             const StateType& relativeErrorTolerance, const StateType& absoluteErrorTolerance,
             const StateType& lowerOrderEstimate, const StateType& higherOrderEstimate );
 
+    //! Function to reduce the step size of the next step, such that it does not cross a breakpoint.
+    /*!
+     * Function to reduce the step size of the next step (stepSize_), such that it ends exactly at the first breakpoint
+     * that lies in its interval (if any). Breakpoints closer to the current independent variable than the minimum step
+     * size are ignored (i.e. considered to be passed).
+     */
+    void limitStepSizeToStepBreakpoints( );
+
     //! Last used step size.
     /*!
      * Last used step size, passed to either integrateTo( ) or performIntegrationStep( ).
@@ -483,6 +508,9 @@ protected:
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Sorted values of the independent variable at which steps are to end (see setStepBreakpoints).
+    std::vector< double > stepBreakpoints_;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -545,6 +573,7 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
         this->lastState_ = this->currentState_;
         this->currentIndependentVariable_ += stepSize;
+        limitStepSizeToStepBreakpoints( );
 
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
@@ -563,6 +592,7 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     else
     {
         // Reject current step.
+        limitStepSizeToStepBreakpoints( );
         return performIntegrationStep( this->stepSize_ );
     }
 }
@@ -633,6 +663,46 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     }
 }
 
+//! Function to reduce the step size of the next step, such that it does not cross a breakpoint.
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+void
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::limitStepSizeToStepBreakpoints( )
+{
+    if( !useStepSizeControl_ || stepBreakpoints_.size( ) == 0 )
+    {
+        return;
+    }
+
+    const double currentIndependentVariable = static_cast< double >( this->currentIndependentVariable_ );
+    const double stepSize = static_cast< double >( this->stepSize_ );
+    const double minimumDistanceToBreakpoint = std::max(
+                static_cast< double >( std::fabs( this->minimumStepSize_ ) ),
+                std::fabs( currentIndependentVariable ) * std::numeric_limits< double >::epsilon( ) * 16.0 );
+
+    if( stepSize > 0.0 )
+    {
+        std::vector< double >::const_iterator nextBreakpoint = std::upper_bound(
+                    stepBreakpoints_.begin( ), stepBreakpoints_.end( ),
+                    currentIndependentVariable + minimumDistanceToBreakpoint );
+        if( nextBreakpoint != stepBreakpoints_.end( ) && *nextBreakpoint < currentIndependentVariable + stepSize )
+        {
+            this->stepSize_ = static_cast< TimeStepType >( *nextBreakpoint - currentIndependentVariable );
+        }
+    }
+    else
+    {
+        std::vector< double >::const_iterator nextBreakpoint = std::lower_bound(
+                    stepBreakpoints_.begin( ), stepBreakpoints_.end( ),
+                    currentIndependentVariable - minimumDistanceToBreakpoint );
+        if( nextBreakpoint != stepBreakpoints_.begin( ) &&
+                *( nextBreakpoint - 1 ) > currentIndependentVariable + stepSize )
+        {
+            this->stepSize_ = static_cast< TimeStepType >( *( nextBreakpoint - 1 ) - currentIndependentVariable );
+        }
+    }
+}
+
 //! Compute new step size.
 /*!
  * Computes the new step size based on a generic definition of the local truncation error.
@@ -26,6 +26,13 @@
 namespace tudat
 {
 
+namespace aerodynamics
+{
+
+struct NRLMSISE00InterpolationSettings;
+
+}
+
 namespace simulation_setup
 {
 
@@ -468,9 +475,14 @@ public:
      *  Constructor.
      *  \param spaceWeatherFile File containing space weather data, as in
      *  https://celestrak.com/SpaceData/sw19571001.txt
+     *  \param interpolationSettings Settings for interpolation of model output, to reduce the number of (computationally
+     *  expensive) model evaluations (default none; model evaluated directly).
      */
-    NRLMSISE00AtmosphereSettings( const std::string& spaceWeatherFile ):
-        AtmosphereSettings( nrlmsise00 ), spaceWeatherFile_( spaceWeatherFile ){ }
+    NRLMSISE00AtmosphereSettings(
+            const std::string& spaceWeatherFile,
+            const std::shared_ptr< aerodynamics::NRLMSISE00InterpolationSettings > interpolationSettings = nullptr ):
+        AtmosphereSettings( nrlmsise00 ), spaceWeatherFile_( spaceWeatherFile ),
+        interpolationSettings_( interpolationSettings ){ }
 
     //! Function to return file containing space weather data.
     /*!
@@ -479,6 +491,16 @@ public:
      */
     std::string getSpaceWeatherFile( ){ return spaceWeatherFile_; }
 
+    //! Function to return settings for interpolation of model output
+    /*!
+     *  Function to return settings for interpolation of model output
+     *  \return Settings for interpolation of model output (nullptr if model is to be evaluated directly).
+     */
+    std::shared_ptr< aerodynamics::NRLMSISE00InterpolationSettings > getInterpolationSettings( )
+    {
+        return interpolationSettings_;
+    }
+
 private:
 
     //! File containing space weather data.
@@ -486,6 +508,9 @@ private:
      *  File containing space weather data, as in https://celestrak.com/SpaceData/sw19571001.txt
      */
     std::string spaceWeatherFile_;
+
+    //! Settings for interpolation of model output (nullptr if model is to be evaluated directly).
+    std::shared_ptr< aerodynamics::NRLMSISE00InterpolationSettings > interpolationSettings_;
 };
 
 
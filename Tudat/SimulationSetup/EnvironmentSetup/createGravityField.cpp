@@ -17,7 +17,9 @@
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/triAxialEllipsoidGravity.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/numericTextFileParser.h"
 
 namespace tudat
 {
@@ -107,20 +109,25 @@ FromFileSphericalHarmonicsGravityFieldSettings::FromFileSphericalHarmonicsGravit
 std::pair< double, double  > readGravityFieldFile(
         const std::string& fileName, const int maximumDegree, const int maximumOrder,
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
-        const int gravitationalParameterIndex, const int referenceRadiusIndex )
+        const int gravitationalParameterIndex, const int referenceRadiusIndex, const int numberOfThreads )
 {
-    // Attempt to open gravity file.
-    std::fstream stream( fileName.c_str( ), std::ios::in );
-    if( stream.fail( ) )
+    using input_output::TextRange;
+
+    // Attempt to map gravity file into memory.
+    std::shared_ptr< input_output::MappedTextFile > gravityFile;
+    try
+    {
+        gravityFile = std::make_shared< input_output::MappedTextFile >( fileName );
+    }
+    catch( std::runtime_error& )
     {
         throw std::runtime_error( "Pds gravity field data file could not be opened: " + fileName );
     }
+    const TextRange fileContents = gravityFile->getContents( );
 
     // Declare variables for reading file.
-    std::vector< std::string > vectorOfIndividualStrings;
-    vectorOfIndividualStrings.resize( 4 );
-    std::string line;
-
+    std::vector< TextRange > lineEntries;
+    const char* currentLineBegin = fileContents.begin;
 
     double gravitationalParameter = TUDAT_NAN;
     double referenceRadius = TUDAT_NAN;
@@ -129,22 +136,20 @@ std::pair< double, double  > readGravityFieldFile(
             ( referenceRadiusIndex >= 0 ) )
     {
         // Get first line of file.
-        std::getline( stream, line );
+        const char* headerLineEnd = std::find( fileContents.begin, fileContents.end, '\n' );
+        currentLineBegin = ( headerLineEnd == fileContents.end ) ? fileContents.end : headerLineEnd + 1;
 
         // Get reference radius and gravitational parameter from first line of file.
-        boost::algorithm::trim( line );
-        boost::algorithm::split( vectorOfIndividualStrings,
-                                 line,
-                                 boost::algorithm::is_any_of( "\t, " ),
-                                 boost::algorithm::token_compress_on );
-        if( gravitationalParameterIndex >= static_cast< int >( vectorOfIndividualStrings.size( ) ) ||
-                referenceRadiusIndex >= static_cast< int >( vectorOfIndividualStrings.size( ) ) )
+        input_output::splitIntoTokens( input_output::trimWhitespace( TextRange( fileContents.begin, headerLineEnd ) ),
+                                       "\t, ", lineEntries );
+        if( gravitationalParameterIndex >= static_cast< int >( lineEntries.size( ) ) ||
+                referenceRadiusIndex >= static_cast< int >( lineEntries.size( ) ) )
         {
             throw std::runtime_error( "Error when reading gravity field file, requested header index exceeds file contents" );
         }
 
-        gravitationalParameter = std::stod( vectorOfIndividualStrings[ gravitationalParameterIndex ] );
-        referenceRadius = std::stod( vectorOfIndividualStrings[ referenceRadiusIndex ] );
+        gravitationalParameter = input_output::parseDouble( lineEntries[ gravitationalParameterIndex ] );
+        referenceRadius = input_output::parseDouble( lineEntries[ referenceRadiusIndex ] );
     }
     else if( ( !( gravitationalParameterIndex >= 0 ) &&
                ( referenceRadiusIndex >= 0 ) ) ||
@@ -162,45 +167,126 @@ std::pair< double, double  > readGravityFieldFile(
     Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd( maximumDegree + 1, maximumOrder + 1 );
     sineCoefficients.setZero( );
 
-    // Read coefficients up to required maximum degree and order.
-    while ( !stream.fail( ) && !stream.eof( ) &&
-            ( currentDegree <= maximumDegree || currentOrder <= maximumOrder )  )
+    // Contents of a single line with coefficients.
+    struct CoefficientLine
     {
-        // Read current line
-        std::getline( stream, line );
-
-        // Trim input string (removes all leading and trailing whitespaces).
-        boost::algorithm::trim( line );
-
-        // Split string into multiple strings, each containing one element from a line from the
-        // data file.
-        boost::algorithm::split( vectorOfIndividualStrings,
-                                 line,
-                                 boost::algorithm::is_any_of( ", " ),
-                                 boost::algorithm::token_compress_on );
-
-        // Check current line for consistency
-        if( vectorOfIndividualStrings.size( ) != 0 )
+        bool isValid;
+        int numberOfEntries;
+        int degree;
+        int order;
+        double cosineCoefficient;
+        double sineCoefficient;
+    };
+
+    // Function to parse a single line with coefficients. Coefficients of degree or order above the maximum are not
+    // converted.
+    auto parseCoefficientLine = [ & ]( const TextRange& fileLine, CoefficientLine& coefficientLine,
+            std::vector< TextRange >& entries )
+    {
+        const TextRange line = input_output::trimWhitespace( fileLine );
+        coefficientLine.numberOfEntries = 0;
+        if ( !line.empty( ) )
         {
-            if( vectorOfIndividualStrings.size( ) < 4 )
+            input_output::splitIntoTokens( line, ", ", entries );
+            coefficientLine.numberOfEntries = static_cast< int >( entries.size( ) );
+            if ( coefficientLine.numberOfEntries >= 4 )
             {
-                std::string errorMessage = "Error when reading pds gravity field file, number of fields is " +
-                        std::to_string( vectorOfIndividualStrings.size( ) );
-                throw std::runtime_error( errorMessage );
+                coefficientLine.degree = static_cast< int >( input_output::parseInteger( entries[ 0 ] ) );
+                coefficientLine.order = static_cast< int >( input_output::parseInteger( entries[ 1 ] ) );
+                if( coefficientLine.degree <= maximumDegree && coefficientLine.order <= maximumOrder )
+                {
+                    coefficientLine.cosineCoefficient = input_output::parseDouble( entries[ 2 ] );
+                    coefficientLine.sineCoefficient = input_output::parseDouble( entries[ 3 ] );
+                }
+            }
+        }
+    };
+
+    // Read coefficients up to required maximum degree and order. The file is processed in blocks of lines, the lines
+    // of which are parsed concurrently. Errors are only reported for lines that are reached when setting the
+    // coefficients in order of the lines in the file. The first block is sized to the expected number of lines with
+    // degree and order up to the maximum, so that the remainder of a larger file is (typically) not parsed.
+    const int maximumNumberOfLinesPerBlock = 65536;
+    const int numberOfLinesPerTask = 1024;
+    int numberOfLinesPerBlock = std::min(
+                std::max( ( maximumDegree + 1 ) * ( std::min( maximumDegree, maximumOrder ) + 2 ) / 2 + 16,
+                          numberOfLinesPerTask ), maximumNumberOfLinesPerBlock );
+    std::vector< TextRange > blockLines;
+    std::vector< CoefficientLine > blockCoefficientLines;
+    bool isFileFinished = false;
+    while ( !isFileFinished && ( currentDegree <= maximumDegree || currentOrder <= maximumOrder ) )
+    {
+        // Find the lines of the current block.
+        blockLines.clear( );
+        while ( !isFileFinished && static_cast< int >( blockLines.size( ) ) < numberOfLinesPerBlock )
+        {
+            const char* currentLineEnd = std::find( currentLineBegin, fileContents.end, '\n' );
+            blockLines.push_back( TextRange( currentLineBegin, currentLineEnd ) );
+            if ( currentLineEnd == fileContents.end )
+            {
+                isFileFinished = true;
             }
             else
             {
-                // Read current degree and orde from line.
-                currentDegree = std::stoi( vectorOfIndividualStrings[ 0 ] );
-                currentOrder = std::stoi( vectorOfIndividualStrings[ 1 ] );
+                currentLineBegin = currentLineEnd + 1;
+            }
+        }
 
-                // Set cosine and sine coefficients for current degree and order.
-                if( currentDegree <= maximumDegree && currentOrder <= maximumOrder )
+        // Parse the lines of the current block.
+        const int numberOfLines = static_cast< int >( blockLines.size( ) );
+        blockCoefficientLines.resize( numberOfLines );
+        utilities::executeParallelLoop(
+                    ( numberOfLines + numberOfLinesPerTask - 1 ) / numberOfLinesPerTask, [ & ]( const int taskIndex )
+        {
+            std::vector< TextRange > entries;
+            const int lastLine = std::min( ( taskIndex + 1 ) * numberOfLinesPerTask, numberOfLines );
+            for ( int i = taskIndex * numberOfLinesPerTask; i < lastLine; i++ )
+            {
+                try
                 {
-                    cosineCoefficients( currentDegree, currentOrder ) =
-                            std::stod( vectorOfIndividualStrings[ 2 ] );
-                    sineCoefficients( currentDegree, currentOrder ) =
-                            std::stod( vectorOfIndividualStrings[ 3 ] );
+                    parseCoefficientLine( blockLines[ i ], blockCoefficientLines[ i ], entries );
+                    blockCoefficientLines[ i ].isValid = true;
+                }
+                catch( std::runtime_error& )
+                {
+                    blockCoefficientLines[ i ].isValid = false;
+                }
+            }
+        }, numberOfThreads );
+        numberOfLinesPerBlock = std::min( 2 * numberOfLinesPerBlock, maximumNumberOfLinesPerBlock );
+
+        // Set coefficients, in order of the lines in the file, until maximum degree and order have been passed.
+        for ( int i = 0; i < numberOfLines && ( currentDegree <= maximumDegree || currentOrder <= maximumOrder ); i++ )
+        {
+            CoefficientLine& coefficientLine = blockCoefficientLines[ i ];
+
+            // Parse invalid line again, to throw its error.
+            if( !coefficientLine.isValid )
+            {
+                parseCoefficientLine( blockLines[ i ], coefficientLine, lineEntries );
+            }
+
+            // Check current line for consistency (empty lines are skipped).
+            if( coefficientLine.numberOfEntries != 0 )
+            {
+                if( coefficientLine.numberOfEntries < 4 )
+                {
+                    std::string errorMessage = "Error when reading pds gravity field file, number of fields is " +
+                            std::to_string( coefficientLine.numberOfEntries );
+                    throw std::runtime_error( errorMessage );
+                }
+                else
+                {
+                    // Read current degree and order from line.
+                    currentDegree = coefficientLine.degree;
+                    currentOrder = coefficientLine.order;
+
+                    // Set cosine and sine coefficients for current degree and order.
+                    if( currentDegree <= maximumDegree && currentOrder <= maximumOrder )
+                    {
+                        cosineCoefficients( currentDegree, currentOrder ) = coefficientLine.cosineCoefficient;
+                        sineCoefficients( currentDegree, currentOrder ) = coefficientLine.sineCoefficient;
+                    }
                 }
             }
         }
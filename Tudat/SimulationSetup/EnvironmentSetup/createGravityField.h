@@ -18,6 +18,7 @@
 #include <boost/algorithm/string/trim.hpp>
 #include <memory>
 
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityFieldVariations.h"
 #include "Tudat/Astrodynamics/Gravitation/gravityFieldModel.h"
@@ -407,19 +408,22 @@ std::shared_ptr< SphericalHarmonicsGravityFieldSettings > createHomogeneousTriAx
  *  Degree, Order, Cosine Coefficient, Sine Coefficients
  *  Subsequent columns may be present in the file, but are ignored when parsing.
  *  All coefficients not defined in the file are set to zero (except C(0,0) which is always 1.0)
+ *  Empty lines are skipped. The file is memory-mapped, and blocks of lines are parsed concurrently.
  *  \param fileName Name of PDS gravity field file to be loaded.
  *  \param maximumDegree Maximum degree of gravity field to be loaded.
  *  \param maximumOrder Maximum order of gravity field to be loaded.
  *  \param gravitationalParameterIndex
  *  \param referenceRadiusIndex
  *  \param coefficients Spherical harmonics coefficients (first is cosine, second is sine).
+ *  \param numberOfThreads Maximum number of threads used for parsing.
  *  \return Pair of gravitational parameter and reference radius, values are non-NaN if
  *  gravitationalParameterIndex and referenceRadiusIndex are >=0.
  */
 std::pair< double, double > readGravityFieldFile(
         const std::string& fileName, const int maximumDegree, const int maximumOrder,
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd >& coefficients,
-        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1 );
+        const int gravitationalParameterIndex = -1, const int referenceRadiusIndex = -1,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ) );
 
 //! Function to create a gravity field model.
 /*!
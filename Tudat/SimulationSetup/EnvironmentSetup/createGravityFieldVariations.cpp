@@ -41,6 +41,8 @@ std::shared_ptr< gravitation::GravityFieldVariationsSet > createGravityFieldMode
     std::map< int, double > initialTimes;
     std::map< int, double > finalTimes;
     std::map< int, double > timeSteps;
+    std::map< int, int > numberOfThreads;
+    std::map< int, bool > estimateInterpolationErrors;
 
     // Iterate over all variations to create.
     for( unsigned int i = 0; i < gravityFieldVariationSettings.size( ); i++ )
@@ -82,6 +84,10 @@ std::shared_ptr< gravitation::GravityFieldVariationsSet > createGravityFieldMode
                     = gravityFieldVariationSettings.at( i )->getInterpolatorSettings( )->finalTime_;
             timeSteps[ i ]
                     = gravityFieldVariationSettings.at( i )->getInterpolatorSettings( )->timeStep_;
+            numberOfThreads[ i ]
+                    = gravityFieldVariationSettings.at( i )->getInterpolatorSettings( )->numberOfThreads_;
+            estimateInterpolationErrors[ i ]
+                    = gravityFieldVariationSettings.at( i )->getInterpolatorSettings( )->estimateInterpolationError_;
         }
     }
 
@@ -89,7 +95,8 @@ std::shared_ptr< gravitation::GravityFieldVariationsSet > createGravityFieldMode
     std::shared_ptr< GravityFieldVariationsSet > fieldVariationsSet =
             std::make_shared< GravityFieldVariationsSet >(
                 variationObjects, variationTypes, variationIdentifiers,
-                createInterpolators, initialTimes, finalTimes, timeSteps );
+                createInterpolators, initialTimes, finalTimes, timeSteps, numberOfThreads,
+                estimateInterpolationErrors );
 
     if( std::dynamic_pointer_cast< TimeDependentSphericalHarmonicsGravityField >(
                 bodyMap.at( body )->getGravityFieldModel( ) ) == nullptr )
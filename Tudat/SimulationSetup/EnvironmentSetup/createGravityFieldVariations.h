@@ -43,15 +43,21 @@ public:
      * \param timeStep Time step with which to evaluate model, and provide input to interpolator
      * \param interpolatorSettings Settings to use to crate the interpolator (i.e. type and any
      * required associated information).
+     * \param numberOfThreads Maximum number of threads to use when evaluating the model at all interpolation times.
+     * \param estimateInterpolationError Boolean denoting whether to estimate the error of the interpolated model, by
+     * comparing it to the model evaluated halfway between the interpolation times.
      */
     ModelInterpolationSettings(
             const double initialTime = 0.0,
             const double finalTime = 0.0,
             const double timeStep = 0.0,
             const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
-            std::make_shared< interpolators::LagrangeInterpolatorSettings >( 6 ) ):
+            std::make_shared< interpolators::LagrangeInterpolatorSettings >( 6 ),
+            const int numberOfThreads = utilities::getDefaultNumberOfThreads( ),
+            const bool estimateInterpolationError = false ):
         interpolatorSettings_( interpolatorSettings ), initialTime_( initialTime ),
-        finalTime_( finalTime ), timeStep_( timeStep ){ }
+        finalTime_( finalTime ), timeStep_( timeStep ), numberOfThreads_( numberOfThreads ),
+        estimateInterpolationError_( estimateInterpolationError ){ }
 
     std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings_;
 
@@ -63,6 +69,12 @@ public:
 
     //! Time step with which to evaluate model, and provide input to interpolator
     double timeStep_;
+
+    //! Maximum number of threads to use when evaluating the model at all interpolation times.
+    int numberOfThreads_;
+
+    //! Boolean denoting whether to estimate the error of the interpolated model.
+    bool estimateInterpolationError_;
 };
 
 //! Base class for defining settings for gravity field variations.
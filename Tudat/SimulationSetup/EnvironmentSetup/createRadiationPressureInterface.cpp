@@ -224,6 +224,13 @@ std::shared_ptr< electro_magnetism::RadiationPressureInterface > createRadiation
                     "not recognized for body" + bodyName );
     }
 
+    // Set table of precomputed occultation intervals, if provided.
+    if( radiationPressureInterfaceSettings->getOccultationEventTable( ) != nullptr )
+    {
+        radiationPressureInterface->setOccultationEventTable(
+                    radiationPressureInterfaceSettings->getOccultationEventTable( ) );
+    }
+
     return radiationPressureInterface;
 }
 
@@ -82,6 +82,29 @@ public:
      */
     std::vector< std::string > getOccultingBodies( ){ return occultingBodies_; }
 
+    //! Function to set the table of precomputed occultation intervals of the body undergoing radiation pressure.
+    /*!
+     *  Function to set the table of precomputed occultation intervals of the body undergoing radiation pressure,
+     *  w.r.t. the occulting bodies of these settings (in the same order), which is used to skip the evaluation of the
+     *  shadow function (see RadiationPressureInterface::setOccultationEventTable).
+     *  \param occultationEventTable Table of precomputed occultation intervals (nullptr if not used).
+     */
+    void setOccultationEventTable(
+            const std::shared_ptr< electro_magnetism::OccultationEventTable > occultationEventTable )
+    {
+        occultationEventTable_ = occultationEventTable;
+    }
+
+    //! Function returning the table of precomputed occultation intervals of the body undergoing radiation pressure.
+    /*!
+     *  Function returning the table of precomputed occultation intervals of the body undergoing radiation pressure.
+     *  \return Table of precomputed occultation intervals (nullptr if not used).
+     */
+    std::shared_ptr< electro_magnetism::OccultationEventTable > getOccultationEventTable( )
+    {
+        return occultationEventTable_;
+    }
+
 protected:
 
     //! Type of radiation pressure interface that is to be made.
@@ -92,6 +115,9 @@ protected:
 
     //! List of bodies causing (partial) occultation
     std::vector< std::string > occultingBodies_;
+
+    //! Table of precomputed occultation intervals of the body undergoing radiation pressure (nullptr if not used).
+    std::shared_ptr< electro_magnetism::OccultationEventTable > occultationEventTable_;
 };
 
 //! Class providing settings for the creation of a cannonball radiation pressure interface
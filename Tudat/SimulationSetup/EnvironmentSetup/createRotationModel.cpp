@@ -21,6 +21,7 @@
 #include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
 #include "Tudat/Astrodynamics/Ephemerides/synchronousRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesTable.h"
 #include "Tudat/Astrodynamics/EarthOrientation/shortPeriodEarthOrientationCorrectionCalculator.h"
 #include "Tudat/Mathematics/Interpolators/jumpDataLinearInterpolator.h"
 #endif
@@ -193,9 +194,20 @@ std::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
             std::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
                     std::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
                         polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
+
+            // Load precomputed Earth orientation angles, if provided
+            std::shared_ptr< earth_orientation::EarthOrientationAnglesTable > earthOrientationAnglesTable;
+            if( gcrsToItrsRotationSettings->getEarthOrientationAnglesTableFile( ) != "" )
+            {
+                earthOrientationAnglesTable = std::make_shared< earth_orientation::EarthOrientationAnglesTable >(
+                            gcrsToItrsRotationSettings->getEarthOrientationAnglesTableFile( ) );
+                earth_orientation::checkEarthOrientationAnglesTableConsistency(
+                            earthOrientationAnglesTable, earthOrientationCalculator );
+            }
+
             rotationalEphemeris = std::make_shared< ephemerides::GcrsToItrsRotationModel >(
                         earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ),
-                        gcrsToItrsRotationSettings->getOriginalFrame( ) );
+                        gcrsToItrsRotationSettings->getOriginalFrame( ), earthOrientationAnglesTable );
 
             break;
         }
@@ -251,7 +251,7 @@ public:
         RotationModelSettings( gcrs_to_itrs_rotation_model, baseFrameName, "ITRS" ),
         inputTimeScale_( inputTimeScale ), nutationTheory_( nutationTheory ), eopFile_( eopFile ),
         eopFileFormat_( "C04" ), ut1CorrectionSettings_( ut1CorrectionSettings ),
-        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ){ }
+        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ), earthOrientationAnglesTableFile_( "" ){ }
 
     //! Destructor
     ~GcrsToItrsRotationModelSettings( ){ }
@@ -315,6 +315,30 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //! Function to retrieve the name of the binary file containing a precomputed Earth orientation angles table
+    /*!
+     * Function to retrieve the name of the binary file containing a precomputed Earth orientation angles table (empty if
+     * angles are computed directly)
+     * \return Name of the binary file containing a precomputed Earth orientation angles table
+     */
+    std::string getEarthOrientationAnglesTableFile( )
+    {
+        return earthOrientationAnglesTableFile_;
+    }
+
+    //! Function to set the name of a binary file containing a precomputed Earth orientation angles table
+    /*!
+     * Function to set the name of a binary file containing a precomputed Earth orientation angles table, as written by
+     * EarthOrientationAnglesTable::writeToFile. If set, the angles are interpolated from this table (which must be
+     * defined in the input time scale, and generated with the same nutation theory, EOP data and corrections as defined
+     * by these settings, see checkEarthOrientationAnglesTableConsistency), instead of being computed directly.
+     * \param earthOrientationAnglesTableFile Name of the binary file containing a precomputed Earth orientation angles table
+     */
+    void setEarthOrientationAnglesTableFile( const std::string& earthOrientationAnglesTableFile )
+    {
+        earthOrientationAnglesTableFile_ = earthOrientationAnglesTableFile;
+    }
+
 private:
 
     //! Time scale in which input to the rotation model class is provided
@@ -335,6 +359,9 @@ private:
     //! Settings for short-period polar motion variations
     std::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //! Name of the binary file containing a precomputed Earth orientation angles table (empty if none is used)
+    std::string earthOrientationAnglesTableFile_;
+
 };
 #endif
 
@@ -374,6 +374,11 @@ createSphericalHarmonicsGravityAcceleration(
                       std::bind( &Body::getPosition, bodyExertingAcceleration ),
                       std::bind( &Body::getCurrentRotationToGlobalFrame,
                                  bodyExertingAcceleration ), useCentralBodyFixedFrame );
+
+            // Only retrieve coefficients when updating the acceleration if they have been modified.
+            accelerationModel->setCoefficientUpdateIndexFunction(
+                        std::bind( &SphericalHarmonicsGravityField::getCoefficientUpdateIndex,
+                                   sphericalHarmonicsGravityField ) );
         }
     }
     return accelerationModel;
@@ -736,8 +741,8 @@ std::shared_ptr< aerodynamics::AerodynamicAcceleration > createAerodynamicAccele
                 reference_frames::inertial_frame );
 
     std::function< Eigen::Vector3d( ) > coefficientFunction =
-            std::bind( &AerodynamicCoefficientInterface::getCurrentForceCoefficients,
-                       aerodynamicCoefficients );
+            std::bind( &AtmosphericFlightConditions::getCurrentForceCoefficients,
+                       bodyFlightConditions );
     std::function< Eigen::Vector3d( ) > coefficientInPropagationFrameFunction =
             std::bind( &reference_frames::transformVectorFunctionFromVectorFunctions,
                        coefficientFunction, toPropagationFrameTransformation );
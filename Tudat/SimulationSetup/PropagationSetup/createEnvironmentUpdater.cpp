@@ -944,6 +944,35 @@ std::vector< std::string > > createFullEnvironmentUpdaterSettings(
     }
     return environmentModelsToUpdate;
 }
+
+//! Function to set whether the aerodynamic coefficients of the vehicles with updated flight conditions are evaluated on demand
+void setAerodynamicCoefficientEvaluationModes(
+        const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& environmentModelsToUpdate,
+        const simulation_setup::NamedBodyMap& bodyMap )
+{
+    if( environmentModelsToUpdate.count( vehicle_flight_conditions_update ) > 0 )
+    {
+        std::vector< std::string > bodiesWithFlightConditions =
+                environmentModelsToUpdate.at( vehicle_flight_conditions_update );
+        for( unsigned int i = 0; i < bodiesWithFlightConditions.size( ); i++ )
+        {
+            std::shared_ptr< aerodynamics::AtmosphericFlightConditions > flightConditions =
+                    std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
+                        bodyMap.at( bodiesWithFlightConditions.at( i ) )->getFlightConditions( ) );
+            if( flightConditions != nullptr )
+            {
+                // Coefficients may be required by guidance object when updating the angles.
+                bool isGuidanceSet = false;
+                if( flightConditions->getAerodynamicAngleCalculator( ) != nullptr )
+                {
+                    isGuidanceSet = flightConditions->getAerodynamicAngleCalculator( )->isAngleUpdateFunctionSet( );
+                }
+                flightConditions->setEvaluateAerodynamicCoefficientsOnDemand( !isGuidanceSet );
+            }
+        }
+    }
+}
+
 template std::shared_ptr< propagators::EnvironmentUpdater< double, double > > createEnvironmentUpdaterForDynamicalEquations< double, double >(
         const std::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings,
         const simulation_setup::NamedBodyMap& bodyMap );
@@ -261,6 +261,20 @@ std::map< propagators::EnvironmentModelsToUpdate,
 std::vector< std::string > > createFullEnvironmentUpdaterSettings(
         const simulation_setup::NamedBodyMap& bodyMap );
 
+//! Function to set whether the aerodynamic coefficients of the vehicles with updated flight conditions are evaluated on demand
+/*!
+ * Function to set whether the aerodynamic coefficients of the vehicles with updated flight conditions are evaluated on demand
+ * (see AtmosphericFlightConditions::setEvaluateAerodynamicCoefficientsOnDemand). All models created from propagation
+ * settings (accelerations, torques, dependent variables) retrieve the coefficients through the flight conditions, so that
+ * on-demand evaluation is used for all vehicles, except those for which an aerodynamic guidance object is linked to the
+ * angle calculator, as such an object may access the aerodynamic coefficient interface directly.
+ * \param environmentModelsToUpdate List of environment models that are updated during the propagation
+ * \param bodyMap List of body objects used in the simulations.
+ */
+void setAerodynamicCoefficientEvaluationModes(
+        const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& environmentModelsToUpdate,
+        const simulation_setup::NamedBodyMap& bodyMap );
+
 //! Create environment updater from a list of propagation settings.
 /*!
 * Get environment updater from a list of propagation settings.
@@ -285,6 +299,9 @@ createEnvironmentUpdaterForDynamicalEquations(
             std::vector< std::string > > environmentModelsToUpdate =
             createEnvironmentUpdaterSettings< StateScalarType >( propagatorSettings, bodyMap );
 
+    // Evaluate aerodynamic coefficients on demand where possible.
+    setAerodynamicCoefficientEvaluationModes( environmentModelsToUpdate, bodyMap );
+
     // Create and return environment updater object.
     return std::make_shared< EnvironmentUpdater< StateScalarType, TimeType > >(
                 bodyMap, environmentModelsToUpdate, integratedTypeAndBodyList );
@@ -469,6 +469,28 @@ public:
             }
         }
 
+        // Set up profiling of the individual components of the propagation, if required.
+        if( propagatorSettings_->getProfilePerformance( ) )
+        {
+            performanceProfiler_ = std::make_shared< utilities::PerformanceProfiler >( );
+            environmentUpdater_->setPerformanceProfiler( performanceProfiler_ );
+            dynamicsStateDerivative_->setPerformanceProfiler( performanceProfiler_ );
+
+            if( dependentVariablesFunctions_ != nullptr )
+            {
+                std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler = performanceProfiler_;
+                std::function< Eigen::VectorXd( ) > dependentVariablesFunction = dependentVariablesFunctions_;
+                unsigned int dependentVariablesProfilerIndex = performanceProfiler_->addComponent(
+                            utilities::dependent_variable_profiled_component, "all dependent variables" );
+                dependentVariablesFunctions_ = [ = ]( )
+                {
+                    utilities::ScopedProfilerTimer dependentVariablesTimer(
+                                performanceProfiler.get( ), dependentVariablesProfilerIndex );
+                    return dependentVariablesFunction( );
+                };
+            }
+        }
+
         stateDerivativeFunction_ =
                 std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::computeStateDerivative,
                              dynamicsStateDerivative_, std::placeholders::_1, std::placeholders::_2 );
@@ -515,6 +537,16 @@ public:
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
 
+        // Start profiling of propagation, if required.
+        std::chrono::steady_clock::time_point propagationStartClockTime;
+        unsigned long long propagationStartNumberOfAllocations = 0;
+        if( performanceProfiler_ != nullptr )
+        {
+            performanceProfiler_->resetMeasurements( );
+            propagationStartNumberOfAllocations = utilities::getNumberOfAllocations( );
+            propagationStartClockTime = std::chrono::steady_clock::now( );
+        }
+
         // Integrate equations of motion numerically.
         resetPropagationTerminationConditions( );
         simulation_setup::setAreBodiesInPropagation( bodyMap_, true );
@@ -532,6 +564,15 @@ public:
                     initialClockTime_ );
         simulation_setup::setAreBodiesInPropagation( bodyMap_, false );
 
+        // Finalize profiling of propagation, if required.
+        if( performanceProfiler_ != nullptr )
+        {
+            addIntegratorOverheadToPerformanceProfile(
+                        std::chrono::duration< double >(
+                            std::chrono::steady_clock::now( ) - propagationStartClockTime ).count( ),
+                        utilities::getNumberOfAllocations( ) - propagationStartNumberOfAllocations );
+        }
+
         // Convert numerical solution to conventional state
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
                     equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
@@ -773,6 +814,17 @@ public:
         return dependentVariableIds_;
     }
 
+    //! Function to retrieve the profile of the computation time of the individual components of the last propagation
+    /*!
+     * Function to retrieve the profile of the computation time (and number of allocations) of the individual components
+     * (acceleration models, environment updates, dependent variables and integrator overhead) of the last propagation.
+     * \return Profile of the last propagation (nullptr if profiling was not requested in the propagator settings).
+     */
+    std::shared_ptr< utilities::PerformanceProfiler > getPerformanceProfiler( )
+    {
+        return performanceProfiler_;
+    }
+
     //! Function to retrieve initial time of propagation
     /*!
      * Function to retrieve initial time of propagation
@@ -844,6 +896,38 @@ public:
 
 protected:
 
+    //! Function to add the integrator overhead of the last propagation to the performance profile, and print the profile.
+    /*!
+     * Function to add the integrator overhead of the last propagation to the performance profile, and print a summary of
+     * the profile if requested in the propagator settings. The integrator overhead is the part of the propagation time
+     * (and number of allocations) not spent on the state derivative and dependent variables.
+     * \param propagationTime Total wall-clock time of the propagation (in seconds).
+     * \param propagationNumberOfAllocations Total number of allocations during the propagation.
+     */
+    void addIntegratorOverheadToPerformanceProfile(
+            const double propagationTime, const unsigned long long propagationNumberOfAllocations )
+    {
+        using namespace utilities;
+
+        const ProfiledComponentSummary& stateDerivativeSummary = performanceProfiler_->getComponentSummary(
+                    performanceProfiler_->addComponent( state_derivative_profiled_component, "full state derivative" ) );
+        const double overheadTime = propagationTime - stateDerivativeSummary.totalTime -
+                performanceProfiler_->getTotalTime( dependent_variable_profiled_component );
+        const unsigned long long overheadNumberOfAllocations = propagationNumberOfAllocations -
+                stateDerivativeSummary.numberOfAllocations -
+                performanceProfiler_->getTotalNumberOfAllocations( dependent_variable_profiled_component );
+
+        performanceProfiler_->addMeasurement(
+                    performanceProfiler_->addComponent(
+                        integrator_overhead_profiled_component, "integrator and propagation loop" ),
+                    overheadTime, overheadNumberOfAllocations );
+
+        if( propagatorSettings_->getPrintPerformanceProfile( ) )
+        {
+            performanceProfiler_->printSummary( std::cout, propagationTime );
+        }
+    }
+
     //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
     std::map< IntegratedStateType, std::vector< std::shared_ptr<
     IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
@@ -937,6 +1021,9 @@ protected:
     //! Event that triggered the termination of the propagation
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
 
+    //! Object used to profile the individual components of the propagation (nullptr if no profiling is done).
+    std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler_;
+
 };
 
 //! Function to get a vector of initial states from a vector of propagator settings
@@ -21,6 +21,7 @@
 #include <boost/tuple/tuple_comparison.hpp>
 #include <boost/tuple/tuple_io.hpp>
 
+#include "Tudat/Basics/performanceProfiler.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
@@ -108,17 +109,65 @@ public:
             resetFunctionVector_.at( i ).template get< 2 >( )( );
         }
 
-        // Set integrated state variables in environment.
-        setIntegratedStatesInEnvironment( integratedStatesToSet );
+        if( performanceProfiler_ == nullptr )
+        {
+            // Set integrated state variables in environment.
+            setIntegratedStatesInEnvironment( integratedStatesToSet );
+
+            // Set current state from environment for override settings setIntegratedStatesFromEnvironment
+            setStatesFromEnvironment( setIntegratedStatesFromEnvironment, currentTime );
 
-        // Set current state from environment for override settings setIntegratedStatesFromEnvironment
-        setStatesFromEnvironment( setIntegratedStatesFromEnvironment, currentTime );
+            // Evaluate time-dependent update functions (dependent variables of state and time)
+            // determined by setUpdateFunctions
+            for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+            {
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            }
+        }
+        else
+        {
+            // Perform same operations as above, profiling each of them.
+            {
+                utilities::ScopedProfilerTimer integratedStatesTimer(
+                            performanceProfiler_.get( ), integratedStatesProfilerIndex_ );
+                setIntegratedStatesInEnvironment( integratedStatesToSet );
+                setStatesFromEnvironment( setIntegratedStatesFromEnvironment, currentTime );
+            }
+
+            for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+            {
+                utilities::ScopedProfilerTimer updateFunctionTimer(
+                            performanceProfiler_.get( ), updateFunctionProfilerIndices_.at( i ) );
+                updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            }
+        }
+    }
 
-        // Evaluate time-dependent update functions (dependent variables of state and time)
-        // determined by setUpdateFunctions
+    //! Function to set the object used to profile the environment update functions.
+    /*!
+     * Function to set the object used to profile the environment update functions. Each update function is registered as
+     * a separate component in the profiler, named by the type of update and the body that is updated. Setting the
+     * numerically integrated states in the environment is registered as a single component.
+     * \param performanceProfiler Object used to profile the computations (nullptr to disable profiling).
+     */
+    void setPerformanceProfiler( const std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler )
+    {
+        performanceProfiler_ = performanceProfiler;
+        updateFunctionProfilerIndices_.clear( );
+        if( performanceProfiler_ == nullptr )
+        {
+            return;
+        }
+
+        integratedStatesProfilerIndex_ = performanceProfiler_->addComponent(
+                    utilities::environment_update_profiled_component, "integrated states" );
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
-            updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
+            updateFunctionProfilerIndices_.push_back(
+                        performanceProfiler_->addComponent(
+                            utilities::environment_update_profiled_component,
+                            getEnvironmentModelUpdateName( updateFunctionVector_.at( i ).template get< 0 >( ) ) +
+                            " of " + updateFunctionVector_.at( i ).template get< 1 >( ) ) );
         }
     }
 
@@ -560,6 +609,12 @@ private:
                                                          ::TimeDependentSphericalHarmonicsGravityField
                                                          ::update,
                                                          gravityField, std::placeholders::_1 ) ) );
+
+                            resetFunctionVector_.push_back(
+                                        boost::make_tuple(
+                                            spherical_harmonic_gravity_field_update, currentBodies.at( i ),
+                                            std::bind( &gravitation::TimeDependentSphericalHarmonicsGravityField::
+                                                         resetCurrentTime, gravityField, TUDAT_NAN ) ) );
                         }
                         // If no sh field at all, throw eeror.
                         else if( std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >
@@ -685,6 +740,15 @@ private:
 
 
 
+    //! Object used to profile the environment update functions (nullptr if no profiling is done).
+    std::shared_ptr< utilities::PerformanceProfiler > performanceProfiler_;
+
+    //! Index in performanceProfiler_ of the component for setting the integrated states in the environment.
+    unsigned int integratedStatesProfilerIndex_;
+
+    //! Index in performanceProfiler_ of each entry of updateFunctionVector_.
+    std::vector< unsigned int > updateFunctionProfilerIndices_;
+
     //! Predefined state history iterator for computational efficiency.
     typename std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
     integratedStateIterator_;
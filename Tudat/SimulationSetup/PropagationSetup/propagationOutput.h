@@ -606,9 +606,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         }
 
         variableFunction = std::bind(
-                    &aerodynamics::AerodynamicCoefficientInterface::getCurrentForceCoefficients,
+                    &aerodynamics::AtmosphericFlightConditions::getCurrentForceCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodyMap.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                        bodyMap.at( bodyWithProperty )->getFlightConditions( ) ) );
         parameterSize = 3;
 
         break;
@@ -625,9 +625,9 @@ std::pair< std::function< Eigen::VectorXd( ) >, int > getVectorDependentVariable
         }
 
         variableFunction = std::bind(
-                    &aerodynamics::AerodynamicCoefficientInterface::getCurrentMomentCoefficients,
+                    &aerodynamics::AtmosphericFlightConditions::getCurrentMomentCoefficients,
                     std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
-                        bodyMap.at( bodyWithProperty )->getFlightConditions( ) )->getAerodynamicCoefficientInterface( ) );
+                        bodyMap.at( bodyWithProperty )->getFlightConditions( ) ) );
         parameterSize = 3;
 
         break;
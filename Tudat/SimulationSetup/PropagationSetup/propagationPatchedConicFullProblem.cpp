@@ -9,6 +9,11 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+
 #include "Tudat/SimulationSetup/PropagationSetup/propagationPatchedConicFullProblem.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationLambertTargeterFullProblem.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/exportTrajectory.h"
@@ -26,6 +31,12 @@
 #include "Tudat/Astrodynamics/TrajectoryDesign/swingbyLegMga1DsmPosition.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/swingbyLegMga1DsmVelocity.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
+#include "Tudat/Basics/parallelLoop.h"
+#if USE_CSPICE
+#include "Tudat/External/SpiceInterface/spiceEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceInterface.h"
+#include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
+#endif
 
 namespace tudat
 {
@@ -299,45 +310,31 @@ void propagateMgaWithoutDsmAndFullProblem(
 
 
 
-//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
-void propagateMga1DsmVelocityAndFullProblem(
-        simulation_setup::NamedBodyMap& bodyMap,
-        const std::vector< std::string > departureAndArrivalBodies,
-        const std::string& dsm,
+//! Function to calculate the velocities at departure and arrival of a patched conics leg including a DSM (velocity
+//! formulation).
+static void computeMga1DsmVelocityLegVelocities(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& departureAndArrivalBodies,
         const std::string& centralBody,
-        const Eigen::Vector3d cartesianPositionAtDeparture,
-        const Eigen::Vector3d cartesianPositionDSM,
-        const Eigen::Vector3d cartesianPositionAtArrival,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
         const double initialTime,
-        const double timeDsm,
         const double timeArrival,
         const transfer_trajectories::TransferLegType& legType,
         const std::vector< double >& trajectoryVariableVector,
         const double semiMajorAxis,
         const double eccentricity,
         Eigen::Vector3d& velocityAfterDeparture,
-        Eigen::Vector3d& velocityBeforeArrival,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
-        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+        Eigen::Vector3d& velocityBeforeArrival )
 {
-
     if( legType == transfer_trajectories::mga1DsmVelocity_Departure )
     {
         std::shared_ptr< transfer_trajectories::DepartureLegMga1DsmVelocity > departureLegMga1DsmVelocity =
                 std::make_shared< transfer_trajectories::DepartureLegMga1DsmVelocity >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 semiMajorAxis, eccentricity,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -361,9 +358,9 @@ void propagateMga1DsmVelocityAndFullProblem(
         std::shared_ptr< transfer_trajectories::SwingbyLegMga1DsmVelocity > swingbyLegMga1DsmVelocity =
                 std::make_shared< transfer_trajectories::SwingbyLegMga1DsmVelocity >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 pointerToVelocityBeforeArrival,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -380,51 +377,17 @@ void propagateMga1DsmVelocityAndFullProblem(
         // Update value of velocity after departure.
         swingbyLegMga1DsmVelocity->returnDepartureVariables( departureBodyPosition, departureBodyVelocity, velocityAfterDeparture );
     }
-
-
-    // First part of the leg: propagation of the state from departure body to DSM location.
-    integratorSettings->initialTime_ = initialTime;
-
-    std::vector< std::string >legDepartureAndArrival;
-    legDepartureAndArrival.push_back( departureAndArrivalBodies[ 0 ] );
-    legDepartureAndArrival.push_back( dsm );
-
-    propagateKeplerianOrbitLegAndFullProblem(
-                timeDsm - initialTime, initialTime, bodyMap, centralBody,
-                legDepartureAndArrival, velocityAfterDeparture, propagatorSettingsBeforeDsm, integratorSettings,
-                patchedConicsResultFromDepartureToDsm, fullProblemResultFromDepartureToDsm, dependentVariablesFromDepartureToDsm,
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                cartesianPositionAtDeparture );
-
-    // Second part of the leg: Lambert targeter from DSM location to arrival body.
-    legDepartureAndArrival.clear( );
-    legDepartureAndArrival.push_back( dsm );
-    legDepartureAndArrival.push_back( departureAndArrivalBodies[ 1 ] );
-
-    integratorSettings->initialTime_ = timeDsm;
-
-    propagateLambertTargeterAndFullProblem( timeArrival - timeDsm, timeDsm, bodyMap, centralBody,
-                                            propagatorSettingsAfterDsm, integratorSettings,
-                                            patchedConicsResultFromDsmToArrival, fullProblemResultFromDsmToArrival,
-                                            dependentVariablesFromDsmToArrival, legDepartureAndArrival,
-                                            bodyMap[ centralBody]->getGravityFieldModel( )->getGravitationalParameter( ),
-                                            cartesianPositionDSM, cartesianPositionAtArrival );
-
 }
 
-
-
-//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
-void propagateMga1DsmPositionAndFullProblem(
-        simulation_setup::NamedBodyMap& bodyMap,
-        const std::vector< std::string > departureAndArrivalBodies,
-        const std::string& dsm,
+//! Function to calculate the velocities at departure and arrival of a patched conics leg including a DSM (position
+//! formulation).
+static void computeMga1DsmPositionLegVelocities(
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string >& departureAndArrivalBodies,
         const std::string& centralBody,
-        const Eigen::Vector3d cartesianPositionAtDeparture,
-        const Eigen::Vector3d cartesianPositionDSM,
-        const Eigen::Vector3d cartesianPositionAtArrival,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
         const double initialTime,
-        const double timeDsm,
         const double timeArrival,
         const transfer_trajectories::TransferLegType& legType,
         const std::vector< double >& trajectoryVariableVector,
@@ -432,18 +395,7 @@ void propagateMga1DsmPositionAndFullProblem(
         const double semiMajorAxis,
         const double eccentricity,
         Eigen::Vector3d& velocityAfterDeparture,
-        Eigen::Vector3d& velocityBeforeArrival,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
-        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
-        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
-        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
-        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
-        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
-        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+        Eigen::Vector3d& velocityBeforeArrival )
 {
     if( legType == transfer_trajectories::mga1DsmPosition_Departure )
     {
@@ -451,9 +403,9 @@ void propagateMga1DsmPositionAndFullProblem(
         std::shared_ptr< transfer_trajectories::DepartureLegMga1DsmPosition > departureLegMga1DsmPosition =
                 std::make_shared< transfer_trajectories::DepartureLegMga1DsmPosition >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 semiMajorAxis, eccentricity,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -481,9 +433,9 @@ void propagateMga1DsmPositionAndFullProblem(
         std::shared_ptr< transfer_trajectories::SwingbyLegMga1DsmPosition > swingbyLegMga1DsmPosition =
                 std::make_shared< transfer_trajectories::SwingbyLegMga1DsmPosition >(
                     cartesianPositionAtDeparture, cartesianPositionAtArrival, timeArrival - initialTime,
-                    bodyMap[ departureAndArrivalBodies[ 0 ] ]->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
-                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
-                bodyMap[ departureAndArrivalBodies[ 0 ] ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                    bodyMap.at( departureAndArrivalBodies[ 0 ] )->getEphemeris( )->getCartesianState( initialTime ).segment( 3, 3 ),
+                bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( ),
+                bodyMap.at( departureAndArrivalBodies[ 0 ] )->getGravityFieldModel( )->getGravitationalParameter( ),
                 pointerToVelocityBeforeArrival, minimumPericenterRadius,
                 trajectoryVariableVector[ 0 ],
                 trajectoryVariableVector[ 1 ],
@@ -502,8 +454,111 @@ void propagateMga1DsmPositionAndFullProblem(
 
 
     }
+}
+
+//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
+void propagateMga1DsmVelocityAndFullProblem(
+        simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string > departureAndArrivalBodies,
+        const std::string& dsm,
+        const std::string& centralBody,
+        const Eigen::Vector3d cartesianPositionAtDeparture,
+        const Eigen::Vector3d cartesianPositionDSM,
+        const Eigen::Vector3d cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeDsm,
+        const double timeArrival,
+        const transfer_trajectories::TransferLegType& legType,
+        const std::vector< double >& trajectoryVariableVector,
+        const double semiMajorAxis,
+        const double eccentricity,
+        Eigen::Vector3d& velocityAfterDeparture,
+        Eigen::Vector3d& velocityBeforeArrival,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+{
 
+    computeMga1DsmVelocityLegVelocities(
+                bodyMap, departureAndArrivalBodies, centralBody, cartesianPositionAtDeparture, cartesianPositionAtArrival,
+                initialTime, timeArrival, legType, trajectoryVariableVector, semiMajorAxis, eccentricity,
+                velocityAfterDeparture, velocityBeforeArrival );
 
+    // First part of the leg: propagation of the state from departure body to DSM location.
+    integratorSettings->initialTime_ = initialTime;
+
+    std::vector< std::string >legDepartureAndArrival;
+    legDepartureAndArrival.push_back( departureAndArrivalBodies[ 0 ] );
+    legDepartureAndArrival.push_back( dsm );
+
+    propagateKeplerianOrbitLegAndFullProblem(
+                timeDsm - initialTime, initialTime, bodyMap, centralBody,
+                legDepartureAndArrival, velocityAfterDeparture, propagatorSettingsBeforeDsm, integratorSettings,
+                patchedConicsResultFromDepartureToDsm, fullProblemResultFromDepartureToDsm, dependentVariablesFromDepartureToDsm,
+                bodyMap[ centralBody ]->getGravityFieldModel( )->getGravitationalParameter( ),
+                cartesianPositionAtDeparture );
+
+    // Second part of the leg: Lambert targeter from DSM location to arrival body.
+    legDepartureAndArrival.clear( );
+    legDepartureAndArrival.push_back( dsm );
+    legDepartureAndArrival.push_back( departureAndArrivalBodies[ 1 ] );
+
+    integratorSettings->initialTime_ = timeDsm;
+
+    propagateLambertTargeterAndFullProblem( timeArrival - timeDsm, timeDsm, bodyMap, centralBody,
+                                            propagatorSettingsAfterDsm, integratorSettings,
+                                            patchedConicsResultFromDsmToArrival, fullProblemResultFromDsmToArrival,
+                                            dependentVariablesFromDsmToArrival, legDepartureAndArrival,
+                                            bodyMap[ centralBody]->getGravityFieldModel( )->getGravitationalParameter( ),
+                                            cartesianPositionDSM, cartesianPositionAtArrival );
+
+}
+
+
+
+//! Function to both calculate a patched conics leg including a DSM and propagate the corresponding full dynamics problem.
+void propagateMga1DsmPositionAndFullProblem(
+        simulation_setup::NamedBodyMap& bodyMap,
+        const std::vector< std::string > departureAndArrivalBodies,
+        const std::string& dsm,
+        const std::string& centralBody,
+        const Eigen::Vector3d cartesianPositionAtDeparture,
+        const Eigen::Vector3d cartesianPositionDSM,
+        const Eigen::Vector3d cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeDsm,
+        const double timeArrival,
+        const transfer_trajectories::TransferLegType& legType,
+        const std::vector< double >& trajectoryVariableVector,
+        const double minimumPericenterRadius,
+        const double semiMajorAxis,
+        const double eccentricity,
+        Eigen::Vector3d& velocityAfterDeparture,
+        Eigen::Vector3d& velocityBeforeArrival,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsBeforeDsm,
+        const std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+        std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > propagatorSettingsAfterDsm,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDepartureToDsm,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDepartureToDsm,
+        std::map< double, Eigen::Vector6d >& patchedConicsResultFromDsmToArrival,
+        std::map< double, Eigen::Vector6d >& fullProblemResultFromDsmToArrival,
+        std::map< double, Eigen::VectorXd >& dependentVariablesFromDsmToArrival )
+{
+    computeMga1DsmPositionLegVelocities(
+                bodyMap, departureAndArrivalBodies, centralBody, cartesianPositionAtDeparture, cartesianPositionAtArrival,
+                initialTime, timeArrival, legType, trajectoryVariableVector, minimumPericenterRadius, semiMajorAxis,
+                eccentricity, velocityAfterDeparture, velocityBeforeArrival );
 
     // First part of the leg: Lambert targeter from departure body to DSM location.
 
@@ -1284,6 +1339,372 @@ void fullPropagationPatchedConicsTrajectory(
 
 }
 
+//! Settings for the propagation of a single part of a patched conics leg, as used by the concurrent propagation.
+struct PatchedConicLegPartPropagationSettings
+{
+    //! Index of the leg part (as used for the keys of the output maps).
+    int legPartIndex;
+
+    //! Time of flight of the leg part.
+    double timeOfFlight;
+
+    //! Time at half of the time of flight, from which the full problem is propagated forward and backward.
+    double midpointTime;
+
+    //! Cartesian state of the patched conics solution at half of the time of flight.
+    Eigen::VectorXd midpointState;
+
+    //! Gravitational parameter of the central body.
+    double centralBodyGravitationalParameter;
+
+    //! Boolean denoting whether the patched conics solution of the leg part is computed by a Lambert targeter (true) or
+    //! by propagating a Keplerian orbit from the departure velocity (false).
+    bool isLambertTargeterLegPart;
+};
+
+//! Function to compute the Cartesian state at half of the time of flight of a Keplerian orbit.
+static Eigen::Vector6d computeKeplerianOrbitMidpointState(
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianVelocityAtDeparture,
+        const double timeOfFlight,
+        const double centralBodyGravitationalParameter )
+{
+    Eigen::Vector6d cartesianStateAtDeparture;
+    cartesianStateAtDeparture.segment( 0, 3 ) = cartesianPositionAtDeparture;
+    cartesianStateAtDeparture.segment( 3, 3 ) = cartesianVelocityAtDeparture;
+
+    return orbital_element_conversions::convertKeplerianToCartesianElements(
+                orbital_element_conversions::propagateKeplerOrbit(
+                    orbital_element_conversions::convertCartesianToKeplerianElements(
+                        cartesianStateAtDeparture, centralBodyGravitationalParameter ),
+                    timeOfFlight / 2.0, centralBodyGravitationalParameter ), centralBodyGravitationalParameter );
+}
+
+//! Function to create the settings for the propagation of a leg part of which the patched conics solution is computed by
+//! a Lambert targeter.
+static PatchedConicLegPartPropagationSettings createLambertTargeterLegPartSettings(
+        const int legPartIndex,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& cartesianPositionAtArrival,
+        const double initialTime,
+        const double timeOfFlight,
+        const double centralBodyGravitationalParameter )
+{
+    mission_segments::LambertTargeterIzzo lambertTargeter(
+                cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight, centralBodyGravitationalParameter );
+
+    PatchedConicLegPartPropagationSettings legPartSettings;
+    legPartSettings.legPartIndex = legPartIndex;
+    legPartSettings.timeOfFlight = timeOfFlight;
+    legPartSettings.midpointTime = initialTime + timeOfFlight / 2.0;
+    legPartSettings.midpointState = computeKeplerianOrbitMidpointState(
+                cartesianPositionAtDeparture, lambertTargeter.getInertialVelocityAtDeparture( ), timeOfFlight,
+                centralBodyGravitationalParameter );
+    legPartSettings.centralBodyGravitationalParameter = centralBodyGravitationalParameter;
+    legPartSettings.isLambertTargeterLegPart = true;
+    return legPartSettings;
+}
+
+//! Function to create the settings for the propagation of a leg part of which the patched conics solution is computed by
+//! propagating a Keplerian orbit from the departure velocity.
+static PatchedConicLegPartPropagationSettings createKeplerianOrbitLegPartSettings(
+        const int legPartIndex,
+        const Eigen::Vector3d& cartesianPositionAtDeparture,
+        const Eigen::Vector3d& velocityAfterDeparture,
+        const double initialTime,
+        const double timeOfFlight,
+        const double centralBodyGravitationalParameter )
+{
+    PatchedConicLegPartPropagationSettings legPartSettings;
+    legPartSettings.legPartIndex = legPartIndex;
+    legPartSettings.timeOfFlight = timeOfFlight;
+    legPartSettings.midpointTime = initialTime + timeOfFlight / 2.0;
+    legPartSettings.midpointState = computeKeplerianOrbitMidpointState(
+                cartesianPositionAtDeparture, velocityAfterDeparture, timeOfFlight, centralBodyGravitationalParameter );
+    legPartSettings.centralBodyGravitationalParameter = centralBodyGravitationalParameter;
+    legPartSettings.isLambertTargeterLegPart = false;
+    return legPartSettings;
+}
+
+#if USE_CSPICE
+//! Function to check whether Spice may be called during the propagation of the bodies in a body map, i.e. whether any
+//! Spice kernels are loaded, or the ephemeris or rotation model of any of the bodies is retrieved from Spice.
+static bool isSpiceUsed( const simulation_setup::NamedBodyMap& bodyMap )
+{
+    if( spice_interface::getTotalCountOfKernelsLoaded( ) > 0 )
+    {
+        return true;
+    }
+
+    for( simulation_setup::NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( );
+         bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        if( std::dynamic_pointer_cast< ephemerides::SpiceEphemeris >(
+                    bodyIterator->second->getEphemeris( ) ) != nullptr ||
+                std::dynamic_pointer_cast< ephemerides::SpiceRotationalEphemeris >(
+                    bodyIterator->second->getRotationalEphemeris( ) ) != nullptr )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+//! Function to calculate the patched conics trajectory and to propagate the corresponding full problem, with all legs and
+//! propagation directions propagated concurrently.
+void fullPropagationPatchedConicsTrajectory(
+        const std::function< simulation_setup::NamedBodyMap( ) >& bodyMapCreationFunction,
+        const std::function< std::vector< basic_astrodynamics::AccelerationMap >(
+            const simulation_setup::NamedBodyMap& ) >& accelerationMapCreationFunction,
+        const std::vector< std::string >& transferBodyOrder,
+        const std::string& centralBody,
+        const std::string& bodyToPropagate,
+        const std::vector< transfer_trajectories::TransferLegType>& legTypeVector,
+        const std::vector< double >& trajectoryVariableVector,
+        const std::vector< double >& minimumPericenterRadiiVector,
+        const std::vector< double >& semiMajorAxesVector,
+        const std::vector< double >& eccentricitiesVector,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
+        std::map< int, std::map< double, Eigen::Vector6d > >& patchedConicsResultForEachLeg,
+        std::map< int, std::map< double, Eigen::Vector6d > >& fullProblemResultForEachLeg,
+        std::map< int, std::map< double, Eigen::VectorXd > >& dependentVariableResultForEachLeg,
+        const int numberOfThreads,
+        const bool terminationSphereOfInfluence,
+        const std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave,
+        const TranslationalPropagatorType propagator )
+{
+    // Create environment used for the patched conics trajectory (and by the first propagation thread).
+    simulation_setup::NamedBodyMap bodyMap = bodyMapCreationFunction( );
+
+    int numberOfLegs = legTypeVector.size( );
+
+    // Define the patched conic trajectory from the body map, and calculate the trajectory.
+    transfer_trajectories::Trajectory trajectory = propagators::createTransferTrajectoryObject(
+                bodyMap, transferBodyOrder, centralBody, legTypeVector, trajectoryVariableVector, minimumPericenterRadiiVector, true,
+                semiMajorAxesVector[ 0 ], eccentricitiesVector[ 0 ], true, semiMajorAxesVector[ 1 ], eccentricitiesVector[ 1 ] );
+
+    std::vector< Eigen::Vector3d > positionVector;
+    std::vector< double > timeVector;
+    std::vector< double > deltaVVector;
+    double totalDeltaV;
+    trajectory.calculateTrajectory( totalDeltaV );
+    trajectory.maneuvers( positionVector, timeVector, deltaVVector );
+
+    double centralBodyGravitationalParameter =
+            bodyMap.at( centralBody )->getGravityFieldModel( )->getGravitationalParameter( );
+
+    // Compute the patched conics state at half of the time of flight of each leg part (sequentially, since the velocity
+    // before arrival of a leg including a DSM is required for the next leg).
+    std::vector< PatchedConicLegPartPropagationSettings > legPartSettings;
+
+    int counterLegs = 0;
+    int counterLegWithDSM = 0;
+
+    Eigen::Vector3d velocityAfterDeparture;
+    Eigen::Vector3d velocityBeforeArrival;
+    for( int i = 0 ; i < numberOfLegs - 1 ; i ++ )
+    {
+        // If the leg does not include any DSM.
+        if( legTypeVector[ i ] == transfer_trajectories::mga_Departure || legTypeVector[ i ] == transfer_trajectories::mga_Swingby )
+        {
+            legPartSettings.push_back(
+                        createLambertTargeterLegPartSettings(
+                            counterLegs, positionVector[ counterLegs ], positionVector[ counterLegs + 1 ], timeVector[ counterLegs ],
+                        timeVector[ counterLegs + 1 ] - timeVector[ counterLegs ], centralBodyGravitationalParameter ) );
+            counterLegs++;
+        }
+        else
+        {
+            std::vector< std::string > departureAndArrivalBodies;
+            departureAndArrivalBodies.push_back( transferBodyOrder[ i ] );
+            departureAndArrivalBodies.push_back( transferBodyOrder[ i + 1 ] );
+
+            std::vector< double > trajectoryVariableVectorLeg;
+            trajectoryVariableVectorLeg.push_back( trajectoryVariableVector[ numberOfLegs + 1 + (counterLegWithDSM * 4) ] );
+            trajectoryVariableVectorLeg.push_back( trajectoryVariableVector[ numberOfLegs + 2 + (counterLegWithDSM * 4) ] );
+            trajectoryVariableVectorLeg.push_back( trajectoryVariableVector[ numberOfLegs + 3 + (counterLegWithDSM * 4) ] );
+            trajectoryVariableVectorLeg.push_back( trajectoryVariableVector[ numberOfLegs + 4 + (counterLegWithDSM * 4) ] );
+
+            // If one DSM is included in the leg (velocity formulation), the first part of the leg follows a Keplerian orbit.
+            if( legTypeVector[ i ] == transfer_trajectories::mga1DsmVelocity_Departure ||
+                    legTypeVector[ i ] == transfer_trajectories::mga1DsmVelocity_Swingby )
+            {
+                computeMga1DsmVelocityLegVelocities(
+                            bodyMap, departureAndArrivalBodies, centralBody, positionVector[ counterLegs ],
+                        positionVector[ counterLegs + 2 ], timeVector[ counterLegs ], timeVector[ counterLegs + 2 ], legTypeVector[ i ],
+                        trajectoryVariableVectorLeg, semiMajorAxesVector[ 0 ], eccentricitiesVector[ 0 ],
+                        velocityAfterDeparture, velocityBeforeArrival );
+
+                legPartSettings.push_back(
+                            createKeplerianOrbitLegPartSettings(
+                                counterLegs, positionVector[ counterLegs ], velocityAfterDeparture, timeVector[ counterLegs ],
+                            timeVector[ counterLegs + 1 ] - timeVector[ counterLegs ], centralBodyGravitationalParameter ) );
+            }
+            // If one DSM is included in the leg (position formulation), both parts of the leg are Lambert arcs.
+            else
+            {
+                computeMga1DsmPositionLegVelocities(
+                            bodyMap, departureAndArrivalBodies, centralBody, positionVector[ counterLegs ],
+                        positionVector[ counterLegs + 2 ], timeVector[ counterLegs ], timeVector[ counterLegs + 2 ], legTypeVector[ i ],
+                        trajectoryVariableVectorLeg, minimumPericenterRadiiVector[ i ], semiMajorAxesVector[ 0 ],
+                        eccentricitiesVector[ 0 ], velocityAfterDeparture, velocityBeforeArrival );
+
+                legPartSettings.push_back(
+                            createLambertTargeterLegPartSettings(
+                                counterLegs, positionVector[ counterLegs ], positionVector[ counterLegs + 1 ], timeVector[ counterLegs ],
+                            timeVector[ counterLegs + 1 ] - timeVector[ counterLegs ], centralBodyGravitationalParameter ) );
+            }
+            counterLegs++;
+
+            // Second part of the leg: Lambert targeter from DSM location to arrival body.
+            legPartSettings.push_back(
+                        createLambertTargeterLegPartSettings(
+                            counterLegs, positionVector[ counterLegs ], positionVector[ counterLegs + 1 ], timeVector[ counterLegs ],
+                        timeVector[ counterLegs + 1 ] - timeVector[ counterLegs ], centralBodyGravitationalParameter ) );
+            counterLegs++;
+            counterLegWithDSM++;
+        }
+    }
+
+    // Define one propagation per leg part and direction, starting with the leg parts with the longest time of flight.
+    std::vector< int > propagationOrder;
+    for( unsigned int i = 0; i < 2 * legPartSettings.size( ); i++ )
+    {
+        propagationOrder.push_back( i );
+    }
+    std::stable_sort( propagationOrder.begin( ), propagationOrder.end( ), [ & ]( const int first, const int second )
+    {
+        return legPartSettings.at( first / 2 ).timeOfFlight > legPartSettings.at( second / 2 ).timeOfFlight;
+    } );
+    int numberOfPropagations = propagationOrder.size( );
+
+    // Spice is not thread-safe, so all propagations are done on a single thread if it may be used by the environment.
+    int numberOfWorkers = std::max( 1, std::min( numberOfThreads, numberOfPropagations ) );
+#if USE_CSPICE
+    if( isSpiceUsed( bodyMap ) )
+    {
+        numberOfWorkers = 1;
+    }
+#endif
+
+    // Propagate the full problem, with a separate environment (and propagator settings) for each thread, since the bodies
+    // and acceleration models are updated during the propagation.
+    std::vector< std::map< double, Eigen::Vector6d > > patchedConicsResults( numberOfPropagations );
+    std::vector< std::map< double, Eigen::Vector6d > > fullProblemResults( numberOfPropagations );
+    std::vector< std::map< double, Eigen::VectorXd > > dependentVariableResults( numberOfPropagations );
+
+    std::atomic< int > nextPropagation( 0 );
+    std::mutex environmentCreationMutex;
+    utilities::executeParallelLoop( numberOfWorkers, [ & ]( const int workerIndex )
+    {
+        simulation_setup::NamedBodyMap workerBodyMap;
+        std::vector< std::pair< std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > >,
+                std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > > > propagatorSettings;
+
+        int propagationIndex;
+        while( ( propagationIndex = nextPropagation++ ) < numberOfPropagations )
+        {
+            // Create environment of current thread, when it starts its first propagation.
+            if( propagatorSettings.size( ) == 0 )
+            {
+                std::vector< basic_astrodynamics::AccelerationMap > accelerationMap;
+                {
+                    std::lock_guard< std::mutex > environmentCreationLock( environmentCreationMutex );
+                    workerBodyMap = ( workerIndex == 0 ) ? bodyMap : bodyMapCreationFunction( );
+                    accelerationMap = accelerationMapCreationFunction( workerBodyMap );
+                }
+                propagatorSettings = getPatchedConicPropagatorSettings(
+                            workerBodyMap, accelerationMap, transferBodyOrder, centralBody, bodyToPropagate, legTypeVector,
+                            trajectoryVariableVector, minimumPericenterRadiiVector, semiMajorAxesVector,
+                            eccentricitiesVector, dependentVariablesToSave, propagator, terminationSphereOfInfluence );
+            }
+
+            const PatchedConicLegPartPropagationSettings& currentLegPartSettings =
+                    legPartSettings.at( propagationOrder.at( propagationIndex ) / 2 );
+            const bool isBackwardPropagation = ( propagationOrder.at( propagationIndex ) % 2 == 1 );
+            const double gravitationalParameter = currentLegPartSettings.centralBodyGravitationalParameter;
+
+            // Define integrator and propagator settings, starting at half of the time of flight.
+            std::shared_ptr< numerical_integrators::IntegratorSettings< double > > currentIntegratorSettings =
+                    integratorSettings->clone( );
+            currentIntegratorSettings->initialTime_ = currentLegPartSettings.midpointTime;
+            if( isBackwardPropagation )
+            {
+                currentIntegratorSettings->initialTimeStep_ = -currentIntegratorSettings->initialTimeStep_;
+            }
+
+            std::shared_ptr< propagators::TranslationalStatePropagatorSettings< double > > currentPropagatorSettings =
+                    isBackwardPropagation ? propagatorSettings.at( currentLegPartSettings.legPartIndex ).first :
+                                            propagatorSettings.at( currentLegPartSettings.legPartIndex ).second;
+            currentPropagatorSettings->resetInitialStates( currentLegPartSettings.midpointState );
+
+            // Perform the propagation.
+            propagators::SingleArcDynamicsSimulator< > dynamicsSimulator(
+                        workerBodyMap, currentIntegratorSettings, currentPropagatorSettings );
+            std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+            std::map< double, Eigen::VectorXd > dependentVariableHistory = dynamicsSimulator.getDependentVariableHistory( );
+
+            // Compute the patched conics solution at the epochs of the full problem solution.
+            Eigen::Vector6d keplerianMidpointState;
+            if( !currentLegPartSettings.isLambertTargeterLegPart )
+            {
+                keplerianMidpointState = orbital_element_conversions::convertCartesianToKeplerianElements(
+                            Eigen::Vector6d( currentLegPartSettings.midpointState ), gravitationalParameter );
+            }
+
+            std::map< double, Eigen::Vector6d >& patchedConicsResult = patchedConicsResults.at( propagationIndex );
+            std::map< double, Eigen::Vector6d >& fullProblemResult = fullProblemResults.at( propagationIndex );
+            std::map< double, Eigen::VectorXd >& dependentVariableResult = dependentVariableResults.at( propagationIndex );
+            for( std::map< double, Eigen::VectorXd >::iterator itr = stateHistory.begin( ); itr != stateHistory.end( ); itr++ )
+            {
+                const double timeSinceMidpoint = itr->first - currentLegPartSettings.midpointTime;
+                if( currentLegPartSettings.isLambertTargeterLegPart )
+                {
+                    patchedConicsResult[ itr->first ] = computeCartesianStateFromKeplerianOrbit(
+                                currentLegPartSettings.midpointState, timeSinceMidpoint, gravitationalParameter );
+                }
+                else
+                {
+                    patchedConicsResult[ itr->first ] = orbital_element_conversions::convertKeplerianToCartesianElements(
+                                orbital_element_conversions::propagateKeplerOrbit(
+                                    keplerianMidpointState, timeSinceMidpoint, gravitationalParameter ), gravitationalParameter );
+                }
+                fullProblemResult[ itr->first ] = itr->second;
+
+                std::map< double, Eigen::VectorXd >::const_iterator dependentVariableIterator =
+                        dependentVariableHistory.find( itr->first );
+                dependentVariableResult[ itr->first ] = ( dependentVariableIterator != dependentVariableHistory.end( ) ) ?
+                            dependentVariableIterator->second : Eigen::VectorXd( );
+            }
+        }
+    }, numberOfWorkers );
+
+    // Collect results for each leg part, with the backward propagation results overriding the forward propagation results
+    // at the common (initial) epoch.
+    patchedConicsResultForEachLeg.clear( );
+    fullProblemResultForEachLeg.clear( );
+    dependentVariableResultForEachLeg.clear( );
+    for( unsigned int direction = 0; direction < 2; direction++ )
+    {
+        for( int i = 0; i < numberOfPropagations; i++ )
+        {
+            if( propagationOrder.at( i ) % 2 == static_cast< int >( direction ) )
+            {
+                int legPartIndex = legPartSettings.at( propagationOrder.at( i ) / 2 ).legPartIndex;
+                for( std::map< double, Eigen::Vector6d >::const_iterator itr = patchedConicsResults.at( i ).begin( );
+                     itr != patchedConicsResults.at( i ).end( ); itr++ )
+                {
+                    patchedConicsResultForEachLeg[ legPartIndex ][ itr->first ] = itr->second;
+                    fullProblemResultForEachLeg[ legPartIndex ][ itr->first ] = fullProblemResults.at( i ).at( itr->first );
+                    dependentVariableResultForEachLeg[ legPartIndex ][ itr->first ] =
+                            dependentVariableResults.at( i ).at( itr->first );
+                }
+            }
+        }
+    }
+}
+
 //! Function to compute the difference in cartesian state between patched conics trajectory and full dynamics problem,
 //! at both departure and arrival positions for each leg.
 std::map< int, std::pair< Eigen::Vector6d, Eigen::Vector6d > > getDifferenceFullProblemWrtPatchedConicsTrajectory(
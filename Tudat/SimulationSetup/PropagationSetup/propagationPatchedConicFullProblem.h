@@ -11,6 +11,9 @@
 #ifndef TUDAT_PROPAGATION_PATCHED_CONIC_FULL
 #define TUDAT_PROPAGATION_PATCHED_CONIC_FULL
 
+#include <functional>
+
+#include "Tudat/Basics/parallelLoop.h"
 #include "Tudat/SimulationSetup/tudatSimulationHeader.h"
 #include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
 
@@ -469,6 +472,61 @@ void fullPropagationPatchedConicsTrajectory(
         const TranslationalPropagatorType propagator = cowell );
 
 
+//! Function to calculate the patched conics trajectory and to propagate the corresponding full problem, with all legs and
+//! propagation directions propagated concurrently.
+/*!
+ * Function to calculate the patched conics trajectory and to propagate the corresponding full problem, with the forward and
+ * backward propagations (from half of the time of flight) of all legs distributed over a number of threads. Since the
+ * bodies and acceleration models are updated during a propagation, each thread propagates in its own environment, created
+ * from the functions provided as input. The ephemerides of the bodies may be shared between these environments, provided
+ * that they can be queried concurrently (e.g. ApproximatePlanetPositions). The results are identical to those of the
+ * overload taking a body map and acceleration maps. Since Spice is not thread-safe, all propagations are done on a single
+ * thread if any Spice kernels are loaded, or if the ephemeris or rotation model of any body is retrieved from Spice.
+ * \param bodyMapCreationFunction Function creating the body map for the patched conics trajectory.
+ * \param accelerationMapCreationFunction Function creating the acceleration maps to propagate the full problem (one per
+ * leg) for a given body map.
+ * \param transferBodyOrder Vector containing the names of the transfer bodies involved in the trajectory.
+ * \param centralBody Name of the central body of the patched conics trajectory.
+ * \param bodyToPropagate Name of the body to be propagated.
+ * \param legTypeVector Vector containing the leg types.
+ * \param trajectoryVariableVector Vector containing all the defining variables for the whole trajectory.
+ * \param minimumPericenterRadiiVector Vector containing the minimum distance between the spacecraft and the body.
+ * \param semiMajorAxesVector Vector containing the semi-major axes of the departure and arrival legs.
+ * \param eccentricitiesVector Vector containing the eccentricities of the departure and arrival legs.
+ * \param integratorSettings Integrator settings for the propagation of the full problem (copied for each propagation, and
+ * not modified by this function).
+ * \param patchedConicsResultForEachLeg Patched conics solution along each leg.
+ * \param fullProblemResultForEachLeg Full problem propagation results along each leg.
+ * \param dependentVariableResultForEachLeg Dependent variables along each leg.
+ * \param numberOfThreads Maximum number of threads used for the propagations.
+ * \param terminationSphereOfInfluence Boolean denoting whether the propagation stops at the exact position (false) or at the sphere of
+ * influence (true) of the departure and arrival body of each leg of the trajectory. The default value is false.
+ * \param dependentVariablesToSave Vector containing the dependent variables to be saved during the full problem propagation for each leg.
+ * \param propagator Type of propagator to be used for the full problem propagation.
+ */
+void fullPropagationPatchedConicsTrajectory(
+        const std::function< simulation_setup::NamedBodyMap( ) >& bodyMapCreationFunction,
+        const std::function< std::vector< basic_astrodynamics::AccelerationMap >(
+            const simulation_setup::NamedBodyMap& ) >& accelerationMapCreationFunction,
+        const std::vector< std::string >& transferBodyOrder,
+        const std::string& centralBody,
+        const std::string& bodyToPropagate,
+        const std::vector< transfer_trajectories::TransferLegType>& legTypeVector,
+        const std::vector< double >& trajectoryVariableVector,
+        const std::vector< double >& minimumPericenterRadiiVector,
+        const std::vector< double >& semiMajorAxesVector,
+        const std::vector< double >& eccentricitiesVector,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > >& integratorSettings,
+        std::map< int, std::map< double, Eigen::Vector6d > >& patchedConicsResultForEachLeg,
+        std::map< int, std::map< double, Eigen::Vector6d > >& fullProblemResultForEachLeg,
+        std::map< int, std::map< double, Eigen::VectorXd > >& dependentVariableResultForEachLeg,
+        const int numberOfThreads = utilities::getDefaultNumberOfThreads( ),
+        const bool terminationSphereOfInfluence = false,
+        const std::vector< std::shared_ptr< DependentVariableSaveSettings > > dependentVariablesToSave =
+        std::vector < std::shared_ptr< DependentVariableSaveSettings > >( ),
+        const TranslationalPropagatorType propagator = cowell );
+
+
 //! Function to compute the difference in cartesian state between patched conics trajectory and full dynamics problem,
 //! at both departure and arrival positions for each leg.
 /*!
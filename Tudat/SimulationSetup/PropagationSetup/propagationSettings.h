@@ -166,7 +166,8 @@ public:
                                  const double printInterval = TUDAT_NAN ):
         PropagatorSettings< StateScalarType >( initialBodyStates, false ),
         stateType_( stateType ), terminationSettings_( terminationSettings ),
-        dependentVariablesToSave_( dependentVariablesToSave ), printInterval_( printInterval)
+        dependentVariablesToSave_( dependentVariablesToSave ), printInterval_( printInterval),
+        profilePerformance_( false ), printPerformanceProfile_( false )
     { }
 
     //! Virtual destructor.
@@ -240,6 +241,41 @@ public:
         terminationSettings_ = terminationSettings;
     }
 
+    //! Function to set whether the computation time of the individual components of the propagation is to be profiled
+    /*!
+     * Function to set whether the computation time (and number of allocations) of the individual components of the
+     * propagation (acceleration models, environment updates, dependent variables and integrator overhead) is to be
+     * profiled. The results are available from the dynamics simulator after propagation.
+     * \param profilePerformance Boolean denoting whether the propagation is to be profiled.
+     * \param printPerformanceProfile Boolean denoting whether a summary of the profile is to be printed to console at the
+     * end of each propagation.
+     */
+    void setPerformanceProfiling( const bool profilePerformance, const bool printPerformanceProfile = true )
+    {
+        profilePerformance_ = profilePerformance;
+        printPerformanceProfile_ = profilePerformance && printPerformanceProfile;
+    }
+
+    //! Function to retrieve whether the computation time of the individual components of the propagation is to be profiled
+    /*!
+     * Function to retrieve whether the computation time of the individual components of the propagation is to be profiled
+     * \return Boolean denoting whether the propagation is to be profiled.
+     */
+    bool getProfilePerformance( )
+    {
+        return profilePerformance_;
+    }
+
+    //! Function to retrieve whether a summary of the performance profile is to be printed at the end of the propagation
+    /*!
+     * Function to retrieve whether a summary of the performance profile is to be printed at the end of the propagation
+     * \return Boolean denoting whether a summary of the performance profile is to be printed.
+     */
+    bool getPrintPerformanceProfile( )
+    {
+        return printPerformanceProfile_;
+    }
+
 protected:
 
     //!Type of state being propagated
@@ -255,6 +291,12 @@ protected:
     //! current state and time are to be printed to console (default never).
     double printInterval_;
 
+    //! Boolean denoting whether the computation time of the individual components of the propagation is to be profiled.
+    bool profilePerformance_;
+
+    //! Boolean denoting whether a summary of the performance profile is to be printed at the end of the propagation.
+    bool printPerformanceProfile_;
+
 };
 
 //! Function to get the total size of multi-arc initial state vector
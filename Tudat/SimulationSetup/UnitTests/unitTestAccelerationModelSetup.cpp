@@ -664,6 +664,94 @@ BOOST_AUTO_TEST_CASE( test_aerodynamicAccelerationModelSetupWithCoefficientIndep
 
         TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
                     automaticCoefficients, manualCoefficients, ( 5.0 *  std::numeric_limits< double >::epsilon( ) ) );
+
+        // Update flight conditions with coefficients evaluated on demand, and compare.
+        coefficientInterface->updateFullCurrentCoefficients( { 0.0, 0.0, 0.0 } );
+        std::shared_ptr< aerodynamics::AtmosphericFlightConditions > vehicleAtmosphericFlightConditions =
+                std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >( vehicleFlightConditions );
+        vehicleAtmosphericFlightConditions->setEvaluateAerodynamicCoefficientsOnDemand( true );
+        vehicleAtmosphericFlightConditions->resetCurrentTime( TUDAT_NAN );
+        vehicleAtmosphericFlightConditions->updateConditions( testTime );
+        Eigen::Vector3d onDemandCoefficients = vehicleAtmosphericFlightConditions->getCurrentForceCoefficients( );
+        vehicleAtmosphericFlightConditions->setEvaluateAerodynamicCoefficientsOnDemand( false );
+
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    onDemandCoefficients, manualCoefficients, ( 5.0 *  std::numeric_limits< double >::epsilon( ) ) );
+    }
+}
+
+//! Test propagation of a trimmed vehicle, for which the aerodynamic coefficients are evaluated on demand, and for which
+//! the coefficient input is required when updating the angle of attack.
+BOOST_AUTO_TEST_CASE( test_trimmedAerodynamicAccelerationPropagation )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::propagators;
+    using namespace tudat::numerical_integrators;
+    using namespace tudat;
+
+    // Load Spice kernels
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create Earth and vehicle
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = getDefaultSingleBodySettings( "Earth", -100.0, 200.0 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setAerodynamicCoefficientInterface( getApolloCoefficientInterface( ) );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( 5.0E3 );
+    setGlobalFrameBodyEphemerides( bodyMap, "Earth", "ECLIPJ2000" );
+
+    // Define accelerations and create trimmed vehicle
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( aerodynamic ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationsMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, bodiesToPropagate, centralBodies );
+    setTrimmedConditions( bodyMap.at( "Vehicle" ) );
+
+    // Define initial state at 120 km altitude
+    Eigen::Vector6d initialState = Eigen::Vector6d::Zero( );
+    initialState( 0 ) = spice_interface::getAverageRadius( "Earth" ) + 120.0E3;
+    initialState( 4 ) = 7.4E3;
+    initialState( 5 ) = -0.2E3;
+
+    // Save angle of attack and moment coefficients
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back(
+                std::make_shared< BodyAerodynamicAngleVariableSaveSettings >( "Vehicle", angle_of_attack ) );
+    dependentVariables.push_back(
+                std::make_shared< SingleDependentVariableSaveSettings >(
+                    aerodynamic_moment_coefficients_dependent_variable, "Vehicle" ) );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationsMap, bodiesToPropagate, initialState,
+                std::make_shared< PropagationTimeTerminationSettings >( 100.0 ), cowell,
+                std::make_shared< DependentVariableSaveSettings >( dependentVariables ) );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 5.0 );
+
+    // Propagate dynamics
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, true, false, false );
+    std::map< double, Eigen::VectorXd > dependentVariableSolution = dynamicsSimulator.getDependentVariableHistory( );
+
+    // Check that coefficients are evaluated on demand
+    std::shared_ptr< aerodynamics::AtmosphericFlightConditions > vehicleFlightConditions =
+            std::dynamic_pointer_cast< aerodynamics::AtmosphericFlightConditions >(
+                bodyMap.at( "Vehicle" )->getFlightConditions( ) );
+    BOOST_CHECK_EQUAL( vehicleFlightConditions->getEvaluateAerodynamicCoefficientsOnDemand( ), true );
+
+    // Check that vehicle is trimmed at each epoch (pitch moment coefficient is zero), and angle of attack is non-zero.
+    for( std::map< double, Eigen::VectorXd >::const_iterator variableIterator = dependentVariableSolution.begin( );
+         variableIterator != dependentVariableSolution.end( ); variableIterator++ )
+    {
+        BOOST_CHECK_GT( std::fabs( variableIterator->second( 0 ) ), 0.0 );
+        BOOST_CHECK_SMALL( variableIterator->second( 2 ), 1.0E-10 );
     }
 }
 
@@ -14,6 +14,7 @@
 
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/filesystem.hpp>
 
 #include <Eigen/Core>
 
@@ -32,6 +33,7 @@
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
 //#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationAnglesTable.h"
 #include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/Astrodynamics/Gravitation/basicSolidBodyTideGravityFieldVariations.h"
@@ -880,6 +882,49 @@ BOOST_AUTO_TEST_CASE( test_earthRotationModelSetup )
         }
     }
 }
+
+//! Test set up of GCRS<->ITRS rotation model using a precomputed table of Earth orientation angles
+BOOST_AUTO_TEST_CASE( test_earthRotationModelTableSetup )
+{
+    // Create table from default Earth orientation settings, and write it to file.
+    double testTime = 5.0E7;
+    std::string tableFile = ( boost::filesystem::temp_directory_path( ) /
+                              boost::filesystem::unique_path( "earthOrientationAnglesTable-%%%%-%%%%.dat" ) ).string( );
+    earth_orientation::createEarthOrientationAnglesTable(
+                testTime - 86400.0, testTime + 86400.0, 600.0 )->writeToFile( tableFile );
+
+    // Create rotation models with and without table
+    std::shared_ptr< tudat::ephemerides::RotationalEphemeris > earthRotationModel =
+            createRotationModel( std::make_shared< GcrsToItrsRotationModelSettings >( ), "Earth" );
+
+    std::shared_ptr< GcrsToItrsRotationModelSettings > tabulatedRotationSettings =
+            std::make_shared< GcrsToItrsRotationModelSettings >( );
+    tabulatedRotationSettings->setEarthOrientationAnglesTableFile( tableFile );
+    std::shared_ptr< tudat::ephemerides::RotationalEphemeris > tabulatedEarthRotationModel =
+            createRotationModel( tabulatedRotationSettings, "Earth" );
+    BOOST_CHECK( std::dynamic_pointer_cast< ephemerides::GcrsToItrsRotationModel >(
+                     tabulatedEarthRotationModel )->getAnglesTable( ) != nullptr );
+
+    for( double currentTime = testTime - 80000.0; currentTime < testTime + 80000.0; currentTime += 7654.3 )
+    {
+        Eigen::Matrix3d rotationDeviation =
+                tabulatedEarthRotationModel->getRotationToTargetFrame( currentTime ).toRotationMatrix( ) -
+                earthRotationModel->getRotationToTargetFrame( currentTime ).toRotationMatrix( );
+        Eigen::Matrix3d rotationDerivativeDeviation =
+                tabulatedEarthRotationModel->getDerivativeOfRotationToTargetFrame( currentTime ) -
+                earthRotationModel->getDerivativeOfRotationToTargetFrame( currentTime );
+        BOOST_CHECK_SMALL( rotationDeviation.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+        BOOST_CHECK_SMALL( rotationDerivativeDeviation.cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    }
+
+    // Check that table is rejected for settings with which it was not generated
+    std::shared_ptr< GcrsToItrsRotationModelSettings > inconsistentRotationSettings =
+            std::make_shared< GcrsToItrsRotationModelSettings >( basic_astrodynamics::iau_2000_b );
+    inconsistentRotationSettings->setEarthOrientationAnglesTableFile( tableFile );
+    BOOST_CHECK_THROW( createRotationModel( inconsistentRotationSettings, "Earth" ), std::runtime_error );
+
+    boost::filesystem::remove( tableFile );
+}
 #endif
 
 #if USE_CSPICE
@@ -934,6 +979,38 @@ BOOST_AUTO_TEST_CASE( test_radiationPressureInterfaceSetup )
                                 vehicleRadiationPressureInterface->getCurrentRadiationPressure( ),
                                 std::numeric_limits< double >::epsilon( ) );
 
+    // Check that a table of precomputed occultation intervals is passed to the interface, if consistent with the
+    // occulting bodies.
+    const std::function< Eigen::Vector3d( const double ) > zeroPositionFunction =
+            [ ]( const double ){ return Eigen::Vector3d::Zero( ); };
+    const std::function< Eigen::Vector3d( const double ) > vehiclePositionFunction =
+            [ ]( const double ){ return Eigen::Vector3d::UnitX( ) * 7.0E6; };
+    std::shared_ptr< RadiationPressureInterfaceSettings > occultedRadiationPressureSettings =
+            std::make_shared< CannonBallRadiationPressureInterfaceSettings >(
+                "Sun", area, coefficient, std::vector< std::string >( { "Earth" } ) );
+    for( unsigned int numberOfOccultingBodies = 1; numberOfOccultingBodies <= 2; numberOfOccultingBodies++ )
+    {
+        std::shared_ptr< electro_magnetism::OccultationEventTable > occultationEventTable =
+                std::make_shared< electro_magnetism::OccultationEventTable >(
+                    [ ]( const double ){ return Eigen::Vector3d::UnitX( ) * 1.5E11; }, 7.0E8,
+                    std::vector< std::function< Eigen::Vector3d( const double ) > >(
+                        numberOfOccultingBodies, zeroPositionFunction ),
+                    std::vector< double >( numberOfOccultingBodies, 6.4E6 ),
+                    vehiclePositionFunction, 0.0, 100.0, 10.0 );
+        occultedRadiationPressureSettings->setOccultationEventTable( occultationEventTable );
+        if( numberOfOccultingBodies == 1 )
+        {
+            BOOST_CHECK_EQUAL( createRadiationPressureInterface(
+                                   occultedRadiationPressureSettings, "Vehicle", bodyMap )->getOccultationEventTable( ),
+                               occultationEventTable );
+        }
+        else
+        {
+            BOOST_CHECK_THROW(
+                        createRadiationPressureInterface( occultedRadiationPressureSettings, "Vehicle", bodyMap ),
+                        std::runtime_error );
+        }
+    }
 }
 #endif
 